@@ -29,6 +29,28 @@ extern const uint32_t cute_bird_lottie_data_size;
 
 static const char *TAG = "main";
 
+#if CONFIG_LV_USE_MEM_TRACE
+// Stop tracing the allocations after this many seconds if the ring buffer isn't full yet
+static const uint32_t MEM_TRACE_SECONDS = 30;
+
+// Print the trace as hex lines. Replay the saved log on the host with
+// managed_components/lvgl__lvgl/scripts/mem_replay
+static void mem_trace_print_cb(const void *data, uint32_t size, void *user_data)
+{
+    const uint8_t *bytes = data;
+    while (size > 0) {
+        uint32_t line_size = size < 32 ? size : 32;
+        printf("lv_mem_trace: ");
+        for (uint32_t i = 0; i < line_size; i++) {
+            printf("%02x", bytes[i]);
+        }
+        printf("\n");
+        bytes += line_size;
+        size -= line_size;
+    }
+}
+#endif
+
 // Lottie buffer dimensions - change here to adjust size
 static const size_t LOTTIE_BUFFER_DIM = 300;
 
@@ -148,9 +170,32 @@ void app_main(void)
     
     ESP_LOGI(TAG, "Lottie animation created successfully");
     
+#if CONFIG_LV_USE_MEM_TRACE
+    lv_mem_trace_start();
+    uint32_t mem_trace_seconds = 0;
+    ESP_LOGI(TAG, "Tracing the allocations");
+#endif
+
     // Keep the app running and display memory info
     while (1) {
         vTaskDelay(pdMS_TO_TICKS(1000));
         printf("Free heap: %" PRIu32 " bytes\n", esp_get_free_heap_size());
+
+#if CONFIG_LV_USE_MEM_TRACE
+        if (mem_trace_seconds < MEM_TRACE_SECONDS) {
+            mem_trace_seconds++;
+            if (mem_trace_seconds == MEM_TRACE_SECONDS ||
+                lv_mem_trace_get_entry_cnt() == CONFIG_LV_MEM_TRACE_BUF_SIZE) {
+                mem_trace_seconds = MEM_TRACE_SECONDS;
+                lv_mem_trace_stop();
+                lv_mem_trace_dump(mem_trace_print_cb, NULL);
+
+                lv_mem_monitor_t mon;
+                lv_mem_monitor(&mon);
+                ESP_LOGI(TAG, "Allocation trace done, LVGL heap: %zu bytes used, %d%% fragmentation",
+                         mon.total_size - mon.free_size, mon.frag_pct);
+            }
+        }
+#endif
     }
 }
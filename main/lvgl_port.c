@@ -9,6 +9,7 @@
 #include "freertos/task.h"
 #include "freertos/semphr.h"
 #include "esp_timer.h"
+#include "esp_attr.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_mipi_dsi.h"
 #include "esp_lcd_st7703.h"
@@ -31,6 +32,8 @@ static esp_lcd_touch_handle_t touch_handle = NULL;
 static esp_lcd_dsi_bus_handle_t mipi_dsi_bus = NULL;
 
 static SemaphoreHandle_t lvgl_mux = NULL;
+static SemaphoreHandle_t lvgl_vsync_sem = NULL;
+static TaskHandle_t lvgl_task_handle = NULL;
 
 // LVGL Tick Timer Callback
 static void lvgl_tick_timer_cb(void *arg)
@@ -50,13 +53,28 @@ void lvgl_port_unlock(void)
     xSemaphoreGiveRecursive(lvgl_mux);
 }
 
-// LVGL Flush Callback - FULL mode: entire screen is redrawn each frame
+// DPI Refresh Done Callback - called from ISR when a frame was sent to the panel
+IRAM_ATTR static bool lvgl_dpi_refresh_done_cb(esp_lcd_panel_handle_t panel, esp_lcd_dpi_panel_event_data_t *edata, void *user_ctx)
+{
+    BaseType_t need_yield = pdFALSE;
+    xSemaphoreGiveFromISR(lvgl_vsync_sem, &need_yield);
+    return need_yield == pdTRUE;
+}
+
+// LVGL Flush Callback - DIRECT mode: only the changed areas are rendered into the framebuffers
 static void lvgl_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
 {
     esp_lcd_panel_handle_t panel = lv_display_get_user_data(disp);
     
-    // FULL mode: draw the entire buffer to panel (area covers full screen)
-    esp_lcd_panel_draw_bitmap(panel, area->x1, area->y1, area->x2 + 1, area->y2 + 1, px_map);
+    // px_map is one of the DPI framebuffers, so after the last area only switch to it.
+    // LVGL copies the areas the other framebuffer has missed before rendering into it.
+    if (lv_display_flush_is_last(disp)) {
+        esp_lcd_panel_draw_bitmap(panel, 0, 0, LCD_H_RES, LCD_V_RES, px_map);
+        
+        // Wait until the panel scans out the new framebuffer to not render into the shown one
+        xSemaphoreTake(lvgl_vsync_sem, 0);
+        xSemaphoreTake(lvgl_vsync_sem, portMAX_DELAY);
+    }
     
     lv_display_flush_ready(disp);
 }
@@ -84,11 +102,24 @@ static void lvgl_touch_cb(lv_indev_t *indev, lv_indev_data_t *data)
     }
 }
 
+// Timer Resume Callback - a timer was created, resumed or made ready from another task
+static void lvgl_timer_resume_cb(void *data)
+{
+    if (lvgl_task_handle != NULL && xTaskGetCurrentTaskHandle() != lvgl_task_handle) {
+        xTaskNotifyGive(lvgl_task_handle);
+    }
+}
+
 // LVGL Task
 static void lvgl_port_task(void *arg)
 {
     ESP_LOGI(TAG, "Starting LVGL task");
     
+    if (lvgl_port_lock(0)) {
+        lv_timer_handler_set_resume_cb(lvgl_timer_resume_cb, NULL);
+        lvgl_port_unlock();
+    }
+    
     while (1) {
         uint32_t task_delay_ms = LVGL_TASK_MAX_DELAY_MS;
         
@@ -103,7 +134,14 @@ static void lvgl_port_task(void *arg)
             task_delay_ms = LVGL_TASK_MIN_DELAY_MS;
         }
         
-        vTaskDelay(pdMS_TO_TICKS(task_delay_ms));
+        // lv_timer_handler() returns the exact time until the next timer, so sleep until then
+        // unless another task wakes us up by creating or resuming a timer.
+        // Block at least one tick to let the lower priority tasks run.
+        TickType_t task_delay_ticks = pdMS_TO_TICKS(task_delay_ms);
+        if (task_delay_ticks == 0) {
+            task_delay_ticks = 1;
+        }
+        ulTaskNotifyTake(pdTRUE, task_delay_ticks);
     }
 }
 
@@ -147,6 +185,13 @@ esp_err_t lvgl_port_init(void)
         return ESP_FAIL;
     }
     
+    // Create the semaphore given when a framebuffer is shown
+    lvgl_vsync_sem = xSemaphoreCreateBinary();
+    if (lvgl_vsync_sem == NULL) {
+        ESP_LOGE(TAG, "Failed to create VSYNC semaphore");
+        return ESP_FAIL;
+    }
+    
     // Initialize LVGL
     lv_init();
     
@@ -202,6 +247,12 @@ esp_err_t lvgl_port_init(void)
     ESP_ERROR_CHECK(esp_lcd_panel_init(panel_handle));
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel_handle, true));
     
+    // Get notified when a framebuffer was sent to the panel
+    esp_lcd_dpi_panel_event_callbacks_t dpi_cbs = {
+        .on_refresh_done = lvgl_dpi_refresh_done_cb,
+    };
+    ESP_ERROR_CHECK(esp_lcd_dpi_panel_register_event_callbacks(panel_handle, &dpi_cbs, NULL));
+    
     // Initialize I2C for touch
     ESP_LOGI(TAG, "Initialize I2C for touch");
     i2c_master_bus_config_t i2c_bus_config = {
@@ -269,10 +320,10 @@ esp_err_t lvgl_port_init(void)
     ESP_LOGI(TAG, "Using DPI panel framebuffers: fb0=%p, fb1=%p, size=%zu bytes", 
              fb0, fb1, buffer_size);
     
-    // FULL mode: entire screen redrawn each frame - stable, no tearing
-    lv_display_set_buffers(lvgl_disp, fb0, fb1, buffer_size, LV_DISPLAY_RENDER_MODE_FULL);
+    // DIRECT mode: only the changed areas are redrawn, the framebuffers are synchronized by LVGL
+    lv_display_set_buffers(lvgl_disp, fb0, fb1, buffer_size, LV_DISPLAY_RENDER_MODE_DIRECT);
     
-    ESP_LOGI(TAG, "LVGL display initialized with FULL mode");
+    ESP_LOGI(TAG, "LVGL display initialized with DIRECT mode");
     
     // Create LVGL input device (touch)
     ESP_LOGI(TAG, "Create LVGL input device");
@@ -291,7 +342,7 @@ esp_err_t lvgl_port_init(void)
     ESP_ERROR_CHECK(esp_timer_start_periodic(lvgl_tick_timer, LVGL_TICK_PERIOD_MS * 1000));
     
     // Create LVGL task
-    xTaskCreate(lvgl_port_task, "LVGL", LVGL_TASK_STACK_SIZE, NULL, LVGL_TASK_PRIORITY, NULL);
+    xTaskCreate(lvgl_port_task, "LVGL", LVGL_TASK_STACK_SIZE, NULL, LVGL_TASK_PRIORITY, &lvgl_task_handle);
     
     ESP_LOGI(TAG, "LVGL initialization complete");
     return ESP_OK;
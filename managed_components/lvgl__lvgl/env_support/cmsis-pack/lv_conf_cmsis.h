@@ -82,6 +82,27 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Serve the small allocations of `lv_malloc()` (<= 256 bytes) from pages split to size classes.
+ *  Each thread keeps a few free blocks per size class to allocate and free them without locking.
+ *  Larger allocations go to the allocator selected by `LV_USE_STDLIB_MALLOC`.
+ *  Adds 8 bytes to each allocation. */
+#define LV_USE_MEM_SLAB 0
+#if LV_USE_MEM_SLAB
+    /** Size of the pages the blocks are allocated in, in bytes */
+    #define LV_MEM_SLAB_PAGE_SIZE (4 * 1024)
+
+    /** Number of free blocks per size class each thread can keep. 0: always lock the shared pages */
+    #define LV_MEM_SLAB_MAGAZINE_SIZE 16
+#endif
+
+/** 1: Record `lv_malloc()`, `lv_realloc()` and `lv_free()` calls in a ring buffer
+ *  with the size, a subsystem tag and a timestamp. See `lv_mem_trace_start()`. */
+#define LV_USE_MEM_TRACE 0
+#if LV_USE_MEM_TRACE
+    /** Number of calls kept in the ring buffer. Each takes 20 bytes. */
+    #define LV_MEM_TRACE_BUF_SIZE 4096
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -89,6 +110,23 @@
 /** Default display refresh, input device read and animation step period. */
 #define LV_DEF_REFR_PERIOD  33      /**< [ms] */
 
+/** 1: Keep the timers in a min-heap ordered by their next deadline.
+ *  Finding the ready timers and the time until the next one is O(log n) instead of scanning all timers,
+ *  and the animation timer sleeps until the next delayed or paused animation is due.
+ *  Uses about 24 bytes of extra memory per timer. */
+#define LV_USE_TIMER_HEAP   0
+
+/** 1: Merge the invalidated areas by comparing the cost of rendering them separately or joined.
+ *  Rendering an area has a fixed cost too (preparing the layers, flushing, etc.), which is given as
+ *  the number of pixels which could be rendered meanwhile. It can be changed by `lv_display_set_inv_area_cost()`.
+ *  The invalidated area buffer also grows up to `LV_INV_BUF_MAX_SIZE` areas instead of
+ *  refreshing the whole screen when it's full. */
+#define LV_USE_INV_AREA_COST_MODEL  0
+#if LV_USE_INV_AREA_COST_MODEL
+    #define LV_INV_AREA_COST_PX     2048    /**< [px] Default fixed cost of an area */
+    #define LV_INV_BUF_MAX_SIZE     256     /**< Max number of invalidated areas to store */
+#endif
+
 /** Default Dots Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #define LV_DPI_DEF 130              /**< [px/inch] */
@@ -467,10 +505,20 @@
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Size of the label coverage cache in bytes. Labels enabled with `lv_label_set_render_cache()`
+ *  keep the rendered coverage (A8) of their whole text in this cache, so that redrawing an
+ *  unchanged label is a single masked fill. 0: disable. */
+#define LV_DRAW_LABEL_CACHE_SIZE 0
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
 
+/** Size of the gradient table cache in bytes. The SW renderer and ThorVG keep the color tables
+ *  of the gradients here, keyed by the stops (and opacity and color format), so that
+ *  redrawing the same gradient doesn't build its table again. 0: disable. */
+#define LV_GRADIENT_CACHE_SIZE 0
+
 /** Adjust color mix functions rounding. GPUs might calculate color mix (blending) differently.
  *  - 0:   round down,
  *  - 64:  round up from x.75,
@@ -482,6 +530,20 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Cache the resolved values of the frequently used style properties (background, border,
+ *  padding, text, opacity and transformation) of each Widget per part and state.
+ *  The cache is allocated on the first lookup and needs 12..16 bytes per entry. */
+#define LV_OBJ_STYLE_RESOLVED_CACHE 0
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /** Number of cached properties per Widget */
+    #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE 16
+#endif
+
+/** Keep the Widgets of each screen in drawing order in a flat array with their clipped areas.
+ *  The refreshing and the hit testing walk the array and skip the Widgets out of the area without
+ *  touching them. Adds 4 bytes to each `lv_obj_t` and 44 bytes per Widget for the array. */
+#define LV_OBJ_DRAW_LIST 0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -662,6 +724,15 @@
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
+/** Number of entries in the per-font cache mapping Unicode letters to glyph IDs.
+ *  Speeds up fonts with large sparse character maps (e.g. CJK fonts).
+ *  Allocated on the first use of a font. Must be a power of 2. 0: disable the cache. */
+#define LV_FONT_FMT_TXT_CACHE_SIZE 0
+
+/** Number of entries in the per-font cache of the kerning values of glyph pairs.
+ *  Used only with fonts storing the kerning as a list of pairs. Must be a power of 2. 0: disable the cache. */
+#define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 0
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -851,6 +922,11 @@
 /** A layout similar to Grid in CSS. */
 #define LV_USE_GRID 1
 
+/** Update only the Widgets whose layout is invalidated and their parents, instead of visiting every
+ *  Widget of the screen. The children of a resized Widget recalculate only their size and position,
+ *  and their layout is updated only if their size changes too. */
+#define LV_LAYOUT_INCREMENTAL 0
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -1082,6 +1158,9 @@
 
     /*Enable event profiler*/
     #define LV_PROFILER_EVENT 1
+
+    /*Enable ThorVG profiler (Lottie building, shape preparation, rasterization and compositing)*/
+    #define LV_PROFILER_THORVG 1
 #endif
 
 /** 1: Enable an observer pattern implementation */
@@ -54,6 +54,7 @@ extern "C" {
 #include "src/core/lv_obj_private.h"
 #include "src/core/lv_obj_scroll_private.h"
 #include "src/core/lv_obj_draw_private.h"
+#include "src/core/lv_obj_draw_list_private.h"
 #include "src/core/lv_obj_class_private.h"
 #include "src/core/lv_group_private.h"
 #include "src/core/lv_obj_event_private.h"
@@ -485,32 +485,68 @@ class LVGLCompressData:
     def __init__(self,
                  cf: ColorFormat,
                  method: CompressMethod,
-                 raw_data: bytes = b''):
+                 raw_data: bytes = b'',
+                 stride: int = 0,
+                 block_rows: int = 0):
         self.blk_size = (cf.bpp + 7) // 8
         self.compress = method
         self.raw_data = raw_data
         self.raw_data_len = len(raw_data)
-        self.compressed = self._compress(raw_data)
+        self.stride = stride
+        self.block_rows = block_rows
 
-    def _compress(self, raw_data: bytes) -> bytearray:
-        if self.compress == CompressMethod.NONE:
-            return raw_data
+        if block_rows:
+            # Rows are decoded block by block, so they need to be stored one after the other
+            if cf.is_indexed or cf.is_alpha_only or cf == ColorFormat.RGB565A8:
+                raise ParameterError(f"Block compression is not supported for {cf.name}")
+            if stride == 0 or block_rows > 0xffff:
+                raise ParameterError(f"Invalid block rows: {block_rows}")
+
+        self.compressed = self._compress(raw_data)
 
+    def _compress_data(self, raw_data: bytes) -> bytes:
         if self.compress == CompressMethod.RLE:
             # RLE compression performs on pixel unit, pad data to pixel unit
             pad = b'\x00' * 0
-            if self.raw_data_len % self.blk_size:
-                pad = b'\x00' * (self.blk_size - self.raw_data_len % self.blk_size)
-            compressed = RLEImage().rle_compress(raw_data + pad, self.blk_size)
+            if len(raw_data) % self.blk_size:
+                pad = b'\x00' * (self.blk_size - len(raw_data) % self.blk_size)
+            return RLEImage().rle_compress(raw_data + pad, self.blk_size)
         elif self.compress == CompressMethod.LZ4:
-            compressed = lz4.block.compress(raw_data, store_size=False)
+            return lz4.block.compress(raw_data, store_size=False)
         else:
             raise ParameterError(f"Invalid compress method: {self.compress}")
 
+    def _compress_blocks(self, raw_data: bytes) -> bytes:
+        # Compress every `block_rows` rows separately, and store the offsets of
+        # the blocks (and the end of the last block) before them.
+        block_len = self.block_rows * self.stride
+        blocks = [
+            self._compress_data(raw_data[i:i + block_len])
+            for i in range(0, len(raw_data), block_len)
+        ]
+
+        index = bytearray()
+        offset = 0
+        for block in blocks:
+            index += uint32_t(offset)
+            offset += len(block)
+        index += uint32_t(offset)
+
+        return bytes(index) + b"".join(blocks)
+
+    def _compress(self, raw_data: bytes) -> bytearray:
+        if self.compress == CompressMethod.NONE:
+            return raw_data
+
+        if self.block_rows:
+            compressed = self._compress_blocks(raw_data)
+        else:
+            compressed = self._compress_data(raw_data)
+
         self.compressed_len = len(compressed)
 
         bin = bytearray()
-        bin += uint32_t(self.compress.value)
+        bin += uint32_t(self.compress.value | (self.block_rows << 4))
         bin += uint32_t(self.compressed_len)
         bin += uint32_t(self.raw_data_len)
         bin += compressed
@@ -776,7 +812,8 @@ class LVGLImage:
 
     def to_bin(self,
                filename: str,
-               compress: CompressMethod = CompressMethod.NONE):
+               compress: CompressMethod = CompressMethod.NONE,
+               block_rows: int = 0):
         """
         Write this image to file, filename should be ended with '.bin'
         """
@@ -795,7 +832,8 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
+            compressed = LVGLCompressData(self.cf, compress, self.data,
+                                          self.stride, block_rows)
             bin += compressed.compressed
 
             f.write(bin)
@@ -805,12 +843,14 @@ class LVGLImage:
     def to_c_array(self,
                    filename: str,
                    compress: CompressMethod = CompressMethod.NONE,
-                   outputname: str = None):
+                   outputname: str = None,
+                   block_rows: int = 0):
         self._check_ext(filename, ".c")
         self._check_dir(filename)
 
         if compress != CompressMethod.NONE:
-            data = LVGLCompressData(self.cf, compress, self.data).compressed
+            data = LVGLCompressData(self.cf, compress, self.data,
+                                    self.stride, block_rows).compressed
         else:
             data = self.data
         write_c_array_file(self.w, self.h, self.stride, self.cf, filename, outputname,
@@ -1317,6 +1357,7 @@ class PNGConverter:
                  align: int = 1,
                  premultiply: bool = False,
                  compress: CompressMethod = CompressMethod.NONE,
+                 block_rows: int = 0,
                  keep_folder=True,
                  rgb565_dither=False,
                  nema_gfx=False) -> None:
@@ -1329,6 +1370,7 @@ class PNGConverter:
         self.align = align
         self.premultiply = premultiply
         self.compress = compress
+        self.block_rows = block_rows
         self.background = background
         self.rgb565_dither = rgb565_dither
         self.nema_gfx = nema_gfx
@@ -1366,11 +1408,13 @@ class PNGConverter:
                 output.append((f, img))
                 if self.ofmt == OutputFormat.BIN_FILE:
                     img.to_bin(self._replace_ext(f, ".bin"),
-                               compress=self.compress)
+                               compress=self.compress,
+                               block_rows=self.block_rows)
                 elif self.ofmt == OutputFormat.C_ARRAY:
                     img.to_c_array(self._replace_ext(f, ".c", outputname),
                                    compress=self.compress,
-                                   outputname=outputname)
+                                   outputname=outputname,
+                                   block_rows=self.block_rows)
                 elif self.ofmt == OutputFormat.PNG_FILE:
                     img.to_png(self._replace_ext(f, ".png"))
 
@@ -1405,6 +1449,13 @@ def main():
                         default="NONE",
                         choices=["NONE", "RLE", "LZ4"])
 
+    parser.add_argument('--block-rows',
+                        help=("compress every N rows separately so that the decoder can "
+                              "decode only the rows it draws, default to 0 (compress the whole image)"),
+                        default=0,
+                        type=int,
+                        metavar='N')
+
     parser.add_argument('--align',
                         help="stride alignment in bytes for bin image",
                         default=1,
@@ -1464,6 +1515,7 @@ def main():
                              align=args.align,
                              premultiply=args.premultiply,
                              compress=compress,
+                             block_rows=args.block_rows,
                              keep_folder=False,
                              rgb565_dither=args.rgb565dither,
                              nema_gfx=args.nemagfx)
@@ -0,0 +1,281 @@
+/**
+ * @file lottie_profiler.c
+ *
+ * Render a Lottie file on the host and print how the time of a frame is spent
+ * in the stages of ThorVG (parsing, building, shape preparation, RLE generation,
+ * rasterization, compositing and effects).
+ *
+ * Usage: lottie_profiler <file.json> [-s <size>] [-f <frames>] [-t <trace.json>]
+ *   -s   width and height of the rendered animation in pixels (default 256)
+ *   -f   number of frames to render (default: all frames of the animation)
+ *   -t   also save the events in Chrome's trace event format.
+ *        Open it in https://ui.perfetto.dev or chrome://tracing
+ *
+ * The stages are measured by the `LV_PROFILER_THORVG` hooks through `lv_profiler_builtin`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "src/misc/lv_profiler_builtin_private.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define STAGE_MAX           64
+#define STAGE_NAME_MAX      48
+#define PROFILER_BUF_SIZE   (1024 * 1024)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    char name[STAGE_NAME_MAX];
+    uint64_t begin_us;
+    uint64_t total_us;
+    uint32_t cnt;
+    uint32_t depth;
+} stage_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint64_t tick_us_get_cb(void);
+static uint32_t tick_ms_get_cb(void);
+static void profiler_flush_cb(const char * buf);
+static stage_t * get_stage(const char * name);
+static int compare_stages(const void * a, const void * b);
+static void display_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void print_report(uint32_t frame_cnt, const lv_lottie_render_stats_t * stats);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static stage_t stages[STAGE_MAX];
+static uint32_t stage_cnt;
+static FILE * trace_file;
+static bool trace_first_event = true;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    const char * src = NULL;
+    const char * trace_path = NULL;
+    int32_t size = 256;
+    int32_t frame_cnt = 0;
+
+    int i;
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "-s") == 0 && i + 1 < argc) size = atoi(argv[++i]);
+        else if(strcmp(argv[i], "-f") == 0 && i + 1 < argc) frame_cnt = atoi(argv[++i]);
+        else if(strcmp(argv[i], "-t") == 0 && i + 1 < argc) trace_path = argv[++i];
+        else if(argv[i][0] != '-') src = argv[i];
+        else src = NULL;
+    }
+
+    if(src == NULL || size <= 0) {
+        fprintf(stderr, "Usage: %s <file.json> [-s <size>] [-f <frames>] [-t <trace.json>]\n", argv[0]);
+        return 1;
+    }
+
+    if(trace_path) {
+        trace_file = fopen(trace_path, "w");
+        if(trace_file == NULL) {
+            fprintf(stderr, "Couldn't open %s\n", trace_path);
+            return 1;
+        }
+        fprintf(trace_file, "{\"traceEvents\":[\n");
+    }
+
+    lv_init();
+    lv_tick_set_cb(tick_ms_get_cb);
+
+    /*Record everything with microsecond resolution and flush rarely*/
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = PROFILER_BUF_SIZE;
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = tick_us_get_cb;
+    config.flush_cb = profiler_flush_cb;
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(true);
+
+    /*A display is required to create widgets but it's never refreshed*/
+    static uint8_t disp_buf[64 * 64 * 4];
+    lv_display_t * disp = lv_display_create(size, size);
+    lv_display_set_buffers(disp, disp_buf, NULL, sizeof(disp_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, display_flush_cb);
+
+    void * buf = malloc(lv_draw_buf_width_to_stride(size, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED) * size +
+                        LV_DRAW_BUF_ALIGN);
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, size, size, buf);
+    lv_lottie_set_src_file(lottie, src);
+    lv_obj_update_layout(lottie);
+
+    uint32_t total = lv_lottie_get_total_frames(lottie);
+    if(total == 0) {
+        fprintf(stderr, "Couldn't load %s\n", src);
+        return 1;
+    }
+    if(frame_cnt <= 0) frame_cnt = (int32_t)total;
+
+    /*Measure only the frames, not the loading*/
+    lv_profiler_builtin_flush();
+    lv_memzero(stages, sizeof(stages));
+    stage_cnt = 0;
+
+    /*Render the frames one by one without the timers and the display refresh*/
+    lv_lottie_reset_render_stats(lottie);
+    for(i = 0; i < frame_cnt; i++) {
+        /*Seeking to the current frame would be skipped, so start from the second frame*/
+        lv_lottie_seek(lottie, (uint32_t)(i + 1) % total);
+    }
+    lv_profiler_builtin_flush();
+
+    lv_lottie_render_stats_t stats;
+    lv_lottie_get_render_stats(lottie, &stats);
+    printf("%s: %"LV_PRIu32" frames, %"LV_PRId32"x%"LV_PRId32" px\n\n", src, (uint32_t)frame_cnt, size, size);
+    print_report(stats.rendered_frames, &stats);
+
+    if(trace_file) {
+        fprintf(trace_file, "\n]}\n");
+        fclose(trace_file);
+        printf("\nTrace saved to %s\n", trace_path);
+    }
+
+    lv_obj_delete(lottie);
+    free(buf);
+    lv_deinit();
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint64_t tick_us_get_cb(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static uint32_t tick_ms_get_cb(void)
+{
+    return (uint32_t)(tick_us_get_cb() / 1000);
+}
+
+/**
+ * Receive the lines of the built-in profiler, e.g.
+ * "   LVGL-1 [0] 12.000345000: tracing_mark_write: B|1|sw_shape_rle"
+ * and accumulate the time of the stages.
+ */
+static void profiler_flush_cb(const char * buf)
+{
+    int tid;
+    int cpu;
+    unsigned long long sec;
+    unsigned long long nsec;
+    char type;
+    char name[STAGE_NAME_MAX];
+    if(sscanf(buf, " LVGL-%d [%d] %llu.%llu: tracing_mark_write: %c|1|%47s",
+              &tid, &cpu, &sec, &nsec, &type, name) != 6) {
+        return;
+    }
+
+    uint64_t ts_us = sec * 1000000 + nsec / 1000;
+
+    if(trace_file) {
+        fprintf(trace_file, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":%d}",
+                trace_first_event ? "" : ",\n", name, type, (unsigned long long)ts_us, tid);
+        trace_first_event = false;
+    }
+
+    stage_t * stage = get_stage(name);
+    if(stage == NULL) return;
+
+    /*Measure only the outermost call of the recursive stages*/
+    if(type == 'B') {
+        if(stage->depth == 0) stage->begin_us = ts_us;
+        stage->depth++;
+    }
+    else if(type == 'E' && stage->depth > 0) {
+        stage->depth--;
+        if(stage->depth == 0) {
+            stage->total_us += ts_us - stage->begin_us;
+            stage->cnt++;
+        }
+    }
+}
+
+static stage_t * get_stage(const char * name)
+{
+    uint32_t i;
+    for(i = 0; i < stage_cnt; i++) {
+        if(strcmp(stages[i].name, name) == 0) return &stages[i];
+    }
+
+    if(stage_cnt >= STAGE_MAX) return NULL;
+
+    stage_t * stage = &stages[stage_cnt++];
+    lv_strlcpy(stage->name, name, sizeof(stage->name));
+    return stage;
+}
+
+static void display_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static int compare_stages(const void * a, const void * b)
+{
+    const stage_t * sa = a;
+    const stage_t * sb = b;
+    if(sa->total_us == sb->total_us) return 0;
+    return sa->total_us < sb->total_us ? 1 : -1;
+}
+
+static void print_report(uint32_t frame_cnt, const lv_lottie_render_stats_t * stats)
+{
+    if(frame_cnt == 0) {
+        printf("No frames were rendered\n");
+        return;
+    }
+
+    qsort(stages, stage_cnt, sizeof(stage_t), compare_stages);
+
+    /*The stages are nested into "lottie_update" so show them relative to it*/
+    uint64_t frame_us = 0;
+    uint32_t i;
+    for(i = 0; i < stage_cnt; i++) {
+        if(strcmp(stages[i].name, "lottie_update") == 0) frame_us = stages[i].total_us;
+    }
+
+    printf("%-24s %10s %12s %12s %8s\n", "stage", "calls", "total [us]", "frame [us]", "frame %");
+    for(i = 0; i < stage_cnt; i++) {
+        const stage_t * stage = &stages[i];
+        if(stage->cnt == 0) continue;
+        printf("%-24s %10"LV_PRIu32" %12llu %12llu %8.1f\n", stage->name, stage->cnt,
+               (unsigned long long)stage->total_us,
+               (unsigned long long)(stage->total_us / frame_cnt),
+               frame_us ? (double)stage->total_us * 100.0 / (double)frame_us : 0.0);
+    }
+
+    printf("\nper frame:\n");
+    printf("  shapes prepared:        %llu\n", (unsigned long long)(stats->shapes / frame_cnt));
+    printf("  spans generated:        %llu\n", (unsigned long long)(stats->spans / frame_cnt));
+    printf("  pixels blended:         %llu\n", (unsigned long long)(stats->blended_px / frame_cnt));
+    printf("  compositor allocations: %.2f\n", (double)stats->compositors / frame_cnt);
+}
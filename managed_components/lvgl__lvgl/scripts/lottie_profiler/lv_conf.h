@@ -0,0 +1,32 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the Lottie profiler. The options not set here have their default values.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#define LV_COLOR_DEPTH 32
+
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_CLIB
+#define LV_USE_STDLIB_STRING    LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF   LV_STDLIB_CLIB
+
+#define LV_USE_LOG      1
+#define LV_LOG_LEVEL    LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF   1
+
+#define LV_USE_FLOAT            1
+#define LV_USE_MATRIX           1
+#define LV_USE_VECTOR_GRAPHIC   1
+#define LV_USE_THORVG_INTERNAL  1
+#define LV_USE_LOTTIE           1
+
+#define LV_USE_PROFILER         1
+#define LV_USE_PROFILER_BUILTIN 1
+#define LV_PROFILER_INCLUDE     "lv_profiler_builtin.h"
+#define LV_PROFILER_THORVG      1
+
+#define LV_BUILD_EXAMPLES       0
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,26 @@
+/**
+ * @file lv_conf.h
+ * Configuration of the allocation trace replay tool. The options not set here have their default values.
+ */
+
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/*TLSF is the core allocator, the slab allocator works on top of it*/
+#define LV_USE_STDLIB_MALLOC    LV_STDLIB_BUILTIN
+#define LV_MEM_SIZE             (64 * 1024 * 1024)
+#define LV_USE_MEM_SLAB         1
+
+/*Only for the types of the trace, it's not recorded*/
+#define LV_USE_MEM_TRACE        1
+
+#define LV_USE_STDLIB_STRING    LV_STDLIB_CLIB
+#define LV_USE_STDLIB_SPRINTF   LV_STDLIB_CLIB
+
+#define LV_USE_LOG      1
+#define LV_LOG_LEVEL    LV_LOG_LEVEL_WARN
+#define LV_LOG_PRINTF   1
+
+#define LV_BUILD_EXAMPLES       0
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,576 @@
+/**
+ * @file mem_replay.c
+ *
+ * Replay an allocation trace recorded with `LV_USE_MEM_TRACE` against different allocators
+ * and print their time, peak memory usage and fragmentation. The peak live memory of the
+ * subsystems (the tags of the trace) is printed too.
+ *
+ * Usage: mem_replay <trace> [-n <replays>]
+ *   <trace>  a file saved by `lv_mem_trace_save()`, or a log with the lines written by
+ *            a `lv_mem_trace_dump()` callback as "lv_mem_trace: <hex bytes>"
+ *   -n       number of timed replays per allocator (default 10)
+ *
+ * The allocators are:
+ *   tlsf     LVGL's built-in allocator (`LV_STDLIB_BUILTIN`)
+ *   slab     the size class allocator of `LV_USE_MEM_SLAB` in front of TLSF
+ *   clib     malloc(), realloc() and free() of the C library
+ * Others can be added to `allocators`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "src/stdlib/lv_mem_private.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    #include <malloc.h>
+    #define HAS_MALLINFO2   1
+#else
+    #define HAS_MALLINFO2   0
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LOG_PREFIX          "lv_mem_trace: "
+#define MAP_EMPTY           0
+#define MAP_DELETED         1   /*Never a valid pointer as they are aligned*/
+#define TAG_MAX             256
+
+/*Sample the memory usage only close to the peak of the live memory as it's slow*/
+#define SAMPLE_PEAK_PCT     95
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    EVENT_ALLOC,
+    EVENT_REALLOC,
+    EVENT_FREE,
+} event_type_t;
+
+/**The trace converted to indices of the live memory blocks (slots) instead of pointers*/
+typedef struct {
+    uint32_t slot;
+    uint32_t size;
+    uint8_t type;
+} event_t;
+
+typedef struct {
+    size_t used;            /**< Memory taken from the pool or the system including the overhead*/
+    uint8_t frag_pct;       /**< Fragmentation of the free memory as in `lv_mem_monitor_t`*/
+    bool has_frag;
+} usage_t;
+
+typedef struct {
+    const char * name;
+    void * (*alloc)(size_t size);
+    void * (*realloc)(void * p, size_t size);
+    void (*free)(void * p);
+    bool (*get_usage)(usage_t * usage);     /**< Return false if it's not known*/
+    void (*trim)(void);                     /**< Release the cached memory. Can be NULL.*/
+} allocator_t;
+
+typedef struct {
+    uint32_t alloc_cnt;
+    uint32_t realloc_cnt;
+    uint32_t free_cnt;
+    size_t live;
+    size_t peak;
+} tag_stats_t;
+
+typedef struct {
+    uint32_t * keys;
+    uint32_t * values;
+    uint32_t mask;
+} ptr_map_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint8_t * load_file(const char * path, size_t * size);
+static uint8_t * hex_log_to_bin(const char * text, size_t * size);
+static bool convert_trace(const lv_mem_trace_entry_t * entries, uint32_t entry_cnt);
+static void add_event(event_type_t type, uint32_t slot, uint32_t size);
+static bool replay(const allocator_t * a, bool measure, uint64_t * time_us, usage_t * peak);
+static uint64_t time_us_get(void);
+static uint32_t map_find(const ptr_map_t * map, uint32_t key);
+static void map_set(ptr_map_t * map, uint32_t key, uint32_t value);
+static void map_remove(ptr_map_t * map, uint32_t key);
+static bool tlsf_get_usage(usage_t * usage);
+static bool clib_get_usage(usage_t * usage);
+static const char * get_tag_name(uint32_t tag, char * buf, size_t buf_size);
+
+/**********************
+ *  GLOBAL PROTOTYPES
+ **********************/
+void * lv_malloc_core(size_t size);
+void * lv_realloc_core(void * p, size_t new_size);
+void lv_free_core(void * p);
+void lv_mem_monitor_core(lv_mem_monitor_t * mon_p);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const allocator_t allocators[] = {
+    {"tlsf", lv_malloc_core, lv_realloc_core, lv_free_core, tlsf_get_usage, NULL},
+    {"slab", lv_mem_slab_alloc, lv_mem_slab_realloc, lv_mem_slab_free, tlsf_get_usage, lv_mem_slab_trim},
+    {"clib", malloc, realloc, free, clib_get_usage, NULL},
+};
+
+static event_t * events;
+static uint32_t event_cnt;
+static uint32_t slot_cnt;
+static uint32_t * slot_sizes;
+static uint8_t * slot_tags;
+static void ** slot_ptrs;
+static size_t peak_live;
+static tag_stats_t tag_stats[TAG_MAX];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    const char * path = NULL;
+    int32_t replay_cnt = 10;
+
+    int i;
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "-n") == 0 && i + 1 < argc) replay_cnt = atoi(argv[++i]);
+        else if(argv[i][0] != '-') path = argv[i];
+        else path = NULL;
+    }
+
+    if(path == NULL || replay_cnt <= 0) {
+        fprintf(stderr, "Usage: %s <trace> [-n <replays>]\n", argv[0]);
+        return 1;
+    }
+
+    size_t size;
+    uint8_t * data = load_file(path, &size);
+    if(data == NULL) {
+        fprintf(stderr, "Couldn't read %s\n", path);
+        return 1;
+    }
+
+    /*Not a saved trace, try it as a log*/
+    if(size < 4 || memcmp(data, "LVMT", 4) != 0) {
+        uint8_t * bin = hex_log_to_bin((const char *)data, &size);
+        free(data);
+        data = bin;
+    }
+
+    const lv_mem_trace_header_t * header = (const lv_mem_trace_header_t *)data;
+    if(data == NULL || size < sizeof(lv_mem_trace_header_t) || memcmp(header->magic, "LVMT", 4) != 0) {
+        fprintf(stderr, "%s is not an allocation trace\n", path);
+        return 1;
+    }
+
+    if(header->version != 1 || header->entry_size != sizeof(lv_mem_trace_entry_t)) {
+        fprintf(stderr, "Unsupported trace version %d with %d bytes entries\n", header->version, header->entry_size);
+        return 1;
+    }
+
+    uint32_t entry_cnt = header->entry_cnt;
+    if(size < sizeof(lv_mem_trace_header_t) + (size_t)entry_cnt * sizeof(lv_mem_trace_entry_t)) {
+        entry_cnt = (uint32_t)((size - sizeof(lv_mem_trace_header_t)) / sizeof(lv_mem_trace_entry_t));
+        fprintf(stderr, "The trace is truncated, replaying %"LV_PRIu32" of %"LV_PRIu32" entries\n",
+                entry_cnt, header->entry_cnt);
+    }
+
+    if(!convert_trace((const lv_mem_trace_entry_t *)(data + sizeof(lv_mem_trace_header_t)), entry_cnt)) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    printf("%s: %"LV_PRIu32" entries (%"LV_PRIu32" dropped), %"LV_PRIu32" events, %"LV_PRIu32" blocks, "
+           "peak live %zu bytes\n\n", path, entry_cnt, header->dropped_cnt, event_cnt, slot_cnt, peak_live);
+    free(data);
+
+    lv_init();
+
+    printf("%-10s %12s %14s %12s %8s\n", "allocator", "time [us]", "peak used [B]", "overhead %", "frag %");
+    size_t a_i;
+    for(a_i = 0; a_i < sizeof(allocators) / sizeof(allocators[0]); a_i++) {
+        const allocator_t * a = &allocators[a_i];
+
+        /*The first replay measures the memory, the others the time*/
+        usage_t peak;
+        uint64_t time_us;
+        bool ok = replay(a, true, &time_us, &peak);
+
+        uint64_t total_us = 0;
+        for(i = 0; ok && i < replay_cnt; i++) {
+            ok = replay(a, false, &time_us, NULL);
+            total_us += time_us;
+        }
+
+        if(!ok) {
+            printf("%-10s out of memory\n", a->name);
+            continue;
+        }
+
+        printf("%-10s %12llu ", a->name, (unsigned long long)(total_us / (uint64_t)replay_cnt));
+        if(peak.used) {
+            printf("%14zu %12.1f ", peak.used,
+                   peak_live ? ((double)peak.used - (double)peak_live) * 100.0 / (double)peak_live : 0.0);
+        }
+        else {
+            printf("%14s %12s ", "-", "-");
+        }
+
+        if(peak.has_frag) printf("%8d\n", peak.frag_pct);
+        else printf("%8s\n", "-");
+    }
+
+    printf("\n%-12s %10s %10s %10s %14s\n", "tag", "allocs", "reallocs", "frees", "peak live [B]");
+    for(i = 0; i < TAG_MAX; i++) {
+        const tag_stats_t * s = &tag_stats[i];
+        if(s->alloc_cnt == 0 && s->realloc_cnt == 0 && s->free_cnt == 0) continue;
+
+        char name[16];
+        printf("%-12s %10"LV_PRIu32" %10"LV_PRIu32" %10"LV_PRIu32" %14zu\n", get_tag_name(i, name, sizeof(name)),
+               s->alloc_cnt, s->realloc_cnt, s->free_cnt, s->peak);
+    }
+
+    lv_deinit();
+    free(events);
+    free(slot_sizes);
+    free(slot_tags);
+    free(slot_ptrs);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint8_t * load_file(const char * path, size_t * size)
+{
+    FILE * f = fopen(path, "rb");
+    if(f == NULL) return NULL;
+
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    /*Keep a closing 0 to parse it as a text*/
+    uint8_t * data = len >= 0 ? malloc((size_t)len + 1) : NULL;
+    if(data && fread(data, 1, (size_t)len, f) != (size_t)len) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+
+    if(data == NULL) return NULL;
+
+    data[len] = '\0';
+    *size = (size_t)len;
+    return data;
+}
+
+/**
+ * Collect the bytes from the "lv_mem_trace: <hex bytes>" lines of a log.
+ * The lines can have a prefix, e.g. a timestamp.
+ * @param text      the log, closed by '\0'
+ * @param size      store the size of the result here
+ * @return          the collected bytes or NULL on error
+ */
+static uint8_t * hex_log_to_bin(const char * text, size_t * size)
+{
+    uint8_t * bin = malloc(strlen(text) / 2 + 1);
+    if(bin == NULL) return NULL;
+
+    size_t bin_size = 0;
+    const char * line = text;
+    while((line = strstr(line, LOG_PREFIX)) != NULL) {
+        line += strlen(LOG_PREFIX);
+        while(isxdigit((unsigned char)line[0]) && isxdigit((unsigned char)line[1])) {
+            char byte[3] = {line[0], line[1], '\0'};
+            bin[bin_size++] = (uint8_t)strtoul(byte, NULL, 16);
+            line += 2;
+        }
+    }
+
+    *size = bin_size;
+    return bin;
+}
+
+/**
+ * Convert the pointers of the trace to slots and collect the statistics of the tags
+ * @param entries       the entries of the trace
+ * @param entry_cnt     number of entries
+ * @return              false on out of memory
+ */
+static bool convert_trace(const lv_mem_trace_entry_t * entries, uint32_t entry_cnt)
+{
+    /*At most one event and one slot per entry, the free ones are kept as a replay needs them anyway*/
+    events = malloc(((size_t)entry_cnt * 2 + 1) * sizeof(event_t));
+    slot_sizes = malloc(((size_t)entry_cnt + 1) * sizeof(uint32_t));
+    slot_tags = malloc((size_t)entry_cnt + 1);
+    slot_ptrs = calloc((size_t)entry_cnt + 1, sizeof(void *));
+
+    ptr_map_t map;
+    map.mask = 1;
+    while(map.mask < entry_cnt * 2) map.mask <<= 1;
+    map.keys = calloc((size_t)map.mask, sizeof(uint32_t));
+    map.values = malloc((size_t)map.mask * sizeof(uint32_t));
+    map.mask--;
+
+    if(!events || !slot_sizes || !slot_tags || !slot_ptrs || !map.keys || !map.values) {
+        free(map.keys);
+        free(map.values);
+        return false;
+    }
+
+    uint32_t failed_cnt = 0;
+    uint32_t unknown_free_cnt = 0;
+    size_t live = 0;
+    uint32_t i;
+    for(i = 0; i < entry_cnt; i++) {
+        const lv_mem_trace_entry_t * e = &entries[i];
+        tag_stats_t * tag = &tag_stats[e->tag];
+        uint32_t slot;
+
+        if(e->op == LV_MEM_TRACE_OP_FREE) {
+            tag->free_cnt++;
+            slot = map_find(&map, e->ptr);
+            if(slot == UINT32_MAX) {
+                /*Allocated before the trace*/
+                unknown_free_cnt++;
+                continue;
+            }
+
+            map_remove(&map, e->ptr);
+            add_event(EVENT_FREE, slot, 0);
+            live -= slot_sizes[slot];
+            tag_stats[slot_tags[slot]].live -= slot_sizes[slot];
+            continue;
+        }
+
+        if(e->ptr == 0) {
+            failed_cnt++;
+            continue;
+        }
+
+        if(e->op == LV_MEM_TRACE_OP_REALLOC) tag->realloc_cnt++;
+        else tag->alloc_cnt++;
+
+        /*Grow the block if it's known, else allocate it*/
+        slot = UINT32_MAX;
+        if(e->op == LV_MEM_TRACE_OP_REALLOC && e->old_ptr != 0) {
+            slot = map_find(&map, e->old_ptr);
+            if(slot != UINT32_MAX) {
+                map_remove(&map, e->old_ptr);
+                live -= slot_sizes[slot];
+                tag_stats[slot_tags[slot]].live -= slot_sizes[slot];
+            }
+        }
+
+        /*The pointer is still live if its free wasn't recorded, free it first*/
+        uint32_t stale_slot = map_find(&map, e->ptr);
+        if(stale_slot != UINT32_MAX) {
+            add_event(EVENT_FREE, stale_slot, 0);
+            live -= slot_sizes[stale_slot];
+            tag_stats[slot_tags[stale_slot]].live -= slot_sizes[stale_slot];
+        }
+
+        if(slot == UINT32_MAX) {
+            slot = slot_cnt++;
+            slot_tags[slot] = e->tag;
+            add_event(EVENT_ALLOC, slot, e->size);
+        }
+        else {
+            add_event(EVENT_REALLOC, slot, e->size);
+        }
+
+        map_set(&map, e->ptr, slot);
+        slot_sizes[slot] = e->size;
+        live += e->size;
+        if(live > peak_live) peak_live = live;
+
+        tag_stats_t * owner = &tag_stats[slot_tags[slot]];
+        owner->live += e->size;
+        if(owner->live > owner->peak) owner->peak = owner->live;
+    }
+
+    if(failed_cnt) printf("%"LV_PRIu32" allocations failed while recording\n", failed_cnt);
+    if(unknown_free_cnt) printf("%"LV_PRIu32" freed blocks were allocated before the trace\n", unknown_free_cnt);
+
+    free(map.keys);
+    free(map.values);
+    return true;
+}
+
+static void add_event(event_type_t type, uint32_t slot, uint32_t size)
+{
+    event_t * e = &events[event_cnt++];
+    e->type = (uint8_t)type;
+    e->slot = slot;
+    e->size = size;
+}
+
+/**
+ * Replay the events with an allocator. The blocks still live at the end are freed.
+ * @param a         the allocator
+ * @param measure   true: sample the memory usage, it makes the replay slower
+ * @param time_us   store the time of the replay here
+ * @param peak      store the memory usage at the peak here if `measure` is true
+ * @return          false if an allocation failed
+ */
+static bool replay(const allocator_t * a, bool measure, uint64_t * time_us, usage_t * peak)
+{
+    if(a->trim) a->trim();
+
+    usage_t base = {0};
+    bool has_usage = measure && a->get_usage(&base);
+    if(peak) lv_memzero(peak, sizeof(usage_t));
+
+    size_t live = 0;
+    size_t sample_limit = peak_live * SAMPLE_PEAK_PCT / 100;
+    bool ok = true;
+
+    uint64_t t_start = time_us_get();
+    uint32_t i;
+    for(i = 0; i < event_cnt; i++) {
+        const event_t * e = &events[i];
+        void ** p = &slot_ptrs[e->slot];
+
+        if(e->type == EVENT_FREE) {
+            a->free(*p);
+            *p = NULL;
+            if(measure) live -= slot_sizes[e->slot];
+            continue;
+        }
+
+        void * new_p = e->type == EVENT_ALLOC ? a->alloc(e->size) : a->realloc(*p, e->size);
+        if(new_p == NULL) {
+            ok = false;
+            break;
+        }
+
+        /*Touch the memory like the code using it would*/
+        *(volatile uint8_t *)new_p = 0;
+        *p = new_p;
+
+        if(has_usage) {
+            live = live - (e->type == EVENT_REALLOC ? slot_sizes[e->slot] : 0) + e->size;
+            slot_sizes[e->slot] = e->size;
+            if(live >= sample_limit) {
+                usage_t usage;
+                a->get_usage(&usage);
+                if(usage.used - base.used > peak->used) {
+                    *peak = usage;
+                    peak->used -= base.used;
+                }
+            }
+        }
+    }
+    *time_us = time_us_get() - t_start;
+
+    for(i = 0; i < slot_cnt; i++) {
+        if(slot_ptrs[i]) a->free(slot_ptrs[i]);
+        slot_ptrs[i] = NULL;
+    }
+
+    return ok;
+}
+
+static uint64_t time_us_get(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+static uint32_t map_find(const ptr_map_t * map, uint32_t key)
+{
+    uint32_t i = (key >> 3) * 2654435761u;
+    while(1) {
+        i &= map->mask;
+        if(map->keys[i] == MAP_EMPTY) return UINT32_MAX;
+        if(map->keys[i] == key) return map->values[i];
+        i++;
+    }
+}
+
+static void map_set(ptr_map_t * map, uint32_t key, uint32_t value)
+{
+    uint32_t i = (key >> 3) * 2654435761u;
+    while(1) {
+        i &= map->mask;
+        if(map->keys[i] == MAP_EMPTY || map->keys[i] == MAP_DELETED || map->keys[i] == key) {
+            map->keys[i] = key;
+            map->values[i] = value;
+            return;
+        }
+        i++;
+    }
+}
+
+static void map_remove(ptr_map_t * map, uint32_t key)
+{
+    uint32_t i = (key >> 3) * 2654435761u;
+    while(1) {
+        i &= map->mask;
+        if(map->keys[i] == MAP_EMPTY) return;
+        if(map->keys[i] == key) {
+            map->keys[i] = MAP_DELETED;
+            return;
+        }
+        i++;
+    }
+}
+
+static bool tlsf_get_usage(usage_t * usage)
+{
+    lv_mem_monitor_t mon;
+    lv_memzero(&mon, sizeof(mon));
+    lv_mem_monitor_core(&mon);
+    usage->used = mon.total_size - mon.free_size;
+    usage->frag_pct = mon.frag_pct;
+    usage->has_frag = true;
+    return true;
+}
+
+static bool clib_get_usage(usage_t * usage)
+{
+#if HAS_MALLINFO2
+    struct mallinfo2 mi = mallinfo2();
+    usage->used = mi.uordblks + mi.hblkhd;
+    usage->frag_pct = 0;
+    usage->has_frag = false;
+    return true;
+#else
+    LV_UNUSED(usage);
+    return false;
+#endif
+}
+
+static const char * get_tag_name(uint32_t tag, char * buf, size_t buf_size)
+{
+    switch(tag) {
+        case LV_MEM_TRACE_TAG_NONE:
+            return "none";
+        case LV_MEM_TRACE_TAG_DRAW:
+            return "draw";
+        case LV_MEM_TRACE_TAG_IMAGE_CACHE:
+            return "image cache";
+        case LV_MEM_TRACE_TAG_THORVG:
+            return "thorvg";
+        case LV_MEM_TRACE_TAG_FONT:
+            return "font";
+        default:
+            lv_snprintf(buf, buf_size, "user+%d", (int)(tag - LV_MEM_TRACE_TAG_USER));
+            return buf;
+    }
+}
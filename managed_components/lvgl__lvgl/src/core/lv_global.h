@@ -31,7 +31,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
+#if LV_USE_FONT_COMPRESSED || LV_FONT_FMT_TXT_CACHE_SIZE || LV_FONT_FMT_TXT_KERN_CACHE_SIZE
 #include "../font/lv_font_fmt_txt_private.h"
 #endif
 
@@ -48,6 +48,7 @@ extern "C" {
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../stdlib/builtin/lv_tlsf_private.h"
+#include "../stdlib/lv_mem_private.h"
 #include "../others/sysmon/lv_sysmon_private.h"
 #include "../others/test/lv_test_private.h"
 #include "../layouts/lv_layout_private.h"
@@ -98,6 +99,18 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    uint32_t style_generation;
+    uint32_t style_resolved_lookups;
+    uint32_t style_resolved_hits;
+    uint32_t style_resolved_misses;
+#endif
+#if LV_OBJ_DRAW_LIST
+    uint32_t obj_tree_generation;
+    uint32_t obj_geometry_generation;
+    lv_obj_draw_list_t * obj_draw_list_refr;    /**< The draw list of the screen being refreshed*/
+    bool obj_draw_list_disabled;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -133,6 +146,12 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    lv_cache_t * draw_label_cache;
+#endif
+#if LV_GRADIENT_CACHE_SIZE > 0
+    lv_cache_t * grad_cache;
+#endif
 
     lv_draw_global_info_t draw_info;
     lv_ll_t draw_sw_blend_handler_ll;
@@ -167,6 +186,14 @@ typedef struct _lv_global_t {
     lv_tlsf_state_t tlsf_state;
 #endif
 
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_state_t mem_slab_state;
+#endif
+
+#if LV_USE_MEM_TRACE
+    lv_mem_trace_state_t mem_trace_state;
+#endif
+
     lv_ll_t fsdrv_ll;
 #if LV_USE_FS_STDIO != '\0'
     lv_fs_drv_t stdio_fs_drv;
@@ -211,6 +238,11 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+    lv_font_fmt_txt_cache_t * font_fmt_txt_cache_head;
+    lv_mutex_t font_fmt_txt_cache_lock;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
@@ -27,6 +27,7 @@
 #include "../tick/lv_tick.h"
 #include "../stdlib/lv_string.h"
 #include "lv_obj_draw_private.h"
+#include "lv_obj_draw_list_private.h"
 
 /*********************
  *      DEFINES
@@ -264,6 +265,10 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags |= f;
 
+#if LV_OBJ_DRAW_LIST
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) lv_obj_draw_list_tree_changed();
+#endif
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         if(lv_obj_has_state(obj, LV_STATE_FOCUSED)) {
             lv_group_t * group = lv_obj_get_group(obj);
@@ -306,6 +311,10 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+#if LV_OBJ_DRAW_LIST
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) lv_obj_draw_list_tree_changed();
+#endif
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
@@ -626,10 +635,20 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 #endif
 
+#if LV_OBJ_DRAW_LIST
+        lv_obj_draw_list_delete(obj->spec_attr->draw_list);
+        obj->spec_attr->draw_list = NULL;
+#endif
+
         lv_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    lv_free(obj->style_resolved);
+    obj->style_resolved = NULL;
+#endif
+
 #if LV_OBJ_ID_AUTO_ASSIGN
     lv_obj_free_id(obj);
 #endif
@@ -941,7 +960,12 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
         uint32_t child_cnt = lv_obj_get_child_count(obj);
         for(i = 0; i < child_cnt; i++) {
             lv_obj_t * child = obj->spec_attr->children[i];
+#if LV_LAYOUT_INCREMENTAL
+            /*The children's layout needs update only if their size changes too*/
+            lv_obj_mark_coords_as_dirty(child);
+#else
             lv_obj_mark_layout_as_dirty(child);
+#endif
         }
     }
     else if(code == LV_EVENT_CHILD_CHANGED) {
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_class_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_draw_list_private.h"
 #include "../themes/lv_theme.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -97,6 +98,9 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
                                                  sizeof(lv_obj_t *) * parent->spec_attr->child_cnt);
         parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
     }
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_tree_changed();
+#endif
 
     return obj;
 }
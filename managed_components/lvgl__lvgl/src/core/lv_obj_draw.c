@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_draw_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_draw_list_private.h"
 #include "lv_obj_style.h"
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
@@ -375,7 +376,12 @@ void lv_obj_refresh_ext_draw_size(lv_obj_t * obj)
         obj->spec_attr->ext_draw_size = s_new;
     }
 
-    if(s_new != s_old) lv_obj_invalidate(obj);
+    if(s_new != s_old) {
+        lv_obj_invalidate(obj);
+#if LV_OBJ_DRAW_LIST
+        lv_obj_draw_list_geometry_changed(obj);
+#endif
+    }
     LV_PROFILER_DRAW_END;
 }
 
@@ -0,0 +1,316 @@
+/**
+ * @file lv_obj_draw_list.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_draw_list_private.h"
+#include "lv_obj_private.h"
+#include "lv_obj_draw_private.h"
+#include "../misc/lv_area_private.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "../misc/lv_profiler.h"
+#include "lv_global.h"
+
+#if LV_OBJ_DRAW_LIST
+
+/*********************
+ *      DEFINES
+ *********************/
+#define obj_tree_generation LV_GLOBAL_DEFAULT()->obj_tree_generation
+#define obj_geometry_generation LV_GLOBAL_DEFAULT()->obj_geometry_generation
+#define draw_list_disabled LV_GLOBAL_DEFAULT()->obj_draw_list_disabled
+
+#define INITIAL_CAPACITY    16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool build(lv_obj_draw_list_t * list, lv_obj_t * obj, const lv_area_t * clip, bool clipped);
+static uint32_t update_areas(lv_obj_draw_list_t * list, uint32_t idx, const lv_area_t * clip, bool clipped);
+static bool update_entry(lv_obj_draw_list_entry_t * entry, const lv_area_t * clip, bool clipped,
+                         lv_area_t * children_clip);
+static void update_dirty_areas(lv_obj_draw_list_t * list);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_draw_list_t * lv_obj_draw_list_get(lv_obj_t * scr)
+{
+    /*Without children there is nothing to walk*/
+    if(draw_list_disabled || scr == NULL || scr->spec_attr == NULL) return NULL;
+
+    lv_obj_draw_list_t * list = scr->spec_attr->draw_list;
+    if(list == NULL) {
+        list = lv_malloc_zeroed(sizeof(lv_obj_draw_list_t));
+        if(list == NULL) return NULL;
+        scr->spec_attr->draw_list = list;
+        list->tree_generation = obj_tree_generation - 1;
+    }
+
+    if(list->tree_generation != obj_tree_generation) {
+        LV_PROFILER_REFR_BEGIN_TAG("draw_list_build");
+        list->cnt = 0;
+        bool ok = build(list, scr, NULL, false);
+        LV_PROFILER_REFR_END_TAG("draw_list_build");
+
+        /*Try again next time*/
+        if(!ok) {
+            list->cnt = 0;
+            return NULL;
+        }
+
+        list->tree_generation = obj_tree_generation;
+        list->geometry_generation = obj_geometry_generation;
+        list->dirty_start = 0;
+        list->dirty_end = 0;
+    }
+    else if(list->geometry_generation != obj_geometry_generation) {
+        /*The same objects in the same order, only the areas need to be updated*/
+        LV_PROFILER_REFR_BEGIN_TAG("draw_list_update");
+        update_areas(list, 0, NULL, false);
+        list->geometry_generation = obj_geometry_generation;
+        list->dirty_start = 0;
+        list->dirty_end = 0;
+        LV_PROFILER_REFR_END_TAG("draw_list_update");
+    }
+    else if(list->dirty_start != list->dirty_end) {
+        LV_PROFILER_REFR_BEGIN_TAG("draw_list_update");
+        update_dirty_areas(list);
+        LV_PROFILER_REFR_END_TAG("draw_list_update");
+    }
+
+    return list;
+}
+
+uint32_t lv_obj_draw_list_find(const lv_obj_draw_list_t * list, const lv_obj_t * obj)
+{
+    if(list == NULL || draw_list_disabled) return LV_OBJ_DRAW_LIST_NONE;
+
+    /*An object might have been changed since the list was fetched, e.g. in an event*/
+    if(list->tree_generation != obj_tree_generation || list->geometry_generation != obj_geometry_generation ||
+       list->dirty_start != list->dirty_end) {
+        return LV_OBJ_DRAW_LIST_NONE;
+    }
+
+    uint32_t idx = obj->draw_list_idx;
+    if(idx >= list->cnt || list->entries[idx].obj != obj) return LV_OBJ_DRAW_LIST_NONE;
+
+    return idx;
+}
+
+void lv_obj_draw_list_delete(lv_obj_draw_list_t * list)
+{
+    if(list == NULL) return;
+
+    lv_free(list->entries);
+    lv_free(list);
+}
+
+void lv_obj_draw_list_tree_changed(void)
+{
+    obj_tree_generation++;
+}
+
+void lv_obj_draw_list_geometry_changed(lv_obj_t * obj)
+{
+    if(obj == NULL) {
+        obj_geometry_generation++;
+        return;
+    }
+
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    lv_obj_draw_list_t * list = scr->spec_attr ? scr->spec_attr->draw_list : NULL;
+
+    /*No list or it will be rebuilt anyway*/
+    if(list == NULL || list->tree_generation != obj_tree_generation) return;
+
+    uint32_t idx = obj->draw_list_idx;
+    if(idx >= list->cnt || list->entries[idx].obj != obj) {
+        obj_geometry_generation++;
+        return;
+    }
+
+    /*Only the object and its children need to be updated*/
+    if(list->dirty_start == list->dirty_end) {
+        list->dirty_start = idx;
+        list->dirty_end = list->entries[idx].next;
+    }
+    else {
+        list->dirty_start = LV_MIN(list->dirty_start, idx);
+        list->dirty_end = LV_MAX(list->dirty_end, list->entries[idx].next);
+    }
+}
+
+void lv_obj_draw_list_set_enabled(bool en)
+{
+    draw_list_disabled = !en;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Add an object and its children to the list in drawing order
+ * @param list      pointer to a draw list
+ * @param obj       the object to add
+ * @param clip      the clip area of the parent, NULL if not clipped
+ * @param clipped   true if the parent clips the object completely
+ * @return          false on out of memory
+ */
+static bool build(lv_obj_draw_list_t * list, lv_obj_t * obj, const lv_area_t * clip, bool clipped)
+{
+    if(list->cnt == list->capacity) {
+        uint32_t new_capacity = list->capacity ? list->capacity * 2 : INITIAL_CAPACITY;
+        lv_obj_draw_list_entry_t * new_entries = lv_realloc(list->entries,
+                                                            new_capacity * sizeof(lv_obj_draw_list_entry_t));
+        if(new_entries == NULL) return false;
+        list->entries = new_entries;
+        list->capacity = new_capacity;
+    }
+
+    uint32_t idx = list->cnt;
+    list->cnt++;
+    obj->draw_list_idx = idx;
+    list->entries[idx].obj = obj;
+
+    lv_area_t children_clip;
+    bool children_clipped = !update_entry(&list->entries[idx], clip, clipped, &children_clip);
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        if(!build(list, obj->spec_attr->children[i], &children_clip, children_clipped)) return false;
+    }
+
+    /*`entries` might be reallocated by the children*/
+    list->entries[idx].next = list->cnt;
+
+    return true;
+}
+
+/**
+ * Update the areas of an entry and its children
+ * @param list      pointer to a draw list
+ * @param idx       index of the entry
+ * @param clip      the clip area of the parent, NULL if not clipped
+ * @param clipped   true if the parent clips the object completely
+ * @return          index of the next sibling
+ */
+static uint32_t update_areas(lv_obj_draw_list_t * list, uint32_t idx, const lv_area_t * clip, bool clipped)
+{
+    lv_obj_draw_list_entry_t * entry = &list->entries[idx];
+
+    lv_area_t children_clip;
+    bool children_clipped = !update_entry(entry, clip, clipped, &children_clip);
+
+    uint32_t child_idx = idx + 1;
+    while(child_idx < entry->next) {
+        child_idx = update_areas(list, child_idx, &children_clip, children_clipped);
+    }
+
+    return entry->next;
+}
+
+/**
+ * Update the areas of the entries in the dirty range. Each entry starts a subtree, so the range is
+ * walked subtree by subtree using the up to date areas of their parents to clip them.
+ * @param list      pointer to a draw list
+ */
+static void update_dirty_areas(lv_obj_draw_list_t * list)
+{
+    uint32_t idx = list->dirty_start;
+    while(idx < list->dirty_end) {
+        /*The parent is before the range, so it's not dirty*/
+        lv_obj_t * parent = lv_obj_get_parent(list->entries[idx].obj);
+        if(parent == NULL) {
+            idx = update_areas(list, idx, NULL, false);
+            continue;
+        }
+
+        const lv_obj_draw_list_entry_t * parent_entry = &list->entries[parent->draw_list_idx];
+        lv_area_t clip;
+        bool clipped = true;
+        if(!(parent_entry->flags & LV_OBJ_DRAW_LIST_FLAG_CLIPPED)) {
+            lv_area_t clip_coords = parent->coords;
+            if(lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+                int32_t ext_draw_size = lv_obj_get_ext_draw_size(parent);
+                lv_area_increase(&clip_coords, ext_draw_size, ext_draw_size);
+            }
+            clipped = !lv_area_intersect(&clip, &parent_entry->area, &clip_coords);
+        }
+
+        idx = update_areas(list, idx, &clip, clipped);
+    }
+
+    list->dirty_start = 0;
+    list->dirty_end = 0;
+}
+
+/**
+ * Update the flags and areas of an entry the same way `lv_obj_redraw()` clips the objects
+ * @param entry             pointer to an entry
+ * @param clip              the clip area of the parent, NULL if not clipped
+ * @param clipped           true if the parent clips the object completely
+ * @param children_clip     store the clip area of the children here
+ * @return                  false if the children are clipped completely
+ */
+static bool update_entry(lv_obj_draw_list_entry_t * entry, const lv_area_t * clip, bool clipped,
+                         lv_area_t * children_clip)
+{
+    lv_obj_t * obj = entry->obj;
+    entry->flags = 0;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) entry->flags |= LV_OBJ_DRAW_LIST_FLAG_HIDDEN;
+
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_t ext_coords = obj->coords;
+    lv_area_increase(&ext_coords, ext_draw_size, ext_draw_size);
+
+    bool overflow_visible = lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+
+    /*Where the object or its children can be clicked. Transformed objects need to transform the point
+     *first so there it's not used.*/
+    int32_t click_pad = obj->spec_attr ? LV_MAX(obj->spec_attr->ext_click_pad, 0) : 0;
+    if(overflow_visible) click_pad = LV_MAX(click_pad, ext_draw_size);
+    entry->click_area = obj->coords;
+    lv_area_increase(&entry->click_area, click_pad, click_pad);
+
+    if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) {
+        /*Drawn on a layer so the final area is not known here. On the layer the children are
+         *clipped only by this object.*/
+        entry->flags |= LV_OBJ_DRAW_LIST_FLAG_TRANSFORMED;
+        entry->area = ext_coords;
+    }
+    else if(clipped) {
+        entry->flags |= LV_OBJ_DRAW_LIST_FLAG_CLIPPED;
+        return false;
+    }
+    else if(clip == NULL) {
+        entry->area = ext_coords;
+    }
+    else if(!lv_area_intersect(&entry->area, clip, &ext_coords)) {
+        entry->flags |= LV_OBJ_DRAW_LIST_FLAG_CLIPPED;
+        return false;
+    }
+
+    return lv_area_intersect(children_clip, &entry->area, overflow_visible ? &ext_coords : &obj->coords);
+}
+
+#endif /*LV_OBJ_DRAW_LIST*/
@@ -0,0 +1,119 @@
+/**
+ * @file lv_obj_draw_list_private.h
+ *
+ */
+
+#ifndef LV_OBJ_DRAW_LIST_PRIVATE_H
+#define LV_OBJ_DRAW_LIST_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj.h"
+
+#if LV_OBJ_DRAW_LIST
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Returned by `lv_obj_draw_list_find()` if the object is not in the list */
+#define LV_OBJ_DRAW_LIST_NONE   UINT32_MAX
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    LV_OBJ_DRAW_LIST_FLAG_HIDDEN = 0x01,        /**< Hidden, the children are not drawn either*/
+    LV_OBJ_DRAW_LIST_FLAG_CLIPPED = 0x02,       /**< Fully clipped by its parents, the children are not drawn either*/
+    LV_OBJ_DRAW_LIST_FLAG_TRANSFORMED = 0x04,   /**< Drawn on a layer, `area` and `click_area` can't be used*/
+} lv_obj_draw_list_flag_t;
+
+/** An object of the list in drawing order */
+typedef struct {
+    lv_obj_t * obj;
+    lv_area_t area;         /**< Coordinates extended by the ext. draw size and clipped by the parents*/
+    lv_area_t click_area;   /**< Where the object or its children can be clicked*/
+    uint32_t next;          /**< Index of the next sibling, i.e. the end of the object's subtree*/
+    uint32_t flags;         /**< OR-ed values from `lv_obj_draw_list_flag_t`*/
+} lv_obj_draw_list_entry_t;
+
+/**
+ * The objects of a screen in drawing order. The children of an object follow it in the array,
+ * so the refreshing and the hit testing can walk a contiguous array and skip the subtrees
+ * which are out of the area without touching the objects.
+ */
+struct _lv_obj_draw_list_t {
+    lv_obj_draw_list_entry_t * entries;
+    uint32_t cnt;
+    uint32_t capacity;
+    uint32_t tree_generation;       /**< `tree_generation` of the last rebuild*/
+    uint32_t geometry_generation;   /**< `geometry_generation` of the last update of the areas*/
+    uint32_t dirty_start;           /**< Start of the range of entries to update*/
+    uint32_t dirty_end;             /**< End of the range of entries to update, `dirty_start` if none*/
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the draw list of a screen. It's rebuilt if the tree changed, and the areas are updated if
+ * an object was moved or resized since the last call.
+ * @param scr       pointer to a screen
+ * @return          the draw list or NULL if it's disabled or couldn't be allocated
+ */
+lv_obj_draw_list_t * lv_obj_draw_list_get(lv_obj_t * scr);
+
+/**
+ * Find an object in a draw list
+ * @param list      pointer to a draw list returned by `lv_obj_draw_list_get()`, can be NULL
+ * @param obj       pointer to an object
+ * @return          index of the object in `list->entries` or `LV_OBJ_DRAW_LIST_NONE` if the object
+ *                  is not in the list or the list is outdated
+ */
+uint32_t lv_obj_draw_list_find(const lv_obj_draw_list_t * list, const lv_obj_t * obj);
+
+/**
+ * Free a draw list
+ * @param list      pointer to a draw list
+ */
+void lv_obj_draw_list_delete(lv_obj_draw_list_t * list);
+
+/**
+ * Report that an object was created, deleted, moved in the tree, hidden or its layer type changed.
+ * The draw lists will be rebuilt on their next use.
+ */
+void lv_obj_draw_list_tree_changed(void);
+
+/**
+ * Report that an object was moved or resized or its extended draw or click area changed.
+ * The areas of the object and its children will be updated on the next use of the list.
+ * @param obj       pointer to the changed object or NULL to update every list
+ */
+void lv_obj_draw_list_geometry_changed(lv_obj_t * obj);
+
+/**
+ * Enable or disable the draw lists. If disabled the refreshing and the hit testing walk the
+ * object tree. Useful to compare the two.
+ * @param en        true: enable, false: disable
+ */
+void lv_obj_draw_list_set_enabled(bool en);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_OBJ_DRAW_LIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_DRAW_LIST_PRIVATE_H*/
@@ -10,6 +10,7 @@
 #include "../layouts/lv_layout_private.h"
 #include "lv_obj_event_private.h"
 #include "lv_obj_draw_private.h"
+#include "lv_obj_draw_list_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_private.h"
 #include "../display/lv_display.h"
@@ -33,6 +34,7 @@
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void mark_screen_layout_as_dirty(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
 
@@ -199,6 +201,9 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     else {
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_geometry_changed(obj);
+#endif
 
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_obj_send_event(obj, LV_EVENT_SIZE_CHANGED, &ori);
@@ -210,6 +215,10 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+#if LV_LAYOUT_INCREMENTAL
+    /*It might be called outside of the layout update, make sure the object will be visited*/
+    mark_screen_layout_as_dirty(obj);
+#endif
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -294,15 +303,16 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    mark_screen_layout_as_dirty(obj);
+}
 
-    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
-    scr->scr_layout_inv = 1;
-
-    /*Make the display refreshing*/
-    lv_display_t * disp = lv_obj_get_display(scr);
-    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+#if LV_LAYOUT_INCREMENTAL
+void lv_obj_mark_coords_as_dirty(lv_obj_t * obj)
+{
+    obj->coords_inv = 1;
+    mark_screen_layout_as_dirty(obj);
 }
+#endif
 
 void lv_obj_update_layout(const lv_obj_t * obj)
 {
@@ -757,6 +767,9 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
     obj->coords.y1 += diff.y;
     obj->coords.x2 += diff.x;
     obj->coords.y2 += diff.y;
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_geometry_changed(obj);
+#endif
 
     lv_obj_move_children_by(obj, diff.x, diff.y, false);
 
@@ -778,6 +791,9 @@ void lv_obj_move_children_by(lv_obj_t * obj, int32_t x_diff, int32_t y_diff, boo
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
+#if LV_OBJ_DRAW_LIST
+    if(child_cnt) lv_obj_draw_list_geometry_changed(obj);
+#endif
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
         if(ignore_floating && lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING)) continue;
@@ -948,6 +964,9 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, int32_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_geometry_changed(obj);
+#endif
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -1237,13 +1256,24 @@ static void layout_update_core(lv_obj_t * obj)
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+#if LV_LAYOUT_INCREMENTAL
+    /*Skip the subtrees without anything to do*/
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+#else
+    {
+#endif
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            layout_update_core(child);
+        }
     }
 
     if(obj->layout_inv) {
         obj->layout_inv = 0;
+#if LV_LAYOUT_INCREMENTAL
+        obj->coords_inv = 0;
+#endif
         lv_obj_refr_size(obj);
         lv_obj_refr_pos(obj);
 
@@ -1251,6 +1281,14 @@ static void layout_update_core(lv_obj_t * obj)
             lv_layout_apply(obj);
         }
     }
+#if LV_LAYOUT_INCREMENTAL
+    else if(obj->coords_inv) {
+        /*If the size changes LV_EVENT_SIZE_CHANGED marks the layout as dirty*/
+        obj->coords_inv = 0;
+        lv_obj_refr_size(obj);
+        lv_obj_refr_pos(obj);
+    }
+#endif
 
     if(obj->readjust_scroll_after_layout) {
         obj->readjust_scroll_after_layout = 0;
@@ -1258,6 +1296,31 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+/**
+ * Mark the screen of an object to have something to do in the next layout update
+ * @param obj       pointer to an object
+ */
+static void mark_screen_layout_as_dirty(lv_obj_t * obj)
+{
+#if LV_LAYOUT_INCREMENTAL
+    /*Mark the parents too to find the dirty objects without visiting the whole screen*/
+    lv_obj_t * scr = obj;
+    while(scr->parent) {
+        scr = scr->parent;
+        scr->child_layout_inv = 1;
+    }
+#else
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+#endif
+
+    /*Mark the screen as dirty too to mark that there is something to do on this screen*/
+    scr->scr_layout_inv = 1;
+
+    /*Make the display refreshing*/
+    lv_display_t * disp = lv_obj_get_display(scr);
+    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+}
+
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv)
 {
 #if LV_DRAW_TRANSFORM_USE_MATRIX
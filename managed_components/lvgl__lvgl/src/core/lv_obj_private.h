@@ -37,6 +37,9 @@ struct _lv_obj_spec_attr_t {
     lv_event_list_t event_list;
 #if LV_USE_OBJ_NAME
     const char * name;              /**< Pointer to the name */
+#endif
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_t * draw_list; /**< The objects in drawing order if it's a screen*/
 #endif
     lv_point_t scroll;              /**< The current X/Y scroll offset*/
 
@@ -60,10 +63,16 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    lv_obj_style_resolved_t * style_resolved;
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
     void * id;
+#endif
+#if LV_OBJ_DRAW_LIST
+    uint32_t draw_list_idx;     /**< Index in the draw list of the screen, valid only if the list is up to date*/
 #endif
     lv_area_t coords;
     lv_obj_flag_t flags;
@@ -76,12 +85,25 @@ struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+#if LV_LAYOUT_INCREMENTAL
+    uint16_t child_layout_inv : 1;  /**< A descendant needs layout or scroll update*/
+    uint16_t coords_inv : 1;        /**< Only the size and position need update, not the layout of the children*/
+#endif
 };
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_LAYOUT_INCREMENTAL
+/**
+ * Mark that the size and position of an object need to be recalculated, but the layout of its
+ * children needs update only if its size changes. E.g. because its parent was resized.
+ * @param obj       pointer to an object
+ */
+void lv_obj_mark_coords_as_dirty(lv_obj_t * obj);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -9,6 +9,8 @@
 #include "lv_obj_private.h"
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
+#include "lv_obj_draw_private.h"
+#include "lv_obj_draw_list_private.h"
 #include "lv_obj_class_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -23,6 +25,10 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define style_generation LV_GLOBAL_DEFAULT()->style_generation
+#define style_resolved_lookups LV_GLOBAL_DEFAULT()->style_resolved_lookups
+#define style_resolved_hits LV_GLOBAL_DEFAULT()->style_resolved_hits
+#define style_resolved_misses LV_GLOBAL_DEFAULT()->style_resolved_misses
 
 /**********************
  *      TYPEDEFS
@@ -60,6 +66,12 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+static lv_style_res_t get_prop_resolved(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                        lv_style_value_t * v);
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    static bool is_resolved_prop(lv_style_prop_t prop);
+    static void resolved_cache_invalidate(lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -143,6 +155,10 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     }
 #endif
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    resolved_cache_invalidate(obj);
+#endif
+
     lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
 }
 
@@ -356,6 +372,10 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    style_resolved_lookups++;
+#endif
+
     found = get_selector_style_prop(obj, selector, prop, &value_act);
     if(found == LV_STYLE_RES_FOUND) return value_act;
 
@@ -576,6 +596,24 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
     return res;
 }
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+void lv_obj_style_get_resolved_cache_stats(lv_obj_style_resolved_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    stats->lookups = style_resolved_lookups;
+    stats->hits = style_resolved_hits;
+    stats->misses = style_resolved_misses;
+}
+
+void lv_obj_style_reset_resolved_cache_stats(void)
+{
+    style_resolved_lookups = 0;
+    style_resolved_hits = 0;
+    style_resolved_misses = 0;
+}
+#endif
+
 void lv_obj_fade_in(lv_obj_t * obj, uint32_t time, uint32_t delay)
 {
     lv_anim_t a;
@@ -660,6 +698,9 @@ lv_opa_t lv_obj_get_style_opa_recursive(const lv_obj_t * obj, lv_part_t part)
 void lv_obj_update_layer_type(lv_obj_t * obj)
 {
     lv_layer_type_t layer_type = calculate_layer_type(obj);
+#if LV_OBJ_DRAW_LIST
+    if(layer_type != lv_obj_get_layer_type(obj)) lv_obj_draw_list_tree_changed();
+#endif
     if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
     else if(layer_type != LV_LAYER_TYPE_NONE) {
         lv_obj_allocate_spec_attr(obj);
@@ -834,6 +875,81 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Same as `get_prop_core()` but return the result from the resolved style cache of the object if possible.
+ * Only the object's own styles are cached, so it doesn't need to be invalidated if the parents change.
+ */
+static lv_style_res_t get_prop_resolved(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                        lv_style_value_t * v)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*The values of the running transitions change in every step, so don't cache them*/
+    if(!is_resolved_prop(prop) || (obj->style_cnt > 0 && obj->styles[0].is_trans)) {
+        return get_prop_core(obj, selector, prop, v);
+    }
+
+    lv_obj_style_resolved_t * cache = obj->style_resolved;
+    if(cache == NULL) {
+        cache = lv_malloc_zeroed(sizeof(lv_obj_style_resolved_t));
+        if(cache == NULL) return get_prop_core(obj, selector, prop, v);
+        cache->generation = style_generation;
+        ((lv_obj_t *)obj)->style_resolved = cache;
+    }
+    else if(cache->generation != style_generation) {
+        /*A style property was changed somewhere since the values were stored*/
+        lv_memzero(cache->entries, sizeof(cache->entries));
+        cache->generation = style_generation;
+    }
+
+    const uint8_t part = (uint8_t)(lv_obj_style_get_selector_part(selector) >> 16);
+    const lv_state_t state = lv_obj_style_get_selector_state(selector);
+    uint32_t idx = ((uint32_t)prop + part * 7 + state * 3) % LV_OBJ_STYLE_RESOLVED_CACHE_SIZE;
+    lv_obj_style_resolved_entry_t * entry = &cache->entries[idx];
+
+    if(entry->prop == prop && entry->part == part && entry->state == state) {
+        style_resolved_hits++;
+        if(!entry->found) return LV_STYLE_RES_NOT_FOUND;
+        *v = entry->value;
+        return LV_STYLE_RES_FOUND;
+    }
+
+    style_resolved_misses++;
+    lv_style_res_t found = get_prop_core(obj, selector, prop, v);
+    entry->prop = prop;
+    entry->part = part;
+    entry->state = state;
+    entry->found = found == LV_STYLE_RES_FOUND;
+    if(entry->found) entry->value = *v;
+
+    return found;
+#else
+    return get_prop_core(obj, selector, prop, v);
+#endif
+}
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/**
+ * Check if a property is read frequently enough (typically in every draw and layout) to be cached
+ * @param prop      a style property
+ * @return          true: the property can be cached
+ */
+static bool is_resolved_prop(lv_style_prop_t prop)
+{
+    return (prop >= LV_STYLE_RADIUS && prop <= LV_STYLE_PAD_COLUMN) ||
+           (prop >= LV_STYLE_BG_COLOR && prop <= LV_STYLE_SHADOW_SPREAD) ||
+           (prop >= LV_STYLE_TEXT_COLOR && prop <= LV_STYLE_COLOR_FILTER_OPA) ||
+           (prop >= LV_STYLE_BLEND_MODE && prop <= LV_STYLE_TRANSFORM_SKEW_Y) ||
+           prop == LV_STYLE_RECOLOR || prop == LV_STYLE_RECOLOR_OPA;
+}
+
+static void resolved_cache_invalidate(lv_obj_t * obj)
+{
+    if(obj->style_resolved) {
+        lv_memzero(obj->style_resolved->entries, sizeof(obj->style_resolved->entries));
+    }
+}
+#endif
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -1062,6 +1178,10 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    resolved_cache_invalidate(obj);
+#endif
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1158,7 +1278,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
     if((part == LV_PART_MAIN ? obj->style_main_prop_is_set : obj->style_other_prop_is_set) & prop_shifted)
 #endif
     {
-        found = get_prop_core(obj, selector, prop, value_act);
+        found = get_prop_resolved(obj, selector, prop, value_act);
         if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
     }
 
@@ -1185,7 +1305,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 #endif
             {
                 selector = part | obj->state;
-                found = get_prop_core(obj, selector, prop, value_act);
+                found = get_prop_resolved(obj, selector, prop, value_act);
                 if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
             }
             /*Check the parent too.*/
@@ -84,6 +84,14 @@ typedef enum {
  */
 typedef uint32_t lv_style_selector_t;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+typedef struct {
+    uint32_t lookups;   /**< Number of `lv_obj_get_style_prop()` calls */
+    uint32_t hits;      /**< The styles of a Widget were not searched because the result was cached */
+    uint32_t misses;    /**< The styles of a Widget were searched and the result was cached */
+} lv_obj_style_resolved_cache_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -249,6 +257,19 @@ void lv_obj_fade_in(lv_obj_t * obj, uint32_t time, uint32_t delay);
  */
 void lv_obj_fade_out(lv_obj_t * obj, uint32_t time, uint32_t delay);
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/**
+ * Get the statistics of the resolved style property cache since the last reset.
+ * @param stats     store the statistics here
+ */
+void lv_obj_style_get_resolved_cache_stats(lv_obj_style_resolved_cache_stats_t * stats);
+
+/**
+ * Reset the statistics of the resolved style property cache.
+ */
+void lv_obj_style_reset_resolved_cache_stats(void);
+#endif
+
 static inline lv_state_t lv_obj_style_get_selector_state(lv_style_selector_t selector)
 {
     return (lv_state_t)(selector & 0xFFFF);
@@ -41,6 +41,22 @@ struct _lv_obj_style_transition_dsc_t {
     void * user_data;
 };
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+typedef struct {
+    lv_style_value_t value;
+    uint16_t state;
+    uint8_t part;       /**< The part shifted to the lowest byte */
+    uint8_t prop;       /**< `LV_STYLE_PROP_INV` if the entry is empty */
+    uint8_t found;      /**< 1: the value was found in the styles of the Widget */
+} lv_obj_style_resolved_entry_t;
+
+/** The result of searching a property in the styles of a Widget for a given part and state */
+struct _lv_obj_style_resolved_t {
+    uint32_t generation;    /**< The style generation when the entries were stored */
+    lv_obj_style_resolved_entry_t entries[LV_OBJ_STYLE_RESOLVED_CACHE_SIZE];
+};
+#endif
+
 
 /**********************
  * GLOBAL PROTOTYPES
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_draw_list_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display.h"
@@ -188,6 +189,9 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
     parent->spec_attr->children = lv_realloc(parent->spec_attr->children,
                                              parent->spec_attr->child_cnt * (sizeof(lv_obj_t *)));
     parent->spec_attr->children[lv_obj_get_child_count(parent) - 1] = obj;
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_tree_changed();
+#endif
 
     obj->parent = parent;
 
@@ -250,6 +254,9 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_tree_changed();
+#endif
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -273,6 +280,9 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
 
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_tree_changed();
+#endif
 
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
@@ -749,6 +759,9 @@ static void obj_delete_core(lv_obj_t * obj)
         obj->parent->spec_attr->children = lv_realloc(obj->parent->spec_attr->children,
                                                       obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
     }
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_tree_changed();
+#endif
 
     /*Free the object itself*/
     lv_free(obj);
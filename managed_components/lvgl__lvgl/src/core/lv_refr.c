@@ -8,6 +8,7 @@
  *********************/
 #include "lv_refr_private.h"
 #include "lv_obj_draw_private.h"
+#include "lv_obj_draw_list_private.h"
 #include "../misc/lv_area_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../draw/lv_draw_mask_private.h"
@@ -31,6 +32,10 @@
 
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
+#define draw_list_refr LV_GLOBAL_DEFAULT()->obj_draw_list_refr
+
+/*Max. number of children which can contain an area to look for covering objects in the draw list*/
+#define TOP_OBJ_CANDIDATE_MAX   16
 
 /**********************
  *      TYPEDEFS
@@ -40,11 +45,26 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+#if LV_USE_INV_AREA_COST_MODEL
+    static uint32_t inv_area_get_cost(lv_display_t * disp, const lv_area_t * area);
+    static bool inv_buf_grow(lv_display_t * disp);
+    static void inv_area_join_cheapest(lv_display_t * disp, const lv_area_t * area);
+#endif
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
+static void refr_sync_save_areas(lv_draw_buf_t * buf_rendered);
+static uint32_t sync_buf_index(lv_display_t * disp, const lv_draw_buf_t * buf);
+static bool sync_add_rect(const lv_area_t * area, uint32_t start);
+static void sync_remove_rect(const lv_area_t * area);
+static void sync_merge_rects(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
 static void refr_configured_layer(lv_layer_t * layer);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
+static void refr_obj_children(lv_layer_t * layer, lv_obj_t * obj);
+#if LV_OBJ_DRAW_LIST
+    static void refr_draw_list_siblings(lv_layer_t * layer, const lv_obj_draw_list_t * list, uint32_t start,
+                                        uint32_t end);
+#endif
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
@@ -150,7 +170,6 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
     }
 
     if(refr_children) {
-        uint32_t i;
         uint32_t child_cnt = lv_obj_get_child_count(obj);
         if(child_cnt == 0) {
             /*If the object was visible on the clip area call the post draw events too*/
@@ -170,10 +189,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
             }
 
             if(clip_corner == false) {
-                for(i = 0; i < child_cnt; i++) {
-                    lv_obj_t * child = obj->spec_attr->children[i];
-                    lv_obj_refr(layer, child);
-                }
+                refr_obj_children(layer, obj);
 
                 /*If the object was visible on the clip area call the post draw events too*/
                 /*If all the children are redrawn make 'post draw' draw*/
@@ -199,10 +215,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 if(lv_area_intersect(&bottom, &bottom, &layer->_clip_area)) {
                     layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &bottom);
 
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer_children, child);
-                    }
+                    refr_obj_children(layer_children, obj);
 
                     /*If all the children are redrawn send 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer_children);
@@ -220,10 +233,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 if(lv_area_intersect(&top, &top, &layer->_clip_area)) {
                     layer_children = lv_draw_layer_create(layer, LV_COLOR_FORMAT_ARGB8888, &top);
 
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer_children, child);
-                    }
+                    refr_obj_children(layer_children, obj);
 
                     /*If all the children are redrawn send 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer_children);
@@ -242,10 +252,7 @@ void lv_obj_redraw(lv_layer_t * layer, lv_obj_t * obj)
                 mid.y2 -= rout;
                 if(lv_area_intersect(&mid, &mid, &layer->_clip_area)) {
                     layer->_clip_area = mid;
-                    for(i = 0; i < child_cnt; i++) {
-                        lv_obj_t * child = obj->spec_attr->children[i];
-                        lv_obj_refr(layer, child);
-                    }
+                    refr_obj_children(layer, obj);
 
                     /*If all the children are redrawn make 'post draw' draw*/
                     lv_obj_send_event(obj, LV_EVENT_DRAW_POST_BEGIN, layer);
@@ -325,9 +332,19 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
 
     /*Save the area*/
     lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
+    if(disp->inv_p >= disp->inv_size) {
+#if LV_USE_INV_AREA_COST_MODEL
+        /*If the buffer can't grow join the area into the one which gets the least more expensive*/
+        if(inv_buf_grow(disp) == false) {
+            inv_area_join_cheapest(disp, &com_area);
+            lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+            return;
+        }
+#else
+        /*If no place for the area add the screen*/
         disp->inv_p = 0;
         tmp_area_p = &scr_area;
+#endif
     }
     lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
     disp->inv_p++;
@@ -414,20 +431,12 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
     if(disp_refr->inv_p == 0) goto refr_finish;
     /*In double buffered direct mode save the updated areas.
-     *They will be used on the next call to synchronize the buffers.*/
+     *They will be used on the next calls to synchronize the buffers.*/
     if(lv_display_is_double_buffered(disp_refr) && disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
-        uint32_t i;
-        for(i = 0; i < disp_refr->inv_p; i++) {
-            if(disp_refr->inv_area_joined[i])
-                continue;
-
-            lv_area_t * sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
-            *sync_area = disp_refr->inv_areas[i];
-        }
+        refr_sync_save_areas(buf_act);
     }
 
-    lv_memzero(disp_refr->inv_areas, sizeof(disp_refr->inv_areas));
-    lv_memzero(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
+    lv_memzero(disp_refr->inv_area_joined, disp_refr->inv_p);
     disp_refr->inv_p = 0;
 
 refr_finish:
@@ -464,6 +473,37 @@ lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj)
     lv_obj_send_event(obj, LV_EVENT_COVER_CHECK, &info);
     if(info.res == LV_COVER_RES_MASKED) return NULL;
 
+#if LV_OBJ_DRAW_LIST
+    /*Only the children whose coordinates contain the area can cover it. Collect them from the list and
+     *check them from the top. The list is not built here as it's called for snapshots too.*/
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    const lv_obj_draw_list_t * list = scr->spec_attr ? scr->spec_attr->draw_list : NULL;
+    uint32_t idx = lv_obj_draw_list_find(list, obj);
+    if(idx != LV_OBJ_DRAW_LIST_NONE) {
+        lv_obj_t * candidates[TOP_OBJ_CANDIDATE_MAX];
+        uint32_t candidate_cnt = 0;
+        uint32_t child_idx = idx + 1;
+        while(child_idx < list->entries[idx].next && candidate_cnt < TOP_OBJ_CANDIDATE_MAX) {
+            const lv_obj_draw_list_entry_t * entry = &list->entries[child_idx];
+            child_idx = entry->next;
+            if(entry->flags & (LV_OBJ_DRAW_LIST_FLAG_HIDDEN | LV_OBJ_DRAW_LIST_FLAG_TRANSFORMED)) continue;
+            if(lv_area_is_in(area_p, &entry->click_area, 0)) candidates[candidate_cnt++] = entry->obj;
+        }
+
+        /*Use the list only if all the candidates were collected*/
+        if(child_idx >= list->entries[idx].next) {
+            while(candidate_cnt > 0 && found_p == NULL) {
+                candidate_cnt--;
+                found_p = lv_refr_get_top_obj(area_p, candidates[candidate_cnt]);
+            }
+
+            /*If no better children use this object*/
+            if(found_p == NULL && info.res == LV_COVER_RES_COVER) found_p = obj;
+            return found_p;
+        }
+    }
+#endif
+
     int32_t i;
     int32_t child_cnt = lv_obj_get_child_count(obj);
     for(i = child_cnt - 1; i >= 0; i--) {
@@ -611,6 +651,31 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
+#if LV_USE_INV_AREA_COST_MODEL
+    /*Join any two areas if rendering their bounding box is not more expensive.
+     *Repeat until no more areas can be joined as a joined area might be worth joining with the others.*/
+    bool joined = true;
+    while(joined) {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            uint32_t cost_in = inv_area_get_cost(disp_refr, &disp_refr->inv_areas[join_in]);
+            for(join_from = join_in + 1; join_from < disp_refr->inv_p; join_from++) {
+                if(disp_refr->inv_area_joined[join_from] != 0) continue;
+
+                lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                uint32_t cost_joined = inv_area_get_cost(disp_refr, &joined_area);
+                if(cost_joined <= cost_in + inv_area_get_cost(disp_refr, &disp_refr->inv_areas[join_from])) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    cost_in = cost_joined;
+                    joined = true;
+                }
+            }
+        }
+    }
+#else
     for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
         if(disp_refr->inv_area_joined[join_in] != 0) continue;
 
@@ -638,11 +703,83 @@ static void lv_refr_join_area(void)
             }
         }
     }
+#endif /*LV_USE_INV_AREA_COST_MODEL*/
     LV_PROFILER_REFR_END;
 }
 
+#if LV_USE_INV_AREA_COST_MODEL
 /**
- * Refresh the sync areas
+ * Estimate the cost of rendering an area as its pixels plus a fixed cost per rendered part.
+ * In partial mode an area is rendered in as many bands as many times its rows fit into the buffer,
+ * so joining areas which still fit into the same bands is cheap.
+ * @param disp      pointer to a display
+ * @param area      the area to check
+ * @return          the cost in pixels
+ */
+static uint32_t inv_area_get_cost(lv_display_t * disp, const lv_area_t * area)
+{
+    uint32_t parts = 1;
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL && disp->buf_act) {
+        uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), disp->color_format);
+        uint32_t rows = stride ? disp->buf_act->data_size / stride : 0;
+        if(rows > 0) parts = (lv_area_get_height(area) + rows - 1) / rows;
+    }
+
+    return parts * disp->inv_area_cost + lv_area_get_size(area);
+}
+
+/**
+ * Double the size of the invalidated area buffer up to `LV_INV_BUF_MAX_SIZE`
+ * @param disp      pointer to a display
+ * @return          false: the buffer is already at its max. size or out of memory
+ */
+static bool inv_buf_grow(lv_display_t * disp)
+{
+    if(disp->inv_size >= LV_INV_BUF_MAX_SIZE) return false;
+
+    uint32_t old_size = disp->inv_size;
+    uint32_t new_size = LV_MIN(old_size * 2, LV_INV_BUF_MAX_SIZE);
+    lv_area_t * areas = lv_realloc(disp->inv_areas, new_size * (sizeof(lv_area_t) + sizeof(uint8_t)));
+    if(areas == NULL) return false;
+
+    /*The joined flags are stored after the areas, so move them to the end of the new areas*/
+    uint8_t * joined = (uint8_t *)&areas[new_size];
+    lv_memmove(joined, &areas[old_size], old_size);
+    lv_memzero(joined + old_size, new_size - old_size);
+
+    disp->inv_areas = areas;
+    disp->inv_area_joined = joined;
+    disp->inv_size = new_size;
+    return true;
+}
+
+/**
+ * Join an area into the stored area whose cost increases the least
+ * @param disp      pointer to a display
+ * @param area      the area to join
+ */
+static void inv_area_join_cheapest(lv_display_t * disp, const lv_area_t * area)
+{
+    uint32_t best = 0;
+    uint32_t best_cost = UINT32_MAX;
+    lv_area_t joined_area;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        lv_area_join(&joined_area, &disp->inv_areas[i], area);
+        uint32_t cost = inv_area_get_cost(disp, &joined_area) - inv_area_get_cost(disp, &disp->inv_areas[i]);
+        if(cost < best_cost) {
+            best_cost = cost;
+            best = i;
+        }
+    }
+
+    lv_area_join(&disp->inv_areas[best], &disp->inv_areas[best], area);
+}
+#endif /*LV_USE_INV_AREA_COST_MODEL*/
+
+/**
+ * Copy the areas which were redrawn since the active buffer was rendered last time
+ * from the most recent buffer. The areas which will be redrawn now are skipped.
  */
 static void refr_sync_areas(void)
 {
@@ -652,95 +789,236 @@ static void refr_sync_areas(void)
     /*Do not sync if not double buffered*/
     if(!lv_display_is_double_buffered(disp_refr)) return;
 
-    /*Do not sync if no sync areas*/
-    if(lv_ll_is_empty(&disp_refr->sync_areas)) return;
+    /*Do not sync if nothing will be rendered as the buffers won't be swapped either*/
+    if(disp_refr->inv_p == 0) return;
+
+    disp_refr->sync_copy_size = 0;
+
+    /*Number of frames the active buffer has missed*/
+    uint32_t frame_id = disp_refr->sync_frame_id;
+    uint32_t missed = frame_id - disp_refr->sync_buf_frame[sync_buf_index(disp_refr, disp_refr->buf_act)];
+    if(missed == 0) return;
+
+    /*The most recently rendered buffer has all the changes*/
+    lv_draw_buf_t * bufs[3] = {disp_refr->buf_1, disp_refr->buf_2, disp_refr->buf_3};
+    lv_draw_buf_t * src = NULL;
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        if(bufs[i] && bufs[i] != disp_refr->buf_act && disp_refr->sync_buf_frame[i] == frame_id) {
+            src = bufs[i];
+            break;
+        }
+    }
+    if(src == NULL) return;
 
     LV_PROFILER_REFR_BEGIN;
-    /*With double buffered direct mode synchronize the rendered areas to the other buffer*/
     /*We need to wait for ready here to not mess up the active screen*/
     wait_for_flushing(disp_refr);
 
-    /*The buffers are already swapped.
-     *So the active buffer is the off screen buffer where LVGL will render*/
-    lv_draw_buf_t * off_screen = disp_refr->buf_act;
-    /*Triple buffer sync buffer for off-screen2 updates.*/
-    lv_draw_buf_t * off_screen2;
-    lv_draw_buf_t * on_screen;
+    lv_area_t disp_area;
+    lv_area_set(&disp_area, 0, 0, lv_display_get_horizontal_resolution(disp_refr) - 1,
+                lv_display_get_vertical_resolution(disp_refr) - 1);
 
-    if(disp_refr->buf_act == disp_refr->buf_1) {
-        off_screen2 = disp_refr->buf_2;
-        on_screen = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_2;
-    }
-    else if(disp_refr->buf_act == disp_refr->buf_2) {
-        off_screen2 = disp_refr->buf_3 ? disp_refr->buf_3 : disp_refr->buf_1;
-        on_screen = disp_refr->buf_1;
+    /*Collect the missed areas without overlapping*/
+    bool ok = true;
+    disp_refr->sync_rect_cnt = 0;
+    if(missed > LV_DISPLAY_SYNC_HISTORY) {
+        ok = sync_add_rect(&disp_area, 0);
     }
     else {
-        off_screen2 = disp_refr->buf_1;
-        on_screen = disp_refr->buf_2;
+        uint32_t f;
+        for(f = 0; f < missed && ok; f++) {
+            lv_display_sync_frame_t * frame = &disp_refr->sync_frames[(frame_id - f) % LV_DISPLAY_SYNC_HISTORY];
+            if(frame->areas == NULL) {
+                ok = sync_add_rect(&disp_area, 0);
+                continue;
+            }
+
+            uint32_t a;
+            for(a = 0; a < frame->area_cnt && ok; a++) {
+                lv_area_t clipped;
+                /*The resolution might be smaller since the area was saved*/
+                if(!lv_area_intersect(&clipped, &frame->areas[a], &disp_area)) continue;
+                ok = sync_add_rect(&clipped, 0);
+            }
+        }
     }
 
-    uint32_t hor_res = lv_display_get_horizontal_resolution(disp_refr);
-    uint32_t ver_res = lv_display_get_vertical_resolution(disp_refr);
+    /*Copy everything if there was no memory to collect the areas*/
+    if(!ok) {
+        lv_draw_buf_copy(disp_refr->buf_act, NULL, src, NULL);
+        disp_refr->sync_copy_size = disp_refr->buf_act->header.stride * disp_refr->buf_act->header.h;
+        disp_refr->sync_rect_cnt = 0;
+        LV_PROFILER_REFR_END;
+        return;
+    }
 
-    /*Iterate through invalidated areas to see if sync area should be copied*/
-    uint16_t i;
-    int8_t j;
-    lv_area_t res[4] = {0};
-    int8_t res_c;
-    lv_area_t * sync_area, * new_area, * next_area;
+    /*Skip what will be redrawn anyway*/
     for(i = 0; i < disp_refr->inv_p; i++) {
-        /*Skip joined areas*/
         if(disp_refr->inv_area_joined[i]) continue;
+        sync_remove_rect(&disp_refr->inv_areas[i]);
+    }
 
-        /*Iterate over sync areas*/
-        sync_area = lv_ll_get_head(&disp_refr->sync_areas);
-        while(sync_area != NULL) {
-            /*Get next sync area*/
-            next_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area);
-
-            /*Remove intersect of redraw area from sync area and get remaining areas*/
-            res_c = lv_area_diff(res, sync_area, &disp_refr->inv_areas[i]);
-
-            /*New sub areas created after removing intersect*/
-            if(res_c != -1) {
-                /*Replace old sync area with new areas*/
-                for(j = 0; j < res_c; j++) {
-                    new_area = lv_ll_ins_prev(&disp_refr->sync_areas, sync_area);
-                    *new_area = res[j];
-                }
-                lv_ll_remove(&disp_refr->sync_areas, sync_area);
-                lv_free(sync_area);
-            }
+    /*Copy larger areas at once*/
+    sync_merge_rects();
 
-            /*Move on to next sync area*/
-            sync_area = next_area;
+    uint32_t bpp = lv_color_format_get_bpp(disp_refr->buf_act->header.cf);
+    for(i = 0; i < disp_refr->sync_rect_cnt; i++) {
+        lv_area_t sync_area = disp_refr->sync_rects[i];
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+        if(lv_display_get_matrix_rotation(disp_refr)) {
+            lv_display_rotate_area(disp_refr, &sync_area);
         }
+#endif
+        lv_draw_buf_copy(disp_refr->buf_act, &sync_area, src, &sync_area);
+        disp_refr->sync_copy_size += ((lv_area_get_width(&sync_area) * bpp + 7) >> 3) * lv_area_get_height(&sync_area);
     }
 
-    lv_area_t disp_area = {0, 0, (int32_t)hor_res - 1, (int32_t)ver_res - 1};
-    /*Copy sync areas (if any remaining)*/
-    for(sync_area = lv_ll_get_head(&disp_refr->sync_areas); sync_area != NULL;
-        sync_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area)) {
-        /**
-         * @todo Resize SDL window will trigger crash because of sync_area is larger than disp_area
-         */
-        if(!lv_area_intersect(sync_area, sync_area, &disp_area)) {
+    disp_refr->sync_rect_cnt = 0;
+    LV_PROFILER_REFR_END;
+}
+
+/**
+ * Save the areas redrawn in the current refresh to the history
+ * @param buf_rendered  the buffer into which the areas were rendered
+ */
+static void refr_sync_save_areas(lv_draw_buf_t * buf_rendered)
+{
+    disp_refr->sync_frame_id++;
+    disp_refr->sync_buf_frame[sync_buf_index(disp_refr, buf_rendered)] = disp_refr->sync_frame_id;
+
+    lv_display_sync_frame_t * frame = &disp_refr->sync_frames[disp_refr->sync_frame_id % LV_DISPLAY_SYNC_HISTORY];
+    if(frame->area_size < disp_refr->inv_p) {
+        lv_area_t * areas = lv_realloc(frame->areas, disp_refr->inv_size * sizeof(lv_area_t));
+        LV_ASSERT_MALLOC(areas);
+        if(areas == NULL) {
+            /*Without areas the whole screen will be synchronized*/
+            lv_free(frame->areas);
+            frame->areas = NULL;
+            frame->area_size = 0;
+            return;
+        }
+        frame->areas = areas;
+        frame->area_size = disp_refr->inv_size;
+    }
+
+    frame->area_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        frame->areas[frame->area_cnt] = disp_refr->inv_areas[i];
+        frame->area_cnt++;
+    }
+}
+
+static uint32_t sync_buf_index(lv_display_t * disp, const lv_draw_buf_t * buf)
+{
+    if(buf == disp->buf_1) return 0;
+    if(buf == disp->buf_2) return 1;
+    return 2;
+}
+
+/**
+ * Add the parts of an area to the sync areas which are not covered yet
+ * @param area      the area to add
+ * @param start     index of the first sync area which can overlap with `area`
+ * @return          false: out of memory
+ */
+static bool sync_add_rect(const lv_area_t * area, uint32_t start)
+{
+    uint32_t i;
+    for(i = start; i < disp_refr->sync_rect_cnt; i++) {
+        lv_area_t res[4];
+        int8_t res_c = lv_area_diff(res, area, &disp_refr->sync_rects[i]);
+        if(res_c < 0) continue;
+
+        /*Add the remaining parts. They don't overlap with the sync areas before `i`*/
+        int8_t j;
+        for(j = 0; j < res_c; j++) {
+            if(!sync_add_rect(&res[j], i + 1)) return false;
+        }
+        return true;
+    }
+
+    if(disp_refr->sync_rect_cnt == disp_refr->sync_rect_size) {
+        uint32_t new_size = disp_refr->sync_rect_size ? disp_refr->sync_rect_size * 2 : LV_INV_BUF_SIZE;
+        lv_area_t * new_rects = lv_realloc(disp_refr->sync_rects, new_size * sizeof(lv_area_t));
+        LV_ASSERT_MALLOC(new_rects);
+        if(new_rects == NULL) return false;
+        disp_refr->sync_rects = new_rects;
+        disp_refr->sync_rect_size = new_size;
+    }
+
+    disp_refr->sync_rects[disp_refr->sync_rect_cnt] = *area;
+    disp_refr->sync_rect_cnt++;
+    return true;
+}
+
+/**
+ * Remove an area from the sync areas
+ * @param area  the area to remove
+ */
+static void sync_remove_rect(const lv_area_t * area)
+{
+    uint32_t i = 0;
+    while(i < disp_refr->sync_rect_cnt) {
+        lv_area_t res[4];
+        int8_t res_c = lv_area_diff(res, &disp_refr->sync_rects[i], area);
+        if(res_c < 0) {
+            i++;
             continue;
         }
-#if LV_DRAW_TRANSFORM_USE_MATRIX
-        if(lv_display_get_matrix_rotation(disp_refr)) {
-            lv_display_rotate_area(disp_refr, sync_area);
+
+        /*Replace the sync area with its remaining parts. There is always space for the first one.*/
+        if(res_c == 0) {
+            disp_refr->sync_rect_cnt--;
+            disp_refr->sync_rects[i] = disp_refr->sync_rects[disp_refr->sync_rect_cnt];
+            continue;
+        }
+
+        disp_refr->sync_rects[i] = res[0];
+        i++;
+        int8_t j;
+        for(j = 1; j < res_c; j++) {
+            /*If there is no memory copy a larger area*/
+            if(!sync_add_rect(&res[j], disp_refr->sync_rect_cnt)) {
+                lv_area_t * last = &disp_refr->sync_rects[i - 1];
+                lv_area_join(last, last, &res[j]);
+            }
         }
-#endif
-        lv_draw_buf_copy(off_screen, sync_area, on_screen, sync_area);
-        if(off_screen2 != on_screen)
-            lv_draw_buf_copy(off_screen2, sync_area, on_screen, sync_area);
     }
+}
 
-    /*Clear sync areas*/
-    lv_ll_clear(&disp_refr->sync_areas);
-    LV_PROFILER_REFR_END;
+/**
+ * Join the neighboring sync areas with the same width or height
+ * to copy them with fewer and longer `lv_memcpy`s
+ */
+static void sync_merge_rects(void)
+{
+    lv_area_t * rects = disp_refr->sync_rects;
+    bool merged;
+    do {
+        merged = false;
+        uint32_t i;
+        for(i = 0; i < disp_refr->sync_rect_cnt; i++) {
+            uint32_t j = i + 1;
+            while(j < disp_refr->sync_rect_cnt) {
+                lv_area_t * a = &rects[i];
+                lv_area_t * b = &rects[j];
+                bool same_cols = a->x1 == b->x1 && a->x2 == b->x2 && (a->y2 + 1 == b->y1 || b->y2 + 1 == a->y1);
+                bool same_rows = a->y1 == b->y1 && a->y2 == b->y2 && (a->x2 + 1 == b->x1 || b->x2 + 1 == a->x1);
+                if(same_cols || same_rows) {
+                    lv_area_join(a, a, b);
+                    disp_refr->sync_rect_cnt--;
+                    rects[j] = rects[disp_refr->sync_rect_cnt];
+                    merged = true;
+                }
+                else {
+                    j++;
+                }
+            }
+        }
+    } while(merged);
 }
 
 /**
@@ -1029,6 +1307,12 @@ static void refr_configured_layer(lv_layer_t * layer)
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
+#if LV_OBJ_DRAW_LIST
+    /*Build or update the draw lists before searching the top objects in them*/
+    lv_obj_draw_list_get(lv_display_get_screen_active(disp_refr));
+    if(disp_refr->prev_scr) lv_obj_draw_list_get(disp_refr->prev_scr);
+#endif
+
     /*Get the most top object which is not covered by others*/
     top_act_scr = lv_refr_get_top_obj(&layer->_clip_area, lv_display_get_screen_active(disp_refr));
     if(disp_refr->prev_scr) {
@@ -1093,22 +1377,39 @@ static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj)
         layer->recolor = lv_obj_get_style_recolor_recursive(parent, LV_PART_MAIN);
     }
 
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_t * draw_list_ori = draw_list_refr;
+    draw_list_refr = lv_obj_draw_list_get(lv_obj_get_screen(top_obj));
+#endif
+
     /*Refresh the top object and its children*/
     lv_obj_refr(layer, top_obj);
 
     /*Do until not reach the screen*/
     while(parent != NULL) {
-        bool go = false;
-        uint32_t i;
-        uint32_t child_cnt = lv_obj_get_child_count(parent);
-        for(i = 0; i < child_cnt; i++) {
-            lv_obj_t * child = parent->spec_attr->children[i];
-            if(!go) {
-                if(child == border_p) go = true;
-            }
-            else {
-                /*Refresh the objects*/
-                lv_obj_refr(layer, child);
+#if LV_OBJ_DRAW_LIST
+        /*The younger siblings follow `border_p`'s subtree in the list*/
+        uint32_t border_idx = lv_obj_draw_list_find(draw_list_refr, border_p);
+        uint32_t parent_idx = lv_obj_draw_list_find(draw_list_refr, parent);
+        if(border_idx != LV_OBJ_DRAW_LIST_NONE && parent_idx != LV_OBJ_DRAW_LIST_NONE) {
+            refr_draw_list_siblings(layer, draw_list_refr, draw_list_refr->entries[border_idx].next,
+                                    draw_list_refr->entries[parent_idx].next);
+        }
+        else
+#endif
+        {
+            bool go = false;
+            uint32_t i;
+            uint32_t child_cnt = lv_obj_get_child_count(parent);
+            for(i = 0; i < child_cnt; i++) {
+                lv_obj_t * child = parent->spec_attr->children[i];
+                if(!go) {
+                    if(child == border_p) go = true;
+                }
+                else {
+                    /*Refresh the objects*/
+                    lv_obj_refr(layer, child);
+                }
             }
         }
 
@@ -1123,9 +1424,63 @@ static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj)
         /*Go a level deeper*/
         parent = lv_obj_get_parent(parent);
     }
+
+#if LV_OBJ_DRAW_LIST
+    draw_list_refr = draw_list_ori;
+#endif
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Draw the children of an object
+ * @param layer     pointer to a layer
+ * @param obj       pointer to an object
+ */
+static void refr_obj_children(lv_layer_t * layer, lv_obj_t * obj)
+{
+#if LV_OBJ_DRAW_LIST
+    uint32_t idx = lv_obj_draw_list_find(draw_list_refr, obj);
+    if(idx != LV_OBJ_DRAW_LIST_NONE) {
+        refr_draw_list_siblings(layer, draw_list_refr, idx + 1, draw_list_refr->entries[idx].next);
+        return;
+    }
+#endif
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        lv_obj_refr(layer, child);
+    }
+}
+
+#if LV_OBJ_DRAW_LIST
+/**
+ * Draw the siblings of a draw list in an index range. The objects which are hidden or out of the
+ * clip area are skipped without touching them.
+ * @param layer     pointer to a layer
+ * @param list      pointer to a draw list
+ * @param start     index of the first sibling
+ * @param end       index after the subtree of the last sibling
+ */
+static void refr_draw_list_siblings(lv_layer_t * layer, const lv_obj_draw_list_t * list, uint32_t start,
+                                    uint32_t end)
+{
+    uint32_t i = start;
+    while(i < end) {
+        const lv_obj_draw_list_entry_t * entry = &list->entries[i];
+        i = entry->next;
+
+        if(entry->flags & (LV_OBJ_DRAW_LIST_FLAG_HIDDEN | LV_OBJ_DRAW_LIST_FLAG_CLIPPED)) continue;
+        if(!(entry->flags & LV_OBJ_DRAW_LIST_FLAG_TRANSFORMED) && !lv_area_is_on(&entry->area, &layer->_clip_area)) {
+            continue;
+        }
+
+        lv_obj_refr(layer, entry->obj);
+    }
+}
+#endif
+
 static lv_result_t layer_get_area(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type,
                                   lv_area_t * layer_area_out, lv_area_t * obj_draw_size_out)
 {
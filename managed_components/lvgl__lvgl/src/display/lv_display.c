@@ -11,6 +11,7 @@
 #include "../misc/lv_anim_private.h"
 #include "../draw/lv_draw_private.h"
 #include "../core/lv_obj_private.h"
+#include "../core/lv_obj_draw_list_private.h"
 #include "lv_display.h"
 #include "../misc/lv_math.h"
 #include "../core/lv_refr_private.h"
@@ -46,6 +47,7 @@ static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_completed(lv_anim_t * a);
 static bool is_out_anim(lv_screen_load_anim_t a);
 static void disp_event_cb(lv_event_t * e);
+static void sync_reset(lv_display_t * disp);
 
 /**********************
  *  STATIC VARIABLES
@@ -96,11 +98,19 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->layer_head->buf_area.y2 = ver_res - 1;
     disp->layer_head->color_format = disp->color_format;
 
+    disp->inv_areas = lv_malloc(LV_INV_BUF_SIZE * (sizeof(lv_area_t) + sizeof(uint8_t)));
+    LV_ASSERT_MALLOC(disp->inv_areas);
+    if(disp->inv_areas == NULL) return NULL;
+    disp->inv_area_joined = (uint8_t *)&disp->inv_areas[LV_INV_BUF_SIZE];
+    lv_memzero(disp->inv_area_joined, LV_INV_BUF_SIZE);
+    disp->inv_size = LV_INV_BUF_SIZE;
+#if LV_USE_INV_AREA_COST_MODEL
+    disp->inv_area_cost = LV_INV_AREA_COST_PX;
+#endif
+
     disp->inv_en_cnt = 1;
     disp->last_activity_time = lv_tick_get();
 
-    lv_ll_init(&disp->sync_areas, sizeof(lv_area_t));
-
     lv_display_t * disp_def_tmp = disp_def;
     disp_def                 = disp; /*Temporarily change the default screen to create the default screens on the
                                         new display*/
@@ -213,7 +223,10 @@ void lv_display_delete(lv_display_t * disp)
         lv_obj_delete(disp->screens[0]);
     }
 
-    lv_ll_clear(&disp->sync_areas);
+    uint32_t i;
+    for(i = 0; i < LV_DISPLAY_SYNC_HISTORY; i++) lv_free(disp->sync_frames[i].areas);
+    lv_free(disp->sync_rects);
+    lv_free(disp->inv_areas);
     lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
@@ -449,6 +462,7 @@ void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_d
     disp->buf_act = disp->buf_1;
 
     disp->stride_is_auto = 0;
+    sync_reset(disp);
 }
 
 void lv_display_set_3rd_draw_buffer(lv_display_t * disp, lv_draw_buf_t * buf3)
@@ -460,6 +474,7 @@ void lv_display_set_3rd_draw_buffer(lv_display_t * disp, lv_draw_buf_t * buf3)
     LV_ASSERT_MSG(disp->buf_2 != NULL, "buf2 is null");
 
     disp->buf_3 = buf3;
+    sync_reset(disp);
 }
 
 void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint32_t buf_size,
@@ -533,6 +548,7 @@ void lv_display_set_render_mode(lv_display_t * disp, lv_display_render_mode_t re
     if(disp == NULL) disp = lv_display_get_default();
     if(disp == NULL) return;
     disp->render_mode = render_mode;
+    sync_reset(disp);
 }
 
 void lv_display_set_flush_cb(lv_display_t * disp, lv_display_flush_cb_t flush_cb)
@@ -1046,6 +1062,30 @@ bool lv_display_is_invalidation_enabled(lv_display_t * disp)
     return (disp->inv_en_cnt > 0);
 }
 
+#if LV_USE_INV_AREA_COST_MODEL
+void lv_display_set_inv_area_cost(lv_display_t * disp, uint32_t cost_px)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        LV_LOG_WARN("no display registered");
+        return;
+    }
+
+    disp->inv_area_cost = cost_px;
+}
+
+uint32_t lv_display_get_inv_area_cost(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        LV_LOG_WARN("no display registered");
+        return 0;
+    }
+
+    return disp->inv_area_cost;
+}
+#endif
+
 lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp)
 {
     if(!disp) disp = lv_display_get_default();
@@ -1268,8 +1308,11 @@ static void update_resolution(lv_display_t * disp)
     lv_area_set_height(&disp->bottom_layer->coords, ver_res);
     lv_obj_send_event(disp->bottom_layer, LV_EVENT_SIZE_CHANGED, &prev_coords);
 
-    lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
-    lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
+#if LV_OBJ_DRAW_LIST
+    lv_obj_draw_list_geometry_changed(NULL);
+#endif
+
+    lv_memzero(disp->inv_area_joined, disp->inv_size);
     disp->inv_p = 0;
     lv_obj_invalidate(disp->sys_layer);
 
@@ -1370,3 +1413,16 @@ static void disp_event_cb(lv_event_t * e)
             break;
     }
 }
+
+/**
+ * Forget the redrawn areas and consider the buffers synchronized.
+ * Called when the buffers or the render mode change.
+ */
+static void sync_reset(lv_display_t * disp)
+{
+    uint32_t i;
+    for(i = 0; i < LV_DISPLAY_SYNC_HISTORY; i++) disp->sync_frames[i].area_cnt = 0;
+    lv_memzero(disp->sync_buf_frame, sizeof(disp->sync_buf_frame));
+    disp->sync_frame_id = 0;
+    disp->sync_rect_cnt = 0;
+}
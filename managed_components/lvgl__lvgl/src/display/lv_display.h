@@ -595,6 +595,24 @@ void lv_display_enable_invalidation(lv_display_t * disp, bool en);
  */
 bool lv_display_is_invalidation_enabled(lv_display_t * disp);
 
+#if LV_USE_INV_AREA_COST_MODEL
+/**
+ * Set the fixed cost of rendering an invalidated area separately.
+ * Two areas are joined if rendering their bounding box is not more expensive
+ * than rendering them separately. A higher cost results in fewer, larger areas.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param cost_px   the overhead of an area (e.g. collecting the widgets, flushing) in pixels
+ */
+void lv_display_set_inv_area_cost(lv_display_t * disp, uint32_t cost_px);
+
+/**
+ * Get the fixed cost of rendering an invalidated area separately.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the overhead of an area in pixels
+ */
+uint32_t lv_display_get_inv_area_cost(lv_display_t * disp);
+#endif
+
 /**
  * Get a pointer to the screen refresher timer to
  * modify its parameters with `lv_timer_...` functions.
@@ -29,10 +29,21 @@ extern "C" {
 #define LV_INV_BUF_SIZE 32 /**< Buffer size for invalid areas */
 #endif
 
+#ifndef LV_DISPLAY_SYNC_HISTORY
+#define LV_DISPLAY_SYNC_HISTORY 3 /**< Number of frames whose redrawn areas are kept to sync the buffers in direct mode */
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/** Areas redrawn in a frame in double or triple buffered direct mode */
+typedef struct {
+    lv_area_t * areas;      /**< NULL if couldn't be allocated, meaning the whole screen*/
+    uint32_t area_cnt;
+    uint32_t area_size;
+} lv_display_sync_frame_t;
+
 struct _lv_display_t {
 
     /*---------------------
@@ -102,13 +113,24 @@ struct _lv_display_t {
     lv_color_format_t   color_format;
 
     /** Invalidated (marked to redraw) areas*/
-    lv_area_t inv_areas[LV_INV_BUF_SIZE];
-    uint8_t inv_area_joined[LV_INV_BUF_SIZE];
+    lv_area_t * inv_areas;
+    uint8_t * inv_area_joined;  /**< Stored after `inv_areas` in the same allocation*/
     uint32_t inv_p;
+    uint32_t inv_size;          /**< Number of areas `inv_areas` can store*/
     int32_t inv_en_cnt;
+#if LV_USE_INV_AREA_COST_MODEL
+    uint32_t inv_area_cost;     /**< Fixed cost of rendering an area in pixels*/
+#endif
 
-    /** Double buffer sync areas (redrawn during last refresh) */
-    lv_ll_t sync_areas;
+    /** Double buffer sync: the areas redrawn in the last few frames.
+     * Before rendering into a buffer the areas it has missed are copied from the most recent buffer.*/
+    lv_display_sync_frame_t sync_frames[LV_DISPLAY_SYNC_HISTORY];
+    uint32_t sync_frame_id;         /**< Id of the last rendered frame, it's the index of `sync_frames` too*/
+    uint32_t sync_buf_frame[3];     /**< Id of the frame rendered last time into `buf_1`, `buf_2` and `buf_3`*/
+    lv_area_t * sync_rects;         /**< Disjoint areas to copy in the current refresh*/
+    uint32_t sync_rect_cnt;
+    uint32_t sync_rect_size;
+    uint32_t sync_copy_size;        /**< Bytes copied by the last synchronization*/
 
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
@@ -16,10 +16,12 @@
 #include "lv_draw_private.h"
 #include "lv_draw_mask_private.h"
 #include "lv_draw_vector_private.h"
+#include "lv_draw_label_private.h"
 #include "lv_draw_3d.h"
 #include "sw/lv_draw_sw.h"
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
+#include "../misc/cache/lv_cache.h"
 #include "../core/lv_refr_private.h"
 #include "../stdlib/lv_string.h"
 
@@ -64,6 +66,14 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    lv_draw_label_cache_init();
+#endif
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+    lv_grad_cache_init(LV_GRADIENT_CACHE_SIZE);
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -81,6 +91,14 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    lv_draw_label_cache_deinit();
+#endif
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+    lv_grad_cache_deinit();
+#endif
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -102,7 +120,9 @@ lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords,
     LV_PROFILER_DRAW_BEGIN;
     size_t dsc_size = get_draw_dsc_size(type);
     LV_ASSERT_FORMAT_MSG(dsc_size > 0, "Draw task size is 0 for type %d", type);
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_DRAW);
     lv_draw_task_t * new_task = lv_malloc_zeroed(LV_ALIGN_UP(sizeof(lv_draw_task_t), 8) + dsc_size);
+    LV_MEM_TRACE_TAG_END();
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -214,6 +234,7 @@ void lv_draw_wait_for_finish(void)
 void lv_draw_dispatch(void)
 {
     LV_PROFILER_DRAW_BEGIN;
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_DRAW);
     bool task_dispatched = false;
     lv_display_t * disp = lv_refr_get_disp_refreshing();
     if(disp != NULL) {
@@ -228,6 +249,7 @@ void lv_draw_dispatch(void)
         lv_draw_wait_for_finish();
         lv_draw_dispatch_request();
     }
+    LV_MEM_TRACE_TAG_END();
     LV_PROFILER_DRAW_END;
 }
 
@@ -429,7 +451,9 @@ void lv_layer_reset(lv_layer_t * layer)
 lv_layer_t * lv_draw_layer_create(lv_layer_t * parent_layer, lv_color_format_t color_format, const lv_area_t * area)
 {
     LV_PROFILER_DRAW_BEGIN;
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_DRAW);
     lv_layer_t * new_layer = lv_malloc_zeroed(sizeof(lv_layer_t));
+    LV_MEM_TRACE_TAG_END();
     LV_ASSERT_MALLOC(new_layer);
     if(new_layer == NULL) {
         LV_PROFILER_DRAW_END;
@@ -498,7 +522,9 @@ void * lv_draw_layer_alloc_buf(lv_layer_t * layer)
     }
 #endif
 
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_DRAW);
     layer->draw_buf = lv_draw_buf_create(w, h, layer->color_format, 0);
+    LV_MEM_TRACE_TAG_END();
 
     if(layer->draw_buf == NULL) {
         LV_LOG_WARN("Allocating layer buffer failed. Try later");
@@ -618,6 +618,13 @@ static void buf_copy(lv_draw_buf_t * dest, const lv_area_t * dest_area,
     uint32_t src_stride = src->header.stride;
     uint32_t line_bytes = (line_width * lv_color_format_get_bpp(dest->header.cf) + 7) >> 3;
 
+    /*Whole lines without padding are continuous so copy them at once*/
+    if(line_bytes == dest_stride && line_bytes == src_stride) {
+        lv_memcpy(dest_bufc, src_bufc, line_bytes * (end_y - start_y + 1));
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+
     for(; start_y <= end_y; start_y++) {
         lv_memcpy(dest_bufc, src_bufc, line_bytes);
         dest_bufc += dest_stride;
@@ -28,6 +28,7 @@
 #define LV_LABEL_HINT_UPDATE_TH 1024 /*Update the "hint" if the label's y coordinates have changed more then this*/
 
 #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#define label_cache_p (LV_GLOBAL_DEFAULT()->draw_label_cache)
 
 /**********************
  *      TYPEDEFS
@@ -39,11 +40,36 @@ enum {
 };
 typedef unsigned char cmd_state_t;
 
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+/*Passed to `label_cache_create_cb`*/
+typedef struct {
+    lv_draw_task_t * t;
+    const lv_draw_label_dsc_t * dsc;
+    const lv_area_t * coords;
+} label_cache_create_ctx_t;
+
+/*The target of `coverage_cb`. The layer is the first to get the context from the draw task*/
+typedef struct {
+    lv_layer_t layer;
+    bool failed;
+} coverage_ctx_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint8_t hex_char_to_num(char hex);
 
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    static lv_cache_compare_res_t label_cache_compare_cb(const lv_draw_label_cache_data_t * lhs,
+                                                         const lv_draw_label_cache_data_t * rhs);
+    static bool label_cache_create_cb(lv_draw_label_cache_data_t * data, label_cache_create_ctx_t * ctx);
+    static void label_cache_free_cb(lv_draw_label_cache_data_t * data, void * user_data);
+    static void coverage_cb(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_dsc, lv_draw_fill_dsc_t * fill_dsc,
+                            const lv_area_t * fill_area);
+    static void coverage_add(coverage_ctx_t * ctx, const uint8_t * src, int32_t src_stride, const lv_area_t * src_area);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -562,6 +588,110 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+
+void lv_draw_label_cache_init(void)
+{
+    label_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_draw_label_cache_data_t), LV_DRAW_LABEL_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) label_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) label_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) label_cache_free_cb,
+    });
+
+    lv_cache_set_name(label_cache_p, "LABEL");
+}
+
+void lv_draw_label_cache_deinit(void)
+{
+    if(label_cache_p == NULL) return;
+
+    lv_cache_destroy(label_cache_p, NULL);
+    label_cache_p = NULL;
+}
+
+lv_cache_entry_t * lv_draw_label_cache_acquire(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc,
+                                               const lv_area_t * coords)
+{
+    if(label_cache_p == NULL) return NULL;
+    if(!dsc->cache_coverage || dsc->base.obj == NULL || dsc->text_local) return NULL;
+    if(dsc->rotation != 0 || dsc->outline_stroke_width > 0) return NULL;
+    if(dsc->flag & LV_TEXT_FLAG_RECOLOR) return NULL;
+    if(dsc->sel_start != LV_DRAW_LABEL_NO_TXT_SEL && dsc->sel_end != LV_DRAW_LABEL_NO_TXT_SEL) return NULL;
+
+    lv_draw_label_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.owner = dsc->base.obj;
+    search_key.params.font = dsc->font;
+    search_key.params.text = dsc->text;
+    search_key.params.w = lv_area_get_width(coords);
+    search_key.params.h = lv_area_get_height(coords);
+    search_key.params.ofs_x = dsc->ofs_x;
+    search_key.params.ofs_y = dsc->ofs_y;
+    search_key.params.letter_space = dsc->letter_space;
+    search_key.params.line_space = dsc->line_space;
+    search_key.params.align = dsc->align;
+    search_key.params.bidi_dir = dsc->bidi_dir;
+    search_key.params.flag = dsc->flag;
+    search_key.params.decor = dsc->decor;
+
+    /*Leave room for the letters reaching out of the label like `LV_EVENT_REFR_EXT_DRAW_SIZE` of the labels*/
+    search_key.ext = lv_font_get_line_height(dsc->font) / 4;
+    uint32_t w = search_key.params.w + 2 * search_key.ext;
+    uint32_t h = search_key.params.h + 2 * search_key.ext;
+    search_key.slot.size = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8) * h;
+
+    /*Don't let a few large labels evict all the others*/
+    if(search_key.slot.size > LV_DRAW_LABEL_CACHE_SIZE / 4) return NULL;
+
+    label_cache_create_ctx_t ctx = {t, dsc, coords};
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(label_cache_p, &search_key, &ctx);
+    if(entry == NULL) return NULL;
+
+    lv_draw_label_cache_data_t * data = lv_cache_entry_get_data(entry);
+    if(lv_memcmp(&data->params, &search_key.params, sizeof(search_key.params)) == 0) return entry;
+
+    /*The label has changed since it was cached, render it again*/
+    lv_cache_release(label_cache_p, entry, NULL);
+    lv_cache_drop(label_cache_p, &search_key, NULL);
+    entry = lv_cache_acquire_or_create(label_cache_p, &search_key, &ctx);
+    if(entry == NULL) return NULL;
+
+    /*Another draw unit has cached the same Widget with other parameters in the meantime*/
+    data = lv_cache_entry_get_data(entry);
+    if(lv_memcmp(&data->params, &search_key.params, sizeof(search_key.params)) != 0) {
+        lv_cache_release(label_cache_p, entry, NULL);
+        return NULL;
+    }
+
+    return entry;
+}
+
+void lv_draw_label_cache_release(lv_cache_entry_t * entry)
+{
+    lv_cache_release(label_cache_p, entry, NULL);
+}
+
+#endif /*LV_DRAW_LABEL_CACHE_SIZE > 0*/
+
+void lv_draw_label_cache_drop(const void * owner)
+{
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    if(label_cache_p == NULL) return;
+
+    if(owner == NULL) {
+        lv_cache_drop_all(label_cache_p, NULL);
+        return;
+    }
+
+    lv_draw_label_cache_data_t search_key;
+    search_key.owner = owner;
+    lv_cache_drop(label_cache_p, &search_key, NULL);
+#else
+    LV_UNUSED(owner);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -578,6 +708,167 @@ static uint8_t hex_char_to_num(char hex)
     return 'A' <= hex && hex <= 'F' ? hex - 'A' + 10 : 0;
 }
 
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+
+static lv_cache_compare_res_t label_cache_compare_cb(const lv_draw_label_cache_data_t * lhs,
+                                                     const lv_draw_label_cache_data_t * rhs)
+{
+    if(lhs->owner == rhs->owner) return 0;
+    return lhs->owner > rhs->owner ? 1 : -1;
+}
+
+static bool label_cache_create_cb(lv_draw_label_cache_data_t * data, label_cache_create_ctx_t * ctx)
+{
+    lv_area_t area = *ctx->coords;
+    lv_area_increase(&area, data->ext, data->ext);
+
+    lv_draw_buf_t * coverage = lv_draw_buf_create(lv_area_get_width(&area), lv_area_get_height(&area),
+                                                  LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(coverage == NULL) return false;
+    lv_draw_buf_clear(coverage, NULL);
+
+    /*Render the whole label, not only the clip area of the task*/
+    coverage_ctx_t cov_ctx;
+    lv_memzero(&cov_ctx, sizeof(cov_ctx));
+    cov_ctx.layer.draw_buf = coverage;
+    cov_ctx.layer.color_format = LV_COLOR_FORMAT_A8;
+    cov_ctx.layer.buf_area = area;
+    cov_ctx.layer.phy_clip_area = area;
+    cov_ctx.layer._clip_area = area;
+
+    lv_draw_task_t cov_task;
+    lv_memcpy(&cov_task, ctx->t, sizeof(cov_task));
+    cov_task.clip_area = area;
+    cov_task.target_layer = &cov_ctx.layer;
+
+    lv_draw_label_dsc_t cov_dsc;
+    lv_memcpy(&cov_dsc, ctx->dsc, sizeof(cov_dsc));
+    cov_dsc.hint = NULL;
+
+    lv_draw_label_iterate_characters(&cov_task, &cov_dsc, ctx->coords, coverage_cb);
+
+    if(cov_ctx.failed) {
+        lv_draw_buf_destroy(coverage);
+        return false;
+    }
+
+    data->coverage = coverage;
+    return true;
+}
+
+static void label_cache_free_cb(lv_draw_label_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    if(data->coverage) lv_draw_buf_destroy(data->coverage);
+    data->coverage = NULL;
+}
+
+/**
+ * Collect the coverage of the glyphs and underlines into an A8 buffer instead of blending them.
+ * Only A1..A8 bitmap glyphs can be collected, anything else makes the label uncacheable.
+ */
+static void coverage_cb(lv_draw_task_t * t, lv_draw_glyph_dsc_t * glyph_dsc, lv_draw_fill_dsc_t * fill_dsc,
+                        const lv_area_t * fill_area)
+{
+    coverage_ctx_t * ctx = (coverage_ctx_t *)t->target_layer;
+
+    if(glyph_dsc) {
+        switch(glyph_dsc->format) {
+            case LV_FONT_GLYPH_FORMAT_NONE: {
+#if LV_USE_FONT_PLACEHOLDER
+                    /*The 1 px wide border of the placeholder*/
+                    const lv_area_t * bg = glyph_dsc->bg_coords;
+                    if(bg == NULL) break;
+                    lv_area_t edge = *bg;
+                    edge.y2 = bg->y1;
+                    coverage_add(ctx, NULL, 0, &edge);
+                    edge.y1 = bg->y2;
+                    edge.y2 = bg->y2;
+                    coverage_add(ctx, NULL, 0, &edge);
+                    edge.y1 = bg->y1;
+                    edge.x2 = bg->x1;
+                    coverage_add(ctx, NULL, 0, &edge);
+                    edge.x1 = bg->x2;
+                    edge.x2 = bg->x2;
+                    coverage_add(ctx, NULL, 0, &edge);
+#endif
+                }
+                break;
+            case LV_FONT_GLYPH_FORMAT_A1:
+            case LV_FONT_GLYPH_FORMAT_A2:
+            case LV_FONT_GLYPH_FORMAT_A3:
+            case LV_FONT_GLYPH_FORMAT_A4:
+            case LV_FONT_GLYPH_FORMAT_A8: {
+                    if(lv_font_has_static_bitmap(glyph_dsc->g->resolved_font) &&
+                       glyph_dsc->g->format == LV_FONT_GLYPH_FORMAT_A8) {
+                        glyph_dsc->g->req_raw_bitmap = 1;
+                        const uint8_t * bitmap = lv_font_get_glyph_static_bitmap(glyph_dsc->g);
+                        coverage_add(ctx, bitmap, glyph_dsc->g->stride, glyph_dsc->letter_coords);
+                    }
+                    else {
+                        const lv_draw_buf_t * draw_buf = lv_font_get_glyph_bitmap(glyph_dsc->g, glyph_dsc->_draw_buf);
+                        if(draw_buf == NULL) {
+                            ctx->failed = true;
+                            break;
+                        }
+                        coverage_add(ctx, draw_buf->data, draw_buf->header.stride, glyph_dsc->letter_coords);
+                    }
+                }
+                break;
+            default:
+                ctx->failed = true;
+                break;
+        }
+    }
+
+    if(fill_dsc && fill_area) {
+        coverage_add(ctx, NULL, 0, fill_area);
+    }
+}
+
+/**
+ * Add a coverage map to the coverage of the label as if they were blended on each other.
+ * @param ctx           the coverage context
+ * @param src           A8 coverage of `src_area` or NULL to fully cover it
+ * @param src_stride    stride of `src` in bytes. 0: use the width of `src_area`
+ * @param src_area      the absolute coordinates of `src`
+ */
+static void coverage_add(coverage_ctx_t * ctx, const uint8_t * src, int32_t src_stride, const lv_area_t * src_area)
+{
+    const lv_area_t * buf_area = &ctx->layer.buf_area;
+    lv_area_t area;
+    if(!lv_area_intersect(&area, src_area, buf_area)) return;
+
+    lv_draw_buf_t * buf = ctx->layer.draw_buf;
+    uint32_t stride = buf->header.stride;
+    int32_t w = lv_area_get_width(&area);
+    if(src_stride == 0) src_stride = lv_area_get_width(src_area);
+
+    uint8_t * dest = buf->data + (area.y1 - buf_area->y1) * stride + (area.x1 - buf_area->x1);
+    if(src) src += (area.y1 - src_area->y1) * src_stride + (area.x1 - src_area->x1);
+
+    int32_t y;
+    for(y = area.y1; y <= area.y2; y++) {
+        if(src == NULL) {
+            lv_memset(dest, 0xff, w);
+        }
+        else {
+            int32_t x;
+            for(x = 0; x < w; x++) {
+                uint32_t s = src[x];
+                if(s == 0) continue;
+                uint32_t d = dest[x];
+                dest[x] = d == 0 ? s : (uint8_t)(d + s - LV_UDIV255(d * s));
+            }
+            src += src_stride;
+        }
+        dest += stride;
+    }
+}
+
+#endif /*LV_DRAW_LABEL_CACHE_SIZE > 0*/
+
 void lv_draw_unit_draw_letter(lv_draw_task_t * t, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                               const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb)
 {
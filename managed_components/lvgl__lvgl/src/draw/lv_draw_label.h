@@ -104,6 +104,10 @@ typedef struct {
      * 0: has not been executed lv_bidi_process_paragraph.*/
     uint8_t has_bided : 1;
 
+    /**1: the rendered coverage of the whole text can be cached (see `LV_DRAW_LABEL_CACHE_SIZE`).
+     * `base.obj` identifies the cached text so it needs to be set too.*/
+    uint8_t cache_coverage : 1;
+
     /**Pointer to an externally stored struct where some data can be cached to speed up rendering*/
     lv_draw_label_hint_t * hint;
 
@@ -218,6 +222,14 @@ void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_letter(lv_layer_t * layer, lv_draw_lett
 void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc,
                                       const lv_area_t * coords, lv_draw_glyph_cb_t cb);
 
+/**
+ * Drop the cached coverage of a label, e.g. because its text, style or size has changed.
+ * Does nothing if `LV_DRAW_LABEL_CACHE_SIZE` is 0.
+ * @param owner         the Widget whose label is cached (`base.obj` of the label draw descriptor),
+ *                      or NULL to drop all the cached labels
+ */
+void lv_draw_label_cache_drop(const void * owner);
+
 /**
  * @brief Draw a single letter using the provided draw unit, glyph descriptor, position, font, and callback.
  *
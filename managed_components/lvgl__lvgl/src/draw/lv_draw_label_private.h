@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_draw_label.h"
+#include "../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
@@ -58,11 +59,76 @@ struct _lv_draw_glyph_dsc_t {
     lv_draw_buf_t * _draw_buf; /**< a shared draw buf for get_bitmap, do not use it directly, use glyph_data instead */
 };
 
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+
+/** The parameters the cached coverage of a label was rendered with*/
+typedef struct {
+    const lv_font_t * font;
+    const char * text;
+    int32_t w;
+    int32_t h;
+    int32_t ofs_x;
+    int32_t ofs_y;
+    int32_t letter_space;
+    int32_t line_space;
+    lv_text_align_t align;
+    lv_base_dir_t bidi_dir;
+    lv_text_flag_t flag;
+    lv_text_decor_t decor;
+} lv_draw_label_cache_params_t;
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    /** The Widget drawing the label, it's the key of the cache*/
+    const void * owner;
+    lv_draw_label_cache_params_t params;
+
+    /** A8 coverage of the whole text. It's larger than the label's coordinates with `ext` on each side
+     *  to hold the letters reaching out of the label (e.g. italic fonts)*/
+    lv_draw_buf_t * coverage;
+    int32_t ext;
+} lv_draw_label_cache_data_t;
+
+#endif /*LV_DRAW_LABEL_CACHE_SIZE > 0*/
+
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+
+/**
+ * Create the cache of the label coverages. Called by `lv_draw_init()`.
+ */
+void lv_draw_label_cache_init(void);
+
+/**
+ * Delete the cache of the label coverages. Called by `lv_draw_deinit()`.
+ */
+void lv_draw_label_cache_deinit(void);
+
+/**
+ * Get the cached coverage of a label, or render and cache it if it's not cached yet.
+ * @param t         pointer to the draw task of the label
+ * @param dsc       pointer to the draw descriptor of the label. Only the ones with `cache_coverage`
+ *                  and without selection, recolor, rotation and outline can be cached.
+ * @param coords    the coordinates of the label
+ * @return          the cache entry with an `lv_draw_label_cache_data_t`
+ *                  or NULL if the label can't be cached. Release it with `lv_draw_label_cache_release()`.
+ */
+lv_cache_entry_t * lv_draw_label_cache_acquire(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc,
+                                               const lv_area_t * coords);
+
+/**
+ * Release a cache entry returned by `lv_draw_label_cache_acquire()`
+ * @param entry     pointer to a cache entry
+ */
+void lv_draw_label_cache_release(lv_cache_entry_t * entry);
+
+#endif /*LV_DRAW_LABEL_CACHE_SIZE > 0*/
+
 /**********************
  *      MACROS
  **********************/
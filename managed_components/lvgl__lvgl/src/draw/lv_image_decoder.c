@@ -150,7 +150,9 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
      * If decoder open failed, free the source and return error.
      * If decoder open succeed, add the image to cache if enabled.
      * */
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_IMAGE_CACHE);
     lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
+    LV_MEM_TRACE_TAG_END();
 
     if(res == LV_RESULT_OK && dsc->decoded != NULL) {
         LV_ASSERT_MSG(dsc->decoded->unaligned_data && dsc->decoded->handlers, "Invalid draw buffer");
@@ -176,7 +178,9 @@ lv_result_t lv_image_decoder_get_area(lv_image_decoder_dsc_t * dsc, const lv_are
                                       lv_area_t * decoded_area)
 {
     lv_result_t res = LV_RESULT_INVALID;
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_IMAGE_CACHE);
     if(dsc->decoder->get_area_cb) res = dsc->decoder->get_area_cb(dsc->decoder, dsc, full_area, decoded_area);
+    LV_MEM_TRACE_TAG_END();
 
     return res;
 }
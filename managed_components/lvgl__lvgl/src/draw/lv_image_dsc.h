@@ -43,7 +43,8 @@ typedef enum _lvimage_flags_t {
     /**
      * The image data is compressed, so decoder needs to decode image firstly.
      * If this flag is set, the whole image will be decompressed upon decode, and
-     * `get_area_cb` won't be necessary.
+     * `get_area_cb` won't be necessary, unless the image is compressed in blocks of rows.
+     * Such images are decompressed block by block in `get_area_cb`.
      */
     LV_IMAGE_FLAGS_COMPRESSED       = 0x0008,
 
@@ -383,6 +383,7 @@ static void render_thread_cb(void * ptr)
 static void execute_drawing(lv_draw_task_t * t)
 {
     LV_PROFILER_DRAW_BEGIN;
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_DRAW);
     /*Render the draw task*/
     switch(t->type) {
         case LV_DRAW_TASK_TYPE_FILL:
@@ -427,7 +428,7 @@ static void execute_drawing(lv_draw_task_t * t)
             break;
     }
 
-
+    LV_MEM_TRACE_TAG_END();
     LV_PROFILER_DRAW_END;
 }
 
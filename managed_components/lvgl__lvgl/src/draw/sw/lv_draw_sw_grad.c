@@ -12,6 +12,8 @@
 #include "../../misc/lv_types.h"
 #include "../../osal/lv_os_private.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -30,6 +32,23 @@
  *      TYPEDEFS
  **********************/
 
+#if LV_GRADIENT_CACHE_SIZE > 0
+
+/*Everything the color table of `lv_draw_sw_grad_get()` is computed from*/
+typedef struct {
+    uint32_t size;
+    uint32_t stops_count;
+    lv_grad_stop_t stops[LV_GRADIENT_MAX_STOPS];
+} grad_cache_key_t;
+
+/*Passed to `grad_build_cb`*/
+typedef struct {
+    const lv_grad_dsc_t * g;
+    uint32_t size;
+} grad_build_ctx_t;
+
+#endif
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 typedef struct {
@@ -73,7 +92,15 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 typedef lv_result_t (*op_cache_t)(lv_draw_sw_grad_calc_t * c, void * ctx);
-static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static uint32_t get_item_size(const lv_grad_dsc_t * g, int32_t w, int32_t h);
+static size_t get_item_req_size(uint32_t size);
+static lv_draw_sw_grad_calc_t * init_item(void * buf, uint32_t size);
+static void fill_item(const lv_grad_dsc_t * g, lv_draw_sw_grad_calc_t * item);
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+    static lv_draw_sw_grad_calc_t * cache_get_item(const lv_grad_dsc_t * g, uint32_t size);
+    static void grad_build_cb(void * table, lv_cache_entry_t * entry, void * user_data);
+#endif
 
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
@@ -89,36 +116,75 @@ static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w
  *   STATIC FUNCTIONS
  **********************/
 
-static lv_draw_sw_grad_calc_t * allocate_item(const lv_grad_dsc_t * g, int32_t w, int32_t h)
+static uint32_t get_item_size(const lv_grad_dsc_t * g, int32_t w, int32_t h)
 {
-    int32_t size;
     switch(g->dir) {
         case LV_GRAD_DIR_HOR:
         case LV_GRAD_DIR_LINEAR:
         case LV_GRAD_DIR_RADIAL:
         case LV_GRAD_DIR_CONICAL:
-            size = w;
-            break;
+            return w;
         case LV_GRAD_DIR_VER:
-            size = h;
-            break;
+            return h;
         default:
-            size = 64;
+            return 64;
     }
+}
 
-    size_t req_size = ALIGN(sizeof(lv_draw_sw_grad_calc_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(
-                                                                                                           lv_opa_t));
-    lv_draw_sw_grad_calc_t * item  = lv_malloc(req_size);
-    LV_ASSERT_MALLOC(item);
-    if(item == NULL) return NULL;
+static size_t get_item_req_size(uint32_t size)
+{
+    return ALIGN(sizeof(lv_draw_sw_grad_calc_t)) + ALIGN(size * sizeof(lv_color_t)) + ALIGN(size * sizeof(lv_opa_t));
+}
 
-    uint8_t * p = (uint8_t *)item;
+static lv_draw_sw_grad_calc_t * init_item(void * buf, uint32_t size)
+{
+    lv_draw_sw_grad_calc_t * item = buf;
+    uint8_t * p = buf;
     item->color_map = (lv_color_t *)(p + ALIGN(sizeof(*item)));
     item->opa_map = (lv_opa_t *)(p + ALIGN(sizeof(*item)) + ALIGN(size * sizeof(lv_color_t)));
     item->size = size;
+    item->cache_entry = NULL;
     return item;
 }
 
+static void fill_item(const lv_grad_dsc_t * g, lv_draw_sw_grad_calc_t * item)
+{
+    uint32_t i;
+    for(i = 0; i < item->size; i++) {
+        lv_draw_sw_grad_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
+    }
+}
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+
+static lv_draw_sw_grad_calc_t * cache_get_item(const lv_grad_dsc_t * g, uint32_t size)
+{
+    /*The table depends only on the stops and its size*/
+    grad_cache_key_t key;
+    lv_memzero(&key, sizeof(key));
+    key.size = size;
+    key.stops_count = g->stops_count;
+    lv_memcpy(key.stops, g->stops, g->stops_count * sizeof(lv_grad_stop_t));
+
+    grad_build_ctx_t ctx = {g, size};
+    uint32_t key_size = offsetof(grad_cache_key_t, stops) + g->stops_count * sizeof(lv_grad_stop_t);
+    lv_cache_entry_t * entry = lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_SW, &key, key_size,
+                                                     get_item_req_size(size), grad_build_cb, &ctx);
+    if(entry == NULL) return NULL;
+
+    return lv_grad_cache_entry_get_table(entry);
+}
+
+static void grad_build_cb(void * table, lv_cache_entry_t * entry, void * user_data)
+{
+    grad_build_ctx_t * ctx = user_data;
+    lv_draw_sw_grad_calc_t * item = init_item(table, ctx->size);
+    fill_item(ctx->g, item);
+    item->cache_entry = entry;
+}
+
+#endif /*LV_GRADIENT_CACHE_SIZE > 0*/
+
 #if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
 
 static inline int32_t extend_w(int32_t w, lv_grad_extend_t extend)
@@ -147,18 +213,23 @@ lv_draw_sw_grad_calc_t * lv_draw_sw_grad_get(const lv_grad_dsc_t * g, int32_t w,
     /* No gradient, no cache */
     if(g->dir == LV_GRAD_DIR_NONE) return NULL;
 
-    /* Step 1: Search cache for the given key */
-    lv_draw_sw_grad_calc_t * item = allocate_item(g, w, h);
-    if(item == NULL) {
+    uint32_t size = get_item_size(g, w, h);
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+    lv_draw_sw_grad_calc_t * cached = cache_get_item(g, size);
+    if(cached) return cached;
+#endif
+
+    /*Not cached, use a private table*/
+    void * buf = lv_malloc(get_item_req_size(size));
+    LV_ASSERT_MALLOC(buf);
+    if(buf == NULL) {
         LV_LOG_WARN("Failed to allocate item for the gradient");
-        return item;
+        return NULL;
     }
 
-    /* Step 3: Fill it with the gradient, as expected */
-    uint32_t i;
-    for(i = 0; i < item->size; i++) {
-        lv_draw_sw_grad_color_calculate(g, item->size, i, &item->color_map[i], &item->opa_map[i]);
-    }
+    lv_draw_sw_grad_calc_t * item = init_item(buf, size);
+    fill_item(g, item);
     return item;
 }
 
@@ -217,6 +288,13 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_grad_color_calculate(const lv_grad_dsc_t *
 
 void lv_draw_sw_grad_cleanup(lv_draw_sw_grad_calc_t * grad)
 {
+#if LV_GRADIENT_CACHE_SIZE > 0
+    if(grad->cache_entry) {
+        lv_grad_cache_release(grad->cache_entry);
+        return;
+    }
+#endif
+
     lv_free(grad);
 }
 
@@ -492,7 +570,7 @@ void lv_draw_sw_grad_linear_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_draw_sw_grad_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -564,7 +642,7 @@ void lv_draw_sw_grad_conical_cleanup(lv_grad_dsc_t * dsc)
     if(state == NULL)
         return;
     if(state->cgrad)
-        lv_free(state->cgrad);
+        lv_draw_sw_grad_cleanup(state->cgrad);
     lv_free(state);
 }
 
@@ -30,6 +30,7 @@ typedef struct {
     lv_color_t   *  color_map;
     lv_opa_t   *  opa_map;
     uint32_t size;
+    lv_cache_entry_t * cache_entry; /**< The entry of the table in the gradient cache or NULL if not cached*/
 } lv_draw_sw_grad_calc_t;
 
 
@@ -53,7 +54,8 @@ void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_grad_color_calculate(const lv_grad_d
 lv_draw_sw_grad_calc_t * lv_draw_sw_grad_get(const lv_grad_dsc_t * gradient, int32_t w, int32_t h);
 
 /**
- * Clean up the gradient item after it was get with `lv_grad_get_from_cache`.
+ * Clean up the gradient item after it was get with `lv_draw_sw_grad_get`.
+ * Releases the table if it's in the gradient cache, frees it otherwise.
  * @param grad      pointer to a gradient
  */
 void lv_draw_sw_grad_cleanup(lv_draw_sw_grad_calc_t * grad);
@@ -118,6 +118,31 @@ void lv_draw_sw_label(lv_draw_task_t * t, const lv_draw_label_dsc_t * dsc, const
     }
 #endif
 
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    lv_cache_entry_t * entry = lv_draw_label_cache_acquire(t, dsc, coords);
+    if(entry) {
+        /*The coverage of the whole text is cached, blend it in one step*/
+        lv_draw_label_cache_data_t * data = lv_cache_entry_get_data(entry);
+        lv_area_t mask_area = *coords;
+        lv_area_increase(&mask_area, data->ext, data->ext);
+
+        lv_draw_sw_blend_dsc_t blend_dsc;
+        lv_memzero(&blend_dsc, sizeof(blend_dsc));
+        blend_dsc.color = dsc->color;
+        blend_dsc.opa = dsc->opa;
+        blend_dsc.mask_buf = data->coverage->data;
+        blend_dsc.mask_area = &mask_area;
+        blend_dsc.mask_stride = data->coverage->header.stride;
+        blend_dsc.blend_area = &mask_area;
+        blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+        lv_draw_sw_blend(t, &blend_dsc);
+
+        lv_draw_label_cache_release(entry);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     lv_draw_label_iterate_characters(t, dsc, coords, draw_letter_cb);
     LV_PROFILER_DRAW_END;
 }
@@ -506,6 +506,7 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
         buf = new_buf->data;
         stride = new_buf->header.stride;
     }
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_THORVG);
     Tvg_Canvas * canvas = tvg_swcanvas_create();
     tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
 
@@ -530,6 +531,7 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
     }
 
     tvg_canvas_destroy(canvas);
+    LV_MEM_TRACE_TAG_END();
 }
 
 /**********************
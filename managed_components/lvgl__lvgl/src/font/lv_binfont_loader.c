@@ -101,6 +101,7 @@ lv_font_t * lv_binfont_create(const char * path)
     lv_fs_res_t fs_res = lv_fs_open(&file, path, LV_FS_MODE_RD);
     if(fs_res != LV_FS_RES_OK) return NULL;
 
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_FONT);
     lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
     LV_ASSERT_MALLOC(font);
 
@@ -114,6 +115,7 @@ lv_font_t * lv_binfont_create(const char * path)
         lv_binfont_destroy(font);
         font = NULL;
     }
+    LV_MEM_TRACE_TAG_END();
 
     lv_fs_close(&file);
 
@@ -137,6 +139,8 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+    lv_font_fmt_txt_cache_drop(font);
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
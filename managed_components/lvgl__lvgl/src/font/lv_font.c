@@ -53,7 +53,9 @@ const void * lv_font_get_glyph_bitmap(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t
 
     const uint8_t save_req = g_dsc->req_raw_bitmap;
     g_dsc->req_raw_bitmap = 0;
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_FONT);
     const void * bitmap = font_p->get_glyph_bitmap(g_dsc, draw_buf);
+    LV_MEM_TRACE_TAG_END();
     g_dsc->req_raw_bitmap = save_req;
 
     return bitmap;
@@ -107,8 +109,10 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
     lv_memzero(dsc_out, sizeof(lv_font_glyph_dsc_t));
 
     while(f) {
+        LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_FONT);
         bool found = f->get_glyph_dsc(f, dsc_out, letter,
                                       has_kerning ? letter_next : 0);
+        LV_MEM_TRACE_TAG_END();
         if(found) {
             if(!dsc_out->is_placeholder) {
                 dsc_out->resolved_font = f;
@@ -22,6 +22,19 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+    #define font_cache_head LV_GLOBAL_DEFAULT()->font_fmt_txt_cache_head
+    #define font_cache_lock LV_GLOBAL_DEFAULT()->font_fmt_txt_cache_lock
+#endif
+
+#if LV_FONT_FMT_TXT_CACHE_SIZE & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)
+    #error "LV_FONT_FMT_TXT_CACHE_SIZE must be a power of 2"
+#endif
+
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE & (LV_FONT_FMT_TXT_KERN_CACHE_SIZE - 1)
+    #error "LV_FONT_FMT_TXT_KERN_CACHE_SIZE must be a power of 2"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +48,12 @@ typedef struct {
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+
+#if LV_FONT_FMT_TXT_USE_CACHE
+    static lv_font_fmt_txt_cache_t * get_cache(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif
+static uint32_t get_sparse_glyph_id(const lv_font_fmt_txt_cmap_t * cmap, uint32_t rcp);
+static int8_t get_kern_pair_value(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
@@ -276,10 +295,94 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+
+void lv_font_fmt_txt_cache_init(void)
+{
+    font_cache_head = NULL;
+    lv_mutex_init(&font_cache_lock);
+}
+
+void lv_font_fmt_txt_cache_deinit(void)
+{
+    lv_font_fmt_txt_cache_t * cache = font_cache_head;
+    while(cache) {
+        lv_font_fmt_txt_cache_t * next = cache->next;
+        lv_free(cache);
+        cache = next;
+    }
+    font_cache_head = NULL;
+    lv_mutex_delete(&font_cache_lock);
+}
+
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font)
+{
+    LV_ASSERT_NULL(font);
+
+    lv_mutex_lock(&font_cache_lock);
+    lv_font_fmt_txt_cache_t ** cache_p = &font_cache_head;
+    while(*cache_p) {
+        lv_font_fmt_txt_cache_t * cache = *cache_p;
+        if(cache->fdsc == font->dsc) {
+            *cache_p = cache->next;
+            lv_free(cache);
+            break;
+        }
+        cache_p = &cache->next;
+    }
+    lv_mutex_unlock(&font_cache_lock);
+}
+
+#else
+
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font)
+{
+    LV_UNUSED(font);
+}
+
+#endif /*LV_FONT_FMT_TXT_USE_CACHE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+
+/**
+ * Get the caches of a font descriptor. Allocate them on the first use.
+ * @param fdsc      pointer to a font descriptor
+ * @return          the caches or NULL if they couldn't be allocated
+ */
+static lv_font_fmt_txt_cache_t * get_cache(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    /*The caches are only added to the head so the list can be read without locking*/
+    lv_font_fmt_txt_cache_t * cache;
+    for(cache = font_cache_head; cache; cache = cache->next) {
+        if(cache->fdsc == fdsc) return cache;
+    }
+
+    lv_mutex_lock(&font_cache_lock);
+    /*Another thread might have added it in the meantime*/
+    for(cache = font_cache_head; cache; cache = cache->next) {
+        if(cache->fdsc == fdsc) break;
+    }
+
+    if(cache == NULL) {
+        cache = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_cache_t));
+        LV_ASSERT_MALLOC(cache);
+        if(cache) {
+            cache->fdsc = fdsc;
+            cache->next = font_cache_head;
+            font_cache_head = cache;
+        }
+    }
+    lv_mutex_unlock(&font_cache_lock);
+
+    return cache;
+}
+
+#endif /*LV_FONT_FMT_TXT_USE_CACHE*/
+
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
@@ -304,26 +407,24 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
             if(gid_ofs_8[rcp] == 0 && letter != fdsc->cmaps[i].range_start) continue;
             glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
         }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
-            }
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
-
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY ||
+                fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+            /*Only the binary search of the sparse maps is worth caching.
+             *Letters and glyph IDs fitting to 16 bits are stored in a single word as `(letter << 16) | glyph_id`*/
+            lv_font_fmt_txt_cache_t * cache = letter <= 0xFFFF ? get_cache(fdsc) : NULL;
+            uint32_t * entry_p = cache ? &cache->glyph_ids[letter & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)] : NULL;
+            if(entry_p) {
+                uint32_t entry = *entry_p;
+                if((entry >> 16) == letter) return entry & 0xFFFF;
             }
+
+            /*The missing letters are cached too as they are looked up again and again with fallback fonts*/
+            glyph_id = get_sparse_glyph_id(&fdsc->cmaps[i], rcp);
+            if(entry_p && glyph_id <= 0xFFFF) *entry_p = (letter << 16) | glyph_id;
+#else
+            glyph_id = get_sparse_glyph_id(&fdsc->cmaps[i], rcp);
+#endif
         }
 
         return glyph_id;
@@ -333,6 +434,23 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 
 }
 
+static uint32_t get_sparse_glyph_id(const lv_font_fmt_txt_cmap_t * cmap, uint32_t rcp)
+{
+    uint16_t key = rcp;
+    uint16_t * p = lv_utils_bsearch(&key, cmap->unicode_list, cmap->list_length,
+                                    sizeof(cmap->unicode_list[0]), unicode_list_compare);
+    if(p == NULL) return 0;
+
+    lv_uintptr_t ofs = p - cmap->unicode_list;
+    if(cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+        return cmap->glyph_id_start + (uint32_t) ofs;
+    }
+    else {
+        const uint16_t * gid_ofs_16 = cmap->glyph_id_ofs_list;
+        return cmap->glyph_id_start + gid_ofs_16[ofs];
+    }
+}
+
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
 {
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
@@ -342,36 +460,25 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
-        if(kdsc->glyph_ids_size == 0) {
-            /*Use binary search to find the kern value.
-             *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint16_t * g_ids = kdsc->glyph_ids;
-            kern_pair_ref_t g_id_both = {gid_left, gid_right};
-            uint16_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
-            }
-        }
-        else if(kdsc->glyph_ids_size == 1) {
-            /*Use binary search to find the kern value.
-             *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint32_t * g_ids = kdsc->glyph_ids;
-            kern_pair_ref_t g_id_both = {gid_left, gid_right};
-            uint32_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
-            }
-
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+        /*Glyph IDs fitting to 12 bits are stored with the value in a single word as
+         *`(gid_left << 20) | (gid_right << 8) | value`*/
+        lv_font_fmt_txt_cache_t * cache = gid_left <= 0xFFF && gid_right <= 0xFFF ? get_cache(fdsc) : NULL;
+        if(cache) {
+            uint32_t key = (gid_left << 12) | gid_right;
+            uint32_t * entry_p = &cache->kern_values[(gid_left * 31 + gid_right) & (LV_FONT_FMT_TXT_KERN_CACHE_SIZE - 1)];
+            uint32_t entry = *entry_p;
+            if((entry >> 8) == key) return (int8_t)(entry & 0xFF);
+
+            value = get_kern_pair_value(kdsc, gid_left, gid_right);
+            *entry_p = (key << 8) | (uint8_t)value;
         }
         else {
-            /*Invalid value*/
+            value = get_kern_pair_value(kdsc, gid_left, gid_right);
         }
+#else
+        value = get_kern_pair_value(kdsc, gid_left, gid_right);
+#endif
     }
     else {
         /*Kern classes*/
@@ -389,6 +496,42 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
+static int8_t get_kern_pair_value(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t gid_left, uint32_t gid_right)
+{
+    int8_t value = 0;
+    if(kdsc->glyph_ids_size == 0) {
+        /*Use binary search to find the kern value.
+         *The pairs are ordered left_id first, then right_id secondly.*/
+        const uint16_t * g_ids = kdsc->glyph_ids;
+        kern_pair_ref_t g_id_both = {gid_left, gid_right};
+        uint16_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
+
+        /*If the `g_id_both` were found get its index from the pointer*/
+        if(kid_p) {
+            lv_uintptr_t ofs = kid_p - g_ids;
+            value = kdsc->values[ofs];
+        }
+    }
+    else if(kdsc->glyph_ids_size == 1) {
+        /*Use binary search to find the kern value.
+         *The pairs are ordered left_id first, then right_id secondly.*/
+        const uint32_t * g_ids = kdsc->glyph_ids;
+        kern_pair_ref_t g_id_both = {gid_left, gid_right};
+        uint32_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
+
+        /*If the `g_id_both` were found get its index from the pointer*/
+        if(kid_p) {
+            lv_uintptr_t ofs = kid_p - g_ids;
+            value = kdsc->values[ofs];
+        }
+
+    }
+    else {
+        /*Invalid value*/
+    }
+    return value;
+}
+
 static int kern_pair_8_compare(const void * ref, const void * element)
 {
     const kern_pair_ref_t * ref8_p = ref;
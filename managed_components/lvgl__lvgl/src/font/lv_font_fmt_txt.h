@@ -224,6 +224,16 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+/**
+ * Free the glyph ID and kerning caches of a font.
+ * Needs to be called before freeing the descriptor of a dynamically created font
+ * as the caches are assigned to the address of the descriptor.
+ * Does nothing if the caches are disabled by `LV_FONT_FMT_TXT_CACHE_SIZE`
+ * and `LV_FONT_FMT_TXT_KERN_CACHE_SIZE`.
+ * @param font      pointer to font
+ */
+void lv_font_fmt_txt_cache_drop(const lv_font_t * font);
+
 /**********************
  *      MACROS
  **********************/
@@ -20,6 +20,8 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_FONT_FMT_TXT_USE_CACHE (LV_FONT_FMT_TXT_CACHE_SIZE || LV_FONT_FMT_TXT_KERN_CACHE_SIZE)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,10 +43,39 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+/**
+ * Direct-mapped lookup caches of a font.
+ * The entries are single words so they can be used from the draw threads as well without locking.
+ */
+typedef struct _lv_font_fmt_txt_cache_t {
+    struct _lv_font_fmt_txt_cache_t * next;
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< The font descriptor the caches belong to*/
+#if LV_FONT_FMT_TXT_CACHE_SIZE
+    uint32_t glyph_ids[LV_FONT_FMT_TXT_CACHE_SIZE];         /**< (letter << 16) | glyph_id, 0: empty*/
+#endif
+#if LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+    uint32_t kern_values[LV_FONT_FMT_TXT_KERN_CACHE_SIZE];  /**< (gid_left << 20) | (gid_right << 8) | value, 0: empty*/
+#endif
+} lv_font_fmt_txt_cache_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+/**
+ * Initialize the glyph ID and kerning caches of the fonts
+ */
+void lv_font_fmt_txt_cache_init(void);
+
+/**
+ * Free the glyph ID and kerning caches of all fonts
+ */
+void lv_font_fmt_txt_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
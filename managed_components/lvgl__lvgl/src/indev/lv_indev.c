@@ -3,6 +3,7 @@
 #include "../misc/lv_area_private.h"
 #include "../misc/lv_anim_private.h"
 #include "../core/lv_obj_draw_private.h"
+#include "../core/lv_obj_draw_list_private.h"
 /**
  * @file lv_indev.c
  *
@@ -59,6 +60,9 @@
 #define indev_obj_act LV_GLOBAL_DEFAULT()->indev_obj_active
 #define indev_ll_head &(LV_GLOBAL_DEFAULT()->indev_ll)
 
+/*Max. number of children which can be under a point to search them in the draw list*/
+#define SEARCH_CANDIDATE_MAX    16
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -75,6 +79,11 @@ static void indev_proc_release(lv_indev_t * indev);
 static lv_result_t indev_proc_short_click(lv_indev_t * indev);
 static void indev_proc_pointer_diff(lv_indev_t * indev);
 static lv_obj_t * pointer_search_obj(lv_display_t * disp, lv_point_t * p);
+static lv_obj_t * search_obj(lv_obj_t * obj, lv_point_t * point, const lv_obj_draw_list_t * list);
+#if LV_OBJ_DRAW_LIST
+    static bool search_draw_list_children(lv_obj_t * obj, lv_point_t * point, const lv_obj_draw_list_t * list,
+                                          lv_obj_t ** found_p);
+#endif
 static void indev_proc_reset_query_handler(lv_indev_t * indev);
 static void indev_click_focus(lv_indev_t * indev);
 static void indev_gesture(lv_indev_t * indev);
@@ -589,38 +598,11 @@ void lv_indev_set_mode(lv_indev_t * indev, lv_indev_mode_t mode)
 
 lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
 {
-    lv_obj_t * found_p = NULL;
-
-    /*If this obj is hidden the children are hidden too so return immediately*/
-    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return NULL;
-
-    lv_point_t p_trans = *point;
-    lv_obj_transform_point(obj, &p_trans, LV_OBJ_POINT_TRANSFORM_FLAG_INVERSE);
-
-    bool hit_test_ok = lv_obj_hit_test(obj, &p_trans);
-
-    /*If the point is on this object check its children too*/
-    lv_area_t obj_coords = obj->coords;
-    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
-        int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
-        lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
-    }
-    if(lv_area_is_point_on(&obj_coords, &p_trans, 0)) {
-        int32_t i;
-        uint32_t child_cnt = lv_obj_get_child_count(obj);
-
-        /*If a child matches use it*/
-        for(i = child_cnt - 1; i >= 0; i--) {
-            lv_obj_t * child = obj->spec_attr->children[i];
-            found_p = lv_indev_search_obj(child, &p_trans);
-            if(found_p) return found_p;
-        }
-    }
-
-    /*If not return earlier for a clicked child and this obj's hittest was ok use it
-     *else return NULL*/
-    if(hit_test_ok) return obj;
-    else return NULL;
+#if LV_OBJ_DRAW_LIST
+    return search_obj(obj, point, lv_obj_draw_list_get(lv_obj_get_screen(obj)));
+#else
+    return search_obj(obj, point, NULL);
+#endif
 }
 
 void lv_indev_add_event_cb(lv_indev_t * indev, lv_event_cb_t event_cb, lv_event_code_t filter, void * user_data)
@@ -1899,3 +1881,98 @@ static void indev_scroll_throw_anim_start(lv_indev_t * indev)
 
     indev->scroll_throw_anim = lv_anim_start(&a);
 }
+/**
+ * Search the top-most clickable object under a point
+ * @param obj       the object to start the search from
+ * @param point     the point in the coordinates of `obj`'s parent
+ * @param list      the draw list of `obj`'s screen to skip the children which are not under the point, can be NULL
+ * @return          the found object or NULL
+ */
+static lv_obj_t * search_obj(lv_obj_t * obj, lv_point_t * point, const lv_obj_draw_list_t * list)
+{
+    lv_obj_t * found_p = NULL;
+
+    /*If this obj is hidden the children are hidden too so return immediately*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return NULL;
+
+    lv_point_t p_trans = *point;
+    lv_obj_transform_point(obj, &p_trans, LV_OBJ_POINT_TRANSFORM_FLAG_INVERSE);
+
+    bool hit_test_ok = lv_obj_hit_test(obj, &p_trans);
+
+    /*If the point is on this object check its children too*/
+    lv_area_t obj_coords = obj->coords;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+        lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
+    }
+    if(lv_area_is_point_on(&obj_coords, &p_trans, 0)) {
+#if LV_OBJ_DRAW_LIST
+        if(search_draw_list_children(obj, &p_trans, list, &found_p)) {
+            if(found_p) return found_p;
+        }
+        else
+#else
+        LV_UNUSED(list);
+#endif
+        {
+            int32_t i;
+            uint32_t child_cnt = lv_obj_get_child_count(obj);
+
+            /*If a child matches use it*/
+            for(i = child_cnt - 1; i >= 0; i--) {
+                lv_obj_t * child = obj->spec_attr->children[i];
+                found_p = search_obj(child, &p_trans, list);
+                if(found_p) return found_p;
+            }
+        }
+    }
+
+    /*If not return earlier for a clicked child and this obj's hittest was ok use it
+     *else return NULL*/
+    if(hit_test_ok) return obj;
+    else return NULL;
+}
+
+#if LV_OBJ_DRAW_LIST
+/**
+ * Search the children of an object under a point using the draw list. Only the children whose
+ * click area contains the point are checked.
+ * @param obj       pointer to an object
+ * @param point     the point in the coordinates of the children
+ * @param list      the draw list of `obj`'s screen
+ * @param found_p   store the found object or NULL here
+ * @return          false if the list can't be used and the children need to be checked one by one
+ */
+static bool search_draw_list_children(lv_obj_t * obj, lv_point_t * point, const lv_obj_draw_list_t * list,
+                                      lv_obj_t ** found_p)
+{
+    uint32_t idx = lv_obj_draw_list_find(list, obj);
+    if(idx == LV_OBJ_DRAW_LIST_NONE) return false;
+
+    lv_obj_t * candidates[SEARCH_CANDIDATE_MAX];
+    uint32_t candidate_cnt = 0;
+    uint32_t child_idx = idx + 1;
+    while(child_idx < list->entries[idx].next) {
+        const lv_obj_draw_list_entry_t * entry = &list->entries[child_idx];
+        child_idx = entry->next;
+
+        if(entry->flags & LV_OBJ_DRAW_LIST_FLAG_HIDDEN) continue;
+        if(!(entry->flags & LV_OBJ_DRAW_LIST_FLAG_TRANSFORMED) && !lv_area_is_point_on(&entry->click_area, point, 0)) {
+            continue;
+        }
+
+        if(candidate_cnt == SEARCH_CANDIDATE_MAX) return false;
+        candidates[candidate_cnt++] = entry->obj;
+    }
+
+    /*The last child is on the top*/
+    *found_p = NULL;
+    while(candidate_cnt > 0 && *found_p == NULL) {
+        candidate_cnt--;
+        *found_p = search_obj(candidates[candidate_cnt], point, list);
+    }
+
+    return true;
+}
+#endif
@@ -9,6 +9,7 @@
 #include "lv_flex.h"
 #include "../lv_layout.h"
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_draw_list_private.h"
 
 #if LV_USE_FLEX
 
@@ -424,6 +425,9 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
                 lv_area_t old_coords;
                 lv_area_copy(&old_coords, &item->coords);
                 area_set_main_size(&item->coords, s);
+#if LV_OBJ_DRAW_LIST
+                lv_obj_draw_list_geometry_changed(item);
+#endif
                 lv_obj_send_event(item, LV_EVENT_SIZE_CHANGED, &old_coords);
                 lv_obj_send_event(lv_obj_get_parent(item), LV_EVENT_CHILD_CHANGED, item);
                 lv_obj_invalidate(item);
@@ -476,6 +480,9 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             item->coords.x2 += diff_x;
             item->coords.y1 += diff_y;
             item->coords.y2 += diff_y;
+#if LV_OBJ_DRAW_LIST
+            lv_obj_draw_list_geometry_changed(item);
+#endif
             lv_obj_invalidate(item);
             lv_obj_move_children_by(item, diff_x, diff_y, false);
         }
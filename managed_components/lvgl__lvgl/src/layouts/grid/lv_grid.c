@@ -13,6 +13,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../lv_layout.h"
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_draw_list_private.h"
 #include "../../core/lv_global.h"
 /*********************
  *      DEFINES
@@ -306,27 +307,23 @@ static lv_result_t calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
     c->x = lv_malloc(sizeof(int32_t) * c->col_num);
     c->w = lv_malloc(sizeof(int32_t) * c->col_num);
 
-    /*Set sizes for CONTENT cells*/
+    /*Set sizes for CONTENT cells. Visit the children only once, not for each track.*/
     uint32_t i;
     for(i = 0; i < c->col_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(col_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t col_span = get_col_span(item);
-                if(col_span != 1) continue;
-
-                uint32_t col_pos = get_col_pos(item);
-                if(col_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_width(item));
-            }
-            if(size >= 0) c->w[i] = size;
-            else c->w[i] = 0;
-        }
+        c->w[i] = 0;
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_count(cont);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * item = cont->spec_attr->children[i];
+        if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+        uint32_t col_span = get_col_span(item);
+        if(col_span != 1) continue;
+
+        uint32_t col_pos = get_col_pos(item);
+        if(col_pos >= c->col_num || !IS_CONTENT(col_templ[col_pos])) continue;
+
+        c->w[col_pos] = LV_MAX(c->w[col_pos], lv_obj_get_width(item));
     }
 
     uint32_t col_fr_cnt = 0;
@@ -396,27 +393,23 @@ static lv_result_t calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
     c->row_num = count_tracks(row_templ);
     c->y = lv_malloc(sizeof(int32_t) * c->row_num);
     c->h = lv_malloc(sizeof(int32_t) * c->row_num);
-    /*Set sizes for CONTENT cells*/
+    /*Set sizes for CONTENT cells. Visit the children only once, not for each track.*/
     uint32_t i;
     for(i = 0; i < c->row_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(row_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t row_span = get_row_span(item);
-                if(row_span != 1) continue;
-
-                uint32_t row_pos = get_row_pos(item);
-                if(row_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_height(item));
-            }
-            if(size >= 0) c->h[i] = size;
-            else c->h[i] = 0;
-        }
+        c->h[i] = 0;
+    }
+
+    uint32_t child_cnt = lv_obj_get_child_count(cont);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * item = cont->spec_attr->children[i];
+        if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+        uint32_t row_span = get_row_span(item);
+        if(row_span != 1) continue;
+
+        uint32_t row_pos = get_row_pos(item);
+        if(row_pos >= c->row_num || !IS_CONTENT(row_templ[row_pos])) continue;
+
+        c->h[row_pos] = LV_MAX(c->h[row_pos], lv_obj_get_height(item));
     }
 
     uint32_t row_fr_cnt = 0;
@@ -549,6 +542,9 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
         lv_obj_invalidate(item);
         lv_area_set_width(&item->coords, item_w);
         lv_area_set_height(&item->coords, item_h);
+#if LV_OBJ_DRAW_LIST
+        lv_obj_draw_list_geometry_changed(item);
+#endif
         lv_obj_invalidate(item);
         lv_obj_send_event(item, LV_EVENT_SIZE_CHANGED, &old_coords);
         lv_obj_send_event(lv_obj_get_parent(item), LV_EVENT_CHILD_CHANGED, item);
@@ -574,6 +570,9 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
         item->coords.x2 += diff_x;
         item->coords.y1 += diff_y;
         item->coords.y2 += diff_y;
+#if LV_OBJ_DRAW_LIST
+        lv_obj_draw_list_geometry_changed(item);
+#endif
         lv_obj_invalidate(item);
         lv_obj_move_children_by(item, diff_x, diff_y, false);
     }
@@ -37,16 +37,22 @@
 
 /**
  * Data format for compressed image data.
+ * If `block_rows` is not 0, every `block_rows` rows are compressed separately, and the compressed
+ * data starts with the offsets of the blocks (and the end of the last block) relative to the
+ * first block as `uint32_t block_index[block_cnt + 1]`.
  */
 
 typedef struct _lv_image_compressed_t {
     uint32_t method: 4; /*Compression method, see `lv_image_compress_t`*/
-    uint32_t reserved : 28;  /*Reserved to be used later*/
+    uint32_t block_rows : 16;  /*Rows per block for block compressed images, 0: compressed at once*/
+    uint32_t reserved : 12;  /*Reserved to be used later*/
     uint32_t compressed_size;  /*Compressed data size in byte*/
     uint32_t decompressed_size;  /*Decompressed data size in byte*/
     const uint8_t * data; /*Compressed data*/
 } lv_image_compressed_t;
 
+#define COMPRESSED_HEADER_SIZE  12
+
 typedef struct {
     lv_fs_file_t * f;
     lv_color32_t * palette;
@@ -56,6 +62,10 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    uint32_t * block_index;             /*Offsets of the blocks of a block compressed image*/
+    uint8_t * block_compressed;         /*Buffer to read a compressed block from file*/
+    lv_draw_buf_t * block;              /*The last decompressed block*/
+    uint32_t block_id;                  /*Index of the block in `block`*/
 } decoder_data_t;
 
 /**********************
@@ -72,10 +82,17 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t read_compressed_header(lv_image_decoder_dsc_t * dsc, lv_image_compressed_t * compressed);
+static lv_result_t open_block_compressed(lv_image_decoder_dsc_t * dsc);
+static lv_result_t decode_block(lv_image_decoder_dsc_t * dsc, uint32_t block_id);
+static lv_result_t get_area_block_compressed(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                             lv_area_t * decoded_area);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
+static uint32_t decompress_data(lv_color_format_t cf, uint32_t method, const uint8_t * input, uint32_t input_len,
+                                uint8_t * output, uint32_t out_len);
 
 /**********************
  *  STATIC VARIABLES
@@ -395,6 +412,11 @@ void lv_bin_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
         decoder_data->decoded_partial = NULL;
     }
 
+    if(decoder_data && decoder_data->block) {
+        lv_draw_buf_destroy(decoder_data->block);
+        decoder_data->block = NULL;
+    }
+
     free_decoder_data(dsc);
 }
 
@@ -426,6 +448,10 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
         return LV_RESULT_INVALID;
     }
 
+    if(decoder_data->block_index) {
+        return get_area_block_compressed(dsc, full_area, decoded_area);
+    }
+
     lv_fs_file_t * f = decoder_data->f;
     uint32_t bpp = lv_color_format_get_bpp(cf);
     int32_t w_px = lv_area_get_width(full_area);
@@ -571,6 +597,8 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
     if(decoder_data->decoded) lv_draw_buf_destroy(decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy(decoder_data->decompressed);
     lv_free(decoder_data->palette);
+    lv_free(decoder_data->block_index);
+    lv_free(decoder_data->block_compressed);
     lv_free(decoder_data);
     dsc->user_data = NULL;
 }
@@ -926,17 +954,21 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
+    decoder_data_t * decoder_data = get_decoder_data(dsc);
+    if(decoder_data == NULL) return LV_RESULT_INVALID;
+
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    if(read_compressed_header(dsc, compressed) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    /*Block compressed images are decompressed block by block in get_area_cb*/
+    if(compressed->block_rows) return open_block_compressed(dsc);
+
 #if LV_BIN_DECODER_RAM_LOAD
     uint32_t rn;
-    uint32_t len;
     uint32_t compressed_len;
-    decoder_data_t * decoder_data = get_decoder_data(dsc);
     lv_result_t res;
     lv_fs_res_t fs_res;
     uint8_t * file_buf = NULL;
-    lv_image_compressed_t * compressed = &decoder_data->compressed;
-
-    lv_memzero(compressed, sizeof(lv_image_compressed_t));
 
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         lv_fs_file_t * f = decoder_data->f;
@@ -948,15 +980,7 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
         }
 
         compressed_len -= sizeof(lv_image_header_t);
-        compressed_len -= 12;
-
-        /*Read compress header*/
-        len = 12;
-        fs_res = fs_read_file_at(f, sizeof(lv_image_header_t), compressed, len, &rn);
-        if(fs_res != LV_FS_RES_OK || rn != len) {
-            LV_LOG_WARN("Read compressed header failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn, len);
-            return LV_RESULT_INVALID;
-        }
+        compressed_len -= COMPRESSED_HEADER_SIZE;
 
         if(compressed->compressed_size != compressed_len) {
             LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size, compressed_len);
@@ -970,8 +994,8 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
 
         }
 
-        /*Continue to read the compressed data following compression header*/
-        fs_res = lv_fs_read(f, file_buf, compressed_len, &rn);
+        /*Read the compressed data following compression header*/
+        fs_res = fs_read_file_at(f, sizeof(lv_image_header_t) + COMPRESSED_HEADER_SIZE, file_buf, compressed_len, &rn);
         if(fs_res != LV_FS_RES_OK || rn != compressed_len) {
             LV_LOG_WARN("Read compressed file failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
                         compressed_len);
@@ -982,24 +1006,15 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
         /*Decompress the image*/
         compressed->data = file_buf;
     }
-    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+    else {
         lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
-        compressed_len = image->data_size;
-
-        /*Read compress header*/
-        len = 12;
-        compressed_len -= len;
-        lv_memcpy(compressed, image->data, len);
-        compressed->data = image->data + len;
+        compressed_len = image->data_size - COMPRESSED_HEADER_SIZE;
+        compressed->data = image->data + COMPRESSED_HEADER_SIZE;
         if(compressed->compressed_size != compressed_len) {
             LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size, compressed_len);
             return LV_RESULT_INVALID;
         }
     }
-    else {
-        LV_LOG_WARN("Compressed image only support file or variable");
-        return LV_RESULT_INVALID;
-    }
 
     res = decompress_image(dsc, compressed);
     compressed->data = NULL; /*No need to store the data any more*/
@@ -1037,12 +1052,266 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
 #else
     LV_UNUSED(decompress_image);
     LV_UNUSED(decoder);
-    LV_UNUSED(dsc);
     LV_LOG_ERROR("Need LV_BIN_DECODER_RAM_LOAD to be enabled");
     return LV_RESULT_INVALID;
 #endif
 }
 
+/**
+ * Read the header of a compressed image
+ * @param dsc           pointer to a decoder descriptor
+ * @param compressed    store the header here
+ * @return              LV_RESULT_OK: no error; LV_RESULT_INVALID: the header can't be read
+ */
+static lv_result_t read_compressed_header(lv_image_decoder_dsc_t * dsc, lv_image_compressed_t * compressed)
+{
+    lv_memzero(compressed, sizeof(lv_image_compressed_t));
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        decoder_data_t * decoder_data = dsc->user_data;
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t), compressed,
+                                             COMPRESSED_HEADER_SIZE, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != COMPRESSED_HEADER_SIZE) {
+            LV_LOG_WARN("Read compressed header failed: %d, with len: %" LV_PRIu32 ", expected: %d", fs_res, rn,
+                        COMPRESSED_HEADER_SIZE);
+            return LV_RESULT_INVALID;
+        }
+    }
+    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+        lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
+        if(image->data_size < COMPRESSED_HEADER_SIZE) {
+            LV_LOG_WARN("Compressed image data is too short: %" LV_PRIu32, image->data_size);
+            return LV_RESULT_INVALID;
+        }
+
+        lv_memcpy(compressed, image->data, COMPRESSED_HEADER_SIZE);
+    }
+    else {
+        LV_LOG_WARN("Compressed image only support file or variable");
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**
+ * Load the block index of a block compressed image. The blocks are decompressed
+ * in `get_area_block_compressed()` when they are drawn.
+ * @param dsc       pointer to a decoder descriptor
+ * @return          LV_RESULT_OK: no error; LV_RESULT_INVALID: unsupported or corrupted image
+ */
+static lv_result_t open_block_compressed(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    const lv_image_compressed_t * compressed = &decoder_data->compressed;
+    lv_color_format_t cf = dsc->header.cf;
+
+    bool method_supported = false;
+#if LV_USE_RLE
+    if(compressed->method == LV_IMAGE_COMPRESS_RLE) method_supported = true;
+#endif
+#if LV_USE_LZ4
+    if(compressed->method == LV_IMAGE_COMPRESS_LZ4) method_supported = true;
+#endif
+    if(!method_supported) {
+        LV_LOG_WARN("Compression method %" LV_PRIu32 " is unknown or not enabled", (uint32_t)compressed->method);
+        return LV_RESULT_INVALID;
+    }
+
+    /*The rows need to be stored one after the other*/
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf) || LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf) || cf == LV_COLOR_FORMAT_RGB565A8) {
+        LV_LOG_WARN("Block compression is not supported for CF: %d", cf);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t block_cnt = (dsc->header.h + compressed->block_rows - 1) / compressed->block_rows;
+    uint32_t index_size = (block_cnt + 1) * sizeof(uint32_t);
+    if(compressed->compressed_size < index_size ||
+       compressed->decompressed_size != (uint32_t)dsc->header.h * dsc->header.stride) {
+        LV_LOG_WARN("Invalid block compressed image");
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->block_index = lv_malloc(index_size);
+    if(decoder_data->block_index == NULL) {
+        LV_LOG_WARN("No memory for block index");
+        return LV_RESULT_INVALID;
+    }
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t) + COMPRESSED_HEADER_SIZE,
+                                             decoder_data->block_index, index_size, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != index_size) {
+            LV_LOG_WARN("Read block index failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
+                        index_size);
+            return LV_RESULT_INVALID;
+        }
+    }
+    else {
+        lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
+        if(image->data_size - COMPRESSED_HEADER_SIZE != compressed->compressed_size) {
+            LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size,
+                        image->data_size - COMPRESSED_HEADER_SIZE);
+            return LV_RESULT_INVALID;
+        }
+
+        lv_memcpy(decoder_data->block_index, image->data + COMPRESSED_HEADER_SIZE, index_size);
+    }
+
+    /*Check the index to never read out of the data*/
+    uint32_t max_block_len = 0;
+    uint32_t i;
+    for(i = 0; i < block_cnt; i++) {
+        if(decoder_data->block_index[i + 1] < decoder_data->block_index[i]) break;
+        max_block_len = LV_MAX(max_block_len, decoder_data->block_index[i + 1] - decoder_data->block_index[i]);
+    }
+
+    if(i != block_cnt || decoder_data->block_index[block_cnt] != compressed->compressed_size - index_size) {
+        LV_LOG_WARN("Invalid block index");
+        return LV_RESULT_INVALID;
+    }
+
+    /*Only one block is read from the file at once*/
+    if(dsc->src_type == LV_IMAGE_SRC_FILE && max_block_len > 0) {
+        decoder_data->block_compressed = lv_malloc(max_block_len);
+        if(decoder_data->block_compressed == NULL) {
+            LV_LOG_WARN("No memory for compressed block");
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    decoder_data->block_id = UINT32_MAX;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress a block of a block compressed image to `decoder_data->block` if it's not there already
+ * @param dsc       pointer to a decoder descriptor
+ * @param block_id  index of the block
+ * @return          LV_RESULT_OK: no error; LV_RESULT_INVALID: the block can't be decompressed
+ */
+static lv_result_t decode_block(lv_image_decoder_dsc_t * dsc, uint32_t block_id)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data->block_id == block_id) return LV_RESULT_OK;
+
+    const lv_image_compressed_t * compressed = &decoder_data->compressed;
+    uint32_t block_rows = compressed->block_rows;
+    uint32_t block_cnt = (dsc->header.h + block_rows - 1) / block_rows;
+    uint32_t data_offset = COMPRESSED_HEADER_SIZE + (block_cnt + 1) * sizeof(uint32_t);
+    uint32_t start = decoder_data->block_index[block_id];
+    uint32_t input_len = decoder_data->block_index[block_id + 1] - start;
+
+    const uint8_t * input;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t) + data_offset + start,
+                                             decoder_data->block_compressed, input_len, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != input_len) {
+            LV_LOG_WARN("Read compressed block failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
+                        input_len);
+            return LV_RESULT_INVALID;
+        }
+        input = decoder_data->block_compressed;
+    }
+    else {
+        const lv_image_dsc_t * image = dsc->src;
+        input = image->data + data_offset + start;
+    }
+
+    if(decoder_data->block == NULL) {
+        decoder_data->block = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, block_rows,
+                                                    dsc->header.cf, dsc->header.stride);
+        if(decoder_data->block == NULL) {
+            LV_LOG_WARN("No memory for decompressed block");
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    /*The last block can be shorter*/
+    uint32_t rows = LV_MIN(block_rows, dsc->header.h - block_id * block_rows);
+    uint32_t out_len = rows * dsc->header.stride;
+    uint32_t len = decompress_data(dsc->header.cf, compressed->method, input, input_len,
+                                   decoder_data->block->data, out_len);
+    if(len != out_len) {
+        LV_LOG_WARN("Decompress block %" LV_PRIu32 " failed: %" LV_PRIu32 ", got: %" LV_PRIu32, block_id, out_len, len);
+        decoder_data->block_id = UINT32_MAX;
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->block_id = block_id;
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decode the next part of an area of a block compressed image. Each call returns the rows of
+ * the area in the next block, so only the blocks intersecting the area are decompressed.
+ * @param dsc           pointer to a decoder descriptor
+ * @param full_area     the area to decode, relative to the image
+ * @param decoded_area  the area decoded by the previous call, `y1` is `LV_COORD_MIN` on the first call
+ * @return              LV_RESULT_OK: `decoded_area` is decoded; LV_RESULT_INVALID: the whole area is
+ *                      decoded or error
+ */
+static lv_result_t get_area_block_compressed(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                             lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    uint32_t block_rows = decoder_data->compressed.block_rows;
+
+    if(full_area->x1 < 0 || full_area->y1 < 0 ||
+       full_area->x2 >= dsc->header.w || full_area->y2 >= dsc->header.h) {
+        return LV_RESULT_INVALID;
+    }
+
+    int32_t y1 = decoded_area->y1 == LV_COORD_MIN ? full_area->y1 : decoded_area->y2 + 1;
+    if(y1 > full_area->y2) return LV_RESULT_INVALID;
+
+    uint32_t block_id = (uint32_t)y1 / block_rows;
+    int32_t y2 = LV_MIN((int32_t)((block_id + 1) * block_rows) - 1, full_area->y2);
+
+    if(decode_block(dsc, block_id) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    /*Copy the part of the rows in the area*/
+    lv_color_format_t cf = dsc->header.cf;
+    int32_t w_px = lv_area_get_width(full_area);
+    int32_t h_px = y2 - y1 + 1;
+    lv_draw_buf_t * decoded = lv_draw_buf_reshape(decoder_data->decoded_partial, cf, w_px, h_px, LV_STRIDE_AUTO);
+    if(decoded == NULL) {
+        if(decoder_data->decoded_partial != NULL) {
+            lv_draw_buf_destroy(decoder_data->decoded_partial);
+            decoder_data->decoded_partial = NULL;
+        }
+
+        /*Allocate it for a whole block so that it can be reused for the next blocks*/
+        decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, w_px, block_rows, cf, LV_STRIDE_AUTO);
+        if(decoded == NULL) return LV_RESULT_INVALID;
+        decoder_data->decoded_partial = decoded; /*Free on decoder close*/
+        decoded = lv_draw_buf_reshape(decoded, cf, w_px, h_px, LV_STRIDE_AUTO);
+    }
+
+    uint32_t bpp = lv_color_format_get_bpp(cf);
+    uint32_t len = (w_px * bpp) / 8;
+    const uint8_t * src = decoder_data->block->data;
+    src += (y1 - block_id * block_rows) * dsc->header.stride;
+    src += full_area->x1 * bpp / 8;
+    uint8_t * dest = decoded->data;
+    int32_t y;
+    for(y = y1; y <= y2; y++) {
+        lv_memcpy(dest, src, len);
+        src += dsc->header.stride;
+        dest += decoded->header.stride;
+    }
+
+    decoded_area->x1 = full_area->x1;
+    decoded_area->x2 = full_area->x2;
+    decoded_area->y1 = y1;
+    decoded_area->y2 = y2;
+    dsc->decoded = decoded; /*Return decoded image*/
+    return LV_RESULT_OK;
+}
+
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out)
 {
@@ -1157,28 +1426,59 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     }
 
     img_data = decompressed->data;
+    len = decompress_data(dsc->header.cf, compressed->method, compressed->data, input_len, img_data, out_len);
 
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
+    if(len != compressed->decompressed_size) {
+        LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
+        lv_draw_buf_destroy(decompressed);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    return LV_RESULT_OK;
+#else
+    LV_UNUSED(dsc);
+    LV_UNUSED(compressed);
+    LV_LOG_WARN("At least one compression method must be enabled");
+    return LV_RESULT_INVALID;
+#endif /* (LV_USE_LZ4 || LV_USE_RLE) */
+}
+
+/**
+ * Decompress RLE or LZ4 compressed data
+ * @param cf        color format of the image
+ * @param method    compression method, see `lv_image_compress_t`
+ * @param input     the compressed data
+ * @param input_len size of the compressed data in bytes
+ * @param output    buffer for the decompressed data
+ * @param out_len   expected size of the decompressed data in bytes
+ * @return          size of the decompressed data, 0 on error
+ */
+static uint32_t decompress_data(lv_color_format_t cf, uint32_t method, const uint8_t * input, uint32_t input_len,
+                                uint8_t * output, uint32_t out_len)
+{
+    LV_UNUSED(cf);
+    LV_UNUSED(input);
+    LV_UNUSED(input_len);
+    LV_UNUSED(output);
+    LV_UNUSED(out_len);
+
+    uint32_t len = 0;
+    if(method == LV_IMAGE_COMPRESS_RLE) {
 #if LV_USE_RLE
         /*Compress always happen on byte*/
         uint32_t pixel_byte;
-        if(dsc->header.cf == LV_COLOR_FORMAT_RGB565A8)
+        if(cf == LV_COLOR_FORMAT_RGB565A8)
             pixel_byte = 2;
         else
-            pixel_byte = (lv_color_format_get_bpp(dsc->header.cf) + 7) >> 3;
-
-        const uint8_t * input = compressed->data;
-        uint8_t * output = img_data;
+            pixel_byte = (lv_color_format_get_bpp(cf) + 7) >> 3;
 
         len = lv_rle_decompress(input, input_len, output, out_len, pixel_byte);
 #endif /* LV_USE_RLE */
     }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
+    else if(method == LV_IMAGE_COMPRESS_LZ4) {
 #if LV_USE_LZ4
-        const char * input = (const char *)compressed->data;
-        char * output = (char *)img_data;
-
-        int ret = LZ4_decompress_safe(input, output, (int)input_len, (int)out_len);
+        int ret = LZ4_decompress_safe((const char *)input, (char *)output, (int)input_len, (int)out_len);
         if(ret >= 0) {
             /* Cast is safe because of the above check */
             len = (uint32_t)ret;
@@ -1186,18 +1486,5 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
 #endif /* LV_USE_LZ4 */
     }
 
-    if(len != compressed->decompressed_size) {
-        LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
-        lv_draw_buf_destroy(decompressed);
-        return LV_RESULT_INVALID;
-    }
-
-    decoder_data->decompressed = decompressed; /*Free on decoder close*/
-    return LV_RESULT_OK;
-#else
-    LV_UNUSED(dsc);
-    LV_UNUSED(compressed);
-    LV_LOG_WARN("At least one compression method must be enabled");
-    return LV_RESULT_INVALID;
-#endif /* (LV_USE_LZ4 || LV_USE_RLE) */
+    return len;
 }
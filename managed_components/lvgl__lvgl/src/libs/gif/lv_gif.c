@@ -9,6 +9,7 @@
 #include "lv_gif.h"
 #if LV_USE_GIF
 #include "../../misc/lv_timer_private.h"
+#include "../../misc/lv_area_private.h"
 #include "../../misc/cache/lv_cache.h"
 #include "../../core/lv_obj_class_private.h"
 #include "../../widgets/image/lv_image_private.h"
@@ -44,6 +45,7 @@ static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void initialize(lv_gif_t * gifobj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void invalidate_frame_area(lv_gif_t * gifobj);
 
 /**********************
  *  STATIC VARIABLES
@@ -312,7 +314,41 @@ static void next_frame_task_cb(lv_timer_t * t)
     }
 
     lv_image_cache_drop(lv_image_get_src(obj));
-    lv_obj_invalidate(obj);
+    invalidate_frame_area(gifobj);
+}
+
+/**
+ * Invalidate only the area of the last decoded frame. A GIF frame updates only its
+ * rectangle of the canvas, the rest of the pixels are kept from the previous frames.
+ * @param gifobj    pointer to a GIF widget
+ */
+static void invalidate_frame_area(lv_gif_t * gifobj)
+{
+    lv_obj_t * obj = (lv_obj_t *) gifobj;
+    lv_image_t * img = &gifobj->img;
+    GIFIMAGE * gif = &gifobj->gif;
+
+    /*Can't tell simply where the frame is drawn if the image is transformed*/
+    if(img->rotation != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE ||
+       img->align >= _LV_IMAGE_ALIGN_AUTO_TRANSFORM) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t image_area;
+    lv_area_set(&image_area, obj->coords.x1, obj->coords.y1, obj->coords.x1 + img->w - 1, obj->coords.y1 + img->h - 1);
+    lv_area_align(&obj->coords, &image_area, img->align, img->offset.x, img->offset.y);
+
+    lv_area_t frame_area;
+    frame_area.x1 = image_area.x1 + gif->iX;
+    frame_area.y1 = image_area.y1 + gif->iY;
+    frame_area.x2 = frame_area.x1 + gif->iWidth - 1;
+    frame_area.y2 = frame_area.y1 + gif->iHeight - 1;
+
+    /*The image is not drawn out of the widget*/
+    if(lv_area_intersect(&frame_area, &frame_area, &obj->coords)) {
+        lv_obj_invalidate_area(obj, &frame_area);
+    }
 }
 
 #endif /*LV_USE_GIF*/
@@ -1670,6 +1670,28 @@ public:
         Individual   ///< Allocate designated memory pool that is only used by current instance.
     };
 
+    /**
+     * @brief Enumeration specifying the rendering quality reductions. The values can be combined with bitwise OR.
+     */
+    enum Quality
+    {
+        QualityFull = 0,          ///< Render everything with the best quality.
+        NoAntiAliasing = 1 << 0,  ///< Disable the anti-aliasing of the shapes' edges.
+        CoarseCurves = 1 << 1,    ///< Flatten the curves with a lower precision to generate less line segments.
+        NoEffects = 1 << 2        ///< Skip the scene post effects, e.g. the gaussian blur.
+    };
+
+    /**
+     * @brief A data structure storing the work done by the sw engine.
+     */
+    struct Stats
+    {
+        uint32_t shapes;       ///< The number of shapes prepared.
+        uint32_t spans;        ///< The number of RLE spans of the rasterized shapes.
+        uint32_t pixels;       ///< The number of pixels blended by the rasterized shapes.
+        uint32_t compositors;  ///< The number of compositor buffers allocated.
+    };
+
     /**
      * @brief Sets the drawing target for the rasterization.
      *
@@ -1716,6 +1738,29 @@ public:
     */
     Result mempool(MempoolPolicy policy) noexcept;
 
+    /**
+     * @brief Sets the rendering quality of the sw engine.
+     *
+     * Lowering the quality trades visual fidelity for rendering speed.
+     * All the paints are updated again on the next Canvas::update() with the new quality.
+     *
+     * @param[in] quality The combination of the Quality flags. The default value is @c Quality::QualityFull.
+     *
+     * @retval Result::InsufficientCondition if the canvas is performing rendering. Please ensure the canvas is synced.
+     * @retval Result::NonSupport In case the software engine is not supported.
+     */
+    Result quality(uint32_t quality) noexcept;
+
+    /**
+     * @brief Gets the work done by the sw engine since the last call and resets the counters.
+     *
+     * @param[out] stats The counters of the engine.
+     *
+     * @retval Result::InvalidArguments In case no valid pointer is provided.
+     * @retval Result::NonSupport In case the software engine is not supported or the counters are disabled (@c LV_PROFILER_THORVG).
+     */
+    Result stats(Stats* stats) noexcept;
+
     /**
      * @brief Creates a new SwCanvas object.
      * @return A new SwCanvas object.
@@ -438,6 +438,29 @@ typedef enum {
 } Tvg_Mempool_Policy;
 
 
+/**
+ * \brief Enumeration specifying the rendering quality reductions of the software engine. The values can be combined with bitwise OR.
+ */
+typedef enum {
+    TVG_SW_QUALITY_FULL = 0,                  ///< Render everything with the best quality.
+    TVG_SW_QUALITY_NO_ANTIALIASING = 1 << 0,  ///< Disable the anti-aliasing of the shapes' edges.
+    TVG_SW_QUALITY_COARSE_CURVES = 1 << 1,    ///< Flatten the curves with a lower precision to generate less line segments.
+    TVG_SW_QUALITY_NO_EFFECTS = 1 << 2        ///< Skip the scene post effects, e.g. the gaussian blur.
+} Tvg_Sw_Quality;
+
+
+/**
+ * \brief A data structure storing the work done by the software engine.
+ */
+typedef struct
+{
+    uint32_t shapes;       /**< The number of shapes prepared. */
+    uint32_t spans;        /**< The number of RLE spans of the rasterized shapes. */
+    uint32_t pixels;       /**< The number of pixels blended by the rasterized shapes. */
+    uint32_t compositors;  /**< The number of compositor buffers allocated. */
+} Tvg_Sw_Stats;
+
+
 /**
  * \brief Enumeration specifying the methods of combining the 8-bit color channels into 32-bit color.
  */
@@ -528,6 +551,36 @@ TVG_API Tvg_Result tvg_swcanvas_set_target(Tvg_Canvas* canvas, uint32_t* buffer,
 */
 TVG_API Tvg_Result tvg_swcanvas_set_mempool(Tvg_Canvas* canvas, Tvg_Mempool_Policy policy);
 
+
+/*!
+* \brief Sets the rendering quality of the software engine.
+*
+* Lowering the quality trades visual fidelity for rendering speed.
+* All the paints are updated again on the next tvg_canvas_update() with the new quality.
+*
+* \param[in] canvas The Tvg_Canvas object of which the quality is to be specified.
+* \param[in] quality The combination of the Tvg_Sw_Quality flags. The default value is @c TVG_SW_QUALITY_FULL.
+*
+* \return Tvg_Result enumeration.
+* \retval TVG_RESULT_INVALID_ARGUMENTS An invalid canvas pointer passed.
+* \retval TVG_RESULT_INSUFFICIENT_CONDITION The canvas is performing rendering.
+* \retval TVG_RESULT_NOT_SUPPORTED The software engine is not supported.
+*/
+TVG_API Tvg_Result tvg_swcanvas_set_quality(Tvg_Canvas* canvas, uint32_t quality);
+
+
+/*!
+* \brief Gets the work done by the software engine since the last call and resets the counters.
+*
+* \param[in] canvas The Tvg_Canvas object of which the counters are to be read.
+* \param[out] stats The counters of the engine.
+*
+* \return Tvg_Result enumeration.
+* \retval TVG_RESULT_INVALID_ARGUMENTS An invalid canvas or stats pointer passed.
+* \retval TVG_RESULT_NOT_SUPPORTED The software engine is not supported or the counters are disabled (LV_PROFILER_THORVG).
+*/
+TVG_API Tvg_Result tvg_swcanvas_get_stats(Tvg_Canvas* canvas, Tvg_Sw_Stats* stats);
+
 /** \} */   // end defgroup ThorVGCapi_SwCanvas
 
 
@@ -86,6 +86,20 @@ TVG_API Tvg_Result tvg_swcanvas_set_mempool(Tvg_Canvas* canvas, Tvg_Mempool_Poli
 }
 
 
+TVG_API Tvg_Result tvg_swcanvas_set_quality(Tvg_Canvas* canvas, uint32_t quality)
+{
+    if (!canvas) return TVG_RESULT_INVALID_ARGUMENT;
+    return (Tvg_Result) reinterpret_cast<SwCanvas*>(canvas)->quality(quality);
+}
+
+
+TVG_API Tvg_Result tvg_swcanvas_get_stats(Tvg_Canvas* canvas, Tvg_Sw_Stats* stats)
+{
+    if (!canvas || !stats) return TVG_RESULT_INVALID_ARGUMENT;
+    return (Tvg_Result) reinterpret_cast<SwCanvas*>(canvas)->stats(reinterpret_cast<SwCanvas::Stats*>(stats));
+}
+
+
 TVG_API Tvg_Result tvg_swcanvas_set_target(Tvg_Canvas* canvas, uint32_t* buffer, uint32_t stride, uint32_t w, uint32_t h, Tvg_Colorspace cs)
 {
     if (!canvas) return TVG_RESULT_INVALID_ARGUMENT;
@@ -28,6 +28,7 @@
 
 #include "config.h"
 #include "thorvg.h"
+#include "../../misc/lv_profiler.h"
 #include <mutex>
 
 // using namespace std;
@@ -37,11 +37,16 @@ void LottieLoader::run(unsigned tid)
 {
     //update frame
     if (comp) {
+        LV_PROFILER_THORVG_BEGIN_TAG("lottie_build");
         builder->update(comp, frameNo);
+        LV_PROFILER_THORVG_END_TAG("lottie_build");
     //initial loading
     } else {
         LottieParser parser(content, dirName);
-        if (!parser.parse()) return;
+        LV_PROFILER_THORVG_BEGIN_TAG("lottie_parse");
+        auto parsed = parser.parse();
+        LV_PROFILER_THORVG_END_TAG("lottie_parse");
+        if (!parsed) return;
         {
             ScopedLock lock(key);
             comp = parser.comp;
@@ -307,18 +312,28 @@ bool LottieLoader::override(const char* slot)
         parser.comp = comp;
 
         auto idx = 0;
+        auto applied = 0;
         while (auto sid = parser.sid(idx == 0)) {
-            for (auto s = comp->slots.begin(); s < comp->slots.end(); ++s) {
+            auto s = comp->slots.begin();
+            for (; s < comp->slots.end(); ++s) {
                 if (strcmp((*s)->sid, sid)) continue;
-                if (!parser.apply(*s)) success = false;
+                if (parser.apply(*s)) ++applied;
+                else success = false;
                 break;
             }
+            //unknown slot, skip its value to continue with the next one
+            if (s == comp->slots.end()) {
+                parser.skip(sid);
+                success = false;
+            }
             ++idx;
         }
 
         if (idx < 1) success = false;
         lv_free(temp);
-        rebuild = overridden = success;
+
+        //only the overridden properties are changed, update the current frame with them
+        if (applied > 0) rebuild = overridden = true;
     //reset slots
     } else if (overridden) {
         for (auto s = comp->slots.begin(); s < comp->slots.end(); ++s) {
@@ -40,6 +40,18 @@
 /* External Class Implementation                                        */
 /************************************************************************/
 
+static LottieOpacity* _opacity(LottieObject* obj)
+{
+    switch (obj->type) {
+        case LottieObject::SolidFill:
+        case LottieObject::SolidStroke: return &static_cast<LottieSolid*>(obj)->opacity;
+        case LottieObject::GradientFill:
+        case LottieObject::GradientStroke: return &static_cast<LottieGradient*>(obj)->opacity;
+        default: return nullptr;
+    }
+}
+
+
 void LottieSlot::reset()
 {
     if (!overridden) return;
@@ -58,6 +70,14 @@ void LottieSlot::reset()
                 static_cast<LottieColor*>(pair->prop)->frames = nullptr;
                 break;
             }
+            case LottieProperty::Type::Opacity: {
+                auto opacity = _opacity(pair->obj);
+                if (!opacity || !pair->prop) break;
+                opacity->release();
+                *opacity = *static_cast<LottieOpacity*>(pair->prop);
+                static_cast<LottieOpacity*>(pair->prop)->frames = nullptr;
+                break;
+            }
             case LottieProperty::Type::TextDoc: {
                 static_cast<LottieText*>(pair->obj)->doc.release();
                 static_cast<LottieText*>(pair->obj)->doc = *static_cast<LottieTextDoc*>(pair->prop);
@@ -97,6 +117,19 @@ void LottieSlot::assign(LottieObject* target)
                 pair->obj->override(&static_cast<LottieSolid*>(target)->color);
                 break;
             }
+            case LottieProperty::Type::Opacity: {
+                auto opacity = _opacity(pair->obj);
+                if (!opacity) break;
+                if (!overridden) {
+                    pair->prop = new LottieOpacity;
+                    *static_cast<LottieOpacity*>(pair->prop) = *opacity;
+                }
+                //drop the keyframes of a previous override
+                else opacity->release();
+
+                *opacity = static_cast<LottieSolid*>(target)->opacity;
+                break;
+            }
             case LottieProperty::Type::TextDoc: {
                 if (!overridden) {
                     pair->prop = new LottieTextDoc;
@@ -498,12 +498,14 @@ void LottieParser::parseProperty(T& prop, LottieObject* obj)
         else if (obj && KEY_AS("sid")) {
             auto sid = getStringCopy();
             //append object if the slot already exists.
-            for (auto slot = comp->slots.begin(); slot < comp->slots.end(); ++slot) {
+            auto slot = comp->slots.begin();
+            for (; slot < comp->slots.end(); ++slot) {
                 if (strcmp((*slot)->sid, sid)) continue;
                 (*slot)->pairs.push({obj, 0});
+                lv_free(sid);
                 break;
             }
-            comp->slots.push(new LottieSlot(sid, obj, type));
+            if (slot == comp->slots.end()) comp->slots.push(new LottieSlot(sid, obj, type));
         } else if (KEY_AS("x")) {
             prop.exp = _expression(getStringCopy(), comp, context.layer, context.parent, &prop);
         } else if (KEY_AS("ix")) {
@@ -1452,6 +1454,12 @@ bool LottieParser::apply(LottieSlot* slot)
             parseSlotProperty<LottieProperty::Type::Color>(static_cast<LottieSolid*>(obj)->color);
             break;
         }
+        case LottieProperty::Type::Opacity: {
+            obj = new LottieSolid;
+            context.parent = obj;
+            parseSlotProperty<LottieProperty::Type::Opacity>(static_cast<LottieSolid*>(obj)->opacity);
+            break;
+        }
         case LottieProperty::Type::TextDoc: {
             obj = new LottieText;
             context.parent = obj;
@@ -1461,7 +1469,11 @@ bool LottieParser::apply(LottieSlot* slot)
         default: break;
     }
 
-    if (!obj || Invalid()) return false;
+    if (!obj) return false;
+    if (Invalid()) {
+        delete(obj);
+        return false;
+    }
 
     slot->assign(obj);
 
@@ -118,6 +118,7 @@ struct LottieProperty
     enum class Type : uint8_t { Point = 0, Float, Opacity, Color, PathSet, ColorStop, Position, TextDoc, Invalid };
 
     LottieExpression* exp = nullptr;
+    uint32_t cursor = 0;  //the last looked up keyframe
     Type type;
     uint8_t ix;  //property index
 
@@ -200,6 +201,19 @@ uint32_t _bsearch(T* frames, float frameNo)
 }
 
 
+//Sequential playback and seeking inside the last keyframe interval hit the cursor without searching
+template<typename T>
+uint32_t _bsearch(T* frames, float frameNo, uint32_t& cursor)
+{
+    if (cursor + 1 < frames->count && frames->data[cursor].no <= frameNo) {
+        if (frameNo < frames->data[cursor + 1].no) return cursor;
+        if (cursor + 2 < frames->count && frameNo < frames->data[cursor + 2].no) return ++cursor;
+    }
+    cursor = _bsearch(frames, frameNo);
+    return cursor;
+}
+
+
 template<typename T>
 uint32_t _nearest(T* frames, float frameNo)
 {
@@ -317,7 +331,7 @@ struct LottieGenericProperty : LottieProperty
         if (frames->count == 1 || frameNo <= frames->first().no) return frames->first().value;
         if (frameNo >= frames->last().no) return frames->last().value;
 
-        auto frame = frames->data + _bsearch(frames, frameNo);
+        auto frame = frames->data + _bsearch(frames, frameNo, cursor);
         if (tvg::equal(frame->no, frameNo)) return frame->value;
         return frame->interpolate(frame + 1, frameNo);
     }
@@ -423,7 +437,7 @@ struct LottiePathSet : LottieProperty
         else if (frames->count == 1 || frameNo <= frames->first().no) path = &frames->first().value;
         else if (frameNo >= frames->last().no) path = &frames->last().value;
         else {
-            frame = frames->data + _bsearch(frames, frameNo);
+            frame = frames->data + _bsearch(frames, frameNo, cursor);
             if (tvg::equal(frame->no, frameNo)) path = &frame->value;
             else if (frame->value.ptsCnt != (frame + 1)->value.ptsCnt) {
                 path = &frame->value;
@@ -588,7 +602,7 @@ struct LottieColorStop : LottieProperty
             return fill->colorStops(frames->last().value.data, count);
         }
 
-        auto frame = frames->data + _bsearch(frames, frameNo);
+        auto frame = frames->data + _bsearch(frames, frameNo, cursor);
         if (tvg::equal(frame->no, frameNo)) return fill->colorStops(frame->value.data, count);
 
         //interpolate
@@ -699,7 +713,7 @@ struct LottiePosition : LottieProperty
         if (frames->count == 1 || frameNo <= frames->first().no) return frames->first().value;
         if (frameNo >= frames->last().no) return frames->last().value;
 
-        auto frame = frames->data + _bsearch(frames, frameNo);
+        auto frame = frames->data + _bsearch(frames, frameNo, cursor);
         if (tvg::equal(frame->no, frameNo)) return frame->value;
         return frame->interpolate(frame + 1, frameNo);
     }
@@ -724,7 +738,7 @@ struct LottiePosition : LottieProperty
             return frame->angle(frame + 1, frames->last().no);
         }
 
-        auto frame = frames->data + _bsearch(frames, frameNo);
+        auto frame = frames->data + _bsearch(frames, frameNo, cursor);
         return frame->angle(frame + 1, frameNo);
     }
 
@@ -812,7 +826,7 @@ struct LottieTextDoc : LottieProperty
         if (frames->count == 1 || frameNo <= frames->first().no) return frames->first().value;
         if (frameNo >= frames->last().no) return frames->last().value;
 
-        auto frame = frames->data + _bsearch(frames, frameNo);
+        auto frame = frames->data + _bsearch(frames, frameNo, cursor);
         return frame->value;
     }
 
@@ -82,6 +82,46 @@ Result SwCanvas::mempool(MempoolPolicy policy) noexcept
 }
 
 
+Result SwCanvas::quality(uint32_t quality) noexcept
+{
+#ifdef THORVG_SW_RASTER_SUPPORT
+    if (Canvas::pImpl->status != Status::Damaged && Canvas::pImpl->status != Status::Synced) {
+        return Result::InsufficientCondition;
+    }
+
+    //We know renderer type, avoid dynamic_cast for performance.
+    auto renderer = static_cast<SwRenderer*>(Canvas::pImpl->renderer);
+    if (!renderer) return Result::MemoryCorruption;
+
+    if (renderer->quality() == quality) return Result::Success;
+    renderer->quality(quality);
+
+    //Paints must be updated again with the new quality.
+    Canvas::pImpl->status = Status::Damaged;
+
+    return Result::Success;
+#endif
+    return Result::NonSupport;
+}
+
+
+Result SwCanvas::stats(Stats* stats) noexcept
+{
+#if defined(THORVG_SW_RASTER_SUPPORT) && LV_USE_PROFILER && LV_PROFILER_THORVG
+    if (!stats) return Result::InvalidArguments;
+
+    //We know renderer type, avoid dynamic_cast for performance.
+    auto renderer = static_cast<SwRenderer*>(Canvas::pImpl->renderer);
+    if (!renderer) return Result::MemoryCorruption;
+
+    renderer->stats(stats);
+
+    return Result::Success;
+#endif
+    return Result::NonSupport;
+}
+
+
 Result SwCanvas::target(uint32_t* buffer, uint32_t stride, uint32_t w, uint32_t h, Colorspace cs) noexcept
 {
 #ifdef THORVG_SW_RASTER_SUPPORT
@@ -26,6 +26,7 @@
 #include "tvgMath.h"
 #include "tvgSwCommon.h"
 #include "tvgFill.h"
+#include "../../misc/cache/lv_cache.h"
 
 /************************************************************************/
 /* Internal Class Implementation                                        */
@@ -105,20 +106,20 @@ static inline uint32_t _alphaUnblend(uint32_t c)
 }
 
 
-static void _applyAA(const SwFill* fill, uint32_t begin, uint32_t end)
+static void _applyAA(uint32_t* ctable, uint32_t begin, uint32_t end)
 {
     if (begin == 0 || end == 0) return;
 
     auto i = GRADIENT_STOP_SIZE - end;
-    auto rgbaEnd = _alphaUnblend(fill->ctable[i]);
-    auto rgbaBegin = _alphaUnblend(fill->ctable[begin]);
+    auto rgbaEnd = _alphaUnblend(ctable[i]);
+    auto rgbaBegin = _alphaUnblend(ctable[begin]);
 
     auto dt = 1.0f / (begin + end + 1.0f);
     float t = dt;
     while (i != begin) {
         auto dist = 255 - static_cast<int32_t>(255 * t);
         auto color = INTERPOLATE(rgbaEnd, rgbaBegin, dist);
-        fill->ctable[i++] = ALPHA_BLEND((color | 0xff000000), (color >> 24));
+        ctable[i++] = ALPHA_BLEND((color | 0xff000000), (color >> 24));
 
         if (i == GRADIENT_STOP_SIZE) i = 0;
         t += dt;
@@ -126,43 +127,27 @@ static void _applyAA(const SwFill* fill, uint32_t begin, uint32_t end)
 }
 
 
-static bool _updateColorTable(SwFill* fill, const Fill* fdata, const SwSurface* surface, uint8_t opacity)
+//If repeat is true, anti-aliasing is applied between the last and the first colors on iAABegin colors.
+static void _buildColorTable(uint32_t* ctable, const Fill::ColorStop* colors, uint32_t cnt, SwJoin join, uint8_t opacity, bool repeat, uint32_t iAABegin)
 {
-    if (fill->solid) return true;
-
-    if (!fill->ctable) {
-        fill->ctable = static_cast<uint32_t*>(lv_malloc(GRADIENT_STOP_SIZE * sizeof(uint32_t)));
-        LV_ASSERT_MALLOC(fill->ctable);
-        if (!fill->ctable) return false;
-    }
-
-    const Fill::ColorStop* colors;
-    auto cnt = fdata->colorStops(&colors);
-    if (cnt == 0 || !colors) return false;
-
     auto pColors = colors;
 
     auto a = MULTIPLY(pColors->a, opacity);
-    if (a < 255) fill->translucent = true;
-
     auto r = pColors->r;
     auto g = pColors->g;
     auto b = pColors->b;
-    auto rgba = surface->join(r, g, b, a);
+    auto rgba = join(r, g, b, a);
 
     auto inc = 1.0f / static_cast<float>(GRADIENT_STOP_SIZE);
     auto pos = 1.5f * inc;
     uint32_t i = 0;
 
-    //If repeat is true, anti-aliasing must be applied between the last and the first colors.
-    auto repeat = fill->spread == FillSpread::Repeat;
-    uint32_t iAABegin = repeat ? _estimateAAMargin(fdata) : 0;
     uint32_t iAAEnd = 0;
 
-    fill->ctable[i++] = ALPHA_BLEND(rgba | 0xff000000, a);
+    ctable[i++] = ALPHA_BLEND(rgba | 0xff000000, a);
 
     while (pos <= pColors->offset) {
-        fill->ctable[i] = fill->ctable[i - 1];
+        ctable[i] = ctable[i - 1];
         ++i;
         pos += inc;
     }
@@ -177,9 +162,8 @@ static bool _updateColorTable(SwFill* fill, const Fill* fdata, const SwSurface*
         auto next = curr + 1;
         auto delta = 1.0f / (next->offset - curr->offset);
         auto a2 = MULTIPLY(next->a, opacity);
-        if (!fill->translucent && a2 < 255) fill->translucent = true;
 
-        auto rgba2 = surface->join(next->r, next->g, next->b, a2);
+        auto rgba2 = join(next->r, next->g, next->b, a2);
 
         while (pos < next->offset && i < GRADIENT_STOP_SIZE) {
             auto t = (pos - curr->offset) * delta;
@@ -187,7 +171,7 @@ static bool _updateColorTable(SwFill* fill, const Fill* fdata, const SwSurface*
             auto dist2 = 255 - dist;
 
             auto color = INTERPOLATE(rgba, rgba2, dist2);
-            fill->ctable[i] = ALPHA_BLEND((color | 0xff000000), (color >> 24));
+            ctable[i] = ALPHA_BLEND((color | 0xff000000), (color >> 24));
 
             ++i;
             pos += inc;
@@ -200,12 +184,106 @@ static bool _updateColorTable(SwFill* fill, const Fill* fdata, const SwSurface*
     rgba = ALPHA_BLEND((rgba | 0xff000000), a);
 
     for (; i < GRADIENT_STOP_SIZE; ++i)
-        fill->ctable[i] = rgba;
+        ctable[i] = rgba;
 
     //For repeat fill spread apply anti-aliasing between the last and first colors,
     //othewise make sure the last color stop is represented at the end of the table.
-    if (repeat) _applyAA(fill, iAABegin, iAAEnd);
-    else fill->ctable[GRADIENT_STOP_SIZE - 1] = rgba;
+    if (repeat) _applyAA(ctable, iAABegin, iAAEnd);
+    else ctable[GRADIENT_STOP_SIZE - 1] = rgba;
+}
+
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+
+#define CACHED_STOPS_MAX 16
+
+//Everything the color table is built from. Only the used stops are the part of the key.
+struct ColorTableKey
+{
+    SwJoin join;
+    uint32_t opacity;
+    uint32_t repeat;
+    uint32_t iAABegin;
+    uint32_t cnt;
+    Fill::ColorStop stops[CACHED_STOPS_MAX];
+};
+
+
+static void _buildColorTableCb(void* table, lv_cache_entry_t* entry, void* userData)
+{
+    LV_UNUSED(entry);
+
+    auto key = static_cast<const ColorTableKey*>(userData);
+    _buildColorTable(static_cast<uint32_t*>(table), key->stops, key->cnt, key->join, key->opacity, key->repeat, key->iAABegin);
+}
+
+
+static void _releaseColorTable(SwFill* fill)
+{
+    if (!fill->ctableEntry) return;
+    lv_grad_cache_release(fill->ctableEntry);
+    fill->ctableEntry = nullptr;
+    fill->ctable = nullptr;
+}
+
+
+//Share the table of the same stops (e.g. the same gradient in each frame of an animation) from the gradient cache
+static bool _acquireColorTable(SwFill* fill, const Fill::ColorStop* colors, uint32_t cnt, SwJoin join, uint8_t opacity, bool repeat, uint32_t iAABegin)
+{
+    if (cnt > CACHED_STOPS_MAX) return false;
+
+    ColorTableKey key;
+    memset(&key, 0, sizeof(key));
+    key.join = join;
+    key.opacity = opacity;
+    key.repeat = repeat;
+    key.iAABegin = iAABegin;
+    key.cnt = cnt;
+    memcpy(key.stops, colors, cnt * sizeof(Fill::ColorStop));
+
+    auto keySize = static_cast<uint32_t>(offsetof(ColorTableKey, stops) + cnt * sizeof(Fill::ColorStop));
+    auto entry = lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_THORVG, &key, keySize, GRADIENT_STOP_SIZE * sizeof(uint32_t), _buildColorTableCb, &key);
+    if (!entry) return false;
+
+    if (fill->ctable) lv_free(fill->ctable);
+    fill->ctable = static_cast<uint32_t*>(lv_grad_cache_entry_get_table(entry));
+    fill->ctableEntry = entry;
+    return true;
+}
+
+#endif
+
+
+static bool _updateColorTable(SwFill* fill, const Fill* fdata, const SwSurface* surface, uint8_t opacity)
+{
+    if (fill->solid) return true;
+
+    const Fill::ColorStop* colors;
+    auto cnt = fdata->colorStops(&colors);
+    if (cnt == 0 || !colors) return false;
+
+    for (uint32_t j = 0; j < cnt; ++j) {
+        if (MULTIPLY(colors[j].a, opacity) < 255) {
+            fill->translucent = true;
+            break;
+        }
+    }
+
+    auto repeat = fill->spread == FillSpread::Repeat;
+    uint32_t iAABegin = repeat ? _estimateAAMargin(fdata) : 0;
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+    _releaseColorTable(fill);
+    if (_acquireColorTable(fill, colors, cnt, surface->join, opacity, repeat, iAABegin)) return true;
+#endif
+
+    if (!fill->ctable) {
+        fill->ctable = static_cast<uint32_t*>(lv_malloc(GRADIENT_STOP_SIZE * sizeof(uint32_t)));
+        LV_ASSERT_MALLOC(fill->ctable);
+        if (!fill->ctable) return false;
+    }
+
+    _buildColorTable(fill->ctable, colors, cnt, surface->join, opacity, repeat, iAABegin);
 
     return true;
 }
@@ -857,6 +935,9 @@ const Fill::ColorStop* fillFetchSolid(const SwFill* fill, const Fill* fdata)
 
 void fillReset(SwFill* fill)
 {
+#if LV_GRADIENT_CACHE_SIZE > 0
+    _releaseColorTable(fill);
+#endif
     if (fill->ctable) {
         lv_free(fill->ctable);
         fill->ctable = nullptr;
@@ -870,6 +951,9 @@ void fillFree(SwFill* fill)
 {
     if (!fill) return;
 
+#if LV_GRADIENT_CACHE_SIZE > 0
+    _releaseColorTable(fill);
+#endif
     if (fill->ctable) lv_free(fill->ctable);
 
     lv_free(fill);
@@ -48,6 +48,7 @@ struct SwTask : Task
     Matrix transform;
     Array<RenderData> clips;
     RenderUpdateFlag flags = RenderUpdateFlag::None;
+    uint32_t quality = 0;                 //SwCanvas::Quality flags
     uint8_t opacity;
     bool pushed = false;                  //Pushed into task list?
     bool disposed = false;                //Disposed task?
@@ -137,7 +138,10 @@ struct SwShapeTask : SwTask
             visibleFill = (alpha > 0 || rshape->fill);
             shapeReset(&shape);
             if (visibleFill || clipper) {
-                if (!shapePrepare(&shape, rshape, transform, bbox, renderRegion, mpool, tid, clips.count > 0 ? true : false)) {
+                LV_PROFILER_THORVG_BEGIN_TAG("sw_shape_outline");
+                auto prepared = shapePrepare(&shape, rshape, transform, bbox, renderRegion, mpool, tid, clips.count > 0 ? true : false);
+                LV_PROFILER_THORVG_END_TAG("sw_shape_outline");
+                if (!prepared) {
                     visibleFill = false;
                     renderRegion.reset();
                 }
@@ -146,7 +150,11 @@ struct SwShapeTask : SwTask
         //Fill
         if (flags & (RenderUpdateFlag::Path |RenderUpdateFlag::Gradient | RenderUpdateFlag::Transform | RenderUpdateFlag::Color)) {
             if (visibleFill || clipper) {
-                if (!shapeGenRle(&shape, rshape, antialiasing(strokeWidth))) goto err;
+                auto antiAlias = !(quality & SwCanvas::NoAntiAliasing) && antialiasing(strokeWidth);
+                LV_PROFILER_THORVG_BEGIN_TAG("sw_shape_rle");
+                auto generated = shapeGenRle(&shape, rshape, antiAlias, quality & SwCanvas::CoarseCurves);
+                LV_PROFILER_THORVG_END_TAG("sw_shape_rle");
+                if (!generated) goto err;
             }
             if (auto fill = rshape->fill) {
                 auto ctable = (flags & RenderUpdateFlag::Gradient) ? true : false;
@@ -161,7 +169,10 @@ struct SwShapeTask : SwTask
             if (strokeWidth > 0.0f) {
                 shapeResetStroke(&shape, rshape, transform);
 
-                if (!shapeGenStrokeRle(&shape, rshape, transform, bbox, renderRegion, mpool, tid)) goto err;
+                LV_PROFILER_THORVG_BEGIN_TAG("sw_stroke_rle");
+                auto generated = shapeGenStrokeRle(&shape, rshape, transform, bbox, renderRegion, mpool, tid, !(quality & SwCanvas::NoAntiAliasing), quality & SwCanvas::CoarseCurves);
+                LV_PROFILER_THORVG_END_TAG("sw_stroke_rle");
+                if (!generated) goto err;
                 if (auto fill = rshape->strokeFill()) {
                     auto ctable = (flags & RenderUpdateFlag::GradientStroke) ? true : false;
                     if (ctable) shapeResetStrokeFill(&shape);
@@ -233,7 +244,10 @@ struct SwImageTask : SwTask
             imageReset(&image);
             if (!image.data || image.w == 0 || image.h == 0) goto end;
 
-            if (!imagePrepare(&image, transform, clipRegion, bbox, mpool, tid)) goto end;
+            LV_PROFILER_THORVG_BEGIN_TAG("sw_image_prepare");
+            auto prepared = imagePrepare(&image, transform, clipRegion, bbox, mpool, tid);
+            LV_PROFILER_THORVG_END_TAG("sw_image_prepare");
+            if (!prepared) goto end;
 
             if (clips.count > 0) {
                 if (!imageGenRle(&image, bbox, false)) goto end;
@@ -283,6 +297,19 @@ static void _renderFill(SwShapeTask* task, SwSurface* surface, uint8_t opacity)
     }
 }
 
+#if LV_USE_PROFILER && LV_PROFILER_THORVG
+static uint32_t _pixels(const SwRle* rle)
+{
+    if (!rle) return 0;
+
+    uint32_t cnt = 0;
+    for (auto span = rle->spans; span < rle->spans + rle->size; ++span) {
+        cnt += span->len;
+    }
+    return cnt;
+}
+#endif
+
 static void _renderStroke(SwShapeTask* task, SwSurface* surface, uint8_t opacity)
 {
     uint8_t r, g, b, a;
@@ -344,6 +371,27 @@ bool SwRenderer::sync()
 }
 
 
+#if LV_USE_PROFILER && LV_PROFILER_THORVG
+void SwRenderer::stats(SwCanvas::Stats* out)
+{
+    *out = counters;
+    counters = {};
+}
+#endif
+
+
+uint32_t SwRenderer::quality()
+{
+    return qualityFlags;
+}
+
+
+void SwRenderer::quality(uint32_t flags)
+{
+    qualityFlags = flags;
+}
+
+
 RenderRegion SwRenderer::viewport()
 {
     return vport;
@@ -419,7 +467,11 @@ bool SwRenderer::renderImage(RenderData data)
 
     if (task->opacity == 0) return true;
 
-    return rasterImage(surface, &task->image, task->transform, task->bbox, task->opacity);
+    LV_PROFILER_THORVG_BEGIN_TAG("sw_raster_image");
+    auto ret = rasterImage(surface, &task->image, task->transform, task->bbox, task->opacity);
+    LV_PROFILER_THORVG_END_TAG("sw_raster_image");
+
+    return ret;
 }
 
 
@@ -433,6 +485,7 @@ bool SwRenderer::renderShape(RenderData data)
     if (task->opacity == 0) return true;
 
     //Main raster stage
+    LV_PROFILER_THORVG_BEGIN_TAG("sw_raster_shape");
     if (task->rshape->stroke && task->rshape->stroke->strokeFirst) {
         _renderStroke(task, surface, task->opacity);
         _renderFill(task, surface, task->opacity);
@@ -440,6 +493,16 @@ bool SwRenderer::renderShape(RenderData data)
         _renderFill(task, surface, task->opacity);
         _renderStroke(task, surface, task->opacity);
     }
+    LV_PROFILER_THORVG_END_TAG("sw_raster_shape");
+
+#if LV_USE_PROFILER && LV_PROFILER_THORVG
+    auto& shape = task->shape;
+    if (shape.fastTrack) counters.pixels += (shape.bbox.max.x - shape.bbox.min.x) * (shape.bbox.max.y - shape.bbox.min.y);
+    else counters.pixels += _pixels(shape.rle);
+    counters.pixels += _pixels(shape.strokeRle);
+    if (shape.rle) counters.spans += shape.rle->size;
+    if (shape.strokeRle) counters.spans += shape.strokeRle->size;
+#endif
 
     return true;
 }
@@ -578,6 +641,9 @@ SwSurface* SwRenderer::request(int channelSize)
         cmp->h = cmp->compositor->image.h;
 
         compositors.push(cmp);
+#if LV_USE_PROFILER && LV_PROFILER_THORVG
+        ++counters.compositors;
+#endif
     }
 
     //Sync. This may have been modified by post-processing.
@@ -641,7 +707,10 @@ bool SwRenderer::endComposite(RenderCompositor* cmp)
     //Default is alpha blending
     if (p->method == CompositeMethod::None) {
         Matrix m = {1, 0, 0, 0, 1, 0, 0, 0, 1};
-        return rasterImage(surface, &p->image, m, p->bbox, p->opacity);
+        LV_PROFILER_THORVG_BEGIN_TAG("sw_composite");
+        auto ret = rasterImage(surface, &p->image, m, p->bbox, p->opacity);
+        LV_PROFILER_THORVG_END_TAG("sw_composite");
+        return ret;
     }
 
     return true;
@@ -659,13 +728,21 @@ bool SwRenderer::prepare(RenderEffect* effect)
 
 bool SwRenderer::effect(RenderCompositor* cmp, const RenderEffect* effect)
 {
+    //Keep the content of the scene as it is
+    if (qualityFlags & SwCanvas::NoEffects) return true;
+
     auto p = static_cast<SwCompositor*>(cmp);
     auto& buffer = request(surface->channelSize)->compositor->image;
+    auto ret = false;
 
+    LV_PROFILER_THORVG_BEGIN_TAG("sw_effect");
     switch (effect->type) {
-        case SceneEffect::GaussianBlur: return effectGaussianBlur(p->image, buffer, p->bbox, static_cast<const RenderEffectGaussian*>(effect));
-        default: return false;
+        case SceneEffect::GaussianBlur: ret = effectGaussianBlur(p->image, buffer, p->bbox, static_cast<const RenderEffectGaussian*>(effect)); break;
+        default: break;
     }
+    LV_PROFILER_THORVG_END_TAG("sw_effect");
+
+    return ret;
 }
 
 
@@ -711,6 +788,7 @@ void* SwRenderer::prepareCommon(SwTask* task, const Matrix& transform, const Arr
     task->surface = surface;
     task->mpool = mpool;
     task->flags = flags;
+    task->quality = qualityFlags;
     task->bbox.min.x = std::max(static_cast<SwCoord>(0), static_cast<SwCoord>(vport.x));
     task->bbox.min.y = std::max(static_cast<SwCoord>(0), static_cast<SwCoord>(vport.y));
     task->bbox.max.x = std::min(static_cast<SwCoord>(surface->w), static_cast<SwCoord>(vport.x + vport.w));
@@ -750,6 +828,10 @@ RenderData SwRenderer::prepare(const RenderShape& rshape, RenderData data, const
     task->rshape = &rshape;
     task->clipper = clipper;
 
+#if LV_USE_PROFILER && LV_PROFILER_THORVG
+    if (surface && flags != RenderUpdateFlag::None) ++counters.shapes;
+#endif
+
     return prepareCommon(task, transform, clips, opacity, flags);
 }
 
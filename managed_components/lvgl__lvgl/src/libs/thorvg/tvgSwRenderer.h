@@ -57,6 +57,11 @@ public:
     bool sync() override;
     bool target(pixel_t* data, uint32_t stride, uint32_t w, uint32_t h, ColorSpace cs);
     bool mempool(bool shared);
+    uint32_t quality();
+    void quality(uint32_t flags);
+#if LV_USE_PROFILER && LV_PROFILER_THORVG
+    void stats(SwCanvas::Stats* out);
+#endif
 
     RenderCompositor* target(const RenderRegion& region, ColorSpace cs) override;
     bool beginComposite(RenderCompositor* cmp, CompositeMethod method, uint8_t opacity) override;
@@ -77,6 +82,10 @@ private:
     Array<SwSurface*>    compositors;                 //render targets cache list
     SwMpool*             mpool;                       //private memory pool
     RenderRegion         vport;                       //viewport
+    uint32_t             qualityFlags = 0;            //SwCanvas::Quality flags
+#if LV_USE_PROFILER && LV_PROFILER_THORVG
+    SwCanvas::Stats      counters = {};               //work done since the last stats() call
+#endif
     bool                 sharedMpool = true;          //memory-pool behavior policy
 
     SwRenderer();
@@ -254,6 +254,8 @@ struct RleWorker
     Cell** yCells;
     SwCoord yCnt;
 
+    SwCoord flatness;    //tolerance of the curve flattening
+
     bool invalid;
     bool antiAlias;
 };
@@ -666,7 +668,7 @@ static void _cubicTo(RleWorker& rw, const SwPoint& ctrl1, const SwPoint& ctrl2,
             if (L > SHRT_MAX) goto split;
 
             //max deviation may be as much as (s/L) * 3/4 (if Hain's v = 1)
-            auto sLimit = L * (ONE_PIXEL / 6);
+            auto sLimit = L * rw.flatness;
 
             auto diff1 = arc[1] - arc[0];
             auto s = diff.y * diff1.x - diff.x * diff1.y;
@@ -853,7 +855,7 @@ void _replaceClipSpan(SwRle *rle, SwSpan* clippedSpans, uint32_t size)
 /* External Class Implementation                                        */
 /************************************************************************/
 
-SwRle* rleRender(SwRle* rle, const SwOutline* outline, const SwBBox& renderRegion, bool antiAlias)
+SwRle* rleRender(SwRle* rle, const SwOutline* outline, const SwBBox& renderRegion, bool antiAlias, bool coarse)
 {
     constexpr auto RENDER_POOL_SIZE = 16384L;
     constexpr auto BAND_SIZE = 40;
@@ -880,6 +882,8 @@ SwRle* rleRender(SwRle* rle, const SwOutline* outline, const SwBBox& renderRegio
     rw.bandSize = rw.bufferSize / (sizeof(Cell) * 2);  //bandSize: 256
     rw.bandShoot = 0;
     rw.antiAlias = antiAlias;
+    //Coarse curves may deviate 3x more from the ideal curve
+    rw.flatness = coarse ? (ONE_PIXEL / 2) : (ONE_PIXEL / 6);
 
     if (!rle) {
     	rw.rle = reinterpret_cast<SwRle*>(lv_zalloc(sizeof(SwRle)));
@@ -230,6 +230,57 @@
     #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Serve the small allocations of `lv_malloc()` (<= 256 bytes) from pages split to size classes.
+ *  Each thread keeps a few free blocks per size class to allocate and free them without locking.
+ *  Larger allocations go to the allocator selected by `LV_USE_STDLIB_MALLOC`.
+ *  Adds 8 bytes to each allocation. */
+#ifndef LV_USE_MEM_SLAB
+    #ifdef CONFIG_LV_USE_MEM_SLAB
+        #define LV_USE_MEM_SLAB CONFIG_LV_USE_MEM_SLAB
+    #else
+        #define LV_USE_MEM_SLAB 0
+    #endif
+#endif
+#if LV_USE_MEM_SLAB
+    /** Size of the pages the blocks are allocated in, in bytes */
+    #ifndef LV_MEM_SLAB_PAGE_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_PAGE_SIZE
+            #define LV_MEM_SLAB_PAGE_SIZE CONFIG_LV_MEM_SLAB_PAGE_SIZE
+        #else
+            #define LV_MEM_SLAB_PAGE_SIZE (4 * 1024)
+        #endif
+    #endif
+
+    /** Number of free blocks per size class each thread can keep. 0: always lock the shared pages */
+    #ifndef LV_MEM_SLAB_MAGAZINE_SIZE
+        #ifdef CONFIG_LV_MEM_SLAB_MAGAZINE_SIZE
+            #define LV_MEM_SLAB_MAGAZINE_SIZE CONFIG_LV_MEM_SLAB_MAGAZINE_SIZE
+        #else
+            #define LV_MEM_SLAB_MAGAZINE_SIZE 16
+        #endif
+    #endif
+#endif
+
+/** 1: Record `lv_malloc()`, `lv_realloc()` and `lv_free()` calls in a ring buffer
+ *  with the size, a subsystem tag and a timestamp. See `lv_mem_trace_start()`. */
+#ifndef LV_USE_MEM_TRACE
+    #ifdef CONFIG_LV_USE_MEM_TRACE
+        #define LV_USE_MEM_TRACE CONFIG_LV_USE_MEM_TRACE
+    #else
+        #define LV_USE_MEM_TRACE 0
+    #endif
+#endif
+#if LV_USE_MEM_TRACE
+    /** Number of calls kept in the ring buffer. Each takes 20 bytes. */
+    #ifndef LV_MEM_TRACE_BUF_SIZE
+        #ifdef CONFIG_LV_MEM_TRACE_BUF_SIZE
+            #define LV_MEM_TRACE_BUF_SIZE CONFIG_LV_MEM_TRACE_BUF_SIZE
+        #else
+            #define LV_MEM_TRACE_BUF_SIZE 4096
+        #endif
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -243,6 +294,47 @@
     #endif
 #endif
 
+/** 1: Keep the timers in a min-heap ordered by their next deadline.
+ *  Finding the ready timers and the time until the next one is O(log n) instead of scanning all timers,
+ *  and the animation timer sleeps until the next delayed or paused animation is due.
+ *  Uses about 24 bytes of extra memory per timer. */
+#ifndef LV_USE_TIMER_HEAP
+    #ifdef CONFIG_LV_USE_TIMER_HEAP
+        #define LV_USE_TIMER_HEAP CONFIG_LV_USE_TIMER_HEAP
+    #else
+        #define LV_USE_TIMER_HEAP   0
+    #endif
+#endif
+
+/** 1: Merge the invalidated areas by comparing the cost of rendering them separately or joined.
+ *  Rendering an area has a fixed cost too (preparing the layers, flushing, etc.), which is given as
+ *  the number of pixels which could be rendered meanwhile. It can be changed by `lv_display_set_inv_area_cost()`.
+ *  The invalidated area buffer also grows up to `LV_INV_BUF_MAX_SIZE` areas instead of
+ *  refreshing the whole screen when it's full. */
+#ifndef LV_USE_INV_AREA_COST_MODEL
+    #ifdef CONFIG_LV_USE_INV_AREA_COST_MODEL
+        #define LV_USE_INV_AREA_COST_MODEL CONFIG_LV_USE_INV_AREA_COST_MODEL
+    #else
+        #define LV_USE_INV_AREA_COST_MODEL  0
+    #endif
+#endif
+#if LV_USE_INV_AREA_COST_MODEL
+    #ifndef LV_INV_AREA_COST_PX
+        #ifdef CONFIG_LV_INV_AREA_COST_PX
+            #define LV_INV_AREA_COST_PX CONFIG_LV_INV_AREA_COST_PX
+        #else
+            #define LV_INV_AREA_COST_PX     2048    /**< [px] Default fixed cost of an area */
+        #endif
+    #endif
+    #ifndef LV_INV_BUF_MAX_SIZE
+        #ifdef CONFIG_LV_INV_BUF_MAX_SIZE
+            #define LV_INV_BUF_MAX_SIZE CONFIG_LV_INV_BUF_MAX_SIZE
+        #else
+            #define LV_INV_BUF_MAX_SIZE     256     /**< Max number of invalidated areas to store */
+        #endif
+    #endif
+#endif
+
 /** Default Dots Per Inch. Used to initialize default sizes such as widgets sized, style paddings.
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #ifndef LV_DPI_DEF
@@ -1456,6 +1548,17 @@
     #endif
 #endif
 
+/** Size of the label coverage cache in bytes. Labels enabled with `lv_label_set_render_cache()`
+ *  keep the rendered coverage (A8) of their whole text in this cache, so that redrawing an
+ *  unchanged label is a single masked fill. 0: disable. */
+#ifndef LV_DRAW_LABEL_CACHE_SIZE
+    #ifdef CONFIG_LV_DRAW_LABEL_CACHE_SIZE
+        #define LV_DRAW_LABEL_CACHE_SIZE CONFIG_LV_DRAW_LABEL_CACHE_SIZE
+    #else
+        #define LV_DRAW_LABEL_CACHE_SIZE 0
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1466,6 +1569,17 @@
     #endif
 #endif
 
+/** Size of the gradient table cache in bytes. The SW renderer and ThorVG keep the color tables
+ *  of the gradients here, keyed by the stops (and opacity and color format), so that
+ *  redrawing the same gradient doesn't build its table again. 0: disable. */
+#ifndef LV_GRADIENT_CACHE_SIZE
+    #ifdef CONFIG_LV_GRADIENT_CACHE_SIZE
+        #define LV_GRADIENT_CACHE_SIZE CONFIG_LV_GRADIENT_CACHE_SIZE
+    #else
+        #define LV_GRADIENT_CACHE_SIZE 0
+    #endif
+#endif
+
 /** Adjust color mix functions rounding. GPUs might calculate color mix (blending) differently.
  *  - 0:   round down,
  *  - 64:  round up from x.75,
@@ -1489,6 +1603,38 @@
     #endif
 #endif
 
+/** Cache the resolved values of the frequently used style properties (background, border,
+ *  padding, text, opacity and transformation) of each Widget per part and state.
+ *  The cache is allocated on the first lookup and needs 12..16 bytes per entry. */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE
+        #define LV_OBJ_STYLE_RESOLVED_CACHE CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE 0
+    #endif
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /** Number of cached properties per Widget */
+    #ifndef LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+        #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+            #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE_SIZE
+        #else
+            #define LV_OBJ_STYLE_RESOLVED_CACHE_SIZE 16
+        #endif
+    #endif
+#endif
+
+/** Keep the Widgets of each screen in drawing order in a flat array with their clipped areas.
+ *  The refreshing and the hit testing walk the array and skip the Widgets out of the area without
+ *  touching them. Adds 4 bytes to each `lv_obj_t` and 44 bytes per Widget for the array. */
+#ifndef LV_OBJ_DRAW_LIST
+    #ifdef CONFIG_LV_OBJ_DRAW_LIST
+        #define LV_OBJ_DRAW_LIST CONFIG_LV_OBJ_DRAW_LIST
+    #else
+        #define LV_OBJ_DRAW_LIST 0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1969,6 +2115,27 @@
     #endif
 #endif
 
+/** Number of entries in the per-font cache mapping Unicode letters to glyph IDs.
+ *  Speeds up fonts with large sparse character maps (e.g. CJK fonts).
+ *  Allocated on the first use of a font. Must be a power of 2. 0: disable the cache. */
+#ifndef LV_FONT_FMT_TXT_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_CACHE_SIZE 0
+    #endif
+#endif
+
+/** Number of entries in the per-font cache of the kerning values of glyph pairs.
+ *  Used only with fonts storing the kerning as a list of pairs. Must be a power of 2. 0: disable the cache. */
+#ifndef LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+        #define LV_FONT_FMT_TXT_KERN_CACHE_SIZE CONFIG_LV_FONT_FMT_TXT_KERN_CACHE_SIZE
+    #else
+        #define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 0
+    #endif
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -2714,6 +2881,17 @@
     #endif
 #endif
 
+/** Update only the Widgets whose layout is invalidated and their parents, instead of visiting every
+ *  Widget of the screen. The children of a resized Widget recalculate only their size and position,
+ *  and their layout is updated only if their size changes too. */
+#ifndef LV_LAYOUT_INCREMENTAL
+    #ifdef CONFIG_LV_LAYOUT_INCREMENTAL
+        #define LV_LAYOUT_INCREMENTAL CONFIG_LV_LAYOUT_INCREMENTAL
+    #else
+        #define LV_LAYOUT_INCREMENTAL 0
+    #endif
+#endif
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -3614,6 +3792,19 @@
             #define LV_PROFILER_EVENT 1
         #endif
     #endif
+
+    /*Enable ThorVG profiler (Lottie building, shape preparation, rasterization and compositing)*/
+    #ifndef LV_PROFILER_THORVG
+        #ifdef LV_KCONFIG_PRESENT
+            #ifdef CONFIG_LV_PROFILER_THORVG
+                #define LV_PROFILER_THORVG CONFIG_LV_PROFILER_THORVG
+            #else
+                #define LV_PROFILER_THORVG 0
+            #endif
+        #else
+            #define LV_PROFILER_THORVG 1
+        #endif
+    #endif
 #endif
 
 /** 1: Enable Monkey test */
@@ -195,6 +195,14 @@ void lv_init(void)
 
     lv_mem_init();
 
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_init();
+#endif
+
+#if LV_USE_MEM_TRACE
+    lv_mem_trace_init();
+#endif
+
     lv_draw_buf_init_handlers();
 
 #if LV_USE_SPAN != 0
@@ -223,6 +231,10 @@ void lv_init(void)
 
     lv_group_init();
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+    lv_font_fmt_txt_cache_init();
+#endif
+
 #if LV_USE_FREETYPE
     /* Since the drawing unit needs to register the freetype event,
      * initialize the freetype module first
@@ -503,6 +515,10 @@ void lv_deinit(void)
 
     lv_draw_deinit();
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+    lv_font_fmt_txt_cache_deinit();
+#endif
+
     lv_group_deinit();
 
     lv_anim_core_deinit();
@@ -533,6 +549,14 @@ void lv_deinit(void)
 
     lv_fs_deinit();
 
+#if LV_USE_MEM_TRACE
+    lv_mem_trace_deinit();
+#endif
+
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_deinit();
+#endif
+
     lv_mem_deinit();
 
     lv_initialized = false;
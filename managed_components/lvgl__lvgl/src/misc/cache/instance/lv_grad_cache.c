@@ -0,0 +1,195 @@
+/**
+* @file lv_grad_cache.c
+*
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_grad_cache.h"
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+
+#include "../lv_cache.h"
+#include "../lv_cache_private.h"
+#include "../../lv_assert.h"
+#include "../../../stdlib/lv_mem.h"
+#include "../../../stdlib/lv_string.h"
+#include "../../../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CACHE_NAME  "GRADIENT"
+
+#define grad_cache_p (LV_GLOBAL_DEFAULT()->grad_cache)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_cache_slot_size_t slot;      /**< Size of the key and the table*/
+    uint32_t hash;                  /**< Hash of the key to make the comparisons fast*/
+    lv_grad_cache_format_t format;
+    uint32_t key_size;
+    const void * key;               /**< The caller's key while searching, the copy after `table` when cached*/
+    void * table;                   /**< The table and the copy of the key in one allocation*/
+} lv_grad_cache_data_t;
+
+/*Passed to `grad_cache_create_cb`*/
+typedef struct {
+    lv_grad_cache_build_cb_t build_cb;
+    void * user_data;
+    uint32_t table_size;
+} grad_cache_create_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_cache_compare_res_t grad_cache_compare_cb(const lv_grad_cache_data_t * lhs,
+                                                    const lv_grad_cache_data_t * rhs);
+static bool grad_cache_create_cb(lv_grad_cache_data_t * data, grad_cache_create_ctx_t * ctx);
+static void grad_cache_free_cb(lv_grad_cache_data_t * data, void * user_data);
+static uint32_t key_hash(const void * key, uint32_t key_size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_grad_cache_init(uint32_t size)
+{
+    if(grad_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    grad_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_grad_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) grad_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) grad_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) grad_cache_free_cb,
+    });
+
+    lv_cache_set_name(grad_cache_p, CACHE_NAME);
+    return grad_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_grad_cache_deinit(void)
+{
+    if(grad_cache_p == NULL) return;
+
+    lv_cache_destroy(grad_cache_p, NULL);
+    grad_cache_p = NULL;
+}
+
+lv_cache_entry_t * lv_grad_cache_acquire(lv_grad_cache_format_t format, const void * key, uint32_t key_size,
+                                         uint32_t table_size, lv_grad_cache_build_cb_t build_cb, void * user_data)
+{
+    LV_ASSERT_NULL(key);
+    LV_ASSERT_NULL(build_cb);
+
+    if(grad_cache_p == NULL) return NULL;
+
+    lv_grad_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.slot.size = table_size + key_size;
+    search_key.format = format;
+    search_key.key = key;
+    search_key.key_size = key_size;
+    search_key.hash = key_hash(key, key_size);
+
+    /*Don't let a few large tables evict all the others*/
+    if(search_key.slot.size > LV_GRADIENT_CACHE_SIZE / 4) return NULL;
+
+    grad_cache_create_ctx_t ctx = {build_cb, user_data, table_size};
+    return lv_cache_acquire_or_create(grad_cache_p, &search_key, &ctx);
+}
+
+void * lv_grad_cache_entry_get_table(lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+
+    lv_grad_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->table;
+}
+
+void lv_grad_cache_release(lv_cache_entry_t * entry)
+{
+    LV_ASSERT_NULL(entry);
+
+    lv_cache_release(grad_cache_p, entry, NULL);
+}
+
+void lv_grad_cache_drop_all(void)
+{
+    if(grad_cache_p == NULL) return;
+
+    lv_cache_drop_all(grad_cache_p, NULL);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_compare_res_t grad_cache_compare_cb(const lv_grad_cache_data_t * lhs,
+                                                    const lv_grad_cache_data_t * rhs)
+{
+    if(lhs->hash != rhs->hash) return lhs->hash > rhs->hash ? 1 : -1;
+    if(lhs->format != rhs->format) return lhs->format > rhs->format ? 1 : -1;
+    if(lhs->key_size != rhs->key_size) return lhs->key_size > rhs->key_size ? 1 : -1;
+
+    int32_t cmp_res = lv_memcmp(lhs->key, rhs->key, lhs->key_size);
+    if(cmp_res != 0) return cmp_res > 0 ? 1 : -1;
+
+    return 0;
+}
+
+static bool grad_cache_create_cb(lv_grad_cache_data_t * data, grad_cache_create_ctx_t * ctx)
+{
+    /*Keep the table aligned, the key is just bytes*/
+    uint8_t * buf = lv_malloc(ctx->table_size + data->key_size);
+    if(buf == NULL) return false;
+
+    lv_memcpy(buf + ctx->table_size, data->key, data->key_size);
+    ctx->build_cb(buf, lv_cache_entry_get_entry(data, grad_cache_p->node_size), ctx->user_data);
+
+    data->table = buf;
+    data->key = buf + ctx->table_size;
+    return true;
+}
+
+static void grad_cache_free_cb(lv_grad_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(data->table);
+    data->table = NULL;
+    data->key = NULL;
+}
+
+/*FNV-1a*/
+static uint32_t key_hash(const void * key, uint32_t key_size)
+{
+    const uint8_t * p = key;
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < key_size; i++) {
+        hash ^= p[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+#endif /*LV_GRADIENT_CACHE_SIZE > 0*/
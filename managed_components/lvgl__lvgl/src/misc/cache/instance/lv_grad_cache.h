@@ -0,0 +1,105 @@
+/**
+* @file lv_grad_cache.h
+*
+ */
+
+#ifndef LV_GRAD_CACHE_H
+#define LV_GRAD_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** The format of the cached gradient tables. Tables of different formats are never shared.*/
+typedef enum {
+    LV_GRAD_CACHE_FORMAT_SW,        /**< `lv_draw_sw_grad_calc_t` with a color and an opacity map*/
+    LV_GRAD_CACHE_FORMAT_THORVG,    /**< ThorVG's table of premultiplied 32 bit colors*/
+} lv_grad_cache_format_t;
+
+/**
+ * Build a gradient table. Called only if the table is not in the cache yet.
+ * @param table         the buffer of the table, with the size given to `lv_grad_cache_acquire()`
+ * @param entry         the cache entry of the table, e.g. to store it in the table and release it later
+ * @param user_data     the `user_data` given to `lv_grad_cache_acquire()`
+ */
+typedef void (*lv_grad_cache_build_cb_t)(void * table, lv_cache_entry_t * entry, void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the gradient table cache.
+ * @param size      size of the cache in bytes
+ * @return          LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_grad_cache_init(uint32_t size);
+
+/**
+ * Delete the gradient table cache and all the tables in it.
+ */
+void lv_grad_cache_deinit(void);
+
+/**
+ * Get a gradient table from the cache, or build and add it if it's not cached yet.
+ * The tables are identified by their content: the format and the bytes they are built from
+ * (e.g. the stops, the opacity and the color format), so the same gradient is shared
+ * by all the users. Release the table with `lv_grad_cache_release()` when it's not used anymore.
+ * @param format        format of the table
+ * @param key           the bytes the table is built from. Make sure padding bytes are zeroed.
+ * @param key_size      size of `key` in bytes
+ * @param table_size    size of the table in bytes
+ * @param build_cb      called to build the table if it's not cached
+ * @param user_data     passed to `build_cb`
+ * @return              the cache entry of the table or NULL if the table can't be cached
+ *                      (e.g. the cache is disabled, too small or all its tables are used)
+ */
+lv_cache_entry_t * lv_grad_cache_acquire(lv_grad_cache_format_t format, const void * key, uint32_t key_size,
+                                         uint32_t table_size, lv_grad_cache_build_cb_t build_cb, void * user_data);
+
+/**
+ * Get the table of a cache entry
+ * @param entry     an entry returned by `lv_grad_cache_acquire()`
+ * @return          pointer to the table
+ */
+void * lv_grad_cache_entry_get_table(lv_cache_entry_t * entry);
+
+/**
+ * Release a table acquired with `lv_grad_cache_acquire()`. The table can be evicted from the cache
+ * when no one uses it.
+ * @param entry     an entry returned by `lv_grad_cache_acquire()`
+ */
+void lv_grad_cache_release(lv_cache_entry_t * entry);
+
+/**
+ * Remove all the unused tables from the cache.
+ */
+void lv_grad_cache_drop_all(void);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_GRAD_CACHE_H*/
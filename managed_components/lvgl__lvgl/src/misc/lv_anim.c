@@ -49,6 +49,10 @@ static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(const lv_anim_t * a_current);
 static void remove_anim(void * a);
+#if LV_USE_TIMER_HEAP
+    static uint32_t anim_time_until_next(void);
+    static void anim_timer_wakeup(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -553,6 +557,10 @@ void lv_anim_resume(lv_anim_t * a)
     a->is_paused = false;
     a->pause_duration = 0;
     a->run_round = state.anim_run_round;
+
+#if LV_USE_TIMER_HEAP
+    anim_timer_wakeup();
+#endif
 }
 
 /**********************
@@ -652,6 +660,21 @@ static void anim_timer(lv_timer_t * param)
             a = lv_ll_get_next(anim_ll_p, a);
     }
 
+#if LV_USE_TIMER_HEAP
+    /*Sleep until the first delayed or paused animation needs to run.
+     *Sleep whole refresh periods to stay in step with the display refresh.*/
+    if(param && state.timer) {
+        uint32_t wait = anim_time_until_next();
+        if(wait == LV_NO_TIMER_READY) {
+            lv_timer_pause(state.timer);
+        }
+        else {
+            wait = LV_MIN(wait, INT32_MAX);
+            uint32_t period = ((wait + LV_DEF_REFR_PERIOD - 1) / LV_DEF_REFR_PERIOD) * LV_DEF_REFR_PERIOD;
+            lv_timer_set_period(state.timer, LV_MAX(period, LV_DEF_REFR_PERIOD));
+        }
+    }
+#endif
 }
 
 /**
@@ -732,7 +755,11 @@ static void anim_mark_list_change(void)
     }
 
     if(state.timer) {
+#if LV_USE_TIMER_HEAP
+        anim_timer_wakeup();
+#else
         lv_timer_resume(state.timer);
+#endif
         return;
     }
 
@@ -762,6 +789,11 @@ static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms)
     a->is_paused = true;
     a->pause_time = lv_tick_get();
     a->pause_duration = ms;
+
+#if LV_USE_TIMER_HEAP
+    /*The animation timer might sleep for longer than the pause*/
+    if(ms != LV_ANIM_PAUSE_FOREVER) anim_timer_wakeup();
+#endif
 }
 
 static void resolve_time(lv_anim_t * a)
@@ -820,3 +852,45 @@ static void remove_anim(void * a)
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
     lv_free(a);
 }
+
+#if LV_USE_TIMER_HEAP
+
+/**
+ * Get the time until any of the animations needs to run.
+ * @return  0 if an animation is running, else the time until the first delayed or paused
+ *          animation starts, or `LV_NO_TIMER_READY` if all are paused forever
+ */
+static uint32_t anim_time_until_next(void)
+{
+    uint32_t wait = LV_NO_TIMER_READY;
+    lv_anim_t * a;
+    LV_LL_READ(anim_ll_p, a) {
+        if(a->is_paused) {
+            if(a->pause_duration == LV_ANIM_PAUSE_FOREVER) continue;
+            uint32_t time_paused = lv_tick_elaps(a->pause_time);
+            uint32_t pause_left = time_paused >= a->pause_duration ? 0 : a->pause_duration - time_paused;
+            wait = LV_MIN(wait, pause_left);
+        }
+        else if(a->act_time < 0) {
+            wait = LV_MIN(wait, (uint32_t)(-a->act_time));
+        }
+        else {
+            return 0;
+        }
+    }
+
+    return wait;
+}
+
+/**
+ * Run the animation timer in the next refresh period again if it's sleeping.
+ */
+static void anim_timer_wakeup(void)
+{
+    if(state.timer == NULL) return;
+
+    lv_timer_set_period(state.timer, LV_DEF_REFR_PERIOD);
+    lv_timer_resume(state.timer);
+}
+
+#endif /*LV_USE_TIMER_HEAP*/
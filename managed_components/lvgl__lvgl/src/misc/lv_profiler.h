@@ -177,6 +177,18 @@ extern "C" {
 #define LV_PROFILER_EVENT_END_TAG(tag)
 #endif
 
+#if LV_USE_PROFILER && LV_PROFILER_THORVG
+#define LV_PROFILER_THORVG_BEGIN LV_PROFILER_BEGIN
+#define LV_PROFILER_THORVG_END LV_PROFILER_END
+#define LV_PROFILER_THORVG_BEGIN_TAG(tag) LV_PROFILER_BEGIN_TAG(tag)
+#define LV_PROFILER_THORVG_END_TAG(tag)   LV_PROFILER_END_TAG(tag)
+#else
+#define LV_PROFILER_THORVG_BEGIN
+#define LV_PROFILER_THORVG_END
+#define LV_PROFILER_THORVG_BEGIN_TAG(tag)
+#define LV_PROFILER_THORVG_END_TAG(tag)
+#endif
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
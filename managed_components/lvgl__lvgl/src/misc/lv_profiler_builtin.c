@@ -189,7 +189,6 @@ void lv_profiler_builtin_write(const char * func, char tag)
 
     if(profiler_ctx->cur_index >= profiler_ctx->item_num) {
         flush_no_lock();
-        profiler_ctx->cur_index = 0;
     }
 
     lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[profiler_ctx->cur_index];
@@ -265,6 +264,9 @@ static void flush_no_lock(void)
 #endif
         profiler_ctx->config.flush_cb(buf);
     }
+
+    /*Don't output the same items again on the next flush*/
+    profiler_ctx->cur_index = 0;
 }
 
 #endif /*LV_USE_PROFILER_BUILTIN*/
@@ -19,6 +19,7 @@
 #define lv_style_custom_prop_flag_lookup_table_size LV_GLOBAL_DEFAULT()->style_custom_table_size
 #define lv_style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define last_custom_prop_id LV_GLOBAL_DEFAULT()->style_last_custom_prop_id
+#define style_generation LV_GLOBAL_DEFAULT()->style_generation
 
 /**********************
  *      TYPEDEFS
@@ -196,6 +197,9 @@ void lv_style_reset(lv_style_t * style)
 
     if(style->prop_cnt != 255) lv_free(style->values_and_props);
     lv_memzero(style, sizeof(lv_style_t));
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    style_generation++;
+#endif
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
@@ -328,6 +332,9 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             }
 
             lv_free(old_values);
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+            style_generation++;
+#endif
             LV_PROFILER_STYLE_END;
             return true;
         }
@@ -351,6 +358,11 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     lv_style_prop_t * props;
     int32_t i;
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*The resolved values cached by the Widgets might be outdated*/
+    style_generation++;
+#endif
+
     if(style->values_and_props) {
         props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
         for(i = style->prop_cnt - 1; i >= 0; i--) {
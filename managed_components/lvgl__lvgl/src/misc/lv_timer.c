@@ -21,6 +21,9 @@
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
 
+/*Keep the deadlines close to the current time so that they can be compared even if the tick overflows*/
+#define HEAP_MAX_WAIT 0x3FFFFFFF /*[ms]*/
+
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
 
@@ -34,6 +37,17 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+#if LV_USE_TIMER_HEAP
+    static void heap_run_ready(uint32_t now);
+    static uint32_t heap_time_until_next(void);
+    static bool heap_reserve(uint32_t size);
+    static void heap_insert(lv_timer_t * timer);
+    static void heap_remove(lv_timer_t * timer);
+    static void heap_sift_up(uint32_t idx);
+    static void heap_sift_down(uint32_t idx);
+    static void timer_schedule(lv_timer_t * timer);
+    static void list_remove(lv_timer_t ** list, lv_timer_t * timer);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -90,6 +104,11 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if LV_USE_TIMER_HEAP
+    /*Run only the timers from the top of the heap whose deadline has passed*/
+    heap_run_ready(handler_start);
+    uint32_t time_until_next = heap_time_until_next();
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     lv_timer_t * timer_active;
@@ -127,6 +146,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
         next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
     }
+#endif
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -170,6 +190,16 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
 
+#if LV_USE_TIMER_HEAP
+    /*Reserve a place for every timer so that adding them to the heap never fails*/
+    if(!heap_reserve(state.timer_cnt + 1)) {
+        lv_ll_remove(timer_ll_p, new_timer);
+        lv_free(new_timer);
+        return NULL;
+    }
+    state.timer_cnt++;
+#endif
+
     new_timer->period = period;
     new_timer->timer_cb = timer_xcb;
     new_timer->repeat_count = -1;
@@ -178,6 +208,13 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
 
+#if LV_USE_TIMER_HEAP
+    new_timer->seq = state.seq++;
+    new_timer->run_round = state.run_round - 1;
+    new_timer->heap_index = LV_TIMER_HEAP_NONE;
+    heap_insert(new_timer);
+#endif
+
     state.timer_created = true;
 
     lv_timer_handler_resume();
@@ -193,6 +230,21 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+#if LV_USE_TIMER_HEAP
+    if(timer->heap_index == LV_TIMER_HEAP_READY) {
+        list_remove(&state.ready, timer);
+    }
+    else if(timer->heap_index == LV_TIMER_HEAP_DEFERRED) {
+        list_remove(&state.deferred, timer);
+    }
+    else if(timer->heap_index != LV_TIMER_HEAP_NONE) {
+        heap_remove(timer);
+    }
+
+    if(state.timer_exec == timer) state.timer_exec = NULL;
+    state.timer_cnt--;
+#endif
+
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,12 +255,18 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+#if LV_USE_TIMER_HEAP
+    timer_schedule(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+#if LV_USE_TIMER_HEAP
+    timer_schedule(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -216,18 +274,33 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+#if LV_USE_TIMER_HEAP
+    timer_schedule(timer);
+#endif
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_USE_TIMER_HEAP
+    timer_schedule(timer);
+#endif
+    lv_timer_handler_resume();
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+
+#if LV_USE_TIMER_HEAP
+    /*Let the handler delete or pause it in the next round as if it was checked*/
+    if(repeat_count == 0 && timer->heap_index < state.heap_cnt) {
+        timer->deadline = lv_tick_get();
+        heap_sift_up(timer->heap_index);
+    }
+#endif
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -246,6 +319,9 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+#if LV_USE_TIMER_HEAP
+    timer_schedule(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -260,6 +336,17 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+#if LV_USE_TIMER_HEAP
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
+    state.ready = NULL;
+    state.deferred = NULL;
+    state.timer_exec = NULL;
+    state.timer_cnt = 0;
+#endif
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -386,3 +473,200 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+#if LV_USE_TIMER_HEAP
+
+/**
+ * Run the timers whose deadline is not later than `now`.
+ * The ready timers run from the newest, in the same order as in the timer list.
+ * Each timer runs at most once. If it's ready again (e.g. its period is 0)
+ * it's deferred to the next call of `lv_timer_handler()`.
+ * @param now   the tick when the handler was started
+ */
+static void heap_run_ready(uint32_t now)
+{
+    state.run_round++;
+
+    while(1) {
+        while(state.heap_cnt > 0) {
+            lv_timer_t * timer = state.heap[0];
+            if((int32_t)(timer->deadline - now) > 0) break;
+
+            heap_remove(timer);
+
+            lv_timer_t ** list = &state.deferred;
+            if(timer->run_round == state.run_round) {
+                timer->heap_index = LV_TIMER_HEAP_DEFERRED;
+            }
+            else {
+                /*Keep the ready list ordered by creation from the newest*/
+                timer->heap_index = LV_TIMER_HEAP_READY;
+                list = &state.ready;
+                while(*list && (int32_t)((*list)->seq - timer->seq) > 0) list = &(*list)->list_next;
+            }
+            timer->list_next = *list;
+            *list = timer;
+        }
+
+        /*Timers can be made ready by the callbacks too, so check the heap again after running them*/
+        if(state.ready == NULL) break;
+
+        while(state.ready) {
+            lv_timer_t * timer = state.ready;
+            state.ready = timer->list_next;
+            timer->heap_index = LV_TIMER_HEAP_NONE;
+
+            timer->run_round = state.run_round;
+            state.timer_exec = timer;
+            state.timer_deleted = false;
+            lv_timer_exec(timer);
+
+            /*`timer_exec` is cleared if the timer was deleted*/
+            if(state.timer_exec == timer) {
+                state.timer_exec = NULL;
+                if(!timer->paused) heap_insert(timer);
+            }
+        }
+    }
+}
+
+/**
+ * Add the deferred timers back to the heap and get the time until the first deadline.
+ * @return  the time until the next timer should run or `LV_NO_TIMER_READY`
+ */
+static uint32_t heap_time_until_next(void)
+{
+    bool deferred = state.deferred != NULL;
+    while(state.deferred) {
+        lv_timer_t * timer = state.deferred;
+        state.deferred = timer->list_next;
+        timer->heap_index = LV_TIMER_HEAP_NONE;
+        if(!timer->paused) heap_insert(timer);
+    }
+
+    if(deferred) return 0;
+    if(state.heap_cnt == 0) return LV_NO_TIMER_READY;
+
+    int32_t diff = (int32_t)(state.heap[0]->deadline - lv_tick_get());
+    return diff > 0 ? (uint32_t)diff : 0;
+}
+
+/**
+ * Make sure that the heap can store `size` timers.
+ * @param size  number of timers
+ * @return      true: success; false: out of memory
+ */
+static bool heap_reserve(uint32_t size)
+{
+    if(size <= state.heap_size) return true;
+
+    uint32_t new_size = state.heap_size ? state.heap_size * 2 : 16;
+    lv_timer_t ** new_heap = lv_realloc(state.heap, new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_heap);
+    if(new_heap == NULL) return false;
+
+    state.heap = new_heap;
+    state.heap_size = new_size;
+    return true;
+}
+
+/**
+ * Tell if timer `a` should run before timer `b`.
+ * Timers with the same deadline run from the newest as in the timer list.
+ */
+static inline bool heap_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    int32_t diff = (int32_t)(a->deadline - b->deadline);
+    if(diff != 0) return diff < 0;
+    return (int32_t)(a->seq - b->seq) > 0;
+}
+
+static inline void heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    state.heap[idx] = timer;
+    timer->heap_index = idx;
+}
+
+static void heap_sift_up(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!heap_less(timer, state.heap[parent])) break;
+        heap_set(idx, state.heap[parent]);
+        idx = parent;
+    }
+    heap_set(idx, timer);
+}
+
+static void heap_sift_down(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= state.heap_cnt) break;
+        if(child + 1 < state.heap_cnt && heap_less(state.heap[child + 1], state.heap[child])) child++;
+        if(!heap_less(state.heap[child], timer)) break;
+        heap_set(idx, state.heap[child]);
+        idx = child;
+    }
+    heap_set(idx, timer);
+}
+
+/**
+ * Add a timer to the heap. Its place was reserved in `lv_timer_create()`.
+ * @param timer pointer to a timer which is not in the heap
+ */
+static void heap_insert(lv_timer_t * timer)
+{
+    uint32_t now = lv_tick_get();
+    uint32_t elapsed = now - timer->last_run;
+    uint32_t remaining = elapsed >= timer->period ? 0 : timer->period - elapsed;
+    timer->deadline = now + LV_MIN(remaining, HEAP_MAX_WAIT);
+
+    heap_set(state.heap_cnt, timer);
+    state.heap_cnt++;
+    heap_sift_up(timer->heap_index);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_index;
+    timer->heap_index = LV_TIMER_HEAP_NONE;
+
+    state.heap_cnt--;
+    if(idx == state.heap_cnt) return;
+
+    /*Move the last timer to the free place and restore the order around it*/
+    lv_timer_t * moved = state.heap[state.heap_cnt];
+    heap_set(idx, moved);
+    heap_sift_up(idx);
+    heap_sift_down(moved->heap_index);
+}
+
+/**
+ * Update the place of a timer in the heap after its period, last run or paused state has changed.
+ * @param timer pointer to a timer
+ */
+static void timer_schedule(lv_timer_t * timer)
+{
+    /*They will be added to the heap again by the handler*/
+    if(timer == state.timer_exec || timer->heap_index == LV_TIMER_HEAP_DEFERRED ||
+       timer->heap_index == LV_TIMER_HEAP_READY) return;
+
+    if(timer->paused) {
+        if(timer->heap_index != LV_TIMER_HEAP_NONE) heap_remove(timer);
+        return;
+    }
+
+    if(timer->heap_index != LV_TIMER_HEAP_NONE) heap_remove(timer);
+    heap_insert(timer);
+}
+
+static void list_remove(lv_timer_t ** list, lv_timer_t * timer)
+{
+    while(*list != timer) list = &(*list)->list_next;
+    *list = timer->list_next;
+}
+
+#endif /*LV_USE_TIMER_HEAP*/
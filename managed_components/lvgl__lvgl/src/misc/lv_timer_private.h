@@ -20,6 +20,12 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_TIMER_HEAP
+#define LV_TIMER_HEAP_NONE      0xFFFFFFFF
+#define LV_TIMER_HEAP_DEFERRED  0xFFFFFFFE
+#define LV_TIMER_HEAP_READY     0xFFFFFFFD
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +41,13 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     volatile int paused;
     uint32_t auto_delete : 1;
+#if LV_USE_TIMER_HEAP
+    uint32_t deadline;         /**< Tick when the timer is checked next, the key of the heap */
+    uint32_t heap_index;       /**< Position in the heap or `LV_TIMER_HEAP_NONE/DEFERRED/READY`*/
+    uint32_t seq;              /**< Creation order to run the timers with the same deadline in the list's order */
+    uint32_t run_round;        /**< The `lv_timer_handler()` call in which the timer ran last time*/
+    lv_timer_t * list_next;    /**< Next timer in the `ready` or `deferred` list*/
+#endif
 };
 
 typedef struct {
@@ -54,6 +67,18 @@ typedef struct {
 
     lv_timer_handler_resume_cb_t resume_cb;
     void * resume_data;
+
+#if LV_USE_TIMER_HEAP
+    lv_timer_t ** heap;        /**< Binary min-heap of the not paused timers ordered by `deadline`*/
+    uint32_t heap_cnt;
+    uint32_t heap_size;
+    lv_timer_t * ready;        /**< Timers taken from the heap to run now, from the newest*/
+    lv_timer_t * deferred;     /**< Timers which were ready again while the handler was running*/
+    lv_timer_t * timer_exec;   /**< The timer whose callback is running (it's not in the heap meanwhile)*/
+    uint32_t timer_cnt;
+    uint32_t seq;
+    uint32_t run_round;
+#endif
 } lv_timer_state_t;
 
 /**********************
@@ -184,12 +184,16 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct _lv_obj_style_resolved_t lv_obj_style_resolved_t;
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
 
 typedef struct _lv_obj_spec_attr_t lv_obj_spec_attr_t;
 
+typedef struct _lv_obj_draw_list_t lv_obj_draw_list_t;
+
 typedef struct _lv_image_t lv_image_t;
 
 typedef struct _lv_animimg_t lv_animimg_t;
@@ -55,6 +55,22 @@ lv_result_t lv_mem_test_core(void);
     #define LV_TRACE_MEM(...)
 #endif
 
+#if LV_USE_MEM_SLAB
+    #define mem_alloc(size)         lv_mem_slab_alloc(size)
+    #define mem_realloc(p, size)    lv_mem_slab_realloc(p, size)
+    #define mem_free(p)             lv_mem_slab_free(p)
+#else
+    #define mem_alloc(size)         lv_malloc_core(size)
+    #define mem_realloc(p, size)    lv_realloc_core(p, size)
+    #define mem_free(p)             lv_free_core(p)
+#endif
+
+#if LV_USE_MEM_TRACE
+    #define mem_trace(op, p, old_p, size)   lv_mem_trace_add(op, p, old_p, size)
+#else
+    #define mem_trace(op, p, old_p, size)
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -67,7 +83,8 @@ void * lv_malloc(size_t size)
         return &zero_mem;
     }
 
-    void * alloc = lv_malloc_core(size);
+    void * alloc = mem_alloc(size);
+    mem_trace(LV_MEM_TRACE_OP_ALLOC, alloc, NULL, size);
 
     if(alloc == NULL) {
         LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
@@ -97,7 +114,8 @@ void * lv_malloc_zeroed(size_t size)
         return &zero_mem;
     }
 
-    void * alloc = lv_malloc_core(size);
+    void * alloc = mem_alloc(size);
+    mem_trace(LV_MEM_TRACE_OP_ALLOC, alloc, NULL, size);
     if(alloc == NULL) {
         LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
@@ -133,7 +151,8 @@ void lv_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
-    lv_free_core(data);
+    mem_trace(LV_MEM_TRACE_OP_FREE, data, NULL, 0);
+    mem_free(data);
 }
 
 void * lv_reallocf(void * data_p, size_t new_size)
@@ -156,7 +175,8 @@ void * lv_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_malloc(new_size);
 
-    void * new_p = lv_realloc_core(data_p, new_size);
+    void * new_p = mem_realloc(data_p, new_size);
+    mem_trace(LV_MEM_TRACE_OP_REALLOC, new_p, data_p, new_size);
 
     if(new_p == NULL) {
         LV_LOG_ERROR("couldn't reallocate memory");
@@ -180,6 +200,9 @@ lv_result_t lv_mem_test(void)
 void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 {
     lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_trim();
+#endif
     lv_mem_monitor_core(mon_p);
 }
 
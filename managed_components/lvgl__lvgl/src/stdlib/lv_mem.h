@@ -23,6 +23,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of size classes of `LV_USE_MEM_SLAB`*/
+#define LV_MEM_SLAB_CLASS_CNT   10
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -43,6 +46,83 @@ typedef struct {
     uint8_t frag_pct;   /**< Amount of fragmentation */
 } lv_mem_monitor_t;
 
+/**
+ * Slab size class information structure.
+ */
+typedef struct {
+    uint32_t block_size;    /**< Usable size of the blocks in bytes */
+    uint32_t page_cnt;      /**< Number of pages allocated for the class */
+    uint32_t total_cnt;     /**< Number of blocks in the pages */
+    uint32_t used_cnt;      /**< Number of live objects */
+    uint32_t cached_cnt;    /**< Number of free blocks kept by the threads */
+} lv_mem_slab_class_monitor_t;
+
+/**
+ * Slab allocator information structure.
+ */
+typedef struct {
+    lv_mem_slab_class_monitor_t classes[LV_MEM_SLAB_CLASS_CNT];
+    size_t total_size;      /**< Size of all pages in bytes */
+    size_t used_size;       /**< Usable size of the live objects in bytes */
+    uint8_t frag_pct;       /**< Part of the pages not used by live objects */
+} lv_mem_slab_monitor_t;
+
+#if LV_USE_MEM_TRACE
+
+typedef enum {
+    LV_MEM_TRACE_OP_ALLOC,
+    LV_MEM_TRACE_OP_REALLOC,
+    LV_MEM_TRACE_OP_FREE,
+} lv_mem_trace_op_t;
+
+/**
+ * The subsystem which was running when the memory was allocated or freed.
+ * Set by `LV_MEM_TRACE_TAG_BEGIN()` / `LV_MEM_TRACE_TAG_END()`.
+ */
+typedef enum {
+    LV_MEM_TRACE_TAG_NONE,
+    LV_MEM_TRACE_TAG_DRAW,          /**< Draw tasks, layers and rendering */
+    LV_MEM_TRACE_TAG_IMAGE_CACHE,   /**< Image decoders and the decoded images in the cache */
+    LV_MEM_TRACE_TAG_THORVG,        /**< ThorVG (Lottie and vector graphics) */
+    LV_MEM_TRACE_TAG_FONT,          /**< Font loading and glyph rendering */
+    LV_MEM_TRACE_TAG_USER,          /**< The first tag which can be used by the application */
+} lv_mem_trace_tag_t;
+
+/**
+ * A recorded call. The layout is the same in the saved traces.
+ */
+typedef struct {
+    uint32_t timestamp;     /**< `lv_tick_get()` at the call */
+    uint32_t ptr;           /**< Lower 32 bits of the allocated or freed pointer. 0 if the allocation failed. */
+    uint32_t old_ptr;       /**< Lower 32 bits of the pointer passed to `lv_realloc()` */
+    uint32_t size;          /**< The requested size in bytes */
+    uint8_t op;             /**< A `lv_mem_trace_op_t` */
+    uint8_t tag;            /**< A `lv_mem_trace_tag_t` */
+    uint16_t reserved;
+} lv_mem_trace_entry_t;
+
+/**
+ * The header of the saved traces, followed by `entry_cnt` entries from the oldest to the newest.
+ * Both are saved in the byte order of the CPU.
+ */
+typedef struct {
+    char magic[4];          /**< "LVMT" */
+    uint16_t version;       /**< 1 */
+    uint16_t entry_size;    /**< `sizeof(lv_mem_trace_entry_t)` */
+    uint32_t entry_cnt;     /**< Number of entries after the header */
+    uint32_t dropped_cnt;   /**< Number of older entries overwritten in the ring buffer */
+} lv_mem_trace_header_t;
+
+/**
+ * Called with the consecutive parts of a trace by `lv_mem_trace_dump()`
+ * @param data          pointer to the data
+ * @param size          size of the data in bytes
+ * @param user_data     the `user_data` passed to `lv_mem_trace_dump()`
+ */
+typedef void (*lv_mem_trace_write_cb_t)(const void * data, uint32_t size, void * user_data);
+
+#endif /*LV_USE_MEM_TRACE*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -149,16 +229,94 @@ lv_result_t lv_mem_test_core(void);
 lv_result_t lv_mem_test(void);
 
 /**
- * Give information about the work memory of dynamic allocation
+ * Give information about the work memory of dynamic allocation.
+ * With `LV_USE_MEM_SLAB` the free blocks cached by the slab allocator are released first
+ * (see `lv_mem_slab_trim()`) so that they are not reported as used.
  * @param mon_p pointer to a lv_mem_monitor_t variable,
  *              the result of the analysis will be stored here
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Give information about the size classes of the slab allocator (`LV_USE_MEM_SLAB`).
+ * All fields are 0 if it's disabled.
+ * @param mon_p pointer to a lv_mem_slab_monitor_t variable,
+ *              the result of the analysis will be stored here
+ */
+void lv_mem_slab_monitor(lv_mem_slab_monitor_t * mon_p);
+
+/**
+ * Give back the free blocks of the calling thread's magazine to their pages and
+ * free the empty pages of the slab allocator. Does nothing if `LV_USE_MEM_SLAB` is disabled.
+ * Useful when a large allocation failed or before checking the free memory.
+ */
+void lv_mem_slab_trim(void);
+
+#if LV_USE_MEM_TRACE
+
+/**
+ * Start recording the allocations. The earlier entries are kept.
+ * The ring buffer of `LV_MEM_TRACE_BUF_SIZE` entries is allocated on the first call.
+ */
+void lv_mem_trace_start(void);
+
+/**
+ * Stop recording the allocations. The recorded entries are kept.
+ */
+void lv_mem_trace_stop(void);
+
+/**
+ * Delete the recorded entries
+ */
+void lv_mem_trace_clear(void);
+
+/**
+ * Get the number of entries in the ring buffer
+ * @return      number of entries, at most `LV_MEM_TRACE_BUF_SIZE`
+ */
+uint32_t lv_mem_trace_get_entry_cnt(void);
+
+/**
+ * Set the tag of the allocations of the calling thread until `lv_mem_trace_pop_tag()`.
+ * Use it through `LV_MEM_TRACE_TAG_BEGIN()`.
+ * @param tag   a `lv_mem_trace_tag_t` or a higher value defined by the application
+ */
+void lv_mem_trace_push_tag(uint32_t tag);
+
+/**
+ * Restore the tag set before the last `lv_mem_trace_push_tag()` of the calling thread.
+ */
+void lv_mem_trace_pop_tag(void);
+
+/**
+ * Write the header and the entries from the oldest to the newest.
+ * The recording is paused while the callback is called.
+ * @param write_cb      called with the consecutive parts of the trace
+ * @param user_data     passed to `write_cb`
+ */
+void lv_mem_trace_dump(lv_mem_trace_write_cb_t write_cb, void * user_data);
+
+/**
+ * Save the trace to a file with `lv_fs`. It can be replayed by `scripts/mem_replay`.
+ * @param path      path of the file, e.g. "A:/trace.lvmt"
+ * @return          LV_RESULT_OK: saved; LV_RESULT_INVALID: the file couldn't be written
+ */
+lv_result_t lv_mem_trace_save(const char * path);
+
+#endif /*LV_USE_MEM_TRACE*/
+
 /**********************
  *      MACROS
  **********************/
 
+#if LV_USE_MEM_TRACE
+#define LV_MEM_TRACE_TAG_BEGIN(tag) lv_mem_trace_push_tag(tag)
+#define LV_MEM_TRACE_TAG_END()      lv_mem_trace_pop_tag()
+#else
+#define LV_MEM_TRACE_TAG_BEGIN(tag)
+#define LV_MEM_TRACE_TAG_END()
+#endif
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
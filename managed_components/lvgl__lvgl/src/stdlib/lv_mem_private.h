@@ -15,19 +15,138 @@ extern "C" {
  *********************/
 
 #include "lv_mem.h"
+#include "../osal/lv_os_private.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+/*Thread local storage for the per thread state of the allocators.
+ *Without an OS there is only one thread so a normal variable is enough.*/
+#if LV_USE_OS == LV_OS_NONE
+    #define LV_MEM_THREAD_LOCAL
+    #define LV_MEM_HAS_THREAD_LOCAL 1
+#elif defined(__GNUC__) || defined(__clang__)
+    #define LV_MEM_THREAD_LOCAL     __thread
+    #define LV_MEM_HAS_THREAD_LOCAL 1
+#elif defined(_MSC_VER)
+    #define LV_MEM_THREAD_LOCAL     __declspec(thread)
+    #define LV_MEM_HAS_THREAD_LOCAL 1
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+    #define LV_MEM_THREAD_LOCAL     _Thread_local
+    #define LV_MEM_HAS_THREAD_LOCAL 1
+#else
+    #define LV_MEM_THREAD_LOCAL
+    #define LV_MEM_HAS_THREAD_LOCAL 0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_MEM_SLAB
+
+typedef struct _lv_mem_slab_page_t lv_mem_slab_page_t;
+typedef struct _lv_mem_slab_magazine_t lv_mem_slab_magazine_t;
+
+typedef struct {
+    /** All pages of the class. The ones with free blocks are at the front.*/
+    lv_mem_slab_page_t * page_head;
+    lv_mem_slab_page_t * page_tail;
+    uint32_t page_cnt;
+    uint32_t empty_page_cnt;
+    uint32_t free_cnt;          /**< Free blocks in the pages (not in the magazines)*/
+} lv_mem_slab_class_t;
+
+typedef struct {
+#if LV_USE_OS
+    lv_mutex_t mutex;
+#endif
+    bool inited;
+    lv_mem_slab_class_t classes[LV_MEM_SLAB_CLASS_CNT];
+    lv_mem_slab_magazine_t * magazine_head;     /**< The magazines of all threads*/
+} lv_mem_slab_state_t;
+
+#endif /*LV_USE_MEM_SLAB*/
+
+#if LV_USE_MEM_TRACE
+
+typedef struct {
+#if LV_USE_OS
+    lv_mutex_t mutex;
+#endif
+    lv_mem_trace_entry_t * entries;     /**< Ring buffer of `LV_MEM_TRACE_BUF_SIZE` entries*/
+    uint32_t head;                      /**< Index of the next entry to write*/
+    uint32_t entry_cnt;
+    uint32_t dropped_cnt;
+    bool inited;
+    bool enabled;
+} lv_mem_trace_state_t;
+
+#endif /*LV_USE_MEM_TRACE*/
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_MEM_SLAB
+
+/**
+ * Initialize the slab allocator. Called by `lv_init()` after `lv_mem_init()`.
+ */
+void lv_mem_slab_init(void);
+
+/**
+ * Free all pages of the slab allocator. Called by `lv_deinit()` before `lv_mem_deinit()`.
+ */
+void lv_mem_slab_deinit(void);
+
+/**
+ * Allocate memory from the size classes or from `lv_malloc_core()` if it's too large.
+ * @param size      size in bytes, not 0
+ * @return          pointer to the allocated memory or NULL on failure
+ */
+void * lv_mem_slab_alloc(size_t size);
+
+/**
+ * Free memory allocated by `lv_mem_slab_alloc()`
+ * @param p         pointer to the memory
+ */
+void lv_mem_slab_free(void * p);
+
+/**
+ * Reallocate memory allocated by `lv_mem_slab_alloc()`
+ * @param p         pointer to the memory
+ * @param new_size  the new size in bytes, not 0
+ * @return          pointer to the new memory or NULL on failure (`p` is kept then)
+ */
+void * lv_mem_slab_realloc(void * p, size_t new_size);
+
+#endif /*LV_USE_MEM_SLAB*/
+
+#if LV_USE_MEM_TRACE
+
+/**
+ * Initialize the allocation trace. Called by `lv_init()` after `lv_mem_init()`.
+ */
+void lv_mem_trace_init(void);
+
+/**
+ * Free the ring buffer of the allocation trace. Called by `lv_deinit()` before `lv_mem_deinit()`.
+ */
+void lv_mem_trace_deinit(void);
+
+/**
+ * Record a call of `lv_malloc()`, `lv_realloc()` or `lv_free()` if the trace is started
+ * @param op        the operation
+ * @param ptr       the allocated or freed pointer, NULL if the allocation failed
+ * @param old_ptr   the pointer passed to `lv_realloc()`, NULL otherwise
+ * @param size      the requested size, 0 for `lv_free()`
+ */
+void lv_mem_trace_add(lv_mem_trace_op_t op, const void * ptr, const void * old_ptr, size_t size);
+
+#endif /*LV_USE_MEM_TRACE*/
+
 /**********************
  *      MACROS
  **********************/
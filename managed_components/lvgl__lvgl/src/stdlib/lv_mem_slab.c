@@ -0,0 +1,526 @@
+/**
+ * @file lv_mem_slab.c
+ * Size class (slab) allocator in front of `lv_malloc_core()`.
+ *
+ * The small allocations are served from pages split to equally sized blocks.
+ * Each block starts with a header pointing to its page (or NULL if the block was
+ * allocated by `lv_malloc_core()`), so `lv_free()` can tell the size class of any pointer.
+ *
+ * Each thread keeps a magazine: a few free blocks per size class it can allocate and
+ * free without locking. The magazines are refilled from and flushed to the shared pages
+ * in batches under a mutex.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_private.h"
+#include "lv_string.h"
+#include "../misc/lv_assert.h"
+#include "../misc/lv_log.h"
+#include "../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_USE_MEM_SLAB
+
+#define state LV_GLOBAL_DEFAULT()->mem_slab_state
+
+#define HDR_SIZE            sizeof(block_hdr_t)
+#define PAGE_HDR_SIZE       ((sizeof(lv_mem_slab_page_t) + HDR_SIZE - 1) & ~(HDR_SIZE - 1))
+#define MAX_SIZE            256
+#define MAGAZINE_REFILL_CNT ((LV_MEM_SLAB_MAGAZINE_SIZE + 1) / 2)
+
+#if LV_MEM_SLAB_PAGE_SIZE < 1024
+    #error "LV_MEM_SLAB_PAGE_SIZE should be at least 1024"
+#endif
+
+#if LV_MEM_SLAB_MAGAZINE_SIZE > 0 && LV_MEM_HAS_THREAD_LOCAL
+    #define USE_MAGAZINE    1
+#else
+    #define USE_MAGAZINE    0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*8 bytes on 32 bit systems too to keep the 8 byte alignment of the allocated memory*/
+typedef union {
+    lv_mem_slab_page_t * page;
+    uint64_t align;
+} block_hdr_t;
+
+struct _lv_mem_slab_page_t {
+    lv_mem_slab_page_t * prev;
+    lv_mem_slab_page_t * next;
+    block_hdr_t * free_list;    /**< The free blocks, linked in the first bytes of their payload*/
+    uint16_t free_cnt;
+    uint16_t block_cnt;
+    uint8_t class_id;
+};
+
+#if USE_MAGAZINE
+struct _lv_mem_slab_magazine_t {
+    lv_mem_slab_magazine_t * next;
+    uint16_t cnt[LV_MEM_SLAB_CLASS_CNT];
+    block_hdr_t * blocks[LV_MEM_SLAB_CLASS_CNT][LV_MEM_SLAB_MAGAZINE_SIZE];
+};
+
+typedef struct {
+    lv_mem_slab_magazine_t * magazine;
+    uint32_t generation;        /**< The magazine is valid only if it's equal to `generation`*/
+} magazine_ref_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static block_hdr_t * block_get(uint32_t class_id);
+static void block_put(block_hdr_t * block);
+static uint32_t depot_get(uint32_t class_id, block_hdr_t ** blocks, uint32_t cnt);
+static void depot_put(uint32_t class_id, block_hdr_t ** blocks, uint32_t cnt);
+static lv_mem_slab_page_t * page_create(uint32_t class_id);
+static void page_unlink(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page);
+static void page_insert_head(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page);
+static void page_insert_tail(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page);
+#if USE_MAGAZINE
+    static lv_mem_slab_magazine_t * get_magazine(void);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/*Usable size of the blocks of each class*/
+static const uint16_t class_size[LV_MEM_SLAB_CLASS_CNT] = {8, 16, 24, 32, 48, 64, 96, 128, 192, 256};
+
+/*Size class of the sizes, indexed by `(size + 7) / 8`*/
+static const uint8_t class_lut[MAX_SIZE / 8 + 1] = {
+    0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+    8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9
+};
+
+#if USE_MAGAZINE
+/*Thread local storage can't be in `lv_global`. Incremented on init and deinit to drop the
+ *magazines the threads still refer to.*/
+static uint32_t generation;
+static LV_MEM_THREAD_LOCAL magazine_ref_t local_magazine;
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+#if LV_USE_OS
+    #define SLAB_LOCK()     lv_mutex_lock(&state.mutex)
+    #define SLAB_UNLOCK()   lv_mutex_unlock(&state.mutex)
+#else
+    #define SLAB_LOCK()
+    #define SLAB_UNLOCK()
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_mem_slab_init(void)
+{
+#if LV_USE_OS
+    lv_mutex_init(&state.mutex);
+#endif
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        lv_memzero(&state.classes[i], sizeof(lv_mem_slab_class_t));
+    }
+    state.magazine_head = NULL;
+
+#if USE_MAGAZINE
+    generation++;
+#endif
+    state.inited = true;
+}
+
+void lv_mem_slab_deinit(void)
+{
+    if(!state.inited) return;
+    state.inited = false;
+
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        lv_mem_slab_page_t * page = state.classes[i].page_head;
+        while(page) {
+            lv_mem_slab_page_t * next = page->next;
+            lv_free_core(page);
+            page = next;
+        }
+        lv_memzero(&state.classes[i], sizeof(lv_mem_slab_class_t));
+    }
+
+#if USE_MAGAZINE
+    lv_mem_slab_magazine_t * magazine = state.magazine_head;
+    while(magazine) {
+        lv_mem_slab_magazine_t * next = magazine->next;
+        lv_free_core(magazine);
+        magazine = next;
+    }
+    generation++;
+#endif
+    state.magazine_head = NULL;
+
+#if LV_USE_OS
+    lv_mutex_delete(&state.mutex);
+#endif
+}
+
+void * lv_mem_slab_alloc(size_t size)
+{
+    if(size <= MAX_SIZE && state.inited) {
+        block_hdr_t * block = block_get(class_lut[(size + 7) / 8]);
+        if(block) return block + 1;
+        /*Try to allocate it as a large block*/
+    }
+
+    block_hdr_t * block = lv_malloc_core(size + HDR_SIZE);
+    if(block == NULL) return NULL;
+
+    block->page = NULL;
+    return block + 1;
+}
+
+void lv_mem_slab_free(void * p)
+{
+    block_hdr_t * block = (block_hdr_t *)p - 1;
+    if(block->page == NULL) lv_free_core(block);
+    else block_put(block);
+}
+
+void * lv_mem_slab_realloc(void * p, size_t new_size)
+{
+    if(p == NULL) return lv_mem_slab_alloc(new_size);
+
+    block_hdr_t * block = (block_hdr_t *)p - 1;
+    if(block->page == NULL) {
+        block = lv_realloc_core(block, new_size + HDR_SIZE);
+        return block ? block + 1 : NULL;
+    }
+
+    size_t old_size = class_size[block->page->class_id];
+    if(new_size <= old_size) return p;
+
+    void * new_p = lv_mem_slab_alloc(new_size);
+    if(new_p == NULL) return NULL;
+
+    lv_memcpy(new_p, p, old_size);
+    block_put(block);
+    return new_p;
+}
+
+#endif /*LV_USE_MEM_SLAB*/
+
+void lv_mem_slab_trim(void)
+{
+#if LV_USE_MEM_SLAB
+    if(!state.inited) return;
+
+    SLAB_LOCK();
+    uint32_t i;
+#if USE_MAGAZINE
+    /*The magazines of the other threads can't be touched without their knowledge*/
+    if(local_magazine.generation == generation) {
+        lv_mem_slab_magazine_t * magazine = local_magazine.magazine;
+        for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+            depot_put(i, magazine->blocks[i], magazine->cnt[i]);
+            magazine->cnt[i] = 0;
+        }
+    }
+#endif
+
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        lv_mem_slab_class_t * cls = &state.classes[i];
+        lv_mem_slab_page_t * page = cls->page_head;
+        /*The pages with free blocks are at the front*/
+        while(page && page->free_cnt > 0) {
+            lv_mem_slab_page_t * next = page->next;
+            if(page->free_cnt == page->block_cnt) {
+                page_unlink(cls, page);
+                cls->page_cnt--;
+                cls->free_cnt -= page->block_cnt;
+                lv_free_core(page);
+            }
+            page = next;
+        }
+        cls->empty_page_cnt = 0;
+    }
+    SLAB_UNLOCK();
+#endif
+}
+
+void lv_mem_slab_monitor(lv_mem_slab_monitor_t * mon_p)
+{
+    lv_memzero(mon_p, sizeof(lv_mem_slab_monitor_t));
+
+#if LV_USE_MEM_SLAB
+    if(!state.inited) return;
+
+    SLAB_LOCK();
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        lv_mem_slab_class_monitor_t * class_mon = &mon_p->classes[i];
+        lv_mem_slab_class_t * cls = &state.classes[i];
+        class_mon->block_size = class_size[i];
+        class_mon->page_cnt = cls->page_cnt;
+
+        lv_mem_slab_page_t * page;
+        for(page = cls->page_head; page; page = page->next) {
+            class_mon->total_cnt += page->block_cnt;
+        }
+
+#if USE_MAGAZINE
+        /*Read without the owner threads' knowledge, it can be slightly off*/
+        lv_mem_slab_magazine_t * magazine;
+        for(magazine = state.magazine_head; magazine; magazine = magazine->next) {
+            class_mon->cached_cnt += magazine->cnt[i];
+        }
+#endif
+        class_mon->used_cnt = class_mon->total_cnt - cls->free_cnt - class_mon->cached_cnt;
+
+        mon_p->total_size += (size_t)cls->page_cnt * LV_MEM_SLAB_PAGE_SIZE;
+        mon_p->used_size += (size_t)class_mon->used_cnt * class_size[i];
+    }
+    SLAB_UNLOCK();
+
+    if(mon_p->total_size) {
+        mon_p->frag_pct = (uint8_t)(100 - (mon_p->used_size * 100) / mon_p->total_size);
+    }
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_MEM_SLAB
+
+static block_hdr_t * block_get(uint32_t class_id)
+{
+#if USE_MAGAZINE
+    lv_mem_slab_magazine_t * magazine = get_magazine();
+    if(magazine) {
+        if(magazine->cnt[class_id] == 0) {
+            SLAB_LOCK();
+            magazine->cnt[class_id] = (uint16_t)depot_get(class_id, magazine->blocks[class_id], MAGAZINE_REFILL_CNT);
+            SLAB_UNLOCK();
+            if(magazine->cnt[class_id] == 0) return NULL;
+        }
+
+        magazine->cnt[class_id]--;
+        return magazine->blocks[class_id][magazine->cnt[class_id]];
+    }
+#endif
+
+    block_hdr_t * block;
+    SLAB_LOCK();
+    uint32_t cnt = depot_get(class_id, &block, 1);
+    SLAB_UNLOCK();
+    return cnt ? block : NULL;
+}
+
+static void block_put(block_hdr_t * block)
+{
+    uint32_t class_id = block->page->class_id;
+
+#if USE_MAGAZINE
+    lv_mem_slab_magazine_t * magazine = get_magazine();
+    if(magazine) {
+        if(magazine->cnt[class_id] == LV_MEM_SLAB_MAGAZINE_SIZE) {
+            /*Keep the older half to allocate them next*/
+            uint32_t keep_cnt = LV_MEM_SLAB_MAGAZINE_SIZE / 2;
+            SLAB_LOCK();
+            depot_put(class_id, &magazine->blocks[class_id][keep_cnt], LV_MEM_SLAB_MAGAZINE_SIZE - keep_cnt);
+            SLAB_UNLOCK();
+            magazine->cnt[class_id] = (uint16_t)keep_cnt;
+        }
+
+        magazine->blocks[class_id][magazine->cnt[class_id]] = block;
+        magazine->cnt[class_id]++;
+        return;
+    }
+#endif
+
+    SLAB_LOCK();
+    depot_put(class_id, &block, 1);
+    SLAB_UNLOCK();
+}
+
+/**
+ * Take free blocks from the pages of a class. Should be called with the lock held.
+ * @param class_id  index of the size class
+ * @param blocks    store the blocks here
+ * @param cnt       number of blocks to take
+ * @return          number of blocks taken. Less than `cnt` if a new page couldn't be allocated.
+ */
+static uint32_t depot_get(uint32_t class_id, block_hdr_t ** blocks, uint32_t cnt)
+{
+    lv_mem_slab_class_t * cls = &state.classes[class_id];
+    uint32_t got = 0;
+    while(got < cnt) {
+        lv_mem_slab_page_t * page = cls->page_head;
+        if(page == NULL || page->free_cnt == 0) {
+            page = page_create(class_id);
+            if(page == NULL) break;
+            page_insert_head(cls, page);
+            cls->page_cnt++;
+            cls->empty_page_cnt++;
+            cls->free_cnt += page->block_cnt;
+        }
+
+        if(page->free_cnt == page->block_cnt) cls->empty_page_cnt--;
+
+        while(got < cnt && page->free_cnt > 0) {
+            block_hdr_t * block = page->free_list;
+            page->free_list = *(block_hdr_t **)(block + 1);
+            page->free_cnt--;
+            cls->free_cnt--;
+            blocks[got] = block;
+            got++;
+        }
+
+        /*Keep the pages with free blocks at the front*/
+        if(page->free_cnt == 0 && page != cls->page_tail) {
+            page_unlink(cls, page);
+            page_insert_tail(cls, page);
+        }
+    }
+
+    return got;
+}
+
+/**
+ * Give back blocks to their pages. Should be called with the lock held.
+ * Empty pages are freed, except one per class to avoid allocating it again right away.
+ * @param class_id  index of the size class
+ * @param blocks    the blocks to give back
+ * @param cnt       number of blocks
+ */
+static void depot_put(uint32_t class_id, block_hdr_t ** blocks, uint32_t cnt)
+{
+    lv_mem_slab_class_t * cls = &state.classes[class_id];
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        block_hdr_t * block = blocks[i];
+        lv_mem_slab_page_t * page = block->page;
+        LV_ASSERT(page->class_id == class_id);
+
+        *(block_hdr_t **)(block + 1) = page->free_list;
+        page->free_list = block;
+        page->free_cnt++;
+        cls->free_cnt++;
+
+        if(page->free_cnt == 1 && page != cls->page_head) {
+            page_unlink(cls, page);
+            page_insert_head(cls, page);
+        }
+
+        if(page->free_cnt == page->block_cnt) {
+            if(cls->empty_page_cnt > 0) {
+                page_unlink(cls, page);
+                cls->page_cnt--;
+                cls->free_cnt -= page->block_cnt;
+                lv_free_core(page);
+            }
+            else {
+                cls->empty_page_cnt++;
+            }
+        }
+    }
+}
+
+static lv_mem_slab_page_t * page_create(uint32_t class_id)
+{
+    lv_mem_slab_page_t * page = lv_malloc_core(LV_MEM_SLAB_PAGE_SIZE);
+    if(page == NULL) {
+        LV_LOG_WARN("couldn't allocate a page for %d bytes blocks", class_size[class_id]);
+        return NULL;
+    }
+
+    uint32_t block_size = HDR_SIZE + class_size[class_id];
+    page->prev = NULL;
+    page->next = NULL;
+    page->class_id = (uint8_t)class_id;
+    page->block_cnt = (uint16_t)((LV_MEM_SLAB_PAGE_SIZE - PAGE_HDR_SIZE) / block_size);
+    page->free_cnt = page->block_cnt;
+    page->free_list = NULL;
+
+    /*Link the blocks backwards so that the first one is allocated first*/
+    uint8_t * block_p = (uint8_t *)page + PAGE_HDR_SIZE + (page->block_cnt - 1) * block_size;
+    uint32_t i;
+    for(i = 0; i < page->block_cnt; i++) {
+        block_hdr_t * block = (block_hdr_t *)block_p;
+        block->page = page;
+        *(block_hdr_t **)(block + 1) = page->free_list;
+        page->free_list = block;
+        block_p -= block_size;
+    }
+
+    return page;
+}
+
+static void page_unlink(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page)
+{
+    if(page->prev) page->prev->next = page->next;
+    else cls->page_head = page->next;
+
+    if(page->next) page->next->prev = page->prev;
+    else cls->page_tail = page->prev;
+
+    page->prev = NULL;
+    page->next = NULL;
+}
+
+static void page_insert_head(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page)
+{
+    page->prev = NULL;
+    page->next = cls->page_head;
+    if(cls->page_head) cls->page_head->prev = page;
+    else cls->page_tail = page;
+    cls->page_head = page;
+}
+
+static void page_insert_tail(lv_mem_slab_class_t * cls, lv_mem_slab_page_t * page)
+{
+    page->next = NULL;
+    page->prev = cls->page_tail;
+    if(cls->page_tail) cls->page_tail->next = page;
+    else cls->page_head = page;
+    cls->page_tail = page;
+}
+
+#if USE_MAGAZINE
+/**
+ * Get the magazine of the current thread, or create it on the first call.
+ * @return  the magazine, or NULL if it couldn't be allocated
+ */
+static lv_mem_slab_magazine_t * get_magazine(void)
+{
+    if(local_magazine.generation == generation) return local_magazine.magazine;
+
+    lv_mem_slab_magazine_t * magazine = lv_malloc_core(sizeof(lv_mem_slab_magazine_t));
+    if(magazine == NULL) return NULL;
+    lv_memzero(magazine, sizeof(lv_mem_slab_magazine_t));
+
+    /*Keep all magazines to free them on deinit and to count their blocks in the monitor.
+     *The blocks of a thread which has exited stay in its magazine until then.*/
+    SLAB_LOCK();
+    magazine->next = state.magazine_head;
+    state.magazine_head = magazine;
+    SLAB_UNLOCK();
+
+    local_magazine.magazine = magazine;
+    local_magazine.generation = generation;
+    return magazine;
+}
+#endif
+
+#endif /*LV_USE_MEM_SLAB*/
@@ -0,0 +1,284 @@
+/**
+ * @file lv_mem_trace.c
+ * Record the calls of `lv_malloc()`, `lv_realloc()` and `lv_free()` in a ring buffer.
+ *
+ * Each entry has the size, the pointers, the tag of the subsystem the calling thread
+ * is in and a timestamp. The trace can be saved and replayed against different
+ * allocators on the host by `scripts/mem_replay`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_mem_private.h"
+#include "lv_string.h"
+#include "../misc/lv_fs.h"
+#include "../misc/lv_log.h"
+#include "../tick/lv_tick.h"
+#include "../core/lv_global.h"
+
+#if LV_USE_MEM_TRACE
+
+/*********************
+ *      DEFINES
+ *********************/
+#define state LV_GLOBAL_DEFAULT()->mem_trace_state
+
+#define TRACE_VERSION       1
+#define TAG_STACK_DEPTH     8
+
+#if LV_MEM_TRACE_BUF_SIZE < 1
+    #error "LV_MEM_TRACE_BUF_SIZE should be at least 1"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint8_t tags[TAG_STACK_DEPTH];
+    uint32_t depth;     /**< Can be larger than `TAG_STACK_DEPTH`, then the deepest tags are not stored*/
+} tag_stack_t;
+
+typedef struct {
+    lv_fs_file_t file;
+    lv_fs_res_t res;
+} save_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool pause_recording(void);
+static void resume_recording(bool enabled);
+static void save_write_cb(const void * data, uint32_t size, void * user_data);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Without thread local storage the threads share the tags*/
+static LV_MEM_THREAD_LOCAL tag_stack_t tag_stack;
+
+/**********************
+ *      MACROS
+ **********************/
+#if LV_USE_OS
+    #define TRACE_LOCK()     lv_mutex_lock(&state.mutex)
+    #define TRACE_UNLOCK()   lv_mutex_unlock(&state.mutex)
+#else
+    #define TRACE_LOCK()
+    #define TRACE_UNLOCK()
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_mem_trace_init(void)
+{
+#if LV_USE_OS
+    lv_mutex_init(&state.mutex);
+#endif
+    state.entries = NULL;
+    state.head = 0;
+    state.entry_cnt = 0;
+    state.dropped_cnt = 0;
+    state.enabled = false;
+    state.inited = true;
+}
+
+void lv_mem_trace_deinit(void)
+{
+    if(!state.inited) return;
+
+    state.enabled = false;
+    state.inited = false;
+    lv_free_core(state.entries);
+    state.entries = NULL;
+
+#if LV_USE_OS
+    lv_mutex_delete(&state.mutex);
+#endif
+}
+
+void lv_mem_trace_start(void)
+{
+    if(!state.inited) return;
+
+    TRACE_LOCK();
+    if(state.entries == NULL) {
+        state.entries = lv_malloc_core(LV_MEM_TRACE_BUF_SIZE * sizeof(lv_mem_trace_entry_t));
+    }
+
+    if(state.entries) state.enabled = true;
+    else LV_LOG_WARN("couldn't allocate the ring buffer");
+    TRACE_UNLOCK();
+}
+
+void lv_mem_trace_stop(void)
+{
+    if(!state.inited) return;
+
+    TRACE_LOCK();
+    state.enabled = false;
+    TRACE_UNLOCK();
+}
+
+void lv_mem_trace_clear(void)
+{
+    if(!state.inited) return;
+
+    TRACE_LOCK();
+    state.head = 0;
+    state.entry_cnt = 0;
+    state.dropped_cnt = 0;
+    TRACE_UNLOCK();
+}
+
+uint32_t lv_mem_trace_get_entry_cnt(void)
+{
+    if(!state.inited) return 0;
+
+    TRACE_LOCK();
+    uint32_t cnt = state.entry_cnt;
+    TRACE_UNLOCK();
+    return cnt;
+}
+
+void lv_mem_trace_push_tag(uint32_t tag)
+{
+    if(tag_stack.depth < TAG_STACK_DEPTH) tag_stack.tags[tag_stack.depth] = (uint8_t)tag;
+    tag_stack.depth++;
+}
+
+void lv_mem_trace_pop_tag(void)
+{
+    if(tag_stack.depth > 0) tag_stack.depth--;
+}
+
+void lv_mem_trace_add(lv_mem_trace_op_t op, const void * ptr, const void * old_ptr, size_t size)
+{
+    /*Checked without the lock too to not slow down the allocations when not recording*/
+    if(!state.enabled) return;
+
+    uint32_t tag = LV_MEM_TRACE_TAG_NONE;
+    if(tag_stack.depth > 0) {
+        tag = tag_stack.tags[LV_MIN(tag_stack.depth, TAG_STACK_DEPTH) - 1];
+    }
+    uint32_t timestamp = lv_tick_get();
+
+    TRACE_LOCK();
+    if(state.enabled) {
+        lv_mem_trace_entry_t * entry = &state.entries[state.head];
+        entry->timestamp = timestamp;
+        entry->ptr = (uint32_t)(lv_uintptr_t)ptr;
+        entry->old_ptr = (uint32_t)(lv_uintptr_t)old_ptr;
+        entry->size = (uint32_t)size;
+        entry->op = (uint8_t)op;
+        entry->tag = (uint8_t)tag;
+        entry->reserved = 0;
+
+        state.head++;
+        if(state.head == LV_MEM_TRACE_BUF_SIZE) state.head = 0;
+
+        if(state.entry_cnt < LV_MEM_TRACE_BUF_SIZE) state.entry_cnt++;
+        else state.dropped_cnt++;
+    }
+    TRACE_UNLOCK();
+}
+
+void lv_mem_trace_dump(lv_mem_trace_write_cb_t write_cb, void * user_data)
+{
+    if(!state.inited) return;
+
+    /*The entries can't change and the allocations of the callback are not recorded*/
+    bool enabled = pause_recording();
+
+    lv_mem_trace_header_t header;
+    lv_memzero(&header, sizeof(header));
+    lv_memcpy(header.magic, "LVMT", sizeof(header.magic));
+    header.version = TRACE_VERSION;
+    header.entry_size = sizeof(lv_mem_trace_entry_t);
+    header.entry_cnt = state.entry_cnt;
+    header.dropped_cnt = state.dropped_cnt;
+    write_cb(&header, sizeof(header), user_data);
+
+    /*The oldest entry is at `head` if the ring buffer is full*/
+    uint32_t first = (state.head + LV_MEM_TRACE_BUF_SIZE - state.entry_cnt) % LV_MEM_TRACE_BUF_SIZE;
+    uint32_t first_part_cnt = LV_MIN(state.entry_cnt, LV_MEM_TRACE_BUF_SIZE - first);
+    if(first_part_cnt > 0) {
+        write_cb(&state.entries[first], first_part_cnt * sizeof(lv_mem_trace_entry_t), user_data);
+    }
+    if(state.entry_cnt > first_part_cnt) {
+        write_cb(state.entries, (state.entry_cnt - first_part_cnt) * sizeof(lv_mem_trace_entry_t), user_data);
+    }
+
+    resume_recording(enabled);
+}
+
+lv_result_t lv_mem_trace_save(const char * path)
+{
+    if(!state.inited) return LV_RESULT_INVALID;
+
+    /*Don't record the allocations of the file system*/
+    bool enabled = pause_recording();
+
+    save_ctx_t ctx;
+    ctx.res = lv_fs_open(&ctx.file, path, LV_FS_MODE_WR);
+    if(ctx.res != LV_FS_RES_OK) {
+        LV_LOG_WARN("couldn't open %s", path);
+        resume_recording(enabled);
+        return LV_RESULT_INVALID;
+    }
+
+    lv_mem_trace_dump(save_write_cb, &ctx);
+    lv_fs_res_t close_res = lv_fs_close(&ctx.file);
+    if(ctx.res == LV_FS_RES_OK) ctx.res = close_res;
+
+    resume_recording(enabled);
+
+    if(ctx.res != LV_FS_RES_OK) {
+        LV_LOG_WARN("couldn't write %s", path);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Stop recording temporarily
+ * @return      true if it was recording
+ */
+static bool pause_recording(void)
+{
+    TRACE_LOCK();
+    bool enabled = state.enabled;
+    state.enabled = false;
+    TRACE_UNLOCK();
+    return enabled;
+}
+
+/**
+ * Continue recording after `pause_recording()`
+ * @param enabled   the return value of `pause_recording()`
+ */
+static void resume_recording(bool enabled)
+{
+    TRACE_LOCK();
+    state.enabled = enabled;
+    TRACE_UNLOCK();
+}
+
+static void save_write_cb(const void * data, uint32_t size, void * user_data)
+{
+    save_ctx_t * ctx = user_data;
+    if(ctx->res != LV_FS_RES_OK) return;
+
+    uint32_t bw = 0;
+    ctx->res = lv_fs_write(&ctx->file, data, size, &bw);
+    if(ctx->res == LV_FS_RES_OK && bw != size) ctx->res = LV_FS_RES_FULL;
+}
+
+#endif /*LV_USE_MEM_TRACE*/
@@ -284,6 +284,17 @@ void lv_label_set_recolor(lv_obj_t * obj, bool en)
     lv_label_refr_text(obj);
 }
 
+void lv_label_set_render_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->render_cache == en) return;
+
+    label->render_cache = en == false ? 0 : 1;
+    if(!en) lv_draw_label_cache_drop(obj);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -659,6 +670,14 @@ bool lv_label_get_recolor(const lv_obj_t * obj)
     return label->recolor == 0 ? false : true;
 }
 
+bool lv_label_get_render_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    return label->render_cache == 0 ? false : true;
+}
+
 /*=====================
  * Other functions
  *====================*/
@@ -786,6 +805,7 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     LV_UNUSED(class_p);
     lv_label_t * label = (lv_label_t *)obj;
 
+    if(label->render_cache) lv_draw_label_cache_drop(obj);
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
 #if LV_USE_TRANSLATION
@@ -897,6 +917,10 @@ static void draw_main(lv_event_t * e)
 
     label_draw_dsc.flag = flag;
     label_draw_dsc.base.layer = layer;
+    /*The offset of the scrolling modes is animated, it's not worth caching them*/
+    label_draw_dsc.cache_coverage = label->render_cache &&
+                                    label->long_mode != LV_LABEL_LONG_MODE_SCROLL &&
+                                    label->long_mode != LV_LABEL_LONG_MODE_SCROLL_CIRCULAR;
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
 
@@ -1069,6 +1093,7 @@ static void overwrite_anim_property(lv_anim_t * dest, const lv_anim_t * src, lv_
 static void lv_label_refr_text(lv_obj_t * obj)
 {
     lv_label_t * label = (lv_label_t *)obj;
+    if(label->render_cache) lv_draw_label_cache_drop(obj);
     if(label->text == NULL) return;
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
@@ -158,6 +158,16 @@ void lv_label_set_text_selection_end(lv_obj_t * obj, uint32_t index);
  */
 void lv_label_set_recolor(lv_obj_t * obj, bool en);
 
+/**
+ * Cache the rendered coverage of the label's text to redraw it with a single masked fill
+ * as long as its text, style and size don't change. Useful for static labels which are redrawn
+ * often because of other Widgets. Requires `LV_DRAW_LABEL_CACHE_SIZE > 0`.
+ * Labels with scrolling long modes, text selection or recoloring are not cached.
+ * @param obj           pointer to a label object
+ * @param en            true: enable caching, false: disable
+ */
+void lv_label_set_render_cache(lv_obj_t * obj, bool en);
+
 #if LV_USE_TRANSLATION
 
 /**
@@ -237,6 +247,13 @@ uint32_t lv_label_get_text_selection_end(const lv_obj_t * obj);
  */
 bool lv_label_get_recolor(const lv_obj_t * obj);
 
+/**
+ * @brief Get whether the rendered text of the label is cached
+ * @param obj       pointer to a label object.
+ * @return          true: caching is enabled, false: caching is disabled
+ */
+bool lv_label_get_render_cache(const lv_obj_t * obj);
+
 /*=====================
  * Other functions
  *====================*/
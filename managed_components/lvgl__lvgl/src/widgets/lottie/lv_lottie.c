@@ -18,12 +18,18 @@
 
 #include "../../misc/lv_timer.h"
 #include "../../core/lv_obj_class_private.h"
+#include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_draw_private.h"
+#include "../../core/lv_refr_private.h"
+#include "../../display/lv_display.h"
+#include "../../misc/lv_area_private.h"
 #include "../../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_lottie_class)
+#define LOTTIE_SLOT_MAX_LEN 128
 
 /**********************
  *      TYPEDEFS
@@ -35,7 +41,22 @@
 static void lv_lottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_lottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void anim_exec_cb(void * var, int32_t v);
-static void lottie_update(lv_lottie_t * lottie, int32_t v);
+static void anim_completed_cb(lv_anim_t * a);
+static void anim_deleted_cb(lv_anim_t * a);
+static void play_anim(lv_lottie_t * lottie, int32_t frame);
+static void apply_play_mode(lv_anim_t * a, lv_lottie_play_mode_t mode);
+static int32_t frame_to_time(const lv_anim_t * a, int32_t frame);
+static void lottie_update(lv_lottie_t * lottie, int32_t v, const lv_area_t * render_area);
+static void refresh_frame(lv_lottie_t * lottie);
+static bool get_render_area(lv_lottie_t * lottie, lv_area_t * render_area);
+static bool is_culling_possible(lv_obj_t * obj);
+static bool cut_covered_area(lv_obj_t * obj, lv_area_t * area);
+static bool cut_covered_by(lv_obj_t * cover, lv_area_t * area);
+static bool is_opa_chain_cover(lv_obj_t * obj);
+static void update_target(lv_lottie_t * lottie);
+static void apply_quality(lv_lottie_t * lottie, lv_lottie_quality_t quality);
+static void update_quality(lv_lottie_t * lottie);
+static void upscale_half_res(lv_draw_buf_t * draw_buf, const lv_area_t * area);
 
 /**********************
  *  STATIC VARIABLES
@@ -79,16 +100,15 @@ void lv_lottie_set_buffer(lv_obj_t * obj, int32_t w, int32_t h, void * buf)
     tvg_swcanvas_set_target(lottie->tvg_canvas, buf, stride / 4, w, h, TVG_COLORSPACE_ARGB8888);
     tvg_canvas_push(lottie->tvg_canvas, lottie->tvg_paint);
     lv_canvas_set_buffer(obj, buf, w, h, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
-    tvg_picture_set_size(lottie->tvg_paint, w, h);
+    update_target(lottie);
 
     /* Rendered output images are premultiplied */
     lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(obj);
     lv_draw_buf_set_flag(draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
 
-    /*Force updating when the buffer changes*/
-    float f_current;
-    tvg_animation_get_frame(lottie->tvg_anim, &f_current);
-    anim_exec_cb(obj, (int32_t) f_current);
+    /*Force updating when the buffer changes.
+     *The layout might be outdated here so render the whole buffer.*/
+    refresh_frame(lottie);
 }
 
 void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
@@ -103,51 +123,38 @@ void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
                             draw_buf->header.w, draw_buf->header.h, TVG_COLORSPACE_ARGB8888);
     tvg_canvas_push(lottie->tvg_canvas, lottie->tvg_paint);
     lv_canvas_set_draw_buf(obj, draw_buf);
-    tvg_picture_set_size(lottie->tvg_paint, draw_buf->header.w, draw_buf->header.h);
+    update_target(lottie);
 
     /* Rendered output images are premultiplied */
     lv_draw_buf_set_flag(draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
 
-    /*Force updating when the buffer changes*/
-    float f_current;
-    tvg_animation_get_frame(lottie->tvg_anim, &f_current);
-    anim_exec_cb(obj, (int32_t) f_current);
+    /*Force updating when the buffer changes.
+     *The layout might be outdated here so render the whole buffer.*/
+    refresh_frame(lottie);
 }
 
 void lv_lottie_set_src_data(lv_obj_t * obj, const void * src, size_t src_size)
 {
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_THORVG);
     tvg_picture_load_data(lottie->tvg_paint, src, src_size, "lottie", true);
-    lv_draw_buf_t * canvas_draw_buf = lv_canvas_get_draw_buf(obj);
-    if(canvas_draw_buf) {
-        tvg_picture_set_size(lottie->tvg_paint, canvas_draw_buf->header.w, canvas_draw_buf->header.h);
-    }
+    LV_MEM_TRACE_TAG_END();
+    update_target(lottie);
 
-    float f_total;
-    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
-    lv_anim_set_duration(lottie->anim, (int32_t)f_total * 1000 / 60); /*60 FPS*/
-    lottie->anim->act_time = 0;
-    lottie->anim->end_value = (int32_t)f_total;
-    lottie->anim->reverse_play_in_progress = false;
-    lottie_update(lottie, 0);   /*Render immediately*/
+    play_anim(lottie, 0);
+    lottie_update(lottie, 0, NULL);   /*Render immediately*/
 }
 
 void lv_lottie_set_src_file(lv_obj_t * obj, const char * src)
 {
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_THORVG);
     tvg_picture_load(lottie->tvg_paint, src);
-    lv_draw_buf_t * canvas_draw_buf = lv_canvas_get_draw_buf(obj);
-    if(canvas_draw_buf) {
-        tvg_picture_set_size(lottie->tvg_paint, canvas_draw_buf->header.w, canvas_draw_buf->header.h);
-    }
+    LV_MEM_TRACE_TAG_END();
+    update_target(lottie);
 
-    float f_total;
-    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
-    lv_anim_set_duration(lottie->anim, (int32_t)f_total * 1000 / 60); /*60 FPS*/
-    lottie->anim->act_time = 0;
-    lottie->anim->end_value = (int32_t)f_total;
-    lottie->anim->reverse_play_in_progress = false;
-    lottie_update(lottie, 0);   /*Render immediately*/
+    play_anim(lottie, 0);
+    lottie_update(lottie, 0, NULL);   /*Render immediately*/
 }
 
 
@@ -158,6 +165,245 @@ lv_anim_t * lv_lottie_get_anim(lv_obj_t * obj)
     return lottie->anim;
 }
 
+lv_result_t lv_lottie_play_segment(lv_obj_t * obj, const char * marker)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    if(tvg_lottie_animation_set_marker(lottie->tvg_anim, marker) != TVG_RESULT_SUCCESS) {
+        LV_LOG_WARN("marker \"%s\" not found", marker);
+        return LV_RESULT_INVALID;
+    }
+
+    play_anim(lottie, 0);
+    anim_exec_cb(lottie, 0);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_lottie_set_segment(lv_obj_t * obj, uint32_t begin, uint32_t end)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    /*The segment is set in the range of [0..1] of the whole animation*/
+    float f_begin = 0.0f;
+    float f_end = 1.0f;
+    float f_total = 0.0f;
+    tvg_animation_get_segment(lottie->tvg_anim, &f_begin, &f_end);
+    tvg_animation_set_segment(lottie->tvg_anim, 0.0f, 1.0f);
+    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
+
+    if(begin > end || end > f_total || f_total == 0.0f) {
+        LV_LOG_WARN("invalid segment: %" LV_PRIu32 "..%" LV_PRIu32, begin, end);
+        tvg_animation_set_segment(lottie->tvg_anim, f_begin, f_end);
+        return LV_RESULT_INVALID;
+    }
+
+    tvg_animation_set_segment(lottie->tvg_anim, (float)begin / f_total, (float)end / f_total);
+    play_anim(lottie, 0);
+    anim_exec_cb(lottie, 0);
+    return LV_RESULT_OK;
+}
+
+uint32_t lv_lottie_get_marker_count(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    uint32_t cnt = 0;
+    tvg_lottie_animation_get_markers_cnt(lottie->tvg_anim, &cnt);
+    return cnt;
+}
+
+const char * lv_lottie_get_marker_name(lv_obj_t * obj, uint32_t idx)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    const char * name = NULL;
+    if(tvg_lottie_animation_get_marker(lottie->tvg_anim, idx, &name) != TVG_RESULT_SUCCESS) return NULL;
+    return name;
+}
+
+void lv_lottie_set_play_mode(lv_obj_t * obj, lv_lottie_play_mode_t mode)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    lottie->play_mode = mode;
+    if(lottie->anim) apply_play_mode(lottie->anim, mode);
+}
+
+lv_lottie_play_mode_t lv_lottie_get_play_mode(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    return lottie->play_mode;
+}
+
+void lv_lottie_seek(lv_obj_t * obj, uint32_t frame)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    uint32_t total = lv_lottie_get_total_frames(obj);
+    if(frame > total) frame = total;
+
+    if(lottie->anim) {
+        apply_play_mode(lottie->anim, lottie->play_mode);
+        lottie->anim->act_time = frame_to_time(lottie->anim, (int32_t)frame);
+        lottie->anim->current_value = (int32_t)frame;
+        lottie->last_rendered_time = lottie->anim->act_time;
+    }
+
+    /*ThorVG only moves the keyframe cursors, nothing is rebuilt. Just don't render the same frame again.*/
+    if(lv_lottie_get_current_frame(obj) == frame) return;
+    anim_exec_cb(lottie, (int32_t)frame);
+}
+
+uint32_t lv_lottie_get_current_frame(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    float f_current = 0.0f;
+    tvg_animation_get_frame(lottie->tvg_anim, &f_current);
+    return (uint32_t)(f_current + 0.5f);
+}
+
+uint32_t lv_lottie_get_total_frames(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    float f_total = 0.0f;
+    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
+    return (uint32_t)(f_total + 0.5f);
+}
+
+lv_result_t lv_lottie_set_slot(lv_obj_t * obj, const char * slot)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    /*Some slots might be applied even if the others are invalid so refresh anyway*/
+    Tvg_Result res = tvg_lottie_animation_override(lottie->tvg_anim, slot);
+    refresh_frame(lottie);
+
+    if(res != TVG_RESULT_SUCCESS) {
+        LV_LOG_WARN("couldn't apply the slot(s)");
+        return LV_RESULT_INVALID;
+    }
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_lottie_set_slot_color(lv_obj_t * obj, const char * sid, lv_color_t color)
+{
+    LV_ASSERT_NULL(sid);
+
+    /*Lottie colors are in the [0..1] range. 4 decimals are enough to get back the same 8 bit values*/
+    char buf[LOTTIE_SLOT_MAX_LEN];
+    int32_t c[3] = {color.red * 10000 / 255, color.green * 10000 / 255, color.blue * 10000 / 255};
+    int len = lv_snprintf(buf, sizeof(buf), "{\"%s\":{\"p\":{\"a\":0,\"k\":[%d.%04d,%d.%04d,%d.%04d]}}}", sid,
+                          (int)(c[0] / 10000), (int)(c[0] % 10000), (int)(c[1] / 10000), (int)(c[1] % 10000),
+                          (int)(c[2] / 10000), (int)(c[2] % 10000));
+    if(len < 0 || len >= (int)sizeof(buf)) {
+        LV_LOG_WARN("too long slot ID: %s", sid);
+        return LV_RESULT_INVALID;
+    }
+
+    return lv_lottie_set_slot(obj, buf);
+}
+
+lv_result_t lv_lottie_set_slot_opa(lv_obj_t * obj, const char * sid, lv_opa_t opa)
+{
+    LV_ASSERT_NULL(sid);
+
+    /*Lottie opacities are percentages and ThorVG truncates them when converting to 8 bit, so round up*/
+    char buf[LOTTIE_SLOT_MAX_LEN];
+    int32_t p = (opa * 1000000 + 254) / 255;
+    int len = lv_snprintf(buf, sizeof(buf), "{\"%s\":{\"p\":{\"a\":0,\"k\":%d.%04d}}}", sid,
+                          (int)(p / 10000), (int)(p % 10000));
+    if(len < 0 || len >= (int)sizeof(buf)) {
+        LV_LOG_WARN("too long slot ID: %s", sid);
+        return LV_RESULT_INVALID;
+    }
+
+    return lv_lottie_set_slot(obj, buf);
+}
+
+void lv_lottie_get_render_stats(lv_obj_t * obj, lv_lottie_render_stats_t * stats)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(stats);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    *stats = lottie->stats;
+}
+
+void lv_lottie_reset_render_stats(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    lv_memzero(&lottie->stats, sizeof(lottie->stats));
+}
+
+void lv_lottie_quality_policy_init(lv_lottie_quality_policy_t * policy)
+{
+    LV_ASSERT_NULL(policy);
+    lv_memzero(policy, sizeof(lv_lottie_quality_policy_t));
+    policy->min_quality = LV_LOTTIE_QUALITY_HALF_RES;
+    policy->degrade_frames = 3;
+    policy->recover_frames = 30;
+    policy->headroom_percent = 50;
+}
+
+void lv_lottie_set_quality_policy(lv_obj_t * obj, const lv_lottie_quality_policy_t * policy)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    if(policy) lottie->quality_policy = *policy;
+    else lv_lottie_quality_policy_init(&lottie->quality_policy);
+
+    if(lottie->quality_policy.min_quality >= LV_LOTTIE_QUALITY_LAST) {
+        lottie->quality_policy.min_quality = LV_LOTTIE_QUALITY_LAST - 1;
+    }
+    if(lottie->quality_policy.headroom_percent > 100) lottie->quality_policy.headroom_percent = 100;
+
+    lottie->over_budget_cnt = 0;
+    lottie->headroom_cnt = 0;
+}
+
+void lv_lottie_set_quality(lv_obj_t * obj, lv_lottie_quality_t quality)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    if(quality >= LV_LOTTIE_QUALITY_LAST) quality = LV_LOTTIE_QUALITY_LAST - 1;
+    lottie->over_budget_cnt = 0;
+    lottie->headroom_cnt = 0;
+    if(lottie->quality == quality) return;
+
+    apply_quality(lottie, quality);
+
+    /*Show the new quality immediately*/
+    refresh_frame(lottie);
+}
+
+lv_lottie_quality_t lv_lottie_get_quality(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    return lottie->quality;
+}
+
+uint32_t lv_lottie_get_render_time(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    return lottie->render_time;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -170,18 +416,19 @@ static void lv_lottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
 
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
-    lottie->tvg_anim = tvg_animation_new();
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_THORVG);
+    lottie->tvg_anim = tvg_lottie_animation_new();
 
     lottie->tvg_paint = tvg_animation_get_picture(lottie->tvg_anim);
 
     lottie->tvg_canvas = tvg_swcanvas_create();
+    LV_MEM_TRACE_TAG_END();
 
-    lv_anim_t a;
-    lv_anim_init(&a);
-    lv_anim_set_exec_cb(&a, anim_exec_cb);
-    lv_anim_set_var(&a, obj);
-    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
-    lottie->anim = lv_anim_start(&a);
+    lottie->quality = LV_LOTTIE_QUALITY_FULL;
+    lv_lottie_quality_policy_init(&lottie->quality_policy);
+
+    lottie->play_mode = LV_LOTTIE_PLAY_MODE_LOOP;
+    play_anim(lottie, 0);
 
     LV_TRACE_OBJ_CREATE("finished");
 }
@@ -191,22 +438,37 @@ static void lv_lottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     LV_UNUSED(class_p);
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
 
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_THORVG);
     tvg_animation_del(lottie->tvg_anim);
     tvg_canvas_destroy(lottie->tvg_canvas);
+    LV_MEM_TRACE_TAG_END();
 }
 
 static void anim_exec_cb(void * var, int32_t v)
 {
     lv_lottie_t * lottie = var;
-
-    /*Do not render not visible animations.*/
-    if(lv_obj_is_visible(var)) {
-        lottie_update(lottie, v);
+    lv_image_t * img = var;
+    uint32_t buf_px = (uint32_t)img->w * img->h;
+
+    /*Do not render not visible animations and render only the visible part of the others*/
+    lv_area_t render_area;
+    if(get_render_area(lottie, &render_area)) {
+        uint32_t render_px = lv_area_get_size(&render_area);
+        lottie->stats.rendered_frames++;
+        lottie->stats.rendered_px += render_px;
+        lottie->stats.skipped_px += buf_px - render_px;
+
+        lottie_update(lottie, v, &render_area);
         if(lottie->anim) {
             lottie->last_rendered_time = lottie->anim->act_time;
         }
+
+        update_quality(lottie);
     }
     else {
+        lottie->stats.skipped_frames++;
+        lottie->stats.skipped_px += buf_px;
+
         /*Artificially keep the animation on the last rendered frame's time
          *To avoid a jump when the widget becomes visible*/
         if(lottie->anim) {
@@ -215,24 +477,391 @@ static void anim_exec_cb(void * var, int32_t v)
     }
 }
 
-static void lottie_update(lv_lottie_t * lottie, int32_t v)
+static void anim_completed_cb(lv_anim_t * a)
+{
+    lv_lottie_t * lottie = a->var;
+
+    /*The animation is deleted after this callback. Forget it now so that a new
+     *segment can be played from the event.*/
+    if(lottie->anim == a) lottie->anim = NULL;
+    lv_obj_send_event((lv_obj_t *)lottie, LV_EVENT_READY, NULL);
+}
+
+static void anim_deleted_cb(lv_anim_t * a)
+{
+    lv_lottie_t * lottie = a->var;
+    if(lottie->anim == a) lottie->anim = NULL;
+}
+
+/**
+ * Restart the animation on the current segment of ThorVG's animation.
+ * The running animation is updated in place to keep `lv_lottie_get_anim()` valid.
+ * @param lottie        pointer to a lottie widget
+ * @param frame         start from this frame
+ */
+static void play_anim(lv_lottie_t * lottie, int32_t frame)
+{
+    float f_total = 0.0f;
+    float f_duration = 0.0f;
+    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
+    tvg_animation_get_duration(lottie->tvg_anim, &f_duration);
+
+    if(lottie->anim == NULL) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_exec_cb(&a, anim_exec_cb);
+        lv_anim_set_completed_cb(&a, anim_completed_cb);
+        lv_anim_set_deleted_cb(&a, anim_deleted_cb);
+        lv_anim_set_var(&a, lottie);
+        lv_anim_set_early_apply(&a, false);
+        lottie->anim = lv_anim_start(&a);
+        if(lottie->anim == NULL) return;
+    }
+
+    /*Use the frame rate of the composition*/
+    lv_anim_t * a = lottie->anim;
+    a->start_value = 0;
+    a->end_value = (int32_t)(f_total + 0.5f);
+    if(f_duration > 0.0f) a->duration = (uint32_t)(f_duration * 1000.0f);
+    a->reverse_play_in_progress = 0;
+    a->start_cb_called = 0;
+    apply_play_mode(a, lottie->play_mode);
+    a->act_time = frame_to_time(a, frame);
+    a->current_value = frame;
+    lottie->last_rendered_time = a->act_time;
+}
+
+/**
+ * Set the repeat and reverse play of an animation according to a play mode
+ * without changing the current frame
+ * @param a             pointer to the animation of a lottie widget
+ * @param mode          the play mode
+ */
+static void apply_play_mode(lv_anim_t * a, lv_lottie_play_mode_t mode)
+{
+    /*Turn a backward playing ping-pong to forward on the same frame*/
+    if(a->reverse_play_in_progress) {
+        int32_t tmp = a->start_value;
+        a->start_value = a->end_value;
+        a->end_value = tmp;
+        uint32_t duration = a->duration;
+        a->duration = a->reverse_duration;
+        a->reverse_duration = duration;
+        a->act_time = a->act_time >= 0 ? (int32_t)a->duration - a->act_time : 0;
+        a->reverse_play_in_progress = 0;
+    }
+
+    a->repeat_cnt = mode == LV_LOTTIE_PLAY_MODE_ONCE ? 1 : LV_ANIM_REPEAT_INFINITE;
+    a->reverse_duration = mode == LV_LOTTIE_PLAY_MODE_PING_PONG ? a->duration : 0;
+}
+
+/**
+ * Get the time of a frame in a forward playing animation
+ * @param a             pointer to the animation of a lottie widget
+ * @param frame         the frame
+ * @return              the first time in ms when the frame is shown
+ */
+static int32_t frame_to_time(const lv_anim_t * a, int32_t frame)
+{
+    if(a->end_value <= 0) return 0;
+    return (int32_t)(((int64_t)frame * a->duration + a->end_value - 1) / a->end_value);
+}
+
+/**
+ * Render a frame
+ * @param lottie        pointer to a lottie widget
+ * @param v             the frame to render
+ * @param render_area   the area to render relative to the buffer, NULL to render the whole buffer.
+ *                      The rest of the buffer is left unchanged.
+ */
+static void lottie_update(lv_lottie_t * lottie, int32_t v, const lv_area_t * render_area)
 {
     lv_obj_t * obj = (lv_obj_t *) lottie;
 
+    uint32_t t_start = lv_tick_get();
+    bool half_res = lottie->quality >= LV_LOTTIE_QUALITY_HALF_RES;
+    lv_area_t buf_area;
+
     lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(obj);
     if(draw_buf) {
-        lv_draw_buf_clear(draw_buf, NULL);
+        lv_area_set(&buf_area, 0, 0, draw_buf->header.w - 1, draw_buf->header.h - 1);
+        if(render_area == NULL || !lv_area_intersect(&buf_area, &buf_area, render_area)) {
+            lv_area_set(&buf_area, 0, 0, draw_buf->header.w - 1, draw_buf->header.h - 1);
+        }
+
+        /*In half resolution the frame is rendered to the top left quarter of the buffer*/
+        lv_area_t tvg_area = buf_area;
+        if(half_res) {
+            lv_area_set(&tvg_area, buf_area.x1 / 2, buf_area.y1 / 2, buf_area.x2 / 2, buf_area.y2 / 2);
+        }
+
+        lv_draw_buf_clear(draw_buf, &tvg_area);
+        tvg_canvas_set_viewport(lottie->tvg_canvas, tvg_area.x1, tvg_area.y1,
+                                lv_area_get_width(&tvg_area), lv_area_get_height(&tvg_area));
 
         /*Drop old cached image*/
         lv_image_cache_drop(lv_image_get_src(obj));
     }
 
+    LV_PROFILER_THORVG_BEGIN_TAG("lottie_update");
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_THORVG);
     tvg_animation_set_frame(lottie->tvg_anim, v);
     tvg_canvas_update(lottie->tvg_canvas);
     tvg_canvas_draw(lottie->tvg_canvas);
     tvg_canvas_sync(lottie->tvg_canvas);
+    LV_MEM_TRACE_TAG_END();
+
+    if(draw_buf && half_res) upscale_half_res(draw_buf, &buf_area);
+    LV_PROFILER_THORVG_END_TAG("lottie_update");
+
+    lottie->render_time = lv_tick_elaps(t_start);
+
+#if LV_USE_THORVG_INTERNAL
+    Tvg_Sw_Stats sw_stats;
+    if(tvg_swcanvas_get_stats(lottie->tvg_canvas, &sw_stats) == TVG_RESULT_SUCCESS) {
+        lottie->stats.shapes += sw_stats.shapes;
+        lottie->stats.spans += sw_stats.spans;
+        lottie->stats.blended_px += sw_stats.pixels;
+        lottie->stats.compositors += sw_stats.compositors;
+    }
+#endif
 
     lv_obj_invalidate(obj);
 }
 
+/**
+ * Render the current frame again, e.g. after the properties of the animation have changed
+ * @param lottie        pointer to a lottie widget
+ */
+static void refresh_frame(lv_lottie_t * lottie)
+{
+    if(!lv_obj_is_visible((lv_obj_t *)lottie)) return;
+
+    float f_current;
+    tvg_animation_get_frame(lottie->tvg_anim, &f_current);
+    lottie_update(lottie, (int32_t) f_current, NULL);
+}
+
+/**
+ * Set ThorVG's target and the picture size according to the buffer and the quality
+ * @param lottie    pointer to a lottie widget
+ */
+static void update_target(lv_lottie_t * lottie)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)lottie);
+    if(draw_buf == NULL) return;
+
+    float w = draw_buf->header.w;
+    float h = draw_buf->header.h;
+    if(lottie->quality >= LV_LOTTIE_QUALITY_HALF_RES) {
+        w = w / 2;
+        h = h / 2;
+    }
+
+    tvg_swcanvas_set_target(lottie->tvg_canvas, (void *)draw_buf->data, draw_buf->header.stride / 4,
+                            (uint32_t)(w + 0.5f), (uint32_t)(h + 0.5f), TVG_COLORSPACE_ARGB8888);
+    tvg_picture_set_size(lottie->tvg_paint, w, h);
+}
+
+/**
+ * Apply a quality level on ThorVG's canvas
+ * @param lottie    pointer to a lottie widget
+ * @param quality   the new quality level
+ */
+static void apply_quality(lv_lottie_t * lottie, lv_lottie_quality_t quality)
+{
+    bool half_res_changed = (quality >= LV_LOTTIE_QUALITY_HALF_RES) != (lottie->quality >= LV_LOTTIE_QUALITY_HALF_RES);
+    lottie->quality = quality;
+
+    uint32_t flags = TVG_SW_QUALITY_FULL;
+    if(quality >= LV_LOTTIE_QUALITY_NO_EFFECTS) flags |= TVG_SW_QUALITY_NO_EFFECTS;
+    if(quality >= LV_LOTTIE_QUALITY_COARSE_CURVES) flags |= TVG_SW_QUALITY_COARSE_CURVES;
+    if(quality >= LV_LOTTIE_QUALITY_NO_ANTIALIAS) flags |= TVG_SW_QUALITY_NO_ANTIALIASING;
+    tvg_swcanvas_set_quality(lottie->tvg_canvas, flags);
+
+    if(half_res_changed) update_target(lottie);
+}
+
+/**
+ * Adjust the quality according to the render time of the last frame and the quality policy
+ * @param lottie    pointer to a lottie widget
+ */
+static void update_quality(lv_lottie_t * lottie)
+{
+    const lv_lottie_quality_policy_t * policy = &lottie->quality_policy;
+    if(policy->frame_budget == 0) return;
+
+    if(lottie->render_time > policy->frame_budget) {
+        lottie->headroom_cnt = 0;
+        if(lottie->over_budget_cnt < UINT16_MAX) lottie->over_budget_cnt++;
+        if(lottie->over_budget_cnt >= policy->degrade_frames && lottie->quality < policy->min_quality) {
+            apply_quality(lottie, lottie->quality + 1);
+            lottie->over_budget_cnt = 0;
+        }
+    }
+    else if(lottie->render_time * 100 <= policy->frame_budget * (100 - policy->headroom_percent)) {
+        lottie->over_budget_cnt = 0;
+        if(lottie->headroom_cnt < UINT16_MAX) lottie->headroom_cnt++;
+        if(lottie->headroom_cnt >= policy->recover_frames && lottie->quality > LV_LOTTIE_QUALITY_FULL) {
+            apply_quality(lottie, lottie->quality - 1);
+            lottie->headroom_cnt = 0;
+        }
+    }
+    else {
+        lottie->over_budget_cnt = 0;
+        lottie->headroom_cnt = 0;
+    }
+}
+
+/**
+ * Scale up the half resolution frame from the top left quarter of the buffer to an area
+ * @param draw_buf  the buffer of the animation
+ * @param area      the area to fill with the upscaled frame
+ */
+static void upscale_half_res(lv_draw_buf_t * draw_buf, const lv_area_t * area)
+{
+    uint32_t stride = draw_buf->header.stride / 4;
+    uint32_t * buf = (uint32_t *)draw_buf->data;
+
+    /*Go backwards so the source pixels are always read before they are overwritten*/
+    int32_t x, y;
+    for(y = area->y2; y >= area->y1; y--) {
+        uint32_t * dest = buf + y * stride;
+        const uint32_t * src = buf + (y / 2) * stride;
+        for(x = area->x2; x >= area->x1; x--) {
+            dest[x] = src[x / 2];
+        }
+    }
+}
+
+/**
+ * Get the part of the buffer which needs to be rendered.
+ * Parts clipped by the parents or covered by opaque widgets are excluded.
+ * @param lottie        pointer to a lottie widget
+ * @param render_area   store the area relative to the buffer here
+ * @return              false: nothing is visible, the frame can be skipped
+ */
+static bool get_render_area(lv_lottie_t * lottie, lv_area_t * render_area)
+{
+    lv_obj_t * obj = (lv_obj_t *)lottie;
+    lv_image_t * img = (lv_image_t *)lottie;
+
+    lv_area_set(render_area, 0, 0, img->w - 1, img->h - 1);
+    if(!lv_obj_is_visible(obj)) return false;
+    if(!is_culling_possible(obj)) return true;
+
+    /*Get where the buffer is drawn on the screen. It is the same as in lv_image's draw_image()*/
+    lv_area_t img_area;
+    lv_area_set(&img_area, 0, 0, img->w - 1, img->h - 1);
+    lv_area_align(&obj->coords, &img_area, img->align, img->offset.x, img->offset.y);
+
+    lv_area_t vis_area = img_area;
+    if(!lv_obj_area_is_visible(obj, &vis_area)) return false;
+    if(!cut_covered_area(obj, &vis_area)) return false;
+
+    lv_area_move(&vis_area, -img_area.x1, -img_area.y1);
+    return lv_area_intersect(render_area, render_area, &vis_area);
+}
+
+/**
+ * Check if the screen area of the buffer can be calculated simply
+ * @param obj       pointer to a lottie widget
+ * @return          true: the image is not transformed
+ */
+static bool is_culling_possible(lv_obj_t * obj)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->align >= _LV_IMAGE_ALIGN_AUTO_TRANSFORM) return false;
+    if(img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE || img->rotation != 0) return false;
+
+    while(obj) {
+        if(obj->spec_attr && obj->spec_attr->layer_type == LV_LAYER_TYPE_TRANSFORM) return false;
+        obj = obj->parent;
+    }
+
+    return true;
+}
+
+/**
+ * Remove the parts of an area which are covered by widgets drawn later than `obj`
+ * @param obj       the covered widget
+ * @param area      an area on the screen. Reduced to the not covered part.
+ * @return          false: the area is fully covered
+ */
+static bool cut_covered_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_obj_t * child = obj;
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    while(parent) {
+        /*The younger siblings are drawn on top of `child`
+         *but they can cover it only if they are not faded by an ancestor*/
+        if(is_opa_chain_cover(parent)) {
+            uint32_t child_cnt = lv_obj_get_child_count(parent);
+            uint32_t i;
+            for(i = lv_obj_get_index(child) + 1; i < child_cnt; i++) {
+                if(!cut_covered_by(parent->spec_attr->children[i], area)) return false;
+            }
+        }
+        child = parent;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    /*Check the layers drawn on top of the screen too*/
+    lv_display_t * disp = lv_obj_get_display(child);
+    lv_obj_t * layer_top = lv_display_get_layer_top(disp);
+    lv_obj_t * layer_sys = lv_display_get_layer_sys(disp);
+    if(child != layer_top && child != layer_sys && layer_top) {
+        if(!cut_covered_by(layer_top, area)) return false;
+    }
+    if(child != layer_sys && layer_sys) {
+        if(!cut_covered_by(layer_sys, area)) return false;
+    }
+
+    return true;
+}
+
+/**
+ * Remove the part of an area which is covered by a widget or its children.
+ * Only a stripe spanning the whole width or height at a side of the area is cut
+ * to keep the result a rectangle.
+ * @param cover     the widget which might cover the area
+ * @param area      an area on the screen. Reduced to the not covered part.
+ * @return          false: the area is fully covered
+ */
+static bool cut_covered_by(lv_obj_t * cover, lv_area_t * area)
+{
+    lv_area_t common;
+    if(!lv_area_intersect(&common, area, &cover->coords)) return true;
+
+    bool full_w = common.x1 == area->x1 && common.x2 == area->x2;
+    bool full_h = common.y1 == area->y1 && common.y2 == area->y2;
+    if(!full_w && !full_h) return true;
+
+    if(lv_refr_get_top_obj(&common, cover) == NULL) return true;
+
+    if(full_w && full_h) return false;
+
+    if(full_w) {
+        if(common.y1 == area->y1) area->y1 = common.y2 + 1;
+        else if(common.y2 == area->y2) area->y2 = common.y1 - 1;
+    }
+    else {
+        if(common.x1 == area->x1) area->x1 = common.x2 + 1;
+        else if(common.x2 == area->x2) area->x2 = common.x1 - 1;
+    }
+
+    return true;
+}
+
+static bool is_opa_chain_cover(lv_obj_t * obj)
+{
+    while(obj) {
+        if(lv_obj_get_style_opa(obj, LV_PART_MAIN) < LV_OPA_MAX) return false;
+        if(lv_obj_get_layer_type(obj) != LV_LAYER_TYPE_NONE) return false;
+        obj = lv_obj_get_parent(obj);
+    }
+
+    return true;
+}
+
 #endif /*LV_USE_LOTTIE*/
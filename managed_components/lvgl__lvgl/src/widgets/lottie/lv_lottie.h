@@ -35,6 +35,46 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** How to play the current segment of the animation */
+typedef enum {
+    LV_LOTTIE_PLAY_MODE_LOOP,       /**< Restart the segment when it ends (default)*/
+    LV_LOTTIE_PLAY_MODE_ONCE,       /**< Play the segment once, stop on its last frame and send `LV_EVENT_READY`*/
+    LV_LOTTIE_PLAY_MODE_PING_PONG,  /**< Play the segment forward and backward repeatedly*/
+} lv_lottie_play_mode_t;
+
+/** Counters about how much of the animation had to be rendered.
+ * The ThorVG counters are collected only if `LV_USE_PROFILER` and `LV_PROFILER_THORVG` are enabled
+ * and the internal ThorVG is used.*/
+typedef struct {
+    uint32_t rendered_frames;   /**< Frames rendered at least partially*/
+    uint32_t skipped_frames;    /**< Frames skipped because nothing was visible*/
+    uint64_t rendered_px;       /**< Pixels rendered by ThorVG*/
+    uint64_t skipped_px;        /**< Pixels not rendered due to clipping or occlusion*/
+    uint64_t shapes;            /**< Shapes prepared by ThorVG*/
+    uint64_t spans;             /**< RLE spans rasterized by ThorVG*/
+    uint64_t blended_px;        /**< Pixels blended by ThorVG. Overlapping shapes are counted more times.*/
+    uint32_t compositors;       /**< Compositor buffers allocated by ThorVG*/
+} lv_lottie_render_stats_t;
+
+/** Rendering quality levels. Each level includes the reductions of the previous levels too. */
+typedef enum {
+    LV_LOTTIE_QUALITY_FULL,             /**< Best quality*/
+    LV_LOTTIE_QUALITY_NO_EFFECTS,       /**< Skip the blur and shadow effects*/
+    LV_LOTTIE_QUALITY_COARSE_CURVES,    /**< Flatten the curves with lower precision*/
+    LV_LOTTIE_QUALITY_NO_ANTIALIAS,     /**< Disable the anti-aliasing*/
+    LV_LOTTIE_QUALITY_HALF_RES,         /**< Render at half resolution and upscale the result*/
+    LV_LOTTIE_QUALITY_LAST,
+} lv_lottie_quality_t;
+
+/** Policy to adjust the rendering quality to the rendering time */
+typedef struct {
+    uint32_t frame_budget;              /**< Max. render time of a frame in ms. 0: don't adjust the quality*/
+    lv_lottie_quality_t min_quality;    /**< Don't reduce the quality below this level*/
+    uint16_t degrade_frames;            /**< Lower the quality after this many frames over the budget in a row*/
+    uint16_t recover_frames;            /**< Raise the quality after this many frames with headroom in a row*/
+    uint8_t headroom_percent;           /**< A frame has headroom if it's rendered this much faster than the budget*/
+} lv_lottie_quality_policy_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -81,10 +121,161 @@ void lv_lottie_set_src_file(lv_obj_t * obj, const char * src);
 /**
  * Get the LVGL animation which controls the lottie animation
  * @param obj       pointer to a lottie widget
- * @return          the LVGL animation
+ * @return          the LVGL animation or NULL if the animation was played once and stopped
  */
 lv_anim_t * lv_lottie_get_anim(lv_obj_t * obj);
 
+/**
+ * Play only the part of the animation delimited by a marker of the Lottie file.
+ * The segment starts from its first frame.
+ * @param obj       pointer to a lottie widget
+ * @param marker    name of the marker, or NULL to play the whole animation
+ * @return          LV_RESULT_OK: the segment is set; LV_RESULT_INVALID: the marker is not found
+ */
+lv_result_t lv_lottie_play_segment(lv_obj_t * obj, const char * marker);
+
+/**
+ * Play only a range of frames of the animation. The segment starts from its first frame.
+ * @param obj       pointer to a lottie widget
+ * @param begin     the first frame of the segment
+ * @param end       the last frame of the segment
+ * @return          LV_RESULT_OK: the segment is set; LV_RESULT_INVALID: the range is invalid
+ */
+lv_result_t lv_lottie_set_segment(lv_obj_t * obj, uint32_t begin, uint32_t end);
+
+/**
+ * Get the number of markers in the Lottie file
+ * @param obj       pointer to a lottie widget
+ * @return          number of markers
+ */
+uint32_t lv_lottie_get_marker_count(lv_obj_t * obj);
+
+/**
+ * Get the name of a marker
+ * @param obj       pointer to a lottie widget
+ * @param idx       index of the marker, in the range of `[0 .. lv_lottie_get_marker_count() - 1]`
+ * @return          name of the marker or NULL if `idx` is invalid
+ */
+const char * lv_lottie_get_marker_name(lv_obj_t * obj, uint32_t idx);
+
+/**
+ * Set how to play the current segment. The playback continues from the current frame.
+ * @param obj       pointer to a lottie widget
+ * @param mode      the play mode
+ */
+void lv_lottie_set_play_mode(lv_obj_t * obj, lv_lottie_play_mode_t mode);
+
+/**
+ * Get the play mode
+ * @param obj       pointer to a lottie widget
+ * @return          the play mode
+ */
+lv_lottie_play_mode_t lv_lottie_get_play_mode(lv_obj_t * obj);
+
+/**
+ * Jump to a frame of the current segment and continue playing from there forward.
+ * If the animation was stopped (e.g. a segment was played once) only the frame is shown.
+ * @param obj       pointer to a lottie widget
+ * @param frame     the frame relative to the beginning of the segment.
+ *                  Clamped to `[0 .. lv_lottie_get_total_frames()]`
+ */
+void lv_lottie_seek(lv_obj_t * obj, uint32_t frame);
+
+/**
+ * Get the currently shown frame
+ * @param obj       pointer to a lottie widget
+ * @return          the frame relative to the beginning of the segment
+ */
+uint32_t lv_lottie_get_current_frame(lv_obj_t * obj);
+
+/**
+ * Get the number of frames in the current segment
+ * @param obj       pointer to a lottie widget
+ * @return          number of frames
+ */
+uint32_t lv_lottie_get_total_frames(lv_obj_t * obj);
+
+/**
+ * Override properties of the animation marked with a slot ID (`"sid"`) in the Lottie file.
+ * Only the affected properties are replaced, the animation is not reloaded.
+ * @param obj       pointer to a lottie widget
+ * @param slot      slot data in JSON, e.g. `{"bg_color":{"p":{"a":0,"k":[1,0,0]}}}`,
+ *                  or NULL to restore the original values of all slots
+ * @return          LV_RESULT_OK: all slots are applied; LV_RESULT_INVALID: a slot is not found or is invalid
+ */
+lv_result_t lv_lottie_set_slot(lv_obj_t * obj, const char * slot);
+
+/**
+ * Override a color slot of the animation
+ * @param obj       pointer to a lottie widget
+ * @param sid       the slot ID
+ * @param color     the new color
+ * @return          LV_RESULT_OK: the slot is applied; LV_RESULT_INVALID: the slot is not found
+ */
+lv_result_t lv_lottie_set_slot_color(lv_obj_t * obj, const char * sid, lv_color_t color);
+
+/**
+ * Override an opacity slot of the animation
+ * @param obj       pointer to a lottie widget
+ * @param sid       the slot ID
+ * @param opa       the new opacity
+ * @return          LV_RESULT_OK: the slot is applied; LV_RESULT_INVALID: the slot is not found
+ */
+lv_result_t lv_lottie_set_slot_opa(lv_obj_t * obj, const char * sid, lv_opa_t opa);
+
+/**
+ * Get the render statistics of the animation.
+ * Only the visible part of the animation is rendered: areas clipped by the parents
+ * or covered by opaque widgets on top of it are skipped.
+ * @param obj       pointer to a lottie widget
+ * @param stats     store the statistics here
+ */
+void lv_lottie_get_render_stats(lv_obj_t * obj, lv_lottie_render_stats_t * stats);
+
+/**
+ * Reset the render statistics of the animation
+ * @param obj       pointer to a lottie widget
+ */
+void lv_lottie_reset_render_stats(lv_obj_t * obj);
+
+/**
+ * Initialize a quality policy with the default values.
+ * The frame budget is 0 so the quality is not adjusted until it's set.
+ * @param policy    pointer to a policy to initialize
+ */
+void lv_lottie_quality_policy_init(lv_lottie_quality_policy_t * policy);
+
+/**
+ * Set a policy to automatically lower the rendering quality when the frames take too long
+ * to render and raise it again when there is enough headroom.
+ * @param obj       pointer to a lottie widget
+ * @param policy    pointer to a policy. It's copied so can be a local variable.
+ *                  NULL to disable the automatic adjustment.
+ */
+void lv_lottie_set_quality_policy(lv_obj_t * obj, const lv_lottie_quality_policy_t * policy);
+
+/**
+ * Set the rendering quality. If a quality policy is set it will adjust
+ * the quality starting from this level.
+ * @param obj       pointer to a lottie widget
+ * @param quality   the quality level
+ */
+void lv_lottie_set_quality(lv_obj_t * obj, lv_lottie_quality_t quality);
+
+/**
+ * Get the current rendering quality
+ * @param obj       pointer to a lottie widget
+ * @return          the quality level
+ */
+lv_lottie_quality_t lv_lottie_get_quality(lv_obj_t * obj);
+
+/**
+ * Get how long it took to render the last frame
+ * @param obj       pointer to a lottie widget
+ * @return          the render time in ms
+ */
+uint32_t lv_lottie_get_render_time(lv_obj_t * obj);
+
 /**********************
  * GLOBAL VARIABLES
  **********************/
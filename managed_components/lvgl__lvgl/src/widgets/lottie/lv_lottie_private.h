@@ -41,6 +41,13 @@ typedef struct {
     Tvg_Animation * tvg_anim;
     lv_anim_t * anim;
     int32_t last_rendered_time;
+    lv_lottie_play_mode_t play_mode;
+    lv_lottie_render_stats_t stats;
+    lv_lottie_quality_policy_t quality_policy;
+    lv_lottie_quality_t quality;
+    uint32_t render_time;
+    uint16_t over_budget_cnt;
+    uint16_t headroom_cnt;
 } lv_lottie_t;
 
 /**********************
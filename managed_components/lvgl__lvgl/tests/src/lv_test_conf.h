@@ -22,6 +22,17 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_RESOLVED_CACHE 0
+#define LV_OBJ_DRAW_LIST            0
+#define LV_LAYOUT_INCREMENTAL       0
+#define LV_USE_TIMER_HEAP           0
+#define LV_USE_INV_AREA_COST_MODEL  0
+#define LV_FONT_FMT_TXT_CACHE_SIZE  0
+#define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 0
+#define LV_DRAW_LABEL_CACHE_SIZE    0
+#define LV_USE_MEM_SLAB             0
+#define LV_GRADIENT_CACHE_SIZE      0
+#define LV_USE_MEM_TRACE            0
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
 #define LV_DRAW_BUF_STRIDE_ALIGN    64  /* Use a large value to be sure any issues will cause crash */
 #endif
@@ -31,6 +42,17 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_OBJ_STYLE_RESOLVED_CACHE 1
+#define LV_OBJ_DRAW_LIST        1
+#define LV_LAYOUT_INCREMENTAL   1
+#define LV_USE_TIMER_HEAP       1
+#define LV_USE_INV_AREA_COST_MODEL 1
+#define LV_FONT_FMT_TXT_CACHE_SIZE  64
+#define LV_FONT_FMT_TXT_KERN_CACHE_SIZE 64
+#define LV_DRAW_LABEL_CACHE_SIZE    (64 * 1024)
+#define LV_USE_MEM_SLAB             1
+#define LV_GRADIENT_CACHE_SIZE      (64 * 1024)
+#define LV_USE_MEM_TRACE            1
 #define LV_BIN_DECODER_RAM_LOAD 0
 #endif
 
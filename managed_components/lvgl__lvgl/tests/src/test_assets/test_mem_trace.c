@@ -0,0 +1,3017 @@
+/* Allocation trace of a Lottie plus widgets session, used by the memory benchmarks.
+
+   Captured by logging `lv_malloc()`, `lv_realloc()` and `lv_free()` while running the
+   `test_lottie` and `test_demo_widgets` test cases, one after the other. The pointers are
+   replaced by slot indices (a freed slot is reused by the next allocation) and the
+   blocks still allocated at the end of each test case are freed.
+
+   Each event is two words: `(op << 16) | slot` and the size.
+   op: 0: allocate, 1: reallocate, 2: free
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+const uint32_t test_mem_trace_slot_cnt = 1186;
+
+const uint32_t test_mem_trace[] = {
+    0, 2568, 1, 112, 2, 16384, 3, 48, 4, 56, 5, 56, 6, 152, 7, 208,
+    8, 32, 9, 72, 10, 72, 11, 72, 12, 56, 13, 152, 14, 152, 15, 72,
+    16, 24, 17, 24, 18, 24, 19, 72, 20, 72, 21, 72, 22, 72, 23, 72,
+    24, 72, 25, 1, 26, 272, 27, 8, 28, 40, 29, 16, 30, 32, 31, 7,
+    32, 32, 33, 10, 34, 32, 35, 9, 36, 32, 37, 9, 38, 32, 39, 7,
+    40, 32, 41, 10, 42, 32, 43, 11, 44, 32, 45, 11, 46, 32, 47, 19,
+    48, 32, 49, 15, 50, 32, 51, 22, 52, 32, 53, 9, 54, 32, 55, 16,
+    56, 32, 57, 16, 58, 32, 59, 14, 60, 32, 61, 9, 62, 32, 63, 16,
+    64, 32, 65, 14, 66, 32, 67, 12, 68, 32, 69, 17, 70, 32, 71, 10,
+    72, 32, 73, 9, 74, 32, 75, 17, 76, 32, 77, 13, 78, 32, 79, 18,
+    80, 32, 81, 16, 82, 32, 83, 12, 84, 32, 85, 12, 86, 32, 87, 7,
+    88, 32, 89, 10, 90, 32, 91, 12, 92, 32, 93, 10, 94, 32, 95, 12,
+    96, 32, 97, 25, 98, 32, 99, 28, 100, 32, 101, 10, 102, 32, 103, 13,
+    104, 32, 105, 20, 106, 32, 107, 24, 108, 32, 109, 16, 110, 32, 111, 28,
+    112, 32, 113, 29, 114, 32, 115, 31, 116, 32, 117, 32, 118, 32, 119, 31,
+    120, 32, 121, 25, 122, 32, 123, 27, 124, 32, 125, 27, 126, 32, 127, 18,
+    128, 32, 129, 23, 130, 32, 131, 27, 132, 32, 133, 23, 134, 32, 135, 23,
+    136, 32, 137, 23, 138, 32, 139, 23, 140, 32, 141, 24, 142, 32, 143, 28,
+    144, 32, 145, 24, 146, 32, 147, 24, 148, 32, 149, 24, 150, 32, 151, 24,
+    152, 688, 153, 104, 154, 544, 155, 56, 156, 1768, 157, 9, 158, 9, 159, 9,
+    65695, 18, 65695, 27, 65695, 36, 65695, 45, 65695, 54, 65695, 63, 65695, 72, 65695, 81,
+    160, 9, 161, 9, 65697, 18, 65697, 27, 65697, 36, 65697, 45, 65697, 54, 65697, 63,
+    162, 9, 65698, 18, 65698, 27, 65698, 36, 65698, 45, 65698, 54, 65698, 63, 65698, 72,
+    65698, 81, 65698, 90, 65698, 99, 65698, 108, 65698, 117, 65698, 126, 65698, 135, 163, 9,
+    65699, 18, 65699, 27, 65699, 36, 164, 9, 65700, 18, 65700, 27, 165, 9, 65701, 18,
+    65701, 27, 65701, 36, 65701, 45, 65701, 54, 65701, 63, 65701, 72, 65701, 81, 65701, 90,
+    65701, 99, 65701, 108, 65701, 117, 65701, 126, 166, 9, 65702, 18, 167, 9, 65703, 18,
+    168, 9, 65704, 18, 169, 9, 65705, 18, 65705, 27, 65705, 36, 65705, 45, 65705, 54,
+    170, 9, 65706, 18, 65706, 27, 65706, 36, 65706, 45, 65706, 54, 171, 9, 65707, 18,
+    172, 9, 173, 9, 174, 9, 65710, 18, 65710, 27, 65710, 36, 65710, 45, 65710, 54,
+    175, 9, 65711, 18, 65711, 27, 65711, 36, 65711, 45, 65711, 54, 176, 9, 65712, 18,
+    65712, 27, 177, 9, 65713, 18, 65713, 27, 178, 9, 65714, 18, 65714, 27, 179, 9,
+    65715, 18, 65715, 27, 180, 9, 65716, 18, 65716, 27, 181, 9, 65717, 18, 65717, 27,
+    182, 9, 183, 9, 184, 9, 185, 9, 65721, 18, 186, 9, 65722, 18, 65722, 27,
+    65722, 36, 65722, 45, 65722, 54, 65722, 63, 187, 9, 188, 9, 189, 9, 65725, 18,
+    65725, 27, 190, 9, 191, 9, 192, 9, 65728, 18, 65728, 27, 65728, 36, 65728, 45,
+    65728, 54, 65728, 63, 65728, 72, 65728, 81, 65728, 90, 65728, 99, 193, 9, 194, 9,
+    65730, 18, 65730, 27, 65730, 36, 65730, 45, 195, 9, 65731, 18, 196, 9, 65732, 18,
+    65732, 27, 197, 9, 65733, 18, 65733, 27, 65733, 36, 65733, 45, 198, 9, 65734, 18,
+    65734, 27, 65734, 36, 65734, 45, 199, 9, 65735, 18, 65735, 27, 65735, 36, 65735, 45,
+    65735, 54, 65735, 63, 65735, 72, 65735, 81, 200, 9, 65736, 18, 65736, 27, 65736, 36,
+    65736, 45, 201, 9, 65737, 18, 65737, 27, 65737, 36, 65737, 45, 65737, 54, 65737, 63,
+    65737, 72, 65737, 81, 65737, 90, 202, 9, 65738, 18, 65738, 27, 65738, 36, 65738, 45,
+    65738, 54, 65738, 63, 65738, 72, 65738, 81, 65738, 90, 203, 9, 65739, 18, 65739, 27,
+    65739, 36, 65739, 45, 65739, 54, 204, 9, 65740, 18, 65740, 27, 65740, 36, 65740, 45,
+    65740, 54, 205, 9, 65741, 18, 65741, 27, 65741, 36, 65741, 45, 65741, 54, 65741, 63,
+    206, 9, 65742, 18, 65742, 27, 65742, 36, 207, 9, 65743, 18, 208, 9, 65744, 18,
+    65744, 27, 209, 9, 65745, 18, 65745, 27, 210, 9, 65746, 18, 65746, 27, 65746, 36,
+    65746, 45, 211, 9, 212, 9, 65748, 18, 65748, 27, 65748, 36, 65748, 45, 65748, 54,
+    213, 9, 65749, 18, 65749, 27, 65749, 36, 214, 9, 65750, 18, 65750, 27, 65750, 36,
+    65750, 45, 65750, 54, 215, 9, 65751, 18, 216, 9, 65752, 18, 217, 9, 65753, 18,
+    65753, 27, 65753, 36, 218, 9, 219, 9, 65755, 18, 65755, 27, 65755, 36, 65755, 45,
+    65755, 54, 65755, 63, 220, 9, 65756, 18, 65756, 27, 65756, 36, 65756, 45, 65756, 54,
+    65756, 63, 65756, 72, 221, 9, 222, 9, 65758, 18, 65758, 27, 65758, 36, 65758, 45,
+    65758, 54, 65758, 63, 223, 9, 65759, 18, 65759, 27, 65759, 36, 65759, 45, 224, 24,
+    225, 8, 226, 72, 227, 8, 228, 16, 65764, 32, 65764, 48, 229, 16, 230, 72,
+    65763, 16, 231, 16, 65767, 32, 65767, 48, 232, 72, 65763, 24, 233, 16, 65769, 32,
+    65769, 48, 234, 72, 65763, 32, 235, 16, 65771, 32, 65771, 48, 65764, 32, 65764, 16,
+    131300, 0, 65769, 32, 65769, 16, 131305, 0, 65771, 32, 65771, 16, 131307, 0, 235, 80,
+    233, 80, 228, 80, 236, 24, 65761, 40, 237, 144, 238, 8, 65765, 32, 239, 5,
+    240, 20, 241, 20, 131313, 0, 131312, 0, 240, 80, 241, 16, 242, 24, 243, 9,
+    65779, 18, 65779, 27, 65779, 36, 65779, 45, 65779, 54, 65779, 63, 131311, 0, 239, 2,
+    244, 8, 245, 8, 131317, 0, 131316, 0, 65779, 72, 65779, 81, 65779, 90, 244, 56,
+    245, 24, 246, 8, 131311, 0, 239, 27, 247, 28, 248, 108, 249, 108, 131321, 0,
+    131320, 0, 131311, 0, 239, 56, 248, 24, 249, 144, 65774, 16, 250, 5, 251, 20,
+    252, 20, 131324, 0, 131323, 0, 251, 80, 252, 16, 253, 24, 254, 9, 65790, 18,
+    65790, 27, 65790, 36, 65790, 45, 65790, 54, 65790, 63, 131322, 0, 250, 2, 255, 8,
+    256, 8, 131328, 0, 131327, 0, 65790, 72, 65790, 81, 65790, 90, 255, 56, 256, 24,
+    257, 8, 131322, 0, 250, 33, 258, 34, 259, 132, 260, 132, 131332, 0, 131331, 0,
+    131322, 0, 250, 24, 259, 24, 260, 24, 65761, 72, 261, 848, 262, 56, 263, 24,
+    264, 8, 265, 848, 266, 56, 267, 24, 268, 8, 269, 848, 270, 56, 271, 24,
+    272, 8, 273, 40, 274, 848, 275, 56, 276, 24, 277, 8, 278, 304, 279, 80,
+    280, 8, 65765, 48, 281, 16, 282, 24, 283, 9, 65819, 18, 284, 152, 285, 5140,
+    286, 2, 287, 256, 288, 6, 289, 8, 290, 14, 291, 8, 65827, 16, 65827, 32,
+    292, 8, 65828, 16, 65828, 32, 293, 8, 65829, 16, 65829, 32, 294, 80, 295, 20,
+    131365, 0, 131363, 0, 131364, 0, 292, 8, 65828, 16, 65828, 32, 291, 8, 293, 48,
+    296, 72, 297, 20, 298, 8, 65829, 96, 65827, 16, 299, 8, 300, 14, 301, 8,
+    65837, 16, 65837, 32, 302, 8, 65838, 16, 65838, 32, 303, 8, 65839, 16, 65839, 32,
+    304, 80, 305, 20, 131375, 0, 131373, 0, 131374, 0, 302, 8, 65838, 16, 65838, 32,
+    301, 8, 303, 48, 65839, 96, 65837, 16, 65835, 16, 306, 14, 307, 8, 65843, 16,
+    65843, 32, 308, 8, 309, 48, 310, 72, 311, 20, 65834, 16, 65845, 96, 65844, 16,
+    65835, 32, 312, 14, 313, 8, 65849, 16, 65849, 32, 314, 8, 315, 48, 65851, 96,
+    65850, 16, 316, 20, 317, 32, 318, 8, 319, 8, 320, 8, 321, 8, 322, 24,
+    323, 104, 324, 8, 325, 8, 326, 8, 327, 12, 328, 56, 329, 20, 330, 32,
+    131357, 0, 131358, 0, 131359, 0, 287, 8, 65823, 16, 65819, 27, 65819, 36, 65819, 45,
+    286, 232, 285, 272, 131358, 0, 286, 112, 131358, 0, 131357, 0, 285, 30, 131357, 0,
+    285, 1536000, 286, 24, 131358, 0, 286, 2248, 331, 24, 131403, 0, 331, 2248, 332, 1152480,
+    333, 76, 334, 76, 335, 76, 336, 32, 337, 32, 131408, 0, 131409, 0, 337, 2048,
+    336, 512, 338, 1024, 131409, 0, 337, 1152, 339, 128, 340, 1152, 341, 1152, 342, 64,
+    343, 64, 131414, 0, 131415, 0, 343, 2048, 342, 512, 344, 1024, 131415, 0, 343, 128,
+    345, 128, 346, 64, 347, 64, 131418, 0, 131419, 0, 347, 2048, 346, 512, 348, 1024,
+    131419, 0, 131405, 0, 131409, 0, 131411, 0, 131407, 0, 131406, 0, 131408, 0, 131410, 0,
+    65868, 1728901, 131413, 0, 131412, 0, 131414, 0, 131416, 0, 131417, 0, 131415, 0, 131418, 0,
+    131420, 0, 131403, 0, 331, 40, 348, 1536851, 131404, 0, 332, 40, 346, 1536851, 131420, 0,
+    131403, 0, 131358, 0, 131357, 0, 131418, 0, 131404, 0, 332, 108, 346, 12, 285, 108,
+    286, 12, 331, 108, 348, 12, 343, 8, 345, 8, 344, 8, 342, 24, 340, 104,
+    341, 8, 338, 8, 336, 8, 334, 12, 335, 56, 339, 192, 337, 16, 333, 16,
+    347, 1, 65869, 32, 65883, 2, 65869, 64, 65883, 4, 65869, 112, 65883, 7, 349, 4,
+    350, 1, 65869, 176, 65883, 11, 65885, 8, 65886, 2, 131409, 0, 337, 256, 351, 16,
+    352, 256, 353, 16, 65873, 640, 65887, 40, 65873, 1216, 65887, 76, 354, 688, 355, 43,
+    356, 4, 357, 16, 358, 2048, 359, 192, 360, 16, 131432, 0, 360, 256, 361, 16,
+    362, 256, 363, 16, 65896, 640, 65897, 40, 364, 16, 365, 2048, 65823, 32, 366, 192,
+    367, 16, 131439, 0, 367, 256, 368, 16, 369, 256, 370, 16, 65903, 640, 65904, 40,
+    371, 16, 372, 2048, 373, 192, 374, 16, 131446, 0, 374, 256, 375, 16, 376, 256,
+    377, 16, 65910, 640, 65911, 40, 378, 16, 379, 2048, 380, 232, 381, 272, 131452, 0,
+    380, 112, 131452, 0, 131453, 0, 381, 232, 380, 272, 131453, 0, 381, 112, 131453, 0,
+    131452, 0, 380, 30, 131452, 0, 380, 1536000, 381, 24, 131453, 0, 381, 4268, 382, 24,
+    131454, 0, 382, 4268, 383, 1152480, 384, 76, 385, 76, 386, 76, 387, 32, 388, 32,
+    131459, 0, 131460, 0, 388, 2048, 387, 512, 389, 1024, 131460, 0, 388, 1152, 390, 128,
+    391, 1152, 392, 1152, 393, 64, 394, 64, 131465, 0, 131466, 0, 394, 2048, 393, 698,
+    395, 1396, 131466, 0, 394, 128, 396, 128, 397, 64, 398, 64, 131469, 0, 131470, 0,
+    398, 2048, 397, 512, 399, 1024, 131470, 0, 131456, 0, 131460, 0, 131462, 0, 131458, 0,
+    131457, 0, 131459, 0, 131461, 0, 65919, 1728901, 131464, 0, 131463, 0, 131465, 0, 131467, 0,
+    131468, 0, 131466, 0, 131469, 0, 131471, 0, 131454, 0, 382, 40, 399, 1536851, 131455, 0,
+    383, 40, 397, 1536851, 131471, 0, 131454, 0, 131453, 0, 131452, 0, 131469, 0, 131455, 0,
+    131319, 0, 247, 28, 383, 29, 397, 112, 380, 112, 131452, 0, 131469, 0, 131319, 0,
+    131330, 0, 258, 33, 247, 34, 397, 132, 380, 132, 131452, 0, 131469, 0, 131330, 0,
+    258, 16, 65869, 272, 65883, 17, 131330, 0, 65888, 640, 65889, 40, 65873, 2080, 65887, 130,
+    65890, 1456, 65891, 91, 65894, 4096, 65894, 8192, 258, 16, 131330, 0, 65898, 640, 65899, 40,
+    65896, 1216, 65897, 76, 65896, 2080, 65897, 130, 65901, 4096, 65901, 8192, 258, 16, 397, 1,
+    65794, 32, 65933, 2, 65794, 64, 65933, 4, 65794, 112, 65933, 7, 380, 4, 381, 1,
+    65908, 4096, 382, 16, 131454, 0, 65915, 4096, 382, 232, 399, 272, 131454, 0, 382, 112,
+    131454, 0, 131471, 0, 399, 232, 382, 272, 131471, 0, 399, 112, 131471, 0, 131454, 0,
+    382, 30, 131454, 0, 382, 1536000, 399, 24, 131471, 0, 399, 6800, 394, 24, 131466, 0,
+    394, 6800, 396, 1152480, 395, 76, 393, 76, 391, 76, 392, 32, 389, 32, 131464, 0,
+    131461, 0, 389, 2048, 392, 512, 387, 1024, 131461, 0, 389, 1152, 385, 128, 386, 1152,
+    390, 1152, 388, 64, 384, 64, 131460, 0, 131456, 0, 384, 2048, 388, 702, 398, 1404,
+    131456, 0, 384, 128, 400, 128, 401, 64, 402, 64, 131473, 0, 131474, 0, 402, 2048,
+    401, 514, 403, 1028, 131474, 0, 131467, 0, 131461, 0, 131457, 0, 131463, 0, 131465, 0,
+    131464, 0, 131459, 0, 65932, 1728901, 131462, 0, 131458, 0, 131460, 0, 131470, 0, 131472, 0,
+    131456, 0, 131473, 0, 131475, 0, 131466, 0, 394, 40, 403, 1536851, 131468, 0, 396, 40,
+    401, 1536851, 131475, 0, 131466, 0, 131471, 0, 131454, 0, 131473, 0, 131468, 0, 131430, 0,
+    131429, 0, 131409, 0, 131423, 0, 131424, 0, 131425, 0, 131411, 0, 131444, 0, 131443, 0,
+    131439, 0, 131440, 0, 131441, 0, 131442, 0, 131438, 0, 366, 232, 370, 272, 131438, 0,
+    366, 112, 131438, 0, 131442, 0, 370, 192, 366, 16, 131438, 0, 366, 256, 369, 16,
+    368, 256, 367, 16, 65902, 640, 65905, 40, 65902, 1216, 65905, 76, 371, 16, 372, 2048,
+    339, 16, 131411, 0, 339, 192, 353, 16, 131425, 0, 353, 256, 352, 16, 351, 256,
+    337, 16, 65889, 640, 65888, 40, 357, 16, 358, 2048, 396, 16, 131468, 0, 396, 232,
+    401, 272, 131468, 0, 396, 112, 131468, 0, 131473, 0, 401, 232, 396, 272, 131473, 0,
+    401, 112, 131473, 0, 131468, 0, 396, 30, 131468, 0, 396, 1536000, 401, 24, 131473, 0,
+    401, 4268, 382, 24, 131454, 0, 382, 4268, 399, 1152480, 394, 76, 403, 76, 384, 76,
+    400, 32, 398, 32, 131472, 0, 131470, 0, 398, 2048, 400, 512, 388, 1024, 131470, 0,
+    398, 1152, 386, 128, 390, 1152, 387, 1152, 392, 64, 393, 64, 131464, 0, 131465, 0,
+    393, 2048, 392, 698, 391, 1396, 131465, 0, 393, 128, 385, 128, 389, 64, 395, 64,
+    131461, 0, 131467, 0, 395, 2048, 389, 512, 402, 1024, 131467, 0, 131466, 0, 131470, 0,
+    131458, 0, 131456, 0, 131475, 0, 131472, 0, 131460, 0, 65935, 1728901, 131459, 0, 131462, 0,
+    131464, 0, 131463, 0, 131457, 0, 131465, 0, 131461, 0, 131474, 0, 131454, 0, 382, 40,
+    402, 1536851, 131471, 0, 399, 40, 389, 1536851, 131474, 0, 131454, 0, 131473, 0, 131468, 0,
+    131461, 0, 131471, 0, 131389, 0, 131388, 0, 131390, 0, 131362, 0, 131367, 0, 131366, 0,
+    131408, 0, 131364, 0, 131410, 0, 131365, 0, 131363, 0, 131413, 0, 131372, 0, 131377, 0,
+    131376, 0, 131398, 0, 131374, 0, 131397, 0, 131375, 0, 131373, 0, 131396, 0, 131378, 0,
+    131416, 0, 131379, 0, 131417, 0, 131381, 0, 131380, 0, 131415, 0, 131384, 0, 131393, 0,
+    131385, 0, 131392, 0, 131387, 0, 131386, 0, 131391, 0, 131371, 0, 131360, 0, 131361, 0,
+    131369, 0, 131368, 0, 131383, 0, 131382, 0, 131370, 0, 131444, 0, 131443, 0, 131438, 0,
+    131441, 0, 131440, 0, 131439, 0, 131442, 0, 131395, 0, 131394, 0, 131437, 0, 131436, 0,
+    131432, 0, 131433, 0, 131434, 0, 131435, 0, 131431, 0, 131412, 0, 131414, 0, 131430, 0,
+    131429, 0, 131425, 0, 131424, 0, 131423, 0, 131409, 0, 131411, 0, 131400, 0, 131399, 0,
+    131451, 0, 131450, 0, 131446, 0, 131447, 0, 131448, 0, 131449, 0, 131445, 0, 131407, 0,
+    131406, 0, 131402, 0, 131401, 0, 131359, 0, 131355, 0, 131354, 0, 131353, 0, 131356, 0,
+    131352, 0, 131350, 0, 278, 304, 280, 8, 284, 16, 281, 24, 282, 9, 65818, 18,
+    283, 152, 287, 5139, 329, 17, 330, 256, 334, 6, 335, 8, 373, 14, 377, 8,
+    65913, 16, 65913, 32, 376, 8, 65912, 16, 65912, 32, 375, 8, 65911, 16, 65911, 32,
+    374, 80, 378, 20, 131447, 0, 131449, 0, 131448, 0, 376, 8, 65912, 16, 65912, 32,
+    377, 8, 375, 48, 379, 72, 327, 20, 328, 8, 65911, 96, 65913, 16, 339, 8,
+    337, 14, 351, 8, 65887, 16, 65887, 32, 352, 8, 65888, 16, 65888, 32, 353, 8,
+    65889, 16, 65889, 32, 357, 80, 358, 20, 131425, 0, 131423, 0, 131424, 0, 352, 8,
+    65888, 16, 65888, 32, 351, 8, 353, 48, 65889, 96, 65887, 16, 65875, 16, 342, 14,
+    340, 8, 65876, 16, 65876, 32, 359, 8, 363, 48, 362, 72, 361, 20, 65864, 16,
+    65899, 96, 65895, 16, 65875, 32, 360, 14, 364, 8, 65900, 16, 65900, 32, 365, 8,
+    322, 48, 65858, 96, 65901, 16, 323, 20, 370, 32, 367, 8, 368, 8, 369, 8,
+    366, 8, 371, 24, 372, 104, 298, 8, 310, 8, 311, 8, 296, 12, 297, 56,
+    289, 20, 288, 32, 131359, 0, 131401, 0, 131402, 0, 330, 8, 65866, 16, 65818, 27,
+    65818, 36, 65818, 45, 329, 232, 287, 272, 131401, 0, 329, 112, 131401, 0, 131359, 0,
+    287, 30, 131359, 0, 287, 1536000, 329, 24, 131401, 0, 329, 2248, 299, 24, 131371, 0,
+    299, 2248, 319, 1152480, 314, 76, 315, 76, 320, 76, 313, 32, 321, 32, 131385, 0,
+    131393, 0, 321, 2048, 313, 512, 312, 1024, 131393, 0, 321, 1152, 343, 128, 308, 1152,
+    309, 1152, 345, 64, 307, 64, 131417, 0, 131379, 0, 307, 2048, 345, 512, 344, 1024,
+    131379, 0, 307, 128, 306, 128, 324, 64, 301, 64, 131396, 0, 131373, 0, 301, 2048,
+    324, 512, 303, 1024, 131373, 0, 131386, 0, 131393, 0, 131415, 0, 131392, 0, 131387, 0,
+    131385, 0, 131384, 0, 65855, 1728901, 131381, 0, 131380, 0, 131417, 0, 131416, 0, 131378, 0,
+    131379, 0, 131396, 0, 131375, 0, 131371, 0, 299, 40, 303, 1536851, 131391, 0, 319, 40,
+    324, 1536851, 131375, 0, 131371, 0, 131401, 0, 131359, 0, 131396, 0, 131391, 0, 131455, 0,
+    383, 30, 319, 31, 324, 120, 287, 120, 131359, 0, 131396, 0, 131455, 0, 131319, 0,
+    247, 33, 383, 34, 324, 132, 287, 132, 131359, 0, 131396, 0, 131319, 0, 247, 8,
+    324, 8, 287, 8, 329, 24, 299, 104, 303, 8, 307, 8, 306, 8, 344, 12,
+    345, 56, 308, 192, 309, 16, 131381, 0, 309, 256, 312, 16, 313, 256, 315, 16,
+    65845, 640, 65848, 40, 65845, 1216, 65848, 76, 320, 16, 343, 2048, 321, 192, 314, 16,
+    131386, 0, 314, 256, 301, 16, 325, 256, 302, 16, 65850, 640, 65837, 40, 326, 16,
+    304, 2048, 65866, 32, 305, 192, 300, 16, 131372, 0, 300, 256, 341, 16, 291, 256,
+    293, 16, 65836, 640, 65877, 40, 338, 16, 292, 2048, 336, 192, 294, 16, 131366, 0,
+    294, 256, 295, 16, 290, 256, 318, 16, 65830, 640, 65831, 40, 316, 16, 317, 2048,
+    399, 232, 389, 272, 131471, 0, 399, 112, 131471, 0, 131461, 0, 389, 232, 399, 272,
+    131461, 0, 389, 112, 131461, 0, 131471, 0, 399, 30, 131471, 0, 399, 1536000, 389, 24,
+    131461, 0, 389, 4268, 396, 24, 131468, 0, 396, 4268, 401, 1152480, 382, 76, 402, 76,
+    393, 76, 385, 32, 391, 32, 131457, 0, 131463, 0, 391, 2048, 385, 512, 392, 1024,
+    131463, 0, 391, 1152, 390, 128, 387, 1152, 388, 1152, 400, 64, 403, 64, 131472, 0,
+    131475, 0, 403, 2048, 400, 698, 384, 1396, 131475, 0, 403, 128, 386, 128, 398, 64,
+    394, 64, 131470, 0, 131466, 0, 394, 2048, 398, 512, 395, 1024, 131466, 0, 131454, 0,
+    131463, 0, 131462, 0, 131465, 0, 131474, 0, 131457, 0, 131464, 0, 65937, 1728901, 131460, 0,
+    131459, 0, 131472, 0, 131456, 0, 131458, 0, 131475, 0, 131470, 0, 131467, 0, 131468, 0,
+    396, 40, 395, 1536851, 131473, 0, 401, 40, 398, 1536851, 131467, 0, 131468, 0, 131461, 0,
+    131471, 0, 131470, 0, 131473, 0, 131391, 0, 319, 29, 401, 30, 398, 116, 399, 116,
+    131471, 0, 131470, 0, 131391, 0, 131455, 0, 383, 33, 319, 34, 398, 132, 399, 132,
+    131471, 0, 131470, 0, 131455, 0, 383, 16, 131455, 0, 65849, 640, 65851, 40, 65845, 2080,
+    65848, 130, 65879, 4096, 65879, 8192, 383, 16, 131455, 0, 65861, 640, 65838, 40, 65850, 1216,
+    65837, 76, 65850, 2080, 65837, 130, 65840, 4096, 65840, 8192, 65828, 4096, 383, 16, 131455, 0,
+    65853, 4096, 383, 232, 398, 272, 131455, 0, 383, 112, 131455, 0, 131470, 0, 398, 232,
+    383, 272, 131470, 0, 398, 112, 131470, 0, 131455, 0, 383, 30, 131455, 0, 383, 1536000,
+    398, 24, 131470, 0, 398, 6800, 399, 24, 131471, 0, 399, 6800, 389, 1152480, 396, 76,
+    395, 76, 403, 76, 386, 32, 384, 32, 131458, 0, 131456, 0, 384, 2048, 386, 512,
+    400, 1024, 131456, 0, 384, 1152, 387, 128, 388, 1152, 392, 1152, 385, 64, 402, 64,
+    131457, 0, 131474, 0, 402, 2048, 385, 702, 393, 1404, 131474, 0, 402, 128, 390, 128,
+    391, 64, 382, 64, 131463, 0, 131454, 0, 382, 2048, 391, 514, 394, 1028, 131454, 0,
+    131468, 0, 131456, 0, 131459, 0, 131475, 0, 131467, 0, 131458, 0, 131472, 0, 65925, 1728901,
+    131464, 0, 131460, 0, 131457, 0, 131465, 0, 131462, 0, 131474, 0, 131463, 0, 131466, 0,
+    131471, 0, 399, 40, 394, 1536851, 131461, 0, 389, 40, 391, 1536851, 131466, 0, 131471, 0,
+    131470, 0, 131455, 0, 131463, 0, 131461, 0, 131415, 0, 131392, 0, 131381, 0, 131384, 0,
+    131385, 0, 131387, 0, 131380, 0, 131364, 0, 131410, 0, 131372, 0, 131413, 0, 131363, 0,
+    131365, 0, 131377, 0, 305, 232, 293, 272, 131377, 0, 305, 112, 131377, 0, 131365, 0,
+    293, 192, 305, 16, 131377, 0, 305, 256, 291, 16, 341, 256, 300, 16, 65841, 640,
+    65827, 40, 65841, 1216, 65827, 76, 338, 16, 292, 2048, 308, 16, 131380, 0, 308, 192,
+    315, 16, 131387, 0, 315, 256, 313, 16, 312, 256, 309, 16, 65851, 640, 65849, 40,
+    320, 16, 343, 2048, 389, 16, 131461, 0, 389, 232, 391, 272, 131461, 0, 389, 112,
+    131461, 0, 131463, 0, 391, 232, 389, 272, 131463, 0, 391, 112, 131463, 0, 131461, 0,
+    389, 30, 131461, 0, 389, 1536000, 391, 24, 131463, 0, 391, 4268, 383, 24, 131455, 0,
+    383, 4268, 398, 1152480, 399, 76, 394, 76, 402, 76, 390, 32, 393, 32, 131462, 0,
+    131465, 0, 393, 2048, 390, 512, 385, 1024, 131465, 0, 393, 1152, 388, 128, 392, 1152,
+    400, 1152, 386, 64, 395, 64, 131458, 0, 131467, 0, 395, 2048, 386, 698, 403, 1396,
+    131467, 0, 395, 128, 387, 128, 384, 64, 396, 64, 131456, 0, 131468, 0, 396, 2048,
+    384, 512, 382, 1024, 131468, 0, 131471, 0, 131465, 0, 131460, 0, 131474, 0, 131466, 0,
+    131462, 0, 131457, 0, 65934, 1728901, 131472, 0, 131464, 0, 131458, 0, 131475, 0, 131459, 0,
+    131467, 0, 131456, 0, 131454, 0, 131455, 0, 383, 40, 382, 1536851, 131470, 0, 398, 40,
+    384, 1536851, 131454, 0, 131455, 0, 131463, 0, 131461, 0, 131456, 0, 131470, 0, 131442, 0,
+    131395, 0, 131439, 0, 131445, 0, 131450, 0, 131446, 0, 131378, 0, 131448, 0, 131379, 0,
+    131447, 0, 131449, 0, 131375, 0, 131409, 0, 131430, 0, 131429, 0, 131383, 0, 131424, 0,
+    131382, 0, 131425, 0, 131423, 0, 131370, 0, 131414, 0, 131359, 0, 131412, 0, 131396, 0,
+    131435, 0, 131431, 0, 131319, 0, 131432, 0, 131438, 0, 131436, 0, 131441, 0, 131394, 0,
+    131437, 0, 131440, 0, 131411, 0, 131406, 0, 131407, 0, 131399, 0, 131451, 0, 131433, 0,
+    131434, 0, 131400, 0, 131364, 0, 131410, 0, 131377, 0, 131363, 0, 131413, 0, 131372, 0,
+    131365, 0, 131444, 0, 131443, 0, 131376, 0, 131398, 0, 131386, 0, 131373, 0, 131397, 0,
+    131374, 0, 131393, 0, 131371, 0, 131401, 0, 131415, 0, 131392, 0, 131387, 0, 131385, 0,
+    131384, 0, 131381, 0, 131380, 0, 131369, 0, 131368, 0, 131389, 0, 131388, 0, 131366, 0,
+    131367, 0, 131362, 0, 131390, 0, 131408, 0, 131417, 0, 131416, 0, 131360, 0, 131361, 0,
+    131402, 0, 131354, 0, 131353, 0, 131356, 0, 131355, 0, 131352, 0, 131350, 0, 278, 304,
+    280, 8, 283, 16, 284, 24, 281, 9, 65817, 18, 282, 152, 330, 304, 65816, 16,
+    289, 16, 288, 24, 344, 9, 65880, 18, 345, 152, 336, 5140, 318, 2, 290, 256,
+    295, 6, 294, 8, 316, 14, 317, 8, 65853, 16, 65853, 32, 296, 8, 65832, 16,
+    65832, 32, 297, 8, 65833, 16, 65833, 32, 308, 80, 309, 20, 131369, 0, 131389, 0,
+    131368, 0, 296, 8, 65832, 16, 65832, 32, 317, 8, 297, 48, 312, 72, 313, 20,
+    315, 8, 65833, 96, 65853, 16, 320, 8, 343, 14, 329, 8, 65865, 16, 65865, 32,
+    299, 8, 65835, 16, 65835, 32, 321, 8, 65857, 16, 65857, 32, 302, 80, 325, 20,
+    131393, 0, 131401, 0, 131371, 0, 299, 8, 65835, 16, 65835, 32, 329, 8, 321, 48,
+    65857, 96, 65865, 16, 65856, 16, 301, 14, 314, 8, 65850, 16, 65850, 32, 326, 8,
+    304, 48, 371, 72, 372, 20, 65851, 16, 65840, 96, 65862, 16, 65856, 32, 293, 14,
+    300, 8, 65836, 16, 65836, 32, 341, 8, 291, 48, 65827, 96, 65877, 16, 305, 20,
+    338, 32, 292, 8, 328, 8, 362, 8, 361, 8, 379, 24, 327, 104, 335, 8,
+    334, 8, 339, 8, 368, 12, 365, 56, 322, 20, 369, 32, 131408, 0, 131390, 0,
+    131362, 0, 290, 8, 65826, 16, 65880, 27, 65880, 36, 65880, 45, 131473, 0, 401, 29,
+    318, 30, 336, 116, 364, 116, 131436, 0, 131408, 0, 131473, 0, 401, 232, 336, 272,
+    131473, 0, 401, 112, 131473, 0, 401, 272, 131408, 0, 336, 112, 131408, 0, 131473, 0,
+    131391, 0, 319, 33, 401, 34, 336, 132, 364, 132, 131436, 0, 131408, 0, 131391, 0,
+    319, 8, 336, 8, 364, 8, 366, 24, 360, 104, 247, 8, 359, 8, 363, 8,
+    324, 12, 340, 56, 287, 192, 342, 16, 131414, 0, 342, 256, 298, 16, 351, 256,
+    353, 16, 65878, 640, 65834, 40, 65887, 640, 65889, 40, 65878, 1216, 65834, 76, 65878, 2080,
+    65834, 130, 310, 16, 352, 2048, 65888, 4096, 65888, 8192, 65826, 32, 311, 192, 357, 16,
+    131429, 0, 357, 256, 358, 16, 337, 256, 303, 16, 65893, 640, 65894, 40, 65873, 640,
+    65839, 40, 65893, 1216, 65894, 76, 65893, 2080, 65894, 130, 377, 16, 375, 2048, 65911, 4096,
+    65911, 8192, 307, 192, 376, 256, 306, 16, 374, 256, 378, 16, 65912, 640, 65842, 40,
+    373, 16, 367, 2048, 65903, 4096, 323, 192, 370, 16, 131442, 0, 370, 256, 398, 16,
+    384, 256, 389, 16, 65906, 640, 65934, 40, 391, 16, 383, 2048, 65919, 4096, 382, 232,
+    395, 272, 131454, 0, 382, 112, 131454, 0, 131467, 0, 395, 232, 382, 272, 131467, 0,
+    395, 272, 387, 112, 131459, 0, 131454, 0, 382, 112, 131454, 0, 131467, 0, 395, 30,
+    131467, 0, 395, 1536000, 382, 24, 131454, 0, 382, 6800, 387, 24, 131459, 0, 387, 6800,
+    403, 1152480, 386, 76, 392, 76, 400, 76, 385, 32, 390, 32, 131457, 0, 131462, 0,
+    390, 2048, 385, 512, 394, 1024, 131462, 0, 390, 1152, 402, 128, 388, 1152, 393, 1152,
+    399, 64, 396, 64, 131471, 0, 131468, 0, 396, 2048, 399, 702, 404, 1404, 131468, 0,
+    396, 128, 405, 128, 406, 64, 407, 64, 131478, 0, 131479, 0, 407, 2048, 406, 514,
+    408, 1028, 131479, 0, 131458, 0, 131462, 0, 131474, 0, 131472, 0, 131464, 0, 131457, 0,
+    131466, 0, 65939, 1728901, 131465, 0, 131460, 0, 131471, 0, 131476, 0, 131477, 0, 131468, 0,
+    131478, 0, 131480, 0, 131459, 0, 387, 40, 408, 1536851, 131475, 0, 403, 40, 406, 1536851,
+    131480, 0, 131459, 0, 131454, 0, 131467, 0, 131478, 0, 131475, 0, 131353, 0, 131356, 0,
+    131355, 0, 131354, 0, 65816, 8, 131350, 0, 131410, 0, 131377, 0, 131364, 0, 131388, 0,
+    131381, 0, 131380, 0, 131435, 0, 131368, 0, 131431, 0, 131369, 0, 131389, 0, 131319, 0,
+    131415, 0, 131397, 0, 131374, 0, 131411, 0, 131371, 0, 131406, 0, 131393, 0, 131401, 0,
+    131407, 0, 131373, 0, 131436, 0, 131386, 0, 131408, 0, 131376, 0, 131398, 0, 131391, 0,
+    131365, 0, 131433, 0, 131372, 0, 131434, 0, 131363, 0, 131413, 0, 131400, 0, 131392, 0,
+    131367, 0, 131366, 0, 131385, 0, 131384, 0, 131444, 0, 131443, 0, 131387, 0, 131424, 0,
+    131382, 0, 131414, 0, 131370, 0, 131423, 0, 131425, 0, 131359, 0, 131399, 0, 131451, 0,
+    131447, 0, 131449, 0, 131429, 0, 131430, 0, 131409, 0, 131375, 0, 131383, 0, 131432, 0,
+    131438, 0, 131439, 0, 131445, 0, 131448, 0, 131378, 0, 131446, 0, 131450, 0, 131379, 0,
+    131437, 0, 131440, 0, 131455, 0, 131463, 0, 131442, 0, 131470, 0, 131456, 0, 131461, 0,
+    131395, 0, 131412, 0, 131396, 0, 131441, 0, 131394, 0, 131362, 0, 131416, 0, 131360, 0,
+    131361, 0, 131417, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 345, 16, 289, 24,
+    288, 9, 65824, 18, 344, 152, 290, 5140, 322, 2, 369, 256, 324, 6, 340, 8,
+    323, 14, 389, 8, 65925, 16, 65925, 32, 384, 8, 65920, 16, 65920, 32, 398, 8,
+    65934, 16, 65934, 32, 370, 80, 391, 20, 131470, 0, 131461, 0, 131456, 0, 384, 8,
+    65920, 16, 65920, 32, 389, 8, 398, 48, 383, 72, 368, 20, 365, 8, 65934, 96,
+    65925, 16, 307, 8, 378, 14, 374, 8, 65910, 16, 65910, 32, 306, 8, 65842, 16,
+    65842, 32, 376, 8, 65912, 16, 65912, 32, 373, 80, 367, 20, 131448, 0, 131446, 0,
+    131378, 0, 306, 8, 65842, 16, 65842, 32, 374, 8, 376, 48, 65912, 96, 65910, 16,
+    65843, 16, 366, 14, 360, 8, 65896, 16, 65896, 32, 311, 8, 303, 48, 337, 72,
+    358, 20, 65901, 16, 65839, 96, 65847, 16, 65843, 32, 357, 14, 377, 8, 65913, 16,
+    65913, 32, 375, 8, 379, 48, 65915, 96, 65911, 16, 327, 20, 287, 32, 353, 8,
+    351, 8, 298, 8, 342, 8, 310, 24, 352, 104, 315, 8, 371, 8, 372, 8,
+    312, 12, 313, 56, 294, 20, 295, 32, 131362, 0, 131394, 0, 131441, 0, 369, 8,
+    65905, 16, 65824, 27, 65824, 36, 65824, 45, 322, 232, 290, 272, 131394, 0, 322, 112,
+    131394, 0, 131362, 0, 290, 8, 322, 8, 320, 8, 328, 24, 341, 104, 291, 8,
+    362, 8, 300, 8, 361, 12, 293, 56, 319, 192, 326, 16, 131398, 0, 326, 256,
+    304, 16, 336, 256, 314, 16, 65862, 640, 65840, 40, 65862, 1216, 65840, 76, 364, 16,
+    301, 2048, 335, 192, 329, 16, 131401, 0, 329, 256, 321, 16, 334, 256, 299, 16,
+    65865, 640, 65857, 40, 339, 16, 302, 2048, 65905, 32, 325, 192, 343, 16, 131415, 0,
+    343, 256, 247, 16, 317, 256, 297, 16, 65879, 640, 65783, 40, 359, 16, 296, 2048,
+    363, 192, 308, 16, 131380, 0, 308, 256, 309, 16, 316, 256, 292, 16, 65844, 640,
+    65845, 40, 305, 16, 338, 2048, 278, 232, 282, 272, 131350, 0, 278, 112, 131350, 0,
+    131354, 0, 282, 232, 278, 272, 131354, 0, 282, 112, 131354, 0, 131350, 0, 278, 30,
+    131350, 0, 278, 1536000, 282, 24, 131354, 0, 282, 4268, 283, 24, 131355, 0, 283, 4268,
+    284, 1152480, 281, 76, 403, 76, 406, 76, 395, 32, 382, 32, 131467, 0, 131454, 0,
+    382, 2048, 395, 512, 387, 1024, 131454, 0, 382, 1152, 408, 128, 396, 1152, 405, 1152,
+    404, 64, 399, 64, 131476, 0, 131471, 0, 399, 2048, 404, 698, 388, 1396, 131471, 0,
+    399, 128, 393, 128, 394, 64, 385, 64, 131466, 0, 131457, 0, 385, 2048, 394, 512,
+    392, 1024, 131457, 0, 131353, 0, 131454, 0, 131480, 0, 131478, 0, 131475, 0, 131467, 0,
+    131459, 0, 65820, 1728901, 131477, 0, 131468, 0, 131476, 0, 131460, 0, 131465, 0, 131471, 0,
+    131466, 0, 131464, 0, 131355, 0, 283, 40, 392, 1536851, 131356, 0, 284, 40, 394, 1536851,
+    131464, 0, 131355, 0, 131354, 0, 131350, 0, 131466, 0, 131356, 0, 284, 16, 131356, 0,
+    284, 16, 131356, 0, 284, 16, 131356, 0, 284, 16, 131356, 0, 284, 16, 131356, 0,
+    284, 16, 131356, 0, 284, 16, 131356, 0, 284, 16, 131356, 0, 284, 232, 394, 272,
+    131356, 0, 284, 112, 131356, 0, 131466, 0, 394, 36, 131466, 0, 394, 1536000, 284, 24,
+    131356, 0, 284, 3243, 278, 24, 131350, 0, 278, 3243, 282, 1152480, 283, 76, 392, 76,
+    399, 76, 393, 32, 388, 32, 131465, 0, 131460, 0, 388, 2048, 393, 512, 404, 1024,
+    131460, 0, 388, 1152, 396, 128, 405, 1152, 387, 1152, 395, 64, 403, 64, 131467, 0,
+    131475, 0, 403, 2048, 395, 686, 406, 1372, 131475, 0, 403, 128, 408, 128, 382, 64,
+    281, 64, 131454, 0, 131353, 0, 281, 2048, 382, 512, 385, 1024, 131353, 0, 131355, 0,
+    131460, 0, 131468, 0, 131471, 0, 131464, 0, 131465, 0, 131476, 0, 65818, 1728901, 131459, 0,
+    131477, 0, 131467, 0, 131478, 0, 131480, 0, 131475, 0, 131454, 0, 131457, 0, 131350, 0,
+    278, 40, 385, 1536851, 131354, 0, 282, 40, 382, 1536851, 131457, 0, 131350, 0, 131356, 0,
+    131466, 0, 131454, 0, 131354, 0, 131390, 0, 318, 29, 282, 30, 382, 116, 394, 116,
+    131466, 0, 131454, 0, 131390, 0, 131473, 0, 401, 33, 318, 34, 382, 132, 394, 132,
+    131466, 0, 131454, 0, 131473, 0, 401, 16, 131473, 0, 65872, 640, 65850, 40, 65862, 2080,
+    65840, 130, 65837, 4096, 401, 16, 131473, 0, 65870, 640, 65835, 40, 65865, 1216, 65857, 76,
+    65865, 2080, 65857, 130, 65838, 4096, 401, 16, 131473, 0, 401, 232, 382, 272, 131473, 0,
+    401, 112, 131473, 0, 131454, 0, 382, 232, 401, 272, 131454, 0, 382, 112, 131454, 0,
+    131473, 0, 401, 36, 131473, 0, 401, 1536000, 382, 24, 131454, 0, 382, 4447, 394, 24,
+    131466, 0, 394, 4447, 284, 1152480, 278, 76, 385, 76, 403, 76, 408, 32, 406, 32,
+    131480, 0, 131478, 0, 406, 2048, 408, 512, 395, 1024, 131478, 0, 406, 1152, 405, 128,
+    387, 1152, 404, 1152, 393, 64, 392, 64, 131465, 0, 131464, 0, 392, 2048, 393, 706,
+    399, 1412, 131464, 0, 392, 128, 396, 128, 388, 64, 283, 64, 131460, 0, 131355, 0,
+    283, 2048, 388, 512, 281, 1024, 131355, 0, 131350, 0, 131478, 0, 131477, 0, 131475, 0,
+    131457, 0, 131480, 0, 131467, 0, 65820, 1728901, 131476, 0, 131459, 0, 131465, 0, 131471, 0,
+    131468, 0, 131464, 0, 131460, 0, 131353, 0, 131466, 0, 394, 40, 281, 1536851, 131356, 0,
+    284, 40, 388, 1536851, 131353, 0, 131466, 0, 131454, 0, 131473, 0, 131460, 0, 131356, 0,
+    131359, 0, 131399, 0, 131425, 0, 131395, 0, 131463, 0, 131442, 0, 131372, 0, 131456, 0,
+    131434, 0, 131470, 0, 131461, 0, 131363, 0, 131450, 0, 131439, 0, 131445, 0, 131444, 0,
+    131378, 0, 131443, 0, 131448, 0, 131446, 0, 131387, 0, 131438, 0, 131392, 0, 131432, 0,
+    131394, 0, 131375, 0, 131383, 0, 131362, 0, 131429, 0, 131414, 0, 131449, 0, 131370, 0,
+    131451, 0, 131447, 0, 131423, 0, 131379, 0, 131396, 0, 131412, 0, 131440, 0, 131455, 0,
+    131430, 0, 131409, 0, 131437, 0, 131373, 0, 131436, 0, 131398, 0, 131376, 0, 131408, 0,
+    131386, 0, 131391, 0, 131424, 0, 131382, 0, 131374, 0, 131411, 0, 131401, 0, 131393, 0,
+    131406, 0, 131371, 0, 131407, 0, 131413, 0, 131400, 0, 131368, 0, 131431, 0, 131415, 0,
+    131319, 0, 131389, 0, 131369, 0, 131397, 0, 131385, 0, 131384, 0, 131410, 0, 131377, 0,
+    131380, 0, 131381, 0, 131388, 0, 131364, 0, 131435, 0, 131365, 0, 131433, 0, 131367, 0,
+    131366, 0, 131441, 0, 131360, 0, 131361, 0, 131417, 0, 131416, 0, 131352, 0, 131402, 0,
+    330, 304, 280, 8, 344, 16, 345, 24, 289, 9, 65825, 18, 288, 152, 369, 5140,
+    294, 2, 295, 256, 361, 6, 293, 8, 363, 14, 292, 8, 65828, 16, 65828, 32,
+    316, 8, 65852, 16, 65852, 32, 309, 8, 65845, 16, 65845, 32, 308, 80, 305, 20,
+    131381, 0, 131364, 0, 131388, 0, 316, 8, 65852, 16, 65852, 32, 292, 8, 309, 48,
+    338, 72, 312, 20, 313, 8, 65845, 96, 65828, 16, 325, 8, 297, 14, 317, 8,
+    65853, 16, 65853, 32, 247, 8, 65783, 16, 65783, 32, 343, 8, 65879, 16, 65879, 32,
+    359, 80, 296, 20, 131415, 0, 131389, 0, 131319, 0, 247, 8, 65783, 16, 65783, 32,
+    317, 8, 343, 48, 65879, 96, 65853, 16, 65861, 16, 328, 14, 341, 8, 65877, 16,
+    65877, 32, 335, 8, 299, 48, 334, 72, 321, 20, 65849, 16, 65835, 96, 65871, 16,
+    65861, 32, 329, 14, 339, 8, 65875, 16, 65875, 32, 302, 8, 310, 48, 65846, 96,
+    65838, 16, 352, 20, 319, 32, 314, 8, 336, 8, 304, 8, 326, 8, 364, 24,
+    301, 104, 365, 8, 337, 8, 358, 8, 383, 12, 368, 56, 340, 20, 324, 32,
+    131441, 0, 131366, 0, 131367, 0, 295, 8, 65831, 16, 65825, 27, 65825, 36, 65825, 45,
+    131354, 0, 282, 29, 294, 30, 369, 116, 307, 116, 131379, 0, 131441, 0, 131354, 0,
+    282, 232, 369, 272, 131354, 0, 282, 112, 131354, 0, 131441, 0, 131390, 0, 318, 33,
+    369, 34, 282, 132, 307, 132, 131379, 0, 131354, 0, 131390, 0, 318, 8, 282, 8,
+    307, 8, 351, 24, 375, 104, 379, 8, 298, 8, 377, 8, 342, 12, 357, 56,
+    290, 192, 311, 16, 131383, 0, 311, 256, 303, 16, 322, 256, 360, 16, 65847, 640,
+    65839, 40, 65858, 640, 65896, 40, 65847, 1216, 65839, 76, 65858, 1216, 65896, 76, 65847, 2080,
+    65839, 130, 65890, 1952, 65891, 122, 320, 16, 366, 2048, 65902, 4096, 65902, 8192, 315, 192,
+    374, 16, 131446, 0, 374, 256, 376, 16, 371, 256, 306, 16, 65910, 640, 65912, 40,
+    65907, 640, 65842, 40, 65910, 1216, 65912, 76, 65907, 1216, 65842, 76, 65910, 2080, 65912, 130,
+    372, 16, 373, 2048, 65909, 4096, 65909, 8192, 65831, 32, 367, 192, 378, 256, 291, 16,
+    389, 256, 398, 16, 65914, 640, 65827, 40, 362, 16, 384, 2048, 65920, 4096, 300, 192,
+    370, 16, 131442, 0, 370, 256, 391, 16, 323, 256, 353, 16, 65906, 640, 65927, 40,
+    327, 16, 287, 2048, 65823, 4096, 284, 232, 388, 272, 131356, 0, 284, 112, 131356, 0,
+    131460, 0, 388, 232, 284, 272, 131460, 0, 388, 112, 131460, 0, 131356, 0, 284, 30,
+    131356, 0, 284, 1536000, 388, 24, 131460, 0, 388, 7215, 401, 24, 131473, 0, 401, 7215,
+    382, 1152480, 394, 76, 281, 76, 392, 76, 396, 32, 399, 32, 131468, 0, 131471, 0,
+    399, 2048, 396, 512, 393, 1024, 131471, 0, 399, 1152, 387, 128, 404, 1152, 395, 1152,
+    408, 64, 385, 64, 131480, 0, 131457, 0, 385, 2048, 408, 670, 403, 1340, 131457, 0,
+    385, 128, 405, 128, 406, 64, 278, 64, 131478, 0, 131350, 0, 278, 2048, 406, 512,
+    283, 1024, 131350, 0, 131466, 0, 131471, 0, 131459, 0, 131464, 0, 131353, 0, 131468, 0,
+    131465, 0, 65918, 1728901, 131467, 0, 131476, 0, 131480, 0, 131475, 0, 131477, 0, 131457, 0,
+    131478, 0, 131355, 0, 131473, 0, 401, 40, 283, 1536851, 131454, 0, 382, 40, 406, 1536851,
+    131355, 0, 131473, 0, 131460, 0, 131356, 0, 131478, 0, 131454, 0, 131391, 0, 131424, 0,
+    131386, 0, 131435, 0, 131377, 0, 131380, 0, 131449, 0, 131388, 0, 131370, 0, 131381, 0,
+    131364, 0, 131451, 0, 131369, 0, 131368, 0, 131431, 0, 131430, 0, 131319, 0, 131409, 0,
+    131415, 0, 131389, 0, 131437, 0, 131400, 0, 131379, 0, 131413, 0, 131354, 0, 131371, 0,
+    131407, 0, 131390, 0, 131401, 0, 131398, 0, 131411, 0, 131376, 0, 131382, 0, 131374, 0,
+    131408, 0, 131397, 0, 131433, 0, 131365, 0, 131384, 0, 131410, 0, 131393, 0, 131406, 0,
+    131385, 0, 131438, 0, 131392, 0, 131383, 0, 131375, 0, 131394, 0, 131432, 0, 131362, 0,
+    131373, 0, 131436, 0, 131445, 0, 131444, 0, 131446, 0, 131448, 0, 131443, 0, 131378, 0,
+    131387, 0, 131447, 0, 131423, 0, 131456, 0, 131434, 0, 131450, 0, 131363, 0, 131461, 0,
+    131470, 0, 131439, 0, 131440, 0, 131455, 0, 131359, 0, 131399, 0, 131442, 0, 131463, 0,
+    131395, 0, 131425, 0, 131372, 0, 131429, 0, 131414, 0, 131396, 0, 131412, 0, 131367, 0,
+    131361, 0, 131417, 0, 131416, 0, 131360, 0, 131352, 0, 131402, 0, 330, 304, 280, 8,
+    288, 16, 344, 24, 345, 9, 65881, 18, 289, 152, 295, 5140, 340, 2, 324, 256,
+    342, 6, 357, 8, 300, 14, 353, 8, 65889, 16, 65889, 32, 323, 8, 65859, 16,
+    65859, 32, 391, 8, 65927, 16, 65927, 32, 370, 80, 327, 20, 131463, 0, 131425, 0,
+    131395, 0, 323, 8, 65859, 16, 65859, 32, 353, 8, 391, 48, 287, 72, 383, 20,
+    368, 8, 65927, 96, 65889, 16, 367, 8, 398, 14, 389, 8, 65925, 16, 65925, 32,
+    291, 8, 65827, 16, 65827, 32, 378, 8, 65914, 16, 65914, 32, 362, 80, 384, 20,
+    131450, 0, 131461, 0, 131363, 0, 291, 8, 65827, 16, 65827, 32, 389, 8, 378, 48,
+    65914, 96, 65925, 16, 65903, 16, 351, 14, 375, 8, 65911, 16, 65911, 32, 315, 8,
+    306, 48, 371, 72, 376, 20, 65904, 16, 65842, 96, 65851, 16, 65903, 32, 374, 14,
+    372, 8, 65908, 16, 65908, 32, 373, 8, 364, 48, 65900, 96, 65909, 16, 301, 20,
+    290, 32, 360, 8, 322, 8, 303, 8, 311, 8, 320, 24, 366, 104, 313, 8,
+    334, 8, 321, 8, 338, 12, 312, 56, 293, 20, 361, 32, 131367, 0, 131412, 0,
+    131396, 0, 324, 8, 65860, 16, 65881, 27, 65881, 36, 65881, 45, 340, 232, 295, 272,
+    131412, 0, 340, 112, 131412, 0, 131367, 0, 131362, 0, 131373, 0, 131432, 0, 131372, 0,
+    131399, 0, 131442, 0, 131395, 0, 131463, 0, 131425, 0, 131470, 0, 131456, 0, 131434, 0,
+    131393, 0, 131363, 0, 131406, 0, 131450, 0, 131461, 0, 131385, 0, 131423, 0, 131447, 0,
+    131378, 0, 131387, 0, 131446, 0, 131383, 0, 131444, 0, 131375, 0, 131436, 0, 131445, 0,
+    131394, 0, 131439, 0, 131414, 0, 131429, 0, 131455, 0, 131359, 0, 131448, 0, 131443, 0,
+    131440, 0, 131438, 0, 131392, 0, 131384, 0, 131410, 0, 131433, 0, 131365, 0, 131396, 0,
+    131417, 0, 131416, 0, 131360, 0, 131361, 0, 131352, 0, 131402, 0, 330, 304, 280, 8,
+    289, 16, 288, 24, 344, 9, 65880, 18, 345, 152, 324, 5140, 293, 2, 361, 256,
+    338, 6, 312, 8, 320, 14, 366, 8, 65902, 16, 65902, 32, 368, 8, 65904, 16,
+    65904, 32, 371, 8, 65907, 16, 65907, 32, 376, 80, 287, 20, 131443, 0, 131438, 0,
+    131440, 0, 368, 8, 65904, 16, 65904, 32, 366, 8, 371, 48, 383, 72, 357, 20,
+    342, 8, 65907, 96, 65902, 16, 367, 8, 322, 14, 373, 8, 65909, 16, 65909, 32,
+    364, 8, 65900, 16, 65900, 32, 303, 8, 65839, 16, 65839, 32, 372, 80, 311, 20,
+    131375, 0, 131445, 0, 131436, 0, 364, 8, 65900, 16, 65900, 32, 373, 8, 303, 48,
+    65839, 96, 65909, 16, 65903, 16, 374, 14, 315, 8, 65851, 16, 65851, 32, 306, 8,
+    375, 48, 351, 72, 313, 20, 65878, 16, 65911, 96, 65842, 16, 65903, 32, 389, 14,
+    378, 8, 65914, 16, 65914, 32, 334, 8, 291, 48, 65827, 96, 65870, 16, 321, 20,
+    362, 32, 384, 8, 398, 8, 353, 8, 391, 8, 323, 24, 370, 104, 327, 8,
+    300, 8, 360, 8, 301, 12, 290, 56, 295, 20, 340, 32, 131396, 0, 131365, 0,
+    131433, 0, 361, 8, 65897, 16, 65880, 27, 65880, 36, 65880, 45, 131366, 0, 294, 29,
+    293, 30, 324, 116, 325, 116, 131397, 0, 131396, 0, 131366, 0, 294, 232, 324, 272,
+    131366, 0, 294, 112, 131366, 0, 131396, 0, 324, 232, 131396, 0, 131441, 0, 369, 33,
+    324, 34, 294, 132, 325, 132, 131397, 0, 131366, 0, 131441, 0, 369, 8, 294, 8,
+    325, 8, 336, 24, 302, 104, 310, 8, 304, 8, 339, 8, 326, 12, 329, 56,
+    318, 192, 335, 16, 131407, 0, 335, 256, 299, 16, 282, 256, 341, 16, 65871, 640,
+    65835, 40, 65818, 640, 65877, 40, 65871, 1216, 65835, 76, 65871, 2080, 65835, 130, 307, 16,
+    328, 2048, 65864, 4096, 65864, 8192, 365, 192, 317, 16, 131389, 0, 317, 256, 343, 16,
+    337, 256, 247, 16, 65853, 640, 65879, 40, 65873, 640, 65783, 40, 65853, 1216, 65879, 76,
+    65853, 2080, 65879, 130, 358, 16, 359, 2048, 65895, 4096, 65895, 8192, 65897, 32, 296, 192,
+    297, 256, 379, 16, 292, 256, 309, 16, 65833, 640, 65915, 40, 298, 16, 316, 2048,
+    65852, 4096, 377, 192, 308, 16, 131380, 0, 308, 256, 305, 16, 363, 256, 314, 16,
+    65844, 640, 65841, 40, 352, 16, 319, 2048, 65855, 4096, 382, 232, 406, 272, 131454, 0,
+    382, 112, 131454, 0, 131478, 0, 131434, 0, 131393, 0, 131456, 0, 131392, 0, 131359, 0,
+    131448, 0, 131411, 0, 131440, 0, 131376, 0, 131443, 0, 131438, 0, 131382, 0, 131394, 0,
+    131383, 0, 131444, 0, 131432, 0, 131436, 0, 131372, 0, 131375, 0, 131445, 0, 131399, 0,
+    131446, 0, 131397, 0, 131387, 0, 131366, 0, 131447, 0, 131378, 0, 131441, 0, 131461, 0,
+    131463, 0, 131450, 0, 131425, 0, 131363, 0, 131406, 0, 131470, 0, 131439, 0, 131410, 0,
+    131384, 0, 131429, 0, 131455, 0, 131385, 0, 131423, 0, 131414, 0, 131400, 0, 131379, 0,
+    131407, 0, 131371, 0, 131354, 0, 131413, 0, 131390, 0, 131442, 0, 131395, 0, 131431, 0,
+    131430, 0, 131389, 0, 131415, 0, 131409, 0, 131319, 0, 131437, 0, 131374, 0, 131408, 0,
+    131388, 0, 131370, 0, 131369, 0, 131451, 0, 131364, 0, 131381, 0, 131368, 0, 131362, 0,
+    131373, 0, 131391, 0, 131424, 0, 131380, 0, 131377, 0, 131435, 0, 131386, 0, 131449, 0,
+    131401, 0, 131398, 0, 131412, 0, 131367, 0, 131433, 0, 131416, 0, 131360, 0, 131361, 0,
+    131417, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 345, 16, 289, 24, 288, 9,
+    65824, 18, 344, 152, 361, 5140, 295, 2, 340, 256, 326, 6, 329, 8, 377, 14,
+    314, 8, 65850, 16, 65850, 32, 363, 8, 65899, 16, 65899, 32, 305, 8, 65841, 16,
+    65841, 32, 308, 80, 352, 20, 131377, 0, 131386, 0, 131435, 0, 363, 8, 65899, 16,
+    65899, 32, 314, 8, 305, 48, 319, 72, 301, 20, 290, 8, 65841, 96, 65850, 16,
+    296, 8, 309, 14, 292, 8, 65828, 16, 65828, 32, 379, 8, 65915, 16, 65915, 32,
+    297, 8, 65833, 16, 65833, 32, 298, 80, 316, 20, 131369, 0, 131364, 0, 131451, 0,
+    379, 8, 65915, 16, 65915, 32, 292, 8, 297, 48, 65833, 96, 65828, 16, 65832, 16,
+    336, 14, 302, 8, 65838, 16, 65838, 32, 365, 8, 247, 48, 337, 72, 343, 20,
+    65826, 16, 65783, 96, 65901, 16, 65832, 32, 317, 14, 358, 8, 65894, 16, 65894, 32,
+    359, 8, 323, 48, 65859, 96, 65895, 16, 370, 20, 318, 32, 341, 8, 282, 8,
+    299, 8, 335, 8, 307, 24, 328, 104, 342, 8, 351, 8, 313, 8, 383, 12,
+    357, 56, 312, 20, 338, 32, 131433, 0, 131367, 0, 131412, 0, 340, 8, 65876, 16,
+    65824, 27, 65824, 36, 65824, 45, 131365, 0, 293, 29, 295, 30, 361, 116, 367, 116,
+    131439, 0, 131433, 0, 131365, 0, 293, 232, 361, 272, 131365, 0, 293, 112, 131365, 0,
+    131433, 0, 361, 232, 131433, 0, 131396, 0, 324, 33, 361, 34, 293, 132, 367, 132,
+    131439, 0, 131365, 0, 131396, 0, 324, 8, 293, 8, 367, 8, 398, 24, 334, 104,
+    291, 8, 353, 8, 378, 8, 391, 12, 389, 56, 369, 192, 306, 16, 131378, 0,
+    306, 256, 375, 16, 294, 256, 315, 16, 65842, 640, 65911, 40, 65830, 640, 65851, 40,
+    65842, 1216, 65911, 76, 65842, 2080, 65911, 130, 325, 16, 374, 2048, 65910, 4096, 65910, 8192,
+    327, 192, 373, 16, 131445, 0, 373, 256, 303, 16, 300, 256, 364, 16, 65909, 640,
+    65839, 40, 65836, 640, 65900, 40, 65909, 1216, 65839, 76, 65909, 2080, 65839, 130, 360, 16,
+    372, 2048, 65908, 4096, 65908, 8192, 65876, 32, 311, 192, 322, 256, 310, 16, 366, 256,
+    371, 16, 65858, 640, 65846, 40, 304, 16, 368, 2048, 65904, 4096, 339, 192, 376, 16,
+    131448, 0, 376, 256, 287, 16, 320, 256, 384, 16, 65912, 640, 65823, 40, 321, 16,
+    362, 2048, 65898, 4096, 406, 16, 131478, 0, 406, 16, 131478, 0, 406, 16, 131478, 0,
+    406, 16, 131478, 0, 406, 232, 382, 272, 131478, 0, 406, 112, 131478, 0, 131454, 0,
+    131390, 0, 131442, 0, 131413, 0, 131449, 0, 131424, 0, 131380, 0, 131450, 0, 131435, 0,
+    131425, 0, 131377, 0, 131386, 0, 131363, 0, 131381, 0, 131388, 0, 131370, 0, 131385, 0,
+    131451, 0, 131423, 0, 131369, 0, 131364, 0, 131414, 0, 131408, 0, 131439, 0, 131374, 0,
+    131365, 0, 131319, 0, 131437, 0, 131396, 0, 131389, 0, 131407, 0, 131430, 0, 131371, 0,
+    131395, 0, 131431, 0, 131354, 0, 131368, 0, 131398, 0, 131401, 0, 131373, 0, 131391, 0,
+    131415, 0, 131409, 0, 131362, 0, 131446, 0, 131397, 0, 131378, 0, 131447, 0, 131366, 0,
+    131387, 0, 131441, 0, 131400, 0, 131379, 0, 131444, 0, 131432, 0, 131445, 0, 131375, 0,
+    131372, 0, 131436, 0, 131399, 0, 131406, 0, 131470, 0, 131440, 0, 131376, 0, 131394, 0,
+    131382, 0, 131438, 0, 131443, 0, 131383, 0, 131429, 0, 131455, 0, 131434, 0, 131393, 0,
+    131448, 0, 131359, 0, 131392, 0, 131456, 0, 131411, 0, 131461, 0, 131463, 0, 131410, 0,
+    131384, 0, 131412, 0, 131360, 0, 131361, 0, 131417, 0, 131416, 0, 131352, 0, 131402, 0,
+    330, 304, 280, 8, 344, 16, 345, 24, 289, 9, 65825, 18, 288, 152, 340, 5140,
+    312, 2, 338, 256, 391, 6, 389, 8, 339, 14, 384, 8, 65920, 16, 65920, 32,
+    320, 8, 65856, 16, 65856, 32, 287, 8, 65823, 16, 65823, 32, 376, 80, 321, 20,
+    131359, 0, 131456, 0, 131392, 0, 320, 8, 65856, 16, 65856, 32, 384, 8, 287, 48,
+    362, 72, 383, 20, 357, 8, 65823, 96, 65920, 16, 311, 8, 371, 14, 366, 8,
+    65902, 16, 65902, 32, 310, 8, 65846, 16, 65846, 32, 322, 8, 65858, 16, 65858, 32,
+    304, 80, 368, 20, 131394, 0, 131438, 0, 131382, 0, 310, 8, 65846, 16, 65846, 32,
+    366, 8, 322, 48, 65858, 96, 65902, 16, 65847, 16, 398, 14, 334, 8, 65870, 16,
+    65870, 32, 327, 8, 364, 48, 300, 72, 303, 20, 65893, 16, 65900, 96, 65863, 16,
+    65847, 32, 373, 14, 360, 8, 65896, 16, 65896, 32, 372, 8, 307, 48, 65843, 96,
+    65908, 16, 328, 20, 369, 32, 315, 8, 294, 8, 375, 8, 306, 8, 325, 24,
+    374, 104, 290, 8, 337, 8, 343, 8, 319, 12, 301, 56, 329, 20, 326, 32,
+    131412, 0, 131384, 0, 131410, 0, 338, 8, 65874, 16, 65825, 27, 65825, 36, 65825, 45,
+    131367, 0, 295, 29, 312, 30, 340, 116, 296, 116, 131368, 0, 131412, 0, 131367, 0,
+    295, 232, 340, 272, 131367, 0, 295, 112, 131367, 0, 131412, 0, 340, 232, 131412, 0,
+    131433, 0, 361, 33, 340, 34, 295, 132, 296, 132, 131368, 0, 131367, 0, 131433, 0,
+    361, 8, 295, 8, 296, 8, 282, 24, 359, 104, 323, 8, 299, 8, 358, 8,
+    335, 12, 317, 56, 324, 192, 365, 16, 131437, 0, 365, 256, 247, 16, 293, 256,
+    302, 16, 65901, 640, 65783, 40, 65829, 640, 65838, 40, 65901, 1216, 65783, 76, 65901, 2080,
+    65783, 130, 367, 16, 336, 2048, 65872, 4096, 65872, 8192, 342, 192, 292, 16, 131364, 0,
+    292, 256, 297, 16, 351, 256, 379, 16, 65828, 640, 65833, 40, 65887, 640, 65915, 40,
+    65828, 1216, 65833, 76, 65828, 2080, 65833, 130, 313, 16, 298, 2048, 65834, 4096, 65834, 8192,
+    65874, 32, 316, 192, 309, 256, 291, 16, 314, 256, 305, 16, 65845, 640, 65827, 40,
+    353, 16, 363, 2048, 65899, 4096, 378, 192, 308, 16, 131380, 0, 308, 256, 352, 16,
+    377, 256, 341, 16, 65844, 640, 65888, 40, 370, 16, 318, 2048, 65854, 4096, 382, 232,
+    406, 272, 131454, 0, 382, 112, 131454, 0, 131478, 0, 131441, 0, 131400, 0, 131387, 0,
+    131411, 0, 131393, 0, 131448, 0, 131430, 0, 131392, 0, 131371, 0, 131359, 0, 131456, 0,
+    131395, 0, 131443, 0, 131440, 0, 131376, 0, 131415, 0, 131382, 0, 131409, 0, 131394, 0,
+    131438, 0, 131362, 0, 131470, 0, 131368, 0, 131406, 0, 131367, 0, 131436, 0, 131399, 0,
+    131433, 0, 131445, 0, 131378, 0, 131432, 0, 131447, 0, 131379, 0, 131444, 0, 131366, 0,
+    131383, 0, 131463, 0, 131461, 0, 131455, 0, 131434, 0, 131375, 0, 131372, 0, 131429, 0,
+    131408, 0, 131439, 0, 131437, 0, 131319, 0, 131365, 0, 131374, 0, 131396, 0, 131446, 0,
+    131397, 0, 131370, 0, 131385, 0, 131364, 0, 131369, 0, 131423, 0, 131451, 0, 131414, 0,
+    131431, 0, 131354, 0, 131435, 0, 131425, 0, 131381, 0, 131363, 0, 131386, 0, 131377, 0,
+    131388, 0, 131373, 0, 131391, 0, 131390, 0, 131442, 0, 131380, 0, 131424, 0, 131449, 0,
+    131413, 0, 131450, 0, 131389, 0, 131407, 0, 131398, 0, 131401, 0, 131410, 0, 131361, 0,
+    131417, 0, 131416, 0, 131360, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 288, 16,
+    344, 24, 345, 9, 65881, 18, 289, 152, 338, 5140, 329, 2, 326, 256, 335, 6,
+    317, 8, 378, 14, 341, 8, 65877, 16, 65877, 32, 377, 8, 65913, 16, 65913, 32,
+    352, 8, 65888, 16, 65888, 32, 308, 80, 370, 20, 131424, 0, 131413, 0, 131449, 0,
+    377, 8, 65913, 16, 65913, 32, 341, 8, 352, 48, 318, 72, 319, 20, 301, 8,
+    65888, 96, 65877, 16, 316, 8, 305, 14, 314, 8, 65850, 16, 65850, 32, 291, 8,
+    65827, 16, 65827, 32, 309, 8, 65845, 16, 65845, 32, 353, 80, 363, 20, 131381, 0,
+    131386, 0, 131363, 0, 291, 8, 65827, 16, 65827, 32, 314, 8, 309, 48, 65845, 96,
+    65850, 16, 65852, 16, 282, 14, 359, 8, 65895, 16, 65895, 32, 342, 8, 379, 48,
+    351, 72, 297, 20, 65837, 16, 65915, 96, 65878, 16, 65852, 32, 292, 14, 313, 8,
+    65849, 16, 65849, 32, 298, 8, 325, 48, 65861, 96, 65834, 16, 374, 20, 324, 32,
+    302, 8, 293, 8, 247, 8, 365, 8, 367, 24, 336, 104, 357, 8, 300, 8,
+    303, 8, 362, 12, 383, 56, 389, 20, 391, 32, 131410, 0, 131401, 0, 131398, 0,
+    326, 8, 65862, 16, 65881, 27, 65881, 36, 65881, 45, 131384, 0, 312, 29, 329, 30,
+    338, 116, 311, 116, 131383, 0, 131410, 0, 131384, 0, 312, 232, 338, 272, 131384, 0,
+    312, 112, 131384, 0, 131410, 0, 338, 232, 131410, 0, 131412, 0, 340, 33, 338, 34,
+    312, 132, 311, 132, 131383, 0, 131384, 0, 131412, 0, 340, 8, 312, 8, 311, 8,
+    294, 24, 372, 104, 307, 8, 375, 8, 360, 8, 306, 12, 373, 56, 361, 192,
+    327, 16, 131399, 0, 327, 256, 364, 16, 295, 256, 334, 16, 65863, 640, 65900, 40,
+    65831, 640, 65870, 40, 65863, 1216, 65900, 76, 65863, 2080, 65900, 130, 296, 16, 398, 2048,
+    65934, 4096, 65934, 8192, 290, 192, 366, 16, 131438, 0, 366, 256, 322, 16, 337, 256,
+    310, 16, 65902, 640, 65858, 40, 65873, 640, 65846, 40, 65902, 1216, 65858, 76, 65902, 2080,
+    65858, 130, 343, 16, 304, 2048, 65840, 4096, 65840, 8192, 65862, 32, 368, 192, 371, 256,
+    323, 16, 384, 256, 287, 16, 65907, 640, 65859, 40, 299, 16, 320, 2048, 65856, 4096,
+    358, 192, 376, 16, 131448, 0, 376, 256, 321, 16, 339, 256, 315, 16, 65912, 640,
+    65857, 40, 328, 16, 369, 2048, 65905, 4096, 406, 232, 382, 272, 131478, 0, 406, 112,
+    131478, 0, 131454, 0, 131396, 0, 131446, 0, 131374, 0, 131450, 0, 131442, 0, 131380, 0,
+    131432, 0, 131449, 0, 131447, 0, 131424, 0, 131413, 0, 131379, 0, 131377, 0, 131435, 0,
+    131425, 0, 131375, 0, 131363, 0, 131372, 0, 131381, 0, 131386, 0, 131429, 0, 131354, 0,
+    131383, 0, 131431, 0, 131384, 0, 131451, 0, 131414, 0, 131412, 0, 131364, 0, 131437, 0,
+    131385, 0, 131319, 0, 131397, 0, 131370, 0, 131365, 0, 131388, 0, 131407, 0, 131389, 0,
+    131391, 0, 131390, 0, 131369, 0, 131423, 0, 131373, 0, 131470, 0, 131368, 0, 131399, 0,
+    131436, 0, 131367, 0, 131406, 0, 131433, 0, 131408, 0, 131439, 0, 131376, 0, 131415, 0,
+    131438, 0, 131394, 0, 131409, 0, 131382, 0, 131362, 0, 131444, 0, 131366, 0, 131392, 0,
+    131371, 0, 131443, 0, 131395, 0, 131456, 0, 131359, 0, 131440, 0, 131455, 0, 131434, 0,
+    131441, 0, 131400, 0, 131448, 0, 131393, 0, 131411, 0, 131387, 0, 131430, 0, 131445, 0,
+    131378, 0, 131463, 0, 131461, 0, 131398, 0, 131417, 0, 131416, 0, 131360, 0, 131361, 0,
+    131352, 0, 131402, 0, 330, 304, 280, 8, 289, 16, 288, 24, 344, 9, 65880, 18,
+    345, 152, 326, 5140, 389, 2, 391, 256, 306, 6, 373, 8, 358, 14, 315, 8,
+    65851, 16, 65851, 32, 339, 8, 65875, 16, 65875, 32, 321, 8, 65857, 16, 65857, 32,
+    376, 80, 328, 20, 131393, 0, 131387, 0, 131411, 0, 339, 8, 65875, 16, 65875, 32,
+    315, 8, 321, 48, 369, 72, 362, 20, 383, 8, 65857, 96, 65851, 16, 368, 8,
+    287, 14, 384, 8, 65920, 16, 65920, 32, 323, 8, 65859, 16, 65859, 32, 371, 8,
+    65907, 16, 65907, 32, 299, 80, 320, 20, 131443, 0, 131456, 0, 131395, 0, 323, 8,
+    65859, 16, 65859, 32, 384, 8, 371, 48, 65907, 96, 65920, 16, 65904, 16, 294, 14,
+    372, 8, 65908, 16, 65908, 32, 290, 8, 310, 48, 337, 72, 322, 20, 65919, 16,
+    65846, 96, 65826, 16, 65904, 32, 366, 14, 343, 8, 65879, 16, 65879, 32, 304, 8,
+    367, 48, 65903, 96, 65840, 16, 336, 20, 361, 32, 334, 8, 295, 8, 364, 8,
+    327, 8, 296, 24, 398, 104, 301, 8, 351, 8, 297, 8, 318, 12, 319, 56,
+    317, 20, 335, 32, 131398, 0, 131461, 0, 131463, 0, 391, 8, 65927, 16, 65880, 27,
+    65880, 36, 65880, 45, 131401, 0, 329, 29, 389, 30, 326, 116, 316, 116, 131388, 0,
+    131398, 0, 131401, 0, 329, 232, 326, 272, 131401, 0, 329, 112, 131401, 0, 131398, 0,
+    326, 232, 131398, 0, 131410, 0, 338, 33, 326, 34, 329, 132, 316, 132, 131388, 0,
+    131401, 0, 131410, 0, 338, 8, 329, 8, 316, 8, 293, 24, 298, 104, 325, 8,
+    247, 8, 313, 8, 365, 12, 292, 56, 340, 192, 342, 16, 131414, 0, 342, 256,
+    379, 16, 312, 256, 359, 16, 65878, 640, 65915, 40, 65848, 640, 65895, 40, 65878, 1216,
+    65915, 76, 65878, 2080, 65915, 130, 311, 16, 282, 2048, 65818, 4096, 65818, 8192, 357, 192,
+    314, 16, 131386, 0, 314, 256, 309, 16, 300, 256, 291, 16, 65850, 640, 65845, 40,
+    65836, 640, 65827, 40, 65850, 1216, 65845, 76, 65850, 2080, 65845, 130, 303, 16, 353, 2048,
+    65889, 4096, 65889, 8192, 65927, 32, 363, 192, 305, 256, 307, 16, 341, 256, 352, 16,
+    65841, 640, 65843, 40, 375, 16, 377, 2048, 65913, 4096, 360, 192, 308, 16, 131380, 0,
+    308, 256, 370, 16, 378, 256, 302, 16, 65844, 640, 65906, 40, 374, 16, 324, 2048,
+    65860, 4096, 382, 232, 406, 272, 131454, 0, 382, 112, 131454, 0, 131478, 0, 131433, 0,
+    131408, 0, 131406, 0, 131430, 0, 131400, 0, 131448, 0, 131385, 0, 131411, 0, 131319, 0,
+    131393, 0, 131387, 0, 131397, 0, 131359, 0, 131392, 0, 131371, 0, 131369, 0, 131395, 0,
+    131423, 0, 131443, 0, 131456, 0, 131373, 0, 131366, 0, 131388, 0, 131444, 0, 131401, 0,
+    131382, 0, 131362, 0, 131410, 0, 131438, 0, 131399, 0, 131415, 0, 131436, 0, 131439, 0,
+    131376, 0, 131367, 0, 131440, 0, 131378, 0, 131445, 0, 131434, 0, 131441, 0, 131394, 0,
+    131409, 0, 131455, 0, 131354, 0, 131383, 0, 131414, 0, 131451, 0, 131384, 0, 131431, 0,
+    131412, 0, 131470, 0, 131368, 0, 131425, 0, 131375, 0, 131386, 0, 131381, 0, 131372, 0,
+    131363, 0, 131429, 0, 131370, 0, 131365, 0, 131449, 0, 131447, 0, 131377, 0, 131379, 0,
+    131413, 0, 131424, 0, 131435, 0, 131391, 0, 131390, 0, 131396, 0, 131446, 0, 131380, 0,
+    131442, 0, 131450, 0, 131374, 0, 131432, 0, 131364, 0, 131437, 0, 131407, 0, 131389, 0,
+    131463, 0, 131416, 0, 131360, 0, 131361, 0, 131417, 0, 131352, 0, 131402, 0, 330, 304,
+    280, 8, 345, 16, 289, 24, 288, 9, 65824, 18, 344, 152, 391, 5140, 317, 2,
+    335, 256, 365, 6, 292, 8, 360, 14, 302, 8, 65838, 16, 65838, 32, 378, 8,
+    65914, 16, 65914, 32, 370, 8, 65906, 16, 65906, 32, 308, 80, 374, 20, 131442, 0,
+    131374, 0, 131450, 0, 378, 8, 65914, 16, 65914, 32, 302, 8, 370, 48, 324, 72,
+    318, 20, 319, 8, 65906, 96, 65838, 16, 363, 8, 352, 14, 341, 8, 65877, 16,
+    65877, 32, 307, 8, 65843, 16, 65843, 32, 305, 8, 65841, 16, 65841, 32, 375, 80,
+    377, 20, 131377, 0, 131413, 0, 131379, 0, 307, 8, 65843, 16, 65843, 32, 341, 8,
+    305, 48, 65841, 96, 65877, 16, 65899, 16, 293, 14, 298, 8, 65834, 16, 65834, 32,
+    357, 8, 291, 48, 300, 72, 309, 20, 65855, 16, 65827, 96, 65893, 16, 65899, 32,
+    314, 14, 303, 8, 65839, 16, 65839, 32, 353, 8, 296, 48, 65832, 96, 65889, 16,
+    398, 20, 340, 32, 359, 8, 312, 8, 379, 8, 342, 8, 311, 24, 282, 104,
+    383, 8, 337, 8, 322, 8, 369, 12, 362, 56, 373, 20, 306, 32, 131463, 0,
+    131389, 0, 131407, 0, 335, 8, 65871, 16, 65824, 27, 65824, 36, 65824, 45, 131461, 0,
+    389, 29, 317, 30, 391, 116, 368, 116, 131440, 0, 131463, 0, 131461, 0, 389, 232,
+    391, 272, 131461, 0, 389, 112, 131461, 0, 131463, 0, 391, 232, 131463, 0, 131398, 0,
+    326, 33, 391, 34, 389, 132, 368, 132, 131440, 0, 131461, 0, 131398, 0, 326, 8,
+    389, 8, 368, 8, 295, 24, 304, 104, 367, 8, 364, 8, 343, 8, 327, 12,
+    366, 56, 338, 192, 290, 16, 131362, 0, 290, 256, 310, 16, 329, 256, 372, 16,
+    65826, 640, 65846, 40, 65865, 640, 65908, 40, 65826, 1216, 65846, 76, 65826, 2080, 65846, 130,
+    316, 16, 294, 2048, 65830, 4096, 65830, 8192, 301, 192, 384, 16, 131456, 0, 384, 256,
+    371, 16, 351, 256, 323, 16, 65920, 640, 65907, 40, 65887, 640, 65859, 40, 65920, 1216,
+    65907, 76, 65920, 2080, 65907, 130, 297, 16, 299, 2048, 65835, 4096, 65835, 8192, 65871, 32,
+    320, 192, 287, 256, 325, 16, 315, 256, 321, 16, 65823, 640, 65861, 40, 247, 16,
+    339, 2048, 65875, 4096, 313, 192, 376, 16, 131448, 0, 376, 256, 328, 16, 358, 256,
+    334, 16, 65912, 640, 65864, 40, 336, 16, 361, 2048, 65897, 4096, 406, 232, 382, 272,
+    131478, 0, 406, 112, 131478, 0, 131454, 0, 131412, 0, 131470, 0, 131431, 0, 131432, 0,
+    131446, 0, 131380, 0, 131415, 0, 131450, 0, 131436, 0, 131442, 0, 131374, 0, 131439, 0,
+    131424, 0, 131449, 0, 131447, 0, 131394, 0, 131379, 0, 131409, 0, 131377, 0, 131413, 0,
+    131455, 0, 131365, 0, 131440, 0, 131370, 0, 131461, 0, 131363, 0, 131429, 0, 131398, 0,
+    131386, 0, 131414, 0, 131375, 0, 131451, 0, 131368, 0, 131425, 0, 131384, 0, 131435, 0,
+    131437, 0, 131364, 0, 131390, 0, 131396, 0, 131381, 0, 131372, 0, 131391, 0, 131366, 0,
+    131388, 0, 131362, 0, 131382, 0, 131401, 0, 131444, 0, 131410, 0, 131354, 0, 131383, 0,
+    131371, 0, 131369, 0, 131456, 0, 131443, 0, 131423, 0, 131395, 0, 131373, 0, 131376, 0,
+    131367, 0, 131411, 0, 131319, 0, 131359, 0, 131397, 0, 131387, 0, 131393, 0, 131392, 0,
+    131434, 0, 131441, 0, 131433, 0, 131408, 0, 131448, 0, 131400, 0, 131430, 0, 131406, 0,
+    131385, 0, 131438, 0, 131399, 0, 131378, 0, 131445, 0, 131407, 0, 131360, 0, 131361, 0,
+    131417, 0, 131416, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 344, 16, 345, 24,
+    289, 9, 65825, 18, 288, 152, 335, 5140, 373, 2, 306, 256, 327, 6, 366, 8,
+    313, 14, 334, 8, 65870, 16, 65870, 32, 358, 8, 65894, 16, 65894, 32, 328, 8,
+    65864, 16, 65864, 32, 376, 80, 336, 20, 131400, 0, 131406, 0, 131430, 0, 358, 8,
+    65894, 16, 65894, 32, 334, 8, 328, 48, 361, 72, 369, 20, 362, 8, 65864, 96,
+    65870, 16, 320, 8, 321, 14, 315, 8, 65851, 16, 65851, 32, 325, 8, 65861, 16,
+    65861, 32, 287, 8, 65823, 16, 65823, 32, 247, 80, 339, 20, 131359, 0, 131387, 0,
+    131397, 0, 325, 8, 65861, 16, 65861, 32, 315, 8, 287, 48, 65823, 96, 65851, 16,
+    65856, 16, 295, 14, 304, 8, 65840, 16, 65840, 32, 301, 8, 323, 48, 351, 72,
+    371, 20, 65898, 16, 65859, 96, 65837, 16, 65856, 32, 384, 14, 297, 8, 65833, 16,
+    65833, 32, 299, 8, 311, 48, 65847, 96, 65835, 16, 282, 20, 338, 32, 372, 8,
+    329, 8, 310, 8, 290, 8, 316, 24, 294, 104, 319, 8, 300, 8, 309, 8,
+    324, 12, 318, 56, 292, 20, 365, 32, 131407, 0, 131445, 0, 131378, 0, 306, 8,
+    65842, 16, 65825, 27, 65825, 36, 65825, 45, 131389, 0, 317, 29, 373, 30, 335, 116,
+    363, 116, 131435, 0, 131407, 0, 131389, 0, 317, 232, 335, 272, 131389, 0, 317, 112,
+    131389, 0, 131407, 0, 335, 232, 131407, 0, 131463, 0, 391, 33, 335, 34, 317, 132,
+    363, 132, 131435, 0, 131389, 0, 131463, 0, 391, 8, 317, 8, 363, 8, 312, 24,
+    353, 104, 296, 8, 379, 8, 303, 8, 342, 12, 314, 56, 326, 192, 357, 16,
+    131429, 0, 357, 256, 291, 16, 389, 256, 298, 16, 65893, 640, 65827, 40, 65925, 640,
+    65834, 40, 65893, 1216, 65827, 76, 65893, 2080, 65827, 130, 368, 16, 293, 2048, 65829, 4096,
+    65829, 8192, 383, 192, 341, 16, 131413, 0, 341, 256, 305, 16, 337, 256, 307, 16,
+    65877, 640, 65841, 40, 65873, 640, 65843, 40, 65877, 1216, 65841, 76, 65877, 2080, 65841, 130,
+    322, 16, 375, 2048, 65911, 4096, 65911, 8192, 65842, 32, 377, 192, 352, 256, 367, 16,
+    302, 256, 370, 16, 65888, 640, 65903, 40, 364, 16, 378, 2048, 65914, 4096, 343, 192,
+    308, 16, 131380, 0, 308, 256, 374, 16, 360, 256, 359, 16, 65844, 640, 65910, 40,
+    398, 16, 340, 2048, 65876, 4096, 382, 232, 406, 272, 131454, 0, 382, 112, 131454, 0,
+    131478, 0, 131410, 0, 131354, 0, 131444, 0, 131385, 0, 131408, 0, 131448, 0, 131375, 0,
+    131430, 0, 131451, 0, 131400, 0, 131406, 0, 131368, 0, 131393, 0, 131411, 0, 131319, 0,
+    131381, 0, 131397, 0, 131372, 0, 131359, 0, 131387, 0, 131391, 0, 131367, 0, 131435, 0,
+    131376, 0, 131389, 0, 131395, 0, 131373, 0, 131463, 0, 131456, 0, 131362, 0, 131369, 0,
+    131382, 0, 131383, 0, 131371, 0, 131401, 0, 131392, 0, 131399, 0, 131438, 0, 131441, 0,
+    131433, 0, 131443, 0, 131423, 0, 131434, 0, 131365, 0, 131440, 0, 131429, 0, 131363, 0,
+    131461, 0, 131370, 0, 131398, 0, 131366, 0, 131388, 0, 131447, 0, 131394, 0, 131413, 0,
+    131377, 0, 131409, 0, 131379, 0, 131455, 0, 131425, 0, 131384, 0, 131450, 0, 131436, 0,
+    131424, 0, 131439, 0, 131374, 0, 131442, 0, 131449, 0, 131390, 0, 131396, 0, 131412, 0,
+    131470, 0, 131380, 0, 131446, 0, 131432, 0, 131431, 0, 131415, 0, 131386, 0, 131414, 0,
+    131437, 0, 131364, 0, 131378, 0, 131361, 0, 131417, 0, 131416, 0, 131360, 0, 131352, 0,
+    131402, 0, 330, 304, 280, 8, 288, 16, 344, 24, 345, 9, 65881, 18, 289, 152,
+    306, 5140, 292, 2, 365, 256, 342, 6, 314, 8, 343, 14, 359, 8, 65895, 16,
+    65895, 32, 360, 8, 65896, 16, 65896, 32, 374, 8, 65910, 16, 65910, 32, 308, 80,
+    398, 20, 131446, 0, 131431, 0, 131432, 0, 360, 8, 65896, 16, 65896, 32, 359, 8,
+    374, 48, 340, 72, 324, 20, 318, 8, 65910, 96, 65895, 16, 377, 8, 370, 14,
+    302, 8, 65838, 16, 65838, 32, 367, 8, 65903, 16, 65903, 32, 352, 8, 65888, 16,
+    65888, 32, 364, 80, 378, 20, 131424, 0, 131374, 0, 131439, 0, 367, 8, 65903, 16,
+    65903, 32, 302, 8, 352, 48, 65888, 96, 65838, 16, 65913, 16, 312, 14, 353, 8,
+    65889, 16, 65889, 32, 383, 8, 307, 48, 337, 72, 305, 20, 65854, 16, 65843, 96,
+    65919, 16, 65913, 32, 341, 14, 322, 8, 65858, 16, 65858, 32, 375, 8, 316, 48,
+    65852, 96, 65911, 16, 294, 20, 326, 32, 298, 8, 389, 8, 291, 8, 357, 8,
+    368, 24, 293, 104, 362, 8, 351, 8, 371, 8, 361, 12, 369, 56, 366, 20,
+    327, 32, 131378, 0, 131364, 0, 131437, 0, 365, 8, 65901, 16, 65881, 27, 65881, 36,
+    65881, 45, 131445, 0, 373, 29, 292, 30, 306, 116, 320, 116, 131392, 0, 131378, 0,
+    131445, 0, 373, 232, 306, 272, 131445, 0, 373, 112, 131445, 0, 131378, 0, 306, 232,
+    131378, 0, 131407, 0, 335, 33, 306, 34, 373, 132, 320, 132, 131392, 0, 131445, 0,
+    131407, 0, 335, 8, 373, 8, 320, 8, 329, 24, 299, 104, 311, 8, 310, 8,
+    297, 8, 290, 12, 384, 56, 391, 192, 301, 16, 131373, 0, 301, 256, 323, 16,
+    317, 256, 304, 16, 65837, 640, 65859, 40, 65853, 640, 65840, 40, 65837, 1216, 65859, 76,
+    65837, 2080, 65859, 130, 363, 16, 295, 2048, 65831, 4096, 65831, 8192, 319, 192, 315, 16,
+    131387, 0, 315, 256, 287, 16, 300, 256, 325, 16, 65851, 640, 65823, 40, 65836, 640,
+    65861, 40, 65851, 1216, 65823, 76, 65851, 2080, 65823, 130, 309, 16, 247, 2048, 65783, 4096,
+    65783, 8192, 65901, 32, 339, 192, 321, 256, 296, 16, 334, 256, 328, 16, 65857, 640,
+    65832, 40, 379, 16, 358, 2048, 65894, 4096, 303, 192, 376, 16, 131448, 0, 376, 256,
+    336, 16, 313, 256, 372, 16, 65912, 640, 65872, 40, 282, 16, 338, 2048, 65874, 4096,
+    406, 232, 382, 272, 131478, 0, 406, 112, 131478, 0, 131454, 0, 131398, 0, 131366, 0,
+    131370, 0, 131415, 0, 131470, 0, 131380, 0, 131369, 0, 131432, 0, 131382, 0, 131446, 0,
+    131431, 0, 131383, 0, 131442, 0, 131450, 0, 131436, 0, 131443, 0, 131439, 0, 131423, 0,
+    131424, 0, 131374, 0, 131434, 0, 131384, 0, 131392, 0, 131425, 0, 131445, 0, 131379, 0,
+    131455, 0, 131407, 0, 131413, 0, 131429, 0, 131394, 0, 131363, 0, 131388, 0, 131447, 0,
+    131461, 0, 131449, 0, 131414, 0, 131386, 0, 131396, 0, 131412, 0, 131377, 0, 131409, 0,
+    131390, 0, 131367, 0, 131435, 0, 131373, 0, 131395, 0, 131389, 0, 131376, 0, 131463, 0,
+    131365, 0, 131440, 0, 131319, 0, 131381, 0, 131387, 0, 131359, 0, 131372, 0, 131397, 0,
+    131391, 0, 131371, 0, 131401, 0, 131430, 0, 131451, 0, 131393, 0, 131368, 0, 131406, 0,
+    131400, 0, 131411, 0, 131441, 0, 131433, 0, 131410, 0, 131354, 0, 131448, 0, 131408, 0,
+    131385, 0, 131444, 0, 131375, 0, 131456, 0, 131362, 0, 131399, 0, 131438, 0, 131437, 0,
+    131417, 0, 131416, 0, 131360, 0, 131361, 0, 131352, 0, 131402, 0, 330, 304, 280, 8,
+    289, 16, 288, 24, 344, 9, 65880, 18, 345, 152, 365, 5140, 366, 2, 327, 256,
+    290, 6, 384, 8, 303, 14, 372, 8, 65908, 16, 65908, 32, 313, 8, 65849, 16,
+    65849, 32, 336, 8, 65872, 16, 65872, 32, 376, 80, 282, 20, 131408, 0, 131444, 0,
+    131385, 0, 313, 8, 65849, 16, 65849, 32, 372, 8, 336, 48, 338, 72, 361, 20,
+    369, 8, 65872, 96, 65908, 16, 339, 8, 328, 14, 334, 8, 65870, 16, 65870, 32,
+    296, 8, 65832, 16, 65832, 32, 321, 8, 65857, 16, 65857, 32, 379, 80, 358, 20,
+    131393, 0, 131406, 0, 131368, 0, 296, 8, 65832, 16, 65832, 32, 334, 8, 321, 48,
+    65857, 96, 65870, 16, 65875, 16, 329, 14, 299, 8, 65835, 16, 65835, 32, 319, 8,
+    325, 48, 300, 72, 287, 20, 65905, 16, 65861, 96, 65855, 16, 65875, 32, 315, 14,
+    309, 8, 65845, 16, 65845, 32, 247, 8, 368, 48, 65904, 96, 65783, 16, 293, 20,
+    391, 32, 304, 8, 317, 8, 323, 8, 301, 8, 363, 24, 295, 104, 318, 8,
+    337, 8, 305, 8, 340, 12, 324, 56, 314, 20, 342, 32, 131437, 0, 131438, 0,
+    131399, 0, 327, 8, 65863, 16, 65880, 27, 65880, 36, 65880, 45, 131364, 0, 292, 29,
+    366, 30, 365, 116, 377, 116, 131449, 0, 131437, 0, 131364, 0, 292, 232, 365, 272,
+    131364, 0, 292, 112, 131364, 0, 131437, 0, 365, 232, 131437, 0, 131378, 0, 306, 33,
+    365, 34, 292, 132, 377, 132, 131449, 0, 131364, 0, 131378, 0, 306, 8, 292, 8,
+    377, 8, 389, 24, 375, 104, 316, 8, 291, 8, 322, 8, 357, 12, 341, 56,
+    335, 192, 383, 16, 131455, 0, 383, 256, 307, 16, 373, 256, 353, 16, 65919, 640,
+    65843, 40, 65909, 640, 65889, 40, 65919, 1216, 65843, 76, 65919, 2080, 65843, 130, 320, 16,
+    312, 2048, 65848, 4096, 65848, 8192, 362, 192, 302, 16, 131374, 0, 302, 256, 352, 16,
+    351, 256, 367, 16, 65838, 640, 65888, 40, 65887, 640, 65903, 40, 65838, 1216, 65888, 76,
+    65838, 2080, 65888, 130, 371, 16, 364, 2048, 65900, 4096, 65900, 8192, 65863, 32, 378, 192,
+    370, 256, 311, 16, 359, 256, 374, 16, 65906, 640, 65847, 40, 310, 16, 360, 2048,
+    65896, 4096, 297, 192, 308, 16, 131380, 0, 308, 256, 398, 16, 343, 256, 298, 16,
+    65844, 640, 65934, 40, 294, 16, 326, 2048, 65862, 4096, 382, 232, 406, 272, 131454, 0,
+    382, 112, 131454, 0, 131478, 0, 131463, 0, 131365, 0, 131376, 0, 131375, 0, 131354, 0,
+    131448, 0, 131394, 0, 131385, 0, 131363, 0, 131408, 0, 131444, 0, 131388, 0, 131400, 0,
+    131430, 0, 131451, 0, 131377, 0, 131368, 0, 131409, 0, 131393, 0, 131406, 0, 131390, 0,
+    131401, 0, 131449, 0, 131371, 0, 131364, 0, 131397, 0, 131391, 0, 131378, 0, 131387, 0,
+    131373, 0, 131381, 0, 131395, 0, 131440, 0, 131319, 0, 131389, 0, 131411, 0, 131362, 0,
+    131456, 0, 131433, 0, 131410, 0, 131359, 0, 131372, 0, 131441, 0, 131384, 0, 131392, 0,
+    131455, 0, 131379, 0, 131445, 0, 131425, 0, 131407, 0, 131367, 0, 131435, 0, 131436, 0,
+    131443, 0, 131374, 0, 131424, 0, 131423, 0, 131439, 0, 131434, 0, 131447, 0, 131461, 0,
+    131432, 0, 131382, 0, 131442, 0, 131383, 0, 131431, 0, 131446, 0, 131450, 0, 131396, 0,
+    131412, 0, 131398, 0, 131366, 0, 131380, 0, 131470, 0, 131415, 0, 131370, 0, 131369, 0,
+    131413, 0, 131429, 0, 131414, 0, 131386, 0, 131399, 0, 131416, 0, 131360, 0, 131361, 0,
+    131417, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 345, 16, 289, 24, 288, 9,
+    65824, 18, 344, 152, 327, 5140, 314, 2, 342, 256, 357, 6, 341, 8, 297, 14,
+    298, 8, 65834, 16, 65834, 32, 343, 8, 65879, 16, 65879, 32, 398, 8, 65934, 16,
+    65934, 32, 308, 80, 294, 20, 131470, 0, 131370, 0, 131415, 0, 343, 8, 65879, 16,
+    65879, 32, 298, 8, 398, 48, 326, 72, 340, 20, 324, 8, 65934, 96, 65834, 16,
+    378, 8, 374, 14, 359, 8, 65895, 16, 65895, 32, 311, 8, 65847, 16, 65847, 32,
+    370, 8, 65906, 16, 65906, 32, 310, 80, 360, 20, 131442, 0, 131431, 0, 131383, 0,
+    311, 8, 65847, 16, 65847, 32, 359, 8, 370, 48, 65906, 96, 65895, 16, 65914, 16,
+    389, 14, 375, 8, 65911, 16, 65911, 32, 362, 8, 367, 48, 351, 72, 352, 20,
+    65860, 16, 65903, 96, 65898, 16, 65914, 32, 302, 14, 371, 8, 65907, 16, 65907, 32,
+    364, 8, 363, 48, 65899, 96, 65900, 16, 295, 20, 335, 32, 353, 8, 373, 8,
+    307, 8, 383, 8, 320, 24, 312, 104, 369, 8, 300, 8, 287, 8, 338, 12,
+    361, 56, 384, 20, 290, 32, 131399, 0, 131386, 0, 131414, 0, 342, 8, 65878, 16,
+    65824, 27, 65824, 36, 65824, 45, 131438, 0, 366, 29, 314, 30, 327, 116, 339, 116,
+    131411, 0, 131399, 0, 131438, 0, 366, 232, 327, 272, 131438, 0, 366, 112, 131438, 0,
+    131399, 0, 327, 232, 131399, 0, 131437, 0, 365, 33, 327, 34, 366, 132, 339, 132,
+    131411, 0, 131438, 0, 131437, 0, 365, 8, 366, 8, 339, 8, 317, 24, 247, 104,
+    368, 8, 323, 8, 309, 8, 301, 12, 315, 56, 306, 192, 319, 16, 131391, 0,
+    319, 256, 325, 16, 292, 256, 299, 16, 65855, 640, 65861, 40, 65828, 640, 65835, 40,
+    65855, 1216, 65861, 76, 65855, 2080, 65861, 130, 377, 16, 329, 2048, 65865, 4096, 65865, 8192,
+    318, 192, 334, 16, 131406, 0, 334, 256, 321, 16, 337, 256, 296, 16, 65870, 640,
+    65857, 40, 65873, 640, 65832, 40, 65870, 1216, 65857, 76, 65870, 2080, 65857, 130, 305, 16,
+    379, 2048, 65915, 4096, 65915, 8192, 65878, 32, 358, 192, 328, 256, 316, 16, 372, 256,
+    336, 16, 65864, 640, 65852, 40, 291, 16, 313, 2048, 65849, 4096, 322, 192, 376, 16,
+    131448, 0, 376, 256, 282, 16, 303, 256, 304, 16, 65912, 640, 65818, 40, 293, 16,
+    391, 2048, 65927, 4096, 406, 232, 382, 272, 131478, 0, 406, 112, 131478, 0, 131454, 0,
+    131407, 0, 131367, 0, 131425, 0, 131369, 0, 131366, 0, 131380, 0, 131381, 0, 131415, 0,
+    131395, 0, 131470, 0, 131370, 0, 131440, 0, 131446, 0, 131432, 0, 131382, 0, 131359, 0,
+    131383, 0, 131372, 0, 131442, 0, 131431, 0, 131441, 0, 131461, 0, 131411, 0, 131447, 0,
+    131438, 0, 131439, 0, 131434, 0, 131437, 0, 131374, 0, 131455, 0, 131443, 0, 131379, 0,
+    131435, 0, 131436, 0, 131445, 0, 131450, 0, 131429, 0, 131413, 0, 131412, 0, 131398, 0,
+    131424, 0, 131423, 0, 131396, 0, 131401, 0, 131449, 0, 131391, 0, 131397, 0, 131364, 0,
+    131371, 0, 131378, 0, 131384, 0, 131392, 0, 131451, 0, 131377, 0, 131406, 0, 131393, 0,
+    131409, 0, 131368, 0, 131390, 0, 131319, 0, 131389, 0, 131385, 0, 131363, 0, 131400, 0,
+    131388, 0, 131444, 0, 131408, 0, 131430, 0, 131433, 0, 131410, 0, 131463, 0, 131365, 0,
+    131448, 0, 131354, 0, 131375, 0, 131376, 0, 131394, 0, 131387, 0, 131373, 0, 131362, 0,
+    131456, 0, 131414, 0, 131360, 0, 131361, 0, 131417, 0, 131416, 0, 131352, 0, 131402, 0,
+    330, 304, 280, 8, 344, 16, 345, 24, 289, 9, 65825, 18, 288, 152, 342, 5140,
+    384, 2, 290, 256, 301, 6, 315, 8, 322, 14, 304, 8, 65840, 16, 65840, 32,
+    303, 8, 65839, 16, 65839, 32, 282, 8, 65818, 16, 65818, 32, 376, 80, 293, 20,
+    131354, 0, 131376, 0, 131375, 0, 303, 8, 65839, 16, 65839, 32, 304, 8, 282, 48,
+    391, 72, 338, 20, 361, 8, 65818, 96, 65840, 16, 358, 8, 336, 14, 372, 8,
+    65908, 16, 65908, 32, 316, 8, 65852, 16, 65852, 32, 328, 8, 65864, 16, 65864, 32,
+    291, 80, 313, 20, 131400, 0, 131444, 0, 131388, 0, 316, 8, 65852, 16, 65852, 32,
+    372, 8, 328, 48, 65864, 96, 65908, 16, 65894, 16, 317, 14, 247, 8, 65783, 16,
+    65783, 32, 318, 8, 296, 48, 337, 72, 321, 20, 65897, 16, 65832, 96, 65854, 16,
+    65894, 32, 334, 14, 305, 8, 65841, 16, 65841, 32, 379, 8, 320, 48, 65856, 96,
+    65915, 16, 312, 20, 306, 32, 299, 8, 292, 8, 325, 8, 319, 8, 377, 24,
+    329, 104, 324, 8, 351, 8, 352, 8, 326, 12, 340, 56, 341, 20, 357, 32,
+    131414, 0, 131456, 0, 131362, 0, 290, 8, 65826, 16, 65825, 27, 65825, 36, 65825, 45,
+    131386, 0, 314, 29, 384, 30, 342, 116, 378, 116, 131450, 0, 131414, 0, 131386, 0,
+    314, 232, 342, 272, 131386, 0, 314, 112, 131386, 0, 131414, 0, 342, 232, 131414, 0,
+    131399, 0, 327, 33, 342, 34, 314, 132, 378, 132, 131450, 0, 131386, 0, 131399, 0,
+    327, 8, 314, 8, 378, 8, 373, 24, 364, 104, 363, 8, 307, 8, 371, 8,
+    383, 12, 302, 56, 365, 192, 362, 16, 131434, 0, 362, 256, 367, 16, 366, 256,
+    375, 16, 65898, 640, 65903, 40, 65902, 640, 65911, 40, 65898, 1216, 65903, 76, 65898, 2080,
+    65903, 130, 339, 16, 389, 2048, 65925, 4096, 65925, 8192, 369, 192, 359, 16, 131431, 0,
+    359, 256, 370, 16, 300, 256, 311, 16, 65895, 640, 65906, 40, 65836, 640, 65847, 40,
+    65895, 1216, 65906, 76, 65895, 2080, 65906, 130, 287, 16, 310, 2048, 65846, 4096, 65846, 8192,
+    65826, 32, 360, 192, 374, 256, 368, 16, 298, 256, 398, 16, 65910, 640, 65904, 40,
+    323, 16, 343, 2048, 65879, 4096, 309, 192, 308, 16, 131380, 0, 308, 256, 294, 16,
+    297, 256, 353, 16, 65844, 640, 65830, 40, 295, 16, 335, 2048, 65871, 4096, 382, 232,
+    406, 272, 131454, 0, 382, 112, 131454, 0, 131478, 0, 131378, 0, 131384, 0, 131371, 0,
+    131394, 0, 131365, 0, 131448, 0, 131443, 0, 131375, 0, 131379, 0, 131354, 0, 131376, 0,
+    131435, 0, 131408, 0, 131385, 0, 131363, 0, 131424, 0, 131388, 0, 131423, 0, 131400, 0,
+    131444, 0, 131396, 0, 131389, 0, 131450, 0, 131319, 0, 131386, 0, 131368, 0, 131390, 0,
+    131399, 0, 131406, 0, 131391, 0, 131377, 0, 131397, 0, 131392, 0, 131451, 0, 131364, 0,
+    131430, 0, 131373, 0, 131387, 0, 131410, 0, 131463, 0, 131393, 0, 131409, 0, 131433, 0,
+    131461, 0, 131411, 0, 131434, 0, 131439, 0, 131438, 0, 131447, 0, 131437, 0, 131401, 0,
+    131449, 0, 131382, 0, 131359, 0, 131431, 0, 131442, 0, 131372, 0, 131383, 0, 131441, 0,
+    131436, 0, 131445, 0, 131415, 0, 131395, 0, 131446, 0, 131440, 0, 131370, 0, 131470, 0,
+    131432, 0, 131412, 0, 131398, 0, 131407, 0, 131367, 0, 131380, 0, 131366, 0, 131369, 0,
+    131425, 0, 131381, 0, 131374, 0, 131455, 0, 131429, 0, 131413, 0, 131362, 0, 131361, 0,
+    131417, 0, 131416, 0, 131360, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 288, 16,
+    344, 24, 345, 9, 65881, 18, 289, 152, 290, 5140, 341, 2, 357, 256, 383, 6,
+    302, 8, 309, 14, 353, 8, 65889, 16, 65889, 32, 297, 8, 65833, 16, 65833, 32,
+    294, 8, 65830, 16, 65830, 32, 308, 80, 295, 20, 131366, 0, 131425, 0, 131369, 0,
+    297, 8, 65833, 16, 65833, 32, 353, 8, 294, 48, 335, 72, 326, 20, 340, 8,
+    65830, 96, 65889, 16, 360, 8, 398, 14, 298, 8, 65834, 16, 65834, 32, 368, 8,
+    65904, 16, 65904, 32, 374, 8, 65910, 16, 65910, 32, 323, 80, 343, 20, 131446, 0,
+    131370, 0, 131440, 0, 368, 8, 65904, 16, 65904, 32, 298, 8, 374, 48, 65910, 96,
+    65834, 16, 65896, 16, 373, 14, 364, 8, 65900, 16, 65900, 32, 369, 8, 311, 48,
+    300, 72, 370, 20, 65876, 16, 65847, 96, 65905, 16, 65896, 32, 359, 14, 287, 8,
+    65823, 16, 65823, 32, 310, 8, 377, 48, 65913, 96, 65846, 16, 329, 20, 365, 32,
+    375, 8, 366, 8, 367, 8, 362, 8, 339, 24, 389, 104, 361, 8, 337, 8,
+    321, 8, 391, 12, 338, 56, 315, 20, 301, 32, 131362, 0, 131413, 0, 131429, 0,
+    357, 8, 65893, 16, 65881, 27, 65881, 36, 65881, 45, 131456, 0, 384, 29, 341, 30,
+    290, 116, 358, 116, 131430, 0, 131362, 0, 131456, 0, 384, 232, 290, 272, 131456, 0,
+    384, 112, 131456, 0, 131362, 0, 290, 232, 131362, 0, 131414, 0, 342, 33, 290, 34,
+    384, 132, 358, 132, 131430, 0, 131456, 0, 131414, 0, 342, 8, 384, 8, 358, 8,
+    292, 24, 379, 104, 320, 8, 325, 8, 305, 8, 319, 12, 334, 56, 327, 192,
+    318, 16, 131390, 0, 318, 256, 296, 16, 314, 256, 247, 16, 65854, 640, 65832, 40,
+    65850, 640, 65783, 40, 65854, 1216, 65832, 76, 65854, 2080, 65832, 130, 378, 16, 317, 2048,
+    65853, 4096, 65853, 8192, 324, 192, 372, 16, 131444, 0, 372, 256, 328, 16, 351, 256,
+    316, 16, 65908, 640, 65864, 40, 65887, 640, 65852, 40, 65908, 1216, 65864, 76, 65908, 2080,
+    65864, 130, 352, 16, 291, 2048, 65827, 4096, 65827, 8192, 65893, 32, 313, 192, 336, 256,
+    363, 16, 304, 256, 282, 16, 65872, 640, 65899, 40, 307, 16, 303, 2048, 65839, 4096,
+    371, 192, 376, 16, 131448, 0, 376, 256, 293, 16, 322, 256, 299, 16, 65912, 640,
+    65829, 40, 312, 16, 306, 2048, 65842, 4096, 406, 232, 382, 272, 131478, 0, 406, 112,
+    131478, 0, 131454, 0, 131437, 0, 131401, 0, 131447, 0, 131381, 0, 131367, 0, 131380, 0,
+    131377, 0, 131369, 0, 131397, 0, 131366, 0, 131425, 0, 131392, 0, 131470, 0, 131415, 0,
+    131395, 0, 131393, 0, 131440, 0, 131409, 0, 131446, 0, 131370, 0, 131433, 0, 131445, 0,
+    131430, 0, 131436, 0, 131456, 0, 131383, 0, 131441, 0, 131414, 0, 131431, 0, 131434, 0,
+    131359, 0, 131439, 0, 131449, 0, 131382, 0, 131438, 0, 131432, 0, 131455, 0, 131374, 0,
+    131398, 0, 131407, 0, 131442, 0, 131372, 0, 131412, 0, 131389, 0, 131450, 0, 131390, 0,
+    131368, 0, 131386, 0, 131319, 0, 131399, 0, 131461, 0, 131411, 0, 131363, 0, 131424, 0,
+    131444, 0, 131400, 0, 131423, 0, 131388, 0, 131396, 0, 131451, 0, 131364, 0, 131375, 0,
+    131379, 0, 131408, 0, 131435, 0, 131376, 0, 131354, 0, 131385, 0, 131410, 0, 131463, 0,
+    131378, 0, 131384, 0, 131448, 0, 131365, 0, 131394, 0, 131371, 0, 131443, 0, 131406, 0,
+    131391, 0, 131373, 0, 131387, 0, 131429, 0, 131417, 0, 131416, 0, 131360, 0, 131361, 0,
+    131352, 0, 131402, 0, 330, 304, 280, 8, 289, 16, 288, 24, 344, 9, 65880, 18,
+    345, 152, 357, 5140, 315, 2, 301, 256, 319, 6, 334, 8, 371, 14, 299, 8,
+    65835, 16, 65835, 32, 322, 8, 65858, 16, 65858, 32, 293, 8, 65829, 16, 65829, 32,
+    376, 80, 312, 20, 131365, 0, 131371, 0, 131394, 0, 322, 8, 65858, 16, 65858, 32,
+    299, 8, 293, 48, 306, 72, 391, 20, 338, 8, 65829, 96, 65835, 16, 313, 8,
+    282, 14, 304, 8, 65840, 16, 65840, 32, 363, 8, 65899, 16, 65899, 32, 336, 8,
+    65872, 16, 65872, 32, 307, 80, 303, 20, 131408, 0, 131376, 0, 131435, 0, 363, 8,
+    65899, 16, 65899, 32, 304, 8, 336, 48, 65872, 96, 65840, 16, 65849, 16, 292, 14,
+    379, 8, 65915, 16, 65915, 32, 324, 8, 316, 48, 351, 72, 328, 20, 65874, 16,
+    65852, 96, 65860, 16, 65849, 32, 372, 14, 352, 8, 65888, 16, 65888, 32, 291, 8,
+    339, 48, 65875, 96, 65827, 16, 389, 20, 327, 32, 247, 8, 314, 8, 296, 8,
+    318, 8, 378, 24, 317, 104, 340, 8, 300, 8, 370, 8, 335, 12, 326, 56,
+    302, 20, 383, 32, 131429, 0, 131387, 0, 131373, 0, 301, 8, 65837, 16, 65880, 27,
+    65880, 36, 65880, 45, 131413, 0, 341, 29, 315, 30, 357, 116, 360, 116, 131432, 0,
+    131429, 0, 131413, 0, 341, 232, 357, 272, 131413, 0, 341, 112, 131413, 0, 131429, 0,
+    357, 232, 131429, 0, 131362, 0, 290, 33, 357, 34, 341, 132, 360, 132, 131432, 0,
+    131413, 0, 131362, 0, 290, 8, 341, 8, 360, 8, 366, 24, 310, 104, 377, 8,
+    367, 8, 287, 8, 362, 12, 359, 56, 342, 192, 369, 16, 131441, 0, 369, 256,
+    311, 16, 384, 256, 364, 16, 65905, 640, 65847, 40, 65920, 640, 65900, 40, 65905, 1216,
+    65847, 76, 65905, 2080, 65847, 130, 358, 16, 373, 2048, 65909, 4096, 65909, 8192, 361, 192,
+    298, 16, 131370, 0, 298, 256, 374, 16, 337, 256, 368, 16, 65834, 640, 65910, 40,
+    65873, 640, 65904, 40, 65834, 1216, 65910, 76, 65834, 2080, 65910, 130, 321, 16, 323, 2048,
+    65859, 4096, 65859, 8192, 65837, 32, 343, 192, 398, 256, 320, 16, 353, 256, 294, 16,
+    65934, 640, 65856, 40, 325, 16, 297, 2048, 65833, 4096, 305, 192, 308, 16, 131380, 0,
+    308, 256, 295, 16, 309, 256, 375, 16, 65844, 640, 65831, 40, 329, 16, 365, 2048,
+    65901, 4096, 382, 232, 406, 272, 131454, 0, 382, 112, 131454, 0, 131478, 0, 131399, 0,
+    131461, 0, 131319, 0, 131443, 0, 131384, 0, 131448, 0, 131359, 0, 131394, 0, 131439, 0,
+    131365, 0, 131371, 0, 131449, 0, 131354, 0, 131375, 0, 131379, 0, 131442, 0, 131435, 0,
+    131372, 0, 131408, 0, 131376, 0, 131412, 0, 131364, 0, 131432, 0, 131451, 0, 131413, 0,
+    131388, 0, 131396, 0, 131362, 0, 131444, 0, 131390, 0, 131424, 0, 131368, 0, 131411, 0,
+    131363, 0, 131386, 0, 131385, 0, 131391, 0, 131406, 0, 131463, 0, 131378, 0, 131400, 0,
+    131423, 0, 131410, 0, 131445, 0, 131430, 0, 131441, 0, 131383, 0, 131456, 0, 131436, 0,
+    131414, 0, 131389, 0, 131450, 0, 131395, 0, 131393, 0, 131370, 0, 131446, 0, 131409, 0,
+    131440, 0, 131433, 0, 131382, 0, 131438, 0, 131369, 0, 131397, 0, 131470, 0, 131392, 0,
+    131425, 0, 131366, 0, 131415, 0, 131398, 0, 131407, 0, 131437, 0, 131401, 0, 131380, 0,
+    131367, 0, 131381, 0, 131447, 0, 131377, 0, 131431, 0, 131434, 0, 131455, 0, 131374, 0,
+    131373, 0, 131416, 0, 131360, 0, 131361, 0, 131417, 0, 131352, 0, 131402, 0, 330, 304,
+    280, 8, 345, 16, 289, 24, 288, 9, 65824, 18, 344, 152, 301, 5140, 302, 2,
+    383, 256, 362, 6, 359, 8, 305, 14, 375, 8, 65911, 16, 65911, 32, 309, 8,
+    65845, 16, 65845, 32, 295, 8, 65831, 16, 65831, 32, 308, 80, 329, 20, 131367, 0,
+    131447, 0, 131381, 0, 309, 8, 65845, 16, 65845, 32, 375, 8, 295, 48, 365, 72,
+    335, 20, 326, 8, 65831, 96, 65911, 16, 343, 8, 294, 14, 353, 8, 65889, 16,
+    65889, 32, 320, 8, 65856, 16, 65856, 32, 398, 8, 65934, 16, 65934, 32, 325, 80,
+    297, 20, 131470, 0, 131425, 0, 131392, 0, 320, 8, 65856, 16, 65856, 32, 353, 8,
+    398, 48, 65934, 96, 65889, 16, 65879, 16, 366, 14, 310, 8, 65846, 16, 65846, 32,
+    361, 8, 368, 48, 337, 72, 374, 20, 65862, 16, 65904, 96, 65897, 16, 65879, 32,
+    298, 14, 321, 8, 65857, 16, 65857, 32, 323, 8, 378, 48, 65914, 96, 65859, 16,
+    317, 20, 342, 32, 364, 8, 384, 8, 311, 8, 369, 8, 358, 24, 373, 104,
+    338, 8, 351, 8, 328, 8, 306, 12, 391, 56, 334, 20, 319, 32, 131373, 0,
+    131374, 0, 131455, 0, 383, 8, 65919, 16, 65824, 27, 65824, 36, 65824, 45, 131387, 0,
+    315, 29, 302, 30, 301, 116, 313, 116, 131385, 0, 131373, 0, 131387, 0, 315, 232,
+    301, 272, 131387, 0, 315, 112, 131387, 0, 131373, 0, 301, 232, 131373, 0, 131429, 0,
+    357, 33, 301, 34, 315, 132, 313, 132, 131385, 0, 131387, 0, 131429, 0, 357, 8,
+    315, 8, 313, 8, 314, 24, 291, 104, 339, 8, 296, 8, 352, 8, 318, 12,
+    372, 56, 290, 192, 324, 16, 131396, 0, 324, 256, 316, 16, 341, 256, 379, 16,
+    65860, 640, 65852, 40, 65877, 640, 65915, 40, 65860, 1216, 65852, 76, 65860, 2080, 65852, 130,
+    360, 16, 292, 2048, 65828, 4096, 65828, 8192, 340, 192, 304, 16, 131376, 0, 304, 256,
+    336, 16, 300, 256, 363, 16, 65840, 640, 65872, 40, 65836, 640, 65899, 40, 65840, 1216,
+    65872, 76, 65840, 2080, 65872, 130, 370, 16, 307, 2048, 65843, 4096, 65843, 8192, 65919, 32,
+    303, 192, 282, 256, 377, 16, 299, 256, 293, 16, 65818, 640, 65913, 40, 367, 16,
+    322, 2048, 65858, 4096, 287, 192, 376, 16, 131448, 0, 376, 256, 312, 16, 371, 256,
+    247, 16, 65912, 640, 65848, 40, 389, 16, 327, 2048, 65863, 4096, 406, 232, 382, 272,
+    131478, 0, 406, 112, 131478, 0, 131454, 0, 131414, 0, 131389, 0, 131436, 0, 131377, 0,
+    131401, 0, 131380, 0, 131424, 0, 131381, 0, 131368, 0, 131367, 0, 131447, 0, 131411, 0,
+    131366, 0, 131369, 0, 131397, 0, 131400, 0, 131392, 0, 131423, 0, 131470, 0, 131425, 0,
+    131410, 0, 131438, 0, 131385, 0, 131382, 0, 131387, 0, 131440, 0, 131433, 0, 131429, 0,
+    131370, 0, 131441, 0, 131393, 0, 131383, 0, 131450, 0, 131395, 0, 131456, 0, 131415, 0,
+    131434, 0, 131431, 0, 131407, 0, 131437, 0, 131446, 0, 131409, 0, 131398, 0, 131364, 0,
+    131432, 0, 131396, 0, 131388, 0, 131413, 0, 131451, 0, 131362, 0, 131445, 0, 131430, 0,
+    131379, 0, 131442, 0, 131376, 0, 131408, 0, 131372, 0, 131435, 0, 131412, 0, 131363, 0,
+    131386, 0, 131394, 0, 131439, 0, 131354, 0, 131449, 0, 131371, 0, 131365, 0, 131375, 0,
+    131463, 0, 131378, 0, 131399, 0, 131461, 0, 131448, 0, 131384, 0, 131443, 0, 131319, 0,
+    131359, 0, 131444, 0, 131390, 0, 131391, 0, 131406, 0, 131455, 0, 131360, 0, 131361, 0,
+    131417, 0, 131416, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 344, 16, 345, 24,
+    289, 9, 65825, 18, 288, 152, 383, 5140, 334, 2, 319, 256, 318, 6, 372, 8,
+    287, 14, 247, 8, 65783, 16, 65783, 32, 371, 8, 65907, 16, 65907, 32, 312, 8,
+    65848, 16, 65848, 32, 376, 80, 389, 20, 131384, 0, 131319, 0, 131443, 0, 371, 8,
+    65907, 16, 65907, 32, 247, 8, 312, 48, 327, 72, 306, 20, 391, 8, 65848, 96,
+    65783, 16, 303, 8, 293, 14, 299, 8, 65835, 16, 65835, 32, 377, 8, 65913, 16,
+    65913, 32, 282, 8, 65818, 16, 65818, 32, 367, 80, 322, 20, 131354, 0, 131371, 0,
+    131449, 0, 377, 8, 65913, 16, 65913, 32, 299, 8, 282, 48, 65818, 96, 65835, 16,
+    65839, 16, 314, 14, 291, 8, 65827, 16, 65827, 32, 340, 8, 363, 48, 300, 72,
+    336, 20, 65927, 16, 65899, 96, 65876, 16, 65839, 32, 304, 14, 370, 8, 65906, 16,
+    65906, 32, 307, 8, 358, 48, 65894, 96, 65843, 16, 373, 20, 290, 32, 379, 8,
+    341, 8, 316, 8, 324, 8, 360, 24, 292, 104, 326, 8, 337, 8, 374, 8,
+    365, 12, 335, 56, 359, 20, 362, 32, 131455, 0, 131406, 0, 131391, 0, 319, 8,
+    65855, 16, 65825, 27, 65825, 36, 65825, 45, 131374, 0, 302, 29, 334, 30, 383, 116,
+    343, 116, 131415, 0, 131455, 0, 131374, 0, 302, 232, 383, 272, 131374, 0, 302, 112,
+    131374, 0, 131455, 0, 383, 232, 131455, 0, 131373, 0, 301, 33, 383, 34, 302, 132,
+    343, 132, 131415, 0, 131374, 0, 131373, 0, 301, 8, 302, 8, 343, 8, 384, 24,
+    323, 104, 378, 8, 311, 8, 321, 8, 369, 12, 298, 56, 357, 192, 361, 16,
+    131433, 0, 361, 256, 368, 16, 315, 256, 310, 16, 65897, 640, 65904, 40, 65851, 640,
+    65846, 40, 65897, 1216, 65904, 76, 65897, 2080, 65904, 130, 313, 16, 366, 2048, 65902, 4096,
+    65902, 8192, 338, 192, 353, 16, 131425, 0, 353, 256, 398, 16, 351, 256, 320, 16,
+    65889, 640, 65934, 40, 65887, 640, 65856, 40, 65889, 1216, 65934, 76, 65889, 2080, 65934, 130,
+    328, 16, 325, 2048, 65861, 4096, 65861, 8192, 65855, 32, 297, 192, 294, 256, 339, 16,
+    375, 256, 295, 16, 65830, 640, 65875, 40, 296, 16, 309, 2048, 65845, 4096, 352, 192,
+    308, 16, 131380, 0, 308, 256, 329, 16, 305, 256, 364, 16, 65844, 640, 65865, 40,
+    317, 16, 342, 2048, 65878, 4096, 382, 232, 406, 272, 131454, 0, 382, 112, 131454, 0,
+    131478, 0, 131362, 0, 131445, 0, 131451, 0, 131359, 0, 131461, 0, 131448, 0, 131393, 0,
+    131443, 0, 131383, 0, 131384, 0, 131319, 0, 131450, 0, 131365, 0, 131394, 0, 131439, 0,
+    131446, 0, 131449, 0, 131409, 0, 131354, 0, 131371, 0, 131398, 0, 131386, 0, 131415, 0,
+    131363, 0, 131374, 0, 131435, 0, 131412, 0, 131373, 0, 131376, 0, 131396, 0, 131442, 0,
+    131388, 0, 131430, 0, 131379, 0, 131413, 0, 131375, 0, 131390, 0, 131444, 0, 131378, 0,
+    131399, 0, 131408, 0, 131372, 0, 131463, 0, 131438, 0, 131385, 0, 131433, 0, 131440, 0,
+    131387, 0, 131382, 0, 131429, 0, 131364, 0, 131432, 0, 131397, 0, 131400, 0, 131425, 0,
+    131470, 0, 131423, 0, 131392, 0, 131410, 0, 131395, 0, 131456, 0, 131381, 0, 131368, 0,
+    131366, 0, 131411, 0, 131447, 0, 131367, 0, 131369, 0, 131407, 0, 131437, 0, 131414, 0,
+    131389, 0, 131380, 0, 131401, 0, 131377, 0, 131436, 0, 131424, 0, 131370, 0, 131441, 0,
+    131434, 0, 131431, 0, 131391, 0, 131361, 0, 131417, 0, 131416, 0, 131360, 0, 131352, 0,
+    131402, 0, 330, 304, 280, 8, 288, 16, 344, 24, 345, 9, 65881, 18, 289, 152,
+    319, 5140, 359, 2, 362, 256, 369, 6, 298, 8, 352, 14, 364, 8, 65900, 16,
+    65900, 32, 305, 8, 65841, 16, 65841, 32, 329, 8, 65865, 16, 65865, 32, 308, 80,
+    317, 20, 131401, 0, 131436, 0, 131377, 0, 305, 8, 65841, 16, 65841, 32, 364, 8,
+    329, 48, 342, 72, 365, 20, 335, 8, 65865, 96, 65900, 16, 297, 8, 295, 14,
+    375, 8, 65911, 16, 65911, 32, 339, 8, 65875, 16, 65875, 32, 294, 8, 65830, 16,
+    65830, 32, 296, 80, 309, 20, 131366, 0, 131447, 0, 131411, 0, 339, 8, 65875, 16,
+    65875, 32, 375, 8, 294, 48, 65830, 96, 65911, 16, 65833, 16, 384, 14, 323, 8,
+    65859, 16, 65859, 32, 338, 8, 320, 48, 351, 72, 398, 20, 65871, 16, 65856, 96,
+    65874, 16, 65833, 32, 353, 14, 328, 8, 65864, 16, 65864, 32, 325, 8, 360, 48,
+    65896, 96, 65861, 16, 292, 20, 357, 32, 310, 8, 315, 8, 368, 8, 361, 8,
+    313, 24, 366, 104, 391, 8, 300, 8, 336, 8, 327, 12, 306, 56, 372, 20,
+    318, 32, 131391, 0, 131431, 0, 131434, 0, 362, 8, 65898, 16, 65881, 27, 65881, 36,
+    65881, 45, 131406, 0, 334, 29, 359, 30, 319, 116, 303, 116, 131375, 0, 131391, 0,
+    131406, 0, 334, 232, 319, 272, 131406, 0, 334, 112, 131406, 0, 131391, 0, 319, 232,
+    131391, 0, 131455, 0, 383, 33, 319, 34, 334, 132, 303, 132, 131375, 0, 131406, 0,
+    131455, 0, 383, 8, 334, 8, 303, 8, 341, 24, 307, 104, 358, 8, 316, 8,
+    370, 8, 324, 12, 304, 56, 301, 192, 340, 16, 131412, 0, 340, 256, 363, 16,
+    302, 256, 291, 16, 65876, 640, 65899, 40, 65838, 640, 65827, 40, 65876, 1216, 65899, 76,
+    65876, 2080, 65899, 130, 343, 16, 314, 2048, 65850, 4096, 65850, 8192, 326, 192, 299, 16,
+    131371, 0, 299, 256, 282, 16, 337, 256, 377, 16, 65835, 640, 65818, 40, 65873, 640,
+    65913, 40, 65835, 1216, 65818, 76, 65835, 2080, 65818, 130, 374, 16, 367, 2048, 65903, 4096,
+    65903, 8192, 65898, 32, 322, 192, 293, 256, 378, 16, 247, 256, 312, 16, 65829, 640,
+    65914, 40, 311, 16, 371, 2048, 65907, 4096, 321, 192, 376, 16, 131448, 0, 376, 256,
+    389, 16, 287, 256, 379, 16, 65912, 640, 65925, 40, 373, 16, 290, 2048, 65826, 4096,
+    406, 232, 382, 272, 131478, 0, 406, 112, 131478, 0, 131454, 0, 131429, 0, 131364, 0,
+    131382, 0, 131424, 0, 131389, 0, 131380, 0, 131442, 0, 131377, 0, 131388, 0, 131401, 0,
+    131436, 0, 131430, 0, 131367, 0, 131381, 0, 131368, 0, 131408, 0, 131411, 0, 131372, 0,
+    131366, 0, 131447, 0, 131463, 0, 131456, 0, 131375, 0, 131395, 0, 131406, 0, 131392, 0,
+    131410, 0, 131455, 0, 131425, 0, 131433, 0, 131400, 0, 131440, 0, 131432, 0, 131397, 0,
+    131387, 0, 131369, 0, 131441, 0, 131370, 0, 131437, 0, 131414, 0, 131470, 0, 131423, 0,
+    131407, 0, 131386, 0, 131415, 0, 131412, 0, 131435, 0, 131374, 0, 131363, 0, 131373, 0,
+    131438, 0, 131385, 0, 131439, 0, 131446, 0, 131371, 0, 131354, 0, 131409, 0, 131449, 0,
+    131398, 0, 131379, 0, 131413, 0, 131443, 0, 131383, 0, 131365, 0, 131450, 0, 131319, 0,
+    131384, 0, 131394, 0, 131378, 0, 131399, 0, 131362, 0, 131445, 0, 131448, 0, 131461, 0,
+    131359, 0, 131451, 0, 131393, 0, 131376, 0, 131396, 0, 131390, 0, 131444, 0, 131434, 0,
+    131417, 0, 131416, 0, 131360, 0, 131361, 0, 131352, 0, 131402, 0, 330, 304, 280, 8,
+    289, 16, 288, 24, 344, 9, 65880, 18, 345, 152, 362, 5140, 372, 2, 318, 256,
+    324, 6, 304, 8, 321, 14, 379, 8, 65915, 16, 65915, 32, 287, 8, 65823, 16,
+    65823, 32, 389, 8, 65925, 16, 65925, 32, 376, 80, 373, 20, 131461, 0, 131451, 0,
+    131359, 0, 287, 8, 65823, 16, 65823, 32, 379, 8, 389, 48, 290, 72, 327, 20,
+    306, 8, 65925, 96, 65915, 16, 322, 8, 312, 14, 247, 8, 65783, 16, 65783, 32,
+    378, 8, 65914, 16, 65914, 32, 293, 8, 65829, 16, 65829, 32, 311, 80, 371, 20,
+    131365, 0, 131319, 0, 131450, 0, 378, 8, 65914, 16, 65914, 32, 247, 8, 293, 48,
+    65829, 96, 65783, 16, 65858, 16, 341, 14, 307, 8, 65843, 16, 65843, 32, 326, 8,
+    377, 48, 337, 72, 282, 20, 65842, 16, 65913, 96, 65862, 16, 65858, 32, 299, 14,
+    374, 8, 65910, 16, 65910, 32, 367, 8, 313, 48, 65849, 96, 65903, 16, 366, 20,
+    301, 32, 291, 8, 302, 8, 363, 8, 340, 8, 343, 24, 314, 104, 335, 8,
+    351, 8, 398, 8, 342, 12, 365, 56, 298, 20, 369, 32, 131434, 0, 131444, 0,
+    131390, 0, 318, 8, 65854, 16, 65880, 27, 65880, 36, 65880, 45, 131431, 0, 359, 29,
+    372, 30, 362, 116, 297, 116, 131369, 0, 131434, 0, 131431, 0, 359, 232, 362, 272,
+    131431, 0, 359, 112, 131431, 0, 131434, 0, 362, 232, 131434, 0, 131391, 0, 319, 33,
+    362, 34, 359, 132, 297, 132, 131369, 0, 131431, 0, 131391, 0, 319, 8, 359, 8,
+    297, 8, 315, 24, 325, 104, 360, 8, 368, 8, 328, 8, 361, 12, 353, 56,
+    383, 192, 338, 16, 131410, 0, 338, 256, 320, 16, 334, 256, 323, 16, 65874, 640,
+    65856, 40, 65870, 640, 65859, 40, 65874, 1216, 65856, 76, 65874, 2080, 65856, 130, 303, 16,
+    384, 2048, 65920, 4096, 65920, 8192, 391, 192, 375, 16, 131447, 0, 375, 256, 294, 16,
+    300, 256, 339, 16, 65911, 640, 65830, 40, 65836, 640, 65875, 40, 65911, 1216, 65830, 76,
+    65911, 2080, 65830, 130, 336, 16, 296, 2048, 65832, 4096, 65832, 8192, 65854, 32, 309, 192,
+    295, 256, 358, 16, 364, 256, 329, 16, 65831, 640, 65894, 40, 316, 16, 305, 2048,
+    65841, 4096, 370, 192, 308, 16, 131380, 0, 308, 256, 317, 16, 352, 256, 310, 16,
+    65844, 640, 65853, 40, 292, 16, 357, 2048, 65893, 4096, 382, 232, 406, 272, 131454, 0,
+    382, 112, 131454, 0, 131478, 0, 131373, 0, 131438, 0, 131363, 0, 131393, 0, 131445, 0,
+    131448, 0, 131400, 0, 131359, 0, 131440, 0, 131461, 0, 131451, 0, 131432, 0, 131384, 0,
+    131443, 0, 131383, 0, 131470, 0, 131450, 0, 131423, 0, 131365, 0, 131319, 0, 131407, 0,
+    131413, 0, 131369, 0, 131379, 0, 131431, 0, 131449, 0, 131398, 0, 131391, 0, 131371, 0,
+    131412, 0, 131446, 0, 131435, 0, 131385, 0, 131439, 0, 131374, 0, 131394, 0, 131396, 0,
+    131376, 0, 131399, 0, 131362, 0, 131354, 0, 131409, 0, 131378, 0, 131456, 0, 131375, 0,
+    131410, 0, 131392, 0, 131406, 0, 131395, 0, 131455, 0, 131386, 0, 131415, 0, 131368, 0,
+    131408, 0, 131447, 0, 131366, 0, 131372, 0, 131411, 0, 131463, 0, 131397, 0, 131387, 0,
+    131377, 0, 131388, 0, 131367, 0, 131430, 0, 131436, 0, 131401, 0, 131381, 0, 131437, 0,
+    131414, 0, 131429, 0, 131364, 0, 131380, 0, 131389, 0, 131424, 0, 131382, 0, 131442, 0,
+    131425, 0, 131433, 0, 131441, 0, 131370, 0, 131390, 0, 131416, 0, 131360, 0, 131361, 0,
+    131417, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 345, 16, 289, 24, 288, 9,
+    65824, 18, 344, 152, 318, 5140, 298, 2, 369, 256, 361, 6, 353, 8, 370, 14,
+    310, 8, 65846, 16, 65846, 32, 352, 8, 65888, 16, 65888, 32, 317, 8, 65853, 16,
+    65853, 32, 308, 80, 292, 20, 131389, 0, 131382, 0, 131424, 0, 352, 8, 65888, 16,
+    65888, 32, 310, 8, 317, 48, 357, 72, 342, 20, 365, 8, 65853, 96, 65846, 16,
+    309, 8, 329, 14, 364, 8, 65900, 16, 65900, 32, 358, 8, 65894, 16, 65894, 32,
+    295, 8, 65831, 16, 65831, 32, 316, 80, 305, 20, 131367, 0, 131436, 0, 131430, 0,
+    358, 8, 65894, 16, 65894, 32, 364, 8, 295, 48, 65831, 96, 65900, 16, 65845, 16,
+    315, 14, 325, 8, 65861, 16, 65861, 32, 391, 8, 339, 48, 300, 72, 294, 20,
+    65901, 16, 65875, 96, 65927, 16, 65845, 32, 375, 14, 336, 8, 65872, 16, 65872, 32,
+    296, 8, 343, 48, 65879, 96, 65832, 16, 314, 20, 383, 32, 323, 8, 334, 8,
+    320, 8, 338, 8, 303, 24, 384, 104, 306, 8, 337, 8, 282, 8, 290, 12,
+    327, 56, 304, 20, 324, 32, 131390, 0, 131370, 0, 131441, 0, 369, 8, 65905, 16,
+    65824, 27, 65824, 36, 65824, 45, 131444, 0, 372, 29, 298, 30, 318, 116, 322, 116,
+    131394, 0, 131390, 0, 131444, 0, 372, 232, 318, 272, 131444, 0, 372, 112, 131444, 0,
+    131390, 0, 318, 232, 131390, 0, 131434, 0, 362, 33, 318, 34, 372, 132, 322, 132,
+    131394, 0, 131444, 0, 131434, 0, 362, 8, 372, 8, 322, 8, 302, 24, 367, 104,
+    313, 8, 363, 8, 374, 8, 340, 12, 299, 56, 319, 192, 326, 16, 131398, 0,
+    326, 256, 377, 16, 359, 256, 307, 16, 65862, 640, 65913, 40, 65895, 640, 65843, 40,
+    65862, 1216, 65913, 76, 65862, 2080, 65913, 130, 297, 16, 341, 2048, 65877, 4096, 65877, 8192,
+    335, 192, 247, 16, 131319, 0, 247, 256, 293, 16, 351, 256, 378, 16, 65783, 640,
+    65829, 40, 65887, 640, 65914, 40, 65783, 1216, 65829, 76, 65783, 2080, 65829, 130, 398, 16,
+    311, 2048, 65847, 4096, 65847, 8192, 65905, 32, 371, 192, 312, 256, 360, 16, 379, 256,
+    389, 16, 65848, 640, 65896, 40, 368, 16, 287, 2048, 65823, 4096, 328, 192, 376, 16,
+    131448, 0, 376, 256, 373, 16, 321, 256, 291, 16, 65912, 640, 65909, 40, 366, 16,
+    301, 2048, 65837, 4096, 406, 232, 382, 272, 131478, 0, 406, 112, 131478, 0, 131454, 0,
+    131455, 0, 131386, 0, 131395, 0, 131442, 0, 131364, 0, 131380, 0, 131446, 0, 131424, 0,
+    131435, 0, 131389, 0, 131382, 0, 131385, 0, 131401, 0, 131377, 0, 131388, 0, 131354, 0,
+    131430, 0, 131409, 0, 131367, 0, 131436, 0, 131378, 0, 131387, 0, 131394, 0, 131397, 0,
+    131444, 0, 131411, 0, 131463, 0, 131434, 0, 131447, 0, 131410, 0, 131408, 0, 131392, 0,
+    131415, 0, 131368, 0, 131406, 0, 131381, 0, 131433, 0, 131425, 0, 131414, 0, 131429, 0,
+    131366, 0, 131372, 0, 131437, 0, 131413, 0, 131369, 0, 131398, 0, 131449, 0, 131431, 0,
+    131379, 0, 131391, 0, 131456, 0, 131375, 0, 131383, 0, 131470, 0, 131319, 0, 131365, 0,
+    131423, 0, 131450, 0, 131407, 0, 131439, 0, 131374, 0, 131359, 0, 131440, 0, 131384, 0,
+    131432, 0, 131451, 0, 131461, 0, 131443, 0, 131399, 0, 131362, 0, 131373, 0, 131438, 0,
+    131448, 0, 131445, 0, 131393, 0, 131363, 0, 131400, 0, 131371, 0, 131412, 0, 131396, 0,
+    131376, 0, 131441, 0, 131360, 0, 131361, 0, 131417, 0, 131416, 0, 131352, 0, 131402, 0,
+    330, 304, 280, 8, 344, 16, 345, 24, 289, 9, 65825, 18, 288, 152, 369, 5140,
+    304, 2, 324, 256, 340, 6, 299, 8, 328, 14, 291, 8, 65827, 16, 65827, 32,
+    321, 8, 65857, 16, 65857, 32, 373, 8, 65909, 16, 65909, 32, 376, 80, 366, 20,
+    131445, 0, 131363, 0, 131393, 0, 321, 8, 65857, 16, 65857, 32, 291, 8, 373, 48,
+    301, 72, 290, 20, 327, 8, 65909, 96, 65827, 16, 371, 8, 389, 14, 379, 8,
+    65915, 16, 65915, 32, 360, 8, 65896, 16, 65896, 32, 312, 8, 65848, 16, 65848, 32,
+    368, 80, 287, 20, 131384, 0, 131451, 0, 131432, 0, 360, 8, 65896, 16, 65896, 32,
+    379, 8, 312, 48, 65848, 96, 65915, 16, 65907, 16, 302, 14, 367, 8, 65903, 16,
+    65903, 32, 335, 8, 378, 48, 351, 72, 293, 20, 65863, 16, 65914, 96, 65871, 16,
+    65907, 32, 247, 14, 398, 8, 65934, 16, 65934, 32, 311, 8, 303, 48, 65839, 96,
+    65847, 16, 384, 20, 319, 32, 307, 8, 359, 8, 377, 8, 326, 8, 297, 24,
+    341, 104, 365, 8, 300, 8, 294, 8, 357, 12, 342, 56, 353, 20, 361, 32,
+    131441, 0, 131376, 0, 131396, 0, 324, 8, 65860, 16, 65825, 27, 65825, 36, 65825, 45,
+    131370, 0, 298, 29, 304, 30, 369, 116, 309, 116, 131381, 0, 131441, 0, 131370, 0,
+    298, 232, 369, 272, 131370, 0, 298, 112, 131370, 0, 131441, 0, 369, 232, 131441, 0,
+    131390, 0, 318, 33, 369, 34, 298, 132, 309, 132, 131381, 0, 131370, 0, 131390, 0,
+    318, 8, 298, 8, 309, 8, 334, 24, 296, 104, 343, 8, 320, 8, 336, 8,
+    338, 12, 375, 56, 362, 192, 391, 16, 131463, 0, 391, 256, 339, 16, 372, 256,
+    325, 16, 65927, 640, 65875, 40, 65908, 640, 65861, 40, 65927, 1216, 65875, 76, 65927, 2080,
+    65875, 130, 322, 16, 315, 2048, 65851, 4096, 65851, 8192, 306, 192, 364, 16, 131436, 0,
+    364, 256, 295, 16, 337, 256, 358, 16, 65900, 640, 65831, 40, 65873, 640, 65894, 40,
+    65900, 1216, 65831, 76, 65900, 2080, 65831, 130, 282, 16, 316, 2048, 65852, 4096, 65852, 8192,
+    65860, 32, 305, 192, 329, 256, 313, 16, 310, 256, 317, 16, 65865, 640, 65849, 40,
+    363, 16, 352, 2048, 65888, 4096, 374, 192, 308, 16, 131380, 0, 308, 256, 292, 16,
+    370, 256, 323, 16, 65844, 640, 65828, 40, 314, 16, 383, 2048, 65919, 4096, 382, 232,
+    406, 272, 131454, 0, 382, 112, 131454, 0, 131478, 0, 131391, 0, 131456, 0, 131379, 0,
+    131400, 0, 131438, 0, 131448, 0, 131408, 0, 131393, 0, 131392, 0, 131445, 0, 131363, 0,
+    131415, 0, 131461, 0, 131359, 0, 131440, 0, 131366, 0, 131432, 0, 131372, 0, 131384, 0,
+    131451, 0, 131437, 0, 131374, 0, 131381, 0, 131439, 0, 131370, 0, 131450, 0, 131407, 0,
+    131390, 0, 131319, 0, 131398, 0, 131470, 0, 131449, 0, 131375, 0, 131383, 0, 131431, 0,
+    131443, 0, 131412, 0, 131371, 0, 131362, 0, 131373, 0, 131365, 0, 131423, 0, 131399, 0,
+    131387, 0, 131394, 0, 131463, 0, 131411, 0, 131444, 0, 131397, 0, 131434, 0, 131413, 0,
+    131369, 0, 131388, 0, 131354, 0, 131436, 0, 131367, 0, 131409, 0, 131430, 0, 131378, 0,
+    131368, 0, 131406, 0, 131424, 0, 131435, 0, 131401, 0, 131385, 0, 131382, 0, 131389, 0,
+    131377, 0, 131414, 0, 131429, 0, 131455, 0, 131386, 0, 131380, 0, 131364, 0, 131442, 0,
+    131395, 0, 131446, 0, 131447, 0, 131410, 0, 131433, 0, 131425, 0, 131396, 0, 131361, 0,
+    131417, 0, 131416, 0, 131360, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 288, 16,
+    344, 24, 345, 9, 65881, 18, 289, 152, 324, 5140, 353, 2, 361, 256, 338, 6,
+    375, 8, 374, 14, 323, 8, 65859, 16, 65859, 32, 370, 8, 65906, 16, 65906, 32,
+    292, 8, 65828, 16, 65828, 32, 308, 80, 314, 20, 131364, 0, 131395, 0, 131442, 0,
+    370, 8, 65906, 16, 65906, 32, 323, 8, 292, 48, 383, 72, 357, 20, 342, 8,
+    65828, 96, 65859, 16, 305, 8, 317, 14, 310, 8, 65846, 16, 65846, 32, 313, 8,
+    65849, 16, 65849, 32, 329, 8, 65865, 16, 65865, 32, 363, 80, 352, 20, 131401, 0,
+    131382, 0, 131385, 0, 313, 8, 65849, 16, 65849, 32, 310, 8, 329, 48, 65865, 96,
+    65846, 16, 65841, 16, 334, 14, 296, 8, 65832, 16, 65832, 32, 306, 8, 358, 48,
+    337, 72, 295, 20, 65878, 16, 65894, 96, 65842, 16, 65841, 32, 364, 14, 282, 8,
+    65818, 16, 65818, 32, 316, 8, 297, 48, 65833, 96, 65852, 16, 341, 20, 362, 32,
+    325, 8, 372, 8, 339, 8, 391, 8, 322, 24, 315, 104, 327, 8, 351, 8,
+    293, 8, 301, 12, 290, 56, 299, 20, 340, 32, 131396, 0, 131425, 0, 131433, 0,
+    361, 8, 65897, 16, 65881, 27, 65881, 36, 65881, 45, 131376, 0, 304, 29, 353, 30,
+    324, 116, 371, 116, 131443, 0, 131396, 0, 131376, 0, 304, 232, 324, 272, 131376, 0,
+    304, 112, 131376, 0, 131396, 0, 324, 232, 131396, 0, 131441, 0, 369, 33, 324, 34,
+    304, 132, 371, 132, 131443, 0, 131376, 0, 131441, 0, 369, 8, 304, 8, 371, 8,
+    359, 24, 311, 104, 303, 8, 377, 8, 398, 8, 326, 12, 247, 56, 318, 192,
+    335, 16, 131407, 0, 335, 256, 378, 16, 298, 256, 367, 16, 65871, 640, 65914, 40,
+    65834, 640, 65903, 40, 65871, 1216, 65914, 76, 65871, 2080, 65914, 130, 309, 16, 302, 2048,
+    65838, 4096, 65838, 8192, 365, 192, 379, 16, 131451, 0, 379, 256, 312, 16, 300, 256,
+    360, 16, 65915, 640, 65848, 40, 65836, 640, 65896, 40, 65915, 1216, 65848, 76, 65915, 2080,
+    65848, 130, 294, 16, 368, 2048, 65904, 4096, 65904, 8192, 65897, 32, 287, 192, 389, 256,
+    343, 16, 291, 256, 373, 16, 65925, 640, 65879, 40, 320, 16, 321, 2048, 65857, 4096,
+    336, 192, 376, 16, 131448, 0, 376, 256, 366, 16, 328, 256, 307, 16, 65912, 640,
+    65902, 40, 384, 16, 319, 2048, 65855, 4096, 406, 232, 382, 272, 131478, 0, 406, 112,
+    131478, 0, 131454, 0, 131434, 0, 131413, 0, 131397, 0, 131446, 0, 131386, 0, 131380, 0,
+    131470, 0, 131442, 0, 131449, 0, 131364, 0, 131395, 0, 131375, 0, 131389, 0, 131424, 0,
+    131435, 0, 131365, 0, 131385, 0, 131423, 0, 131401, 0, 131382, 0, 131399, 0, 131406, 0,
+    131443, 0, 131368, 0, 131376, 0, 131430, 0, 131378, 0, 131441, 0, 131436, 0, 131463, 0,
+    131354, 0, 131411, 0, 131369, 0, 131388, 0, 131444, 0, 131377, 0, 131410, 0, 131447, 0,
+    131429, 0, 131455, 0, 131367, 0, 131409, 0, 131414, 0, 131374, 0, 131381, 0, 131407, 0,
+    131450, 0, 131370, 0, 131439, 0, 131390, 0, 131387, 0, 131394, 0, 131440, 0, 131366, 0,
+    131451, 0, 131384, 0, 131372, 0, 131432, 0, 131437, 0, 131383, 0, 131431, 0, 131393, 0,
+    131392, 0, 131461, 0, 131415, 0, 131363, 0, 131445, 0, 131359, 0, 131362, 0, 131373, 0,
+    131391, 0, 131456, 0, 131448, 0, 131438, 0, 131400, 0, 131379, 0, 131408, 0, 131319, 0,
+    131398, 0, 131412, 0, 131371, 0, 131433, 0, 131417, 0, 131416, 0, 131360, 0, 131361, 0,
+    131352, 0, 131402, 0, 330, 304, 280, 8, 289, 16, 288, 24, 344, 9, 65880, 18,
+    345, 152, 361, 5140, 299, 2, 340, 256, 326, 6, 247, 8, 336, 14, 307, 8,
+    65843, 16, 65843, 32, 328, 8, 65864, 16, 65864, 32, 366, 8, 65902, 16, 65902, 32,
+    376, 80, 384, 20, 131438, 0, 131379, 0, 131400, 0, 328, 8, 65864, 16, 65864, 32,
+    307, 8, 366, 48, 319, 72, 301, 20, 290, 8, 65902, 96, 65843, 16, 287, 8,
+    373, 14, 291, 8, 65827, 16, 65827, 32, 343, 8, 65879, 16, 65879, 32, 389, 8,
+    65925, 16, 65925, 32, 320, 80, 321, 20, 131461, 0, 131363, 0, 131415, 0, 343, 8,
+    65879, 16, 65879, 32, 291, 8, 389, 48, 65925, 96, 65827, 16, 65823, 16, 359, 14,
+    311, 8, 65847, 16, 65847, 32, 365, 8, 360, 48, 300, 72, 312, 20, 65826, 16,
+    65896, 96, 65901, 16, 65823, 32, 379, 14, 294, 8, 65830, 16, 65830, 32, 368, 8,
+    322, 48, 65858, 96, 65904, 16, 315, 20, 318, 32, 367, 8, 298, 8, 378, 8,
+    335, 8, 309, 24, 302, 104, 342, 8, 337, 8, 295, 8, 383, 12, 357, 56,
+    375, 20, 338, 32, 131433, 0, 131371, 0, 131412, 0, 340, 8, 65876, 16, 65880, 27,
+    65880, 36, 65880, 45, 131425, 0, 353, 29, 299, 30, 361, 116, 305, 116, 131377, 0,
+    131433, 0, 131425, 0, 353, 232, 361, 272, 131425, 0, 353, 112, 131425, 0, 131433, 0,
+    361, 232, 131433, 0, 131396, 0, 324, 33, 361, 34, 353, 132, 305, 132, 131377, 0,
+    131425, 0, 131396, 0, 324, 8, 353, 8, 305, 8, 372, 24, 316, 104, 297, 8,
+    339, 8, 282, 8, 391, 12, 364, 56, 369, 192, 306, 16, 131378, 0, 306, 256,
+    358, 16, 304, 256, 296, 16, 65842, 640, 65894, 40, 65840, 640, 65832, 40, 65842, 1216,
+    65894, 76, 65842, 2080, 65894, 130, 371, 16, 334, 2048, 65870, 4096, 65870, 8192, 327, 192,
+    310, 16, 131382, 0, 310, 256, 329, 16, 351, 256, 313, 16, 65846, 640, 65865, 40,
+    65887, 640, 65849, 40, 65846, 1216, 65865, 76, 65846, 2080, 65865, 130, 293, 16, 363, 2048,
+    65899, 4096, 65899, 8192, 65876, 32, 352, 192, 317, 256, 303, 16, 323, 256, 292, 16,
+    65853, 640, 65839, 40, 377, 16, 370, 2048, 65906, 4096, 398, 192, 308, 16, 131380, 0,
+    308, 256, 314, 16, 374, 256, 325, 16, 65844, 640, 65850, 40, 341, 16, 362, 2048,
+    65898, 4096, 382, 232, 406, 272, 131454, 0, 382, 112, 131454, 0, 131478, 0, 131390, 0,
+    131387, 0, 131439, 0, 131408, 0, 131456, 0, 131448, 0, 131354, 0, 131400, 0, 131411, 0,
+    131438, 0, 131379, 0, 131369, 0, 131445, 0, 131393, 0, 131392, 0, 131367, 0, 131415, 0,
+    131409, 0, 131461, 0, 131363, 0, 131414, 0, 131431, 0, 131377, 0, 131383, 0, 131425, 0,
+    131432, 0, 131437, 0, 131396, 0, 131451, 0, 131407, 0, 131366, 0, 131450, 0, 131394, 0,
+    131440, 0, 131370, 0, 131359, 0, 131398, 0, 131319, 0, 131373, 0, 131391, 0, 131384, 0,
+    131372, 0, 131362, 0, 131406, 0, 131443, 0, 131378, 0, 131430, 0, 131376, 0, 131368, 0,
+    131441, 0, 131374, 0, 131381, 0, 131435, 0, 131365, 0, 131382, 0, 131401, 0, 131423, 0,
+    131385, 0, 131399, 0, 131388, 0, 131444, 0, 131442, 0, 131449, 0, 131389, 0, 131375, 0,
+    131395, 0, 131364, 0, 131424, 0, 131429, 0, 131455, 0, 131434, 0, 131413, 0, 131380, 0,
+    131386, 0, 131446, 0, 131397, 0, 131470, 0, 131436, 0, 131463, 0, 131410, 0, 131447, 0,
+    131412, 0, 131416, 0, 131360, 0, 131361, 0, 131417, 0, 131352, 0, 131402, 0, 330, 304,
+    280, 8, 345, 16, 289, 24, 288, 9, 65824, 18, 344, 152, 340, 5140, 375, 2,
+    338, 256, 391, 6, 364, 8, 398, 14, 325, 8, 65861, 16, 65861, 32, 374, 8,
+    65910, 16, 65910, 32, 314, 8, 65850, 16, 65850, 32, 308, 80, 341, 20, 131386, 0,
+    131397, 0, 131446, 0, 374, 8, 65910, 16, 65910, 32, 325, 8, 314, 48, 362, 72,
+    383, 20, 357, 8, 65850, 96, 65861, 16, 352, 8, 292, 14, 323, 8, 65859, 16,
+    65859, 32, 303, 8, 65839, 16, 65839, 32, 317, 8, 65853, 16, 65853, 32, 377, 80,
+    370, 20, 131389, 0, 131395, 0, 131375, 0, 303, 8, 65839, 16, 65839, 32, 323, 8,
+    317, 48, 65853, 96, 65859, 16, 65888, 16, 372, 14, 316, 8, 65852, 16, 65852, 32,
+    327, 8, 313, 48, 351, 72, 329, 20, 65893, 16, 65849, 96, 65863, 16, 65888, 32,
+    310, 14, 293, 8, 65829, 16, 65829, 32, 363, 8, 309, 48, 65845, 96, 65899, 16,
+    302, 20, 369, 32, 296, 8, 304, 8, 358, 8, 306, 8, 371, 24, 334, 104,
+    290, 8, 300, 8, 312, 8, 319, 12, 301, 56, 247, 20, 326, 32, 131412, 0,
+    131447, 0, 131410, 0, 338, 8, 65874, 16, 65824, 27, 65824, 36, 65824, 45, 131371, 0,
+    299, 29, 375, 30, 340, 116, 287, 116, 131359, 0, 131412, 0, 131371, 0, 299, 232,
+    340, 272, 131371, 0, 299, 112, 131371, 0, 131412, 0, 340, 232, 131412, 0, 131433, 0,
+    361, 33, 340, 34, 299, 132, 287, 132, 131359, 0, 131371, 0, 131433, 0, 361, 8,
+    299, 8, 287, 8, 298, 24, 368, 104, 322, 8, 378, 8, 294, 8, 335, 12,
+    379, 56, 324, 192, 365, 16, 131437, 0, 365, 256, 360, 16, 353, 256, 311, 16,
+    65901, 640, 65896, 40, 65889, 640, 65847, 40, 65901, 1216, 65896, 76, 65901, 2080, 65896, 130,
+    305, 16, 359, 2048, 65895, 4096, 65895, 8192, 342, 192, 291, 16, 131363, 0, 291, 256,
+    389, 16, 337, 256, 343, 16, 65827, 640, 65925, 40, 65873, 640, 65879, 40, 65827, 1216,
+    65925, 76, 65827, 2080, 65925, 130, 295, 16, 320, 2048, 65856, 4096, 65856, 8192, 65874, 32,
+    321, 192, 373, 256, 297, 16, 307, 256, 366, 16, 65909, 640, 65833, 40, 339, 16,
+    328, 2048, 65864, 4096, 282, 192, 376, 16, 131448, 0, 376, 256, 384, 16, 336, 256,
+    367, 16, 65912, 640, 65920, 40, 315, 16, 318, 2048, 65854, 4096, 406, 232, 382, 272,
+    131478, 0, 406, 112, 131478, 0, 131454, 0, 131441, 0, 131374, 0, 131368, 0, 131470, 0,
+    131413, 0, 131380, 0, 131366, 0, 131446, 0, 131450, 0, 131386, 0, 131397, 0, 131394, 0,
+    131364, 0, 131442, 0, 131449, 0, 131384, 0, 131375, 0, 131372, 0, 131389, 0, 131395, 0,
+    131362, 0, 131444, 0, 131359, 0, 131388, 0, 131371, 0, 131385, 0, 131399, 0, 131433, 0,
+    131382, 0, 131378, 0, 131365, 0, 131430, 0, 131381, 0, 131435, 0, 131376, 0, 131424, 0,
+    131463, 0, 131436, 0, 131455, 0, 131434, 0, 131401, 0, 131423, 0, 131429, 0, 131431, 0,
+    131377, 0, 131437, 0, 131432, 0, 131425, 0, 131383, 0, 131396, 0, 131406, 0, 131443, 0,
+    131392, 0, 131367, 0, 131363, 0, 131461, 0, 131409, 0, 131415, 0, 131414, 0, 131440, 0,
+    131370, 0, 131400, 0, 131411, 0, 131445, 0, 131369, 0, 131379, 0, 131438, 0, 131393, 0,
+    131373, 0, 131391, 0, 131390, 0, 131387, 0, 131448, 0, 131456, 0, 131408, 0, 131439, 0,
+    131354, 0, 131451, 0, 131407, 0, 131398, 0, 131319, 0, 131410, 0, 131360, 0, 131361, 0,
+    131417, 0, 131416, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 344, 16, 345, 24,
+    289, 9, 65825, 18, 288, 152, 338, 5140, 247, 2, 326, 256, 335, 6, 379, 8,
+    282, 14, 367, 8, 65903, 16, 65903, 32, 336, 8, 65872, 16, 65872, 32, 384, 8,
+    65920, 16, 65920, 32, 376, 80, 315, 20, 131456, 0, 131439, 0, 131408, 0, 336, 8,
+    65872, 16, 65872, 32, 367, 8, 384, 48, 318, 72, 319, 20, 301, 8, 65920, 96,
+    65903, 16, 321, 8, 366, 14, 307, 8, 65843, 16, 65843, 32, 297, 8, 65833, 16,
+    65833, 32, 373, 8, 65909, 16, 65909, 32, 339, 80, 328, 20, 131445, 0, 131379, 0,
+    131369, 0, 297, 8, 65833, 16, 65833, 32, 307, 8, 373, 48, 65909, 96, 65843, 16,
+    65857, 16, 298, 14, 368, 8, 65904, 16, 65904, 32, 342, 8, 343, 48, 337, 72,
+    389, 20, 65837, 16, 65879, 96, 65878, 16, 65857, 32, 291, 14, 295, 8, 65831, 16,
+    65831, 32, 320, 8, 371, 48, 65907, 96, 65856, 16, 334, 20, 324, 32, 311, 8,
+    353, 8, 360, 8, 365, 8, 305, 24, 359, 104, 357, 8, 351, 8, 329, 8,
+    362, 12, 383, 56, 364, 20, 391, 32, 131410, 0, 131319, 0, 131398, 0, 326, 8,
+    65862, 16, 65825, 27, 65825, 36, 65825, 45, 131447, 0, 375, 29, 247, 30, 338, 116,
+    352, 116, 131424, 0, 131410, 0, 131447, 0, 375, 232, 338, 272, 131447, 0, 375, 112,
+    131447, 0, 131410, 0, 338, 232, 131410, 0, 131412, 0, 340, 33, 338, 34, 375, 132,
+    352, 132, 131424, 0, 131447, 0, 131412, 0, 340, 8, 375, 8, 352, 8, 304, 24,
+    363, 104, 309, 8, 358, 8, 293, 8, 306, 12, 310, 56, 361, 192, 327, 16,
+    131399, 0, 327, 256, 313, 16, 299, 256, 316, 16, 65863, 640, 65849, 40, 65835, 640,
+    65852, 40, 65863, 1216, 65849, 76, 65863, 2080, 65849, 130, 287, 16, 372, 2048, 65908, 4096,
+    65908, 8192, 290, 192, 323, 16, 131395, 0, 323, 256, 317, 16, 300, 256, 303, 16,
+    65859, 640, 65853, 40, 65836, 640, 65839, 40, 65859, 1216, 65853, 76, 65859, 2080, 65853, 130,
+    312, 16, 377, 2048, 65913, 4096, 65913, 8192, 65862, 32, 370, 192, 292, 256, 322, 16,
+    325, 256, 314, 16, 65828, 640, 65858, 40, 378, 16, 374, 2048, 65910, 4096, 294, 192,
+    308, 16, 131380, 0, 308, 256, 341, 16, 398, 256, 296, 16, 65844, 640, 65877, 40,
+    302, 16, 369, 2048, 65905, 4096, 382, 232, 406, 272, 131454, 0, 382, 112, 131454, 0,
+    131478, 0, 131396, 0, 131406, 0, 131383, 0, 131354, 0, 131387, 0, 131448, 0, 131365, 0,
+    131408, 0, 131430, 0, 131456, 0, 131439, 0, 131381, 0, 131438, 0, 131400, 0, 131411, 0,
+    131401, 0, 131369, 0, 131423, 0, 131445, 0, 131379, 0, 131429, 0, 131370, 0, 131424, 0,
+    131440, 0, 131447, 0, 131415, 0, 131414, 0, 131412, 0, 131363, 0, 131437, 0, 131367, 0,
+    131432, 0, 131443, 0, 131392, 0, 131425, 0, 131393, 0, 131407, 0, 131451, 0, 131391, 0,
+    131390, 0, 131461, 0, 131409, 0, 131373, 0, 131444, 0, 131359, 0, 131399, 0, 131385, 0,
+    131371, 0, 131388, 0, 131433, 0, 131431, 0, 131377, 0, 131449, 0, 131384, 0, 131395, 0,
+    131389, 0, 131372, 0, 131375, 0, 131362, 0, 131435, 0, 131376, 0, 131446, 0, 131450, 0,
+    131364, 0, 131394, 0, 131397, 0, 131386, 0, 131442, 0, 131455, 0, 131434, 0, 131441, 0,
+    131374, 0, 131380, 0, 131413, 0, 131470, 0, 131368, 0, 131366, 0, 131382, 0, 131378, 0,
+    131463, 0, 131436, 0, 131398, 0, 131361, 0, 131417, 0, 131416, 0, 131360, 0, 131352, 0,
+    131402, 0, 330, 304, 280, 8, 288, 16, 344, 24, 345, 9, 65881, 18, 289, 152,
+    326, 5140, 364, 2, 391, 256, 306, 6, 310, 8, 294, 14, 296, 8, 65832, 16,
+    65832, 32, 398, 8, 65934, 16, 65934, 32, 341, 8, 65877, 16, 65877, 32, 308, 80,
+    302, 20, 131413, 0, 131368, 0, 131470, 0, 398, 8, 65934, 16, 65934, 32, 296, 8,
+    341, 48, 369, 72, 362, 20, 383, 8, 65877, 96, 65832, 16, 370, 8, 314, 14,
+    325, 8, 65861, 16, 65861, 32, 322, 8, 65858, 16, 65858, 32, 292, 8, 65828, 16,
+    65828, 32, 378, 80, 374, 20, 131364, 0, 131397, 0, 131394, 0, 322, 8, 65858, 16,
+    65858, 32, 325, 8, 292, 48, 65828, 96, 65861, 16, 65906, 16, 304, 14, 363, 8,
+    65899, 16, 65899, 32, 290, 8, 303, 48, 300, 72, 317, 20, 65919, 16, 65839, 96,
+    65826, 16, 65906, 32, 323, 14, 312, 8, 65848, 16, 65848, 32, 377, 8, 305, 48,
+    65841, 96, 65913, 16, 359, 20, 361, 32, 316, 8, 299, 8, 313, 8, 327, 8,
+    287, 24, 372, 104, 301, 8, 337, 8, 389, 8, 318, 12, 319, 56, 379, 20,
+    335, 32, 131398, 0, 131436, 0, 131463, 0, 391, 8, 65927, 16, 65881, 27, 65881, 36,
+    65881, 45, 131319, 0, 247, 29, 364, 30, 326, 116, 321, 116, 131393, 0, 131398, 0,
+    131319, 0, 247, 232, 326, 272, 131319, 0, 247, 112, 131319, 0, 131398, 0, 326, 232,
+    131398, 0, 131410, 0, 338, 33, 326, 34, 247, 132, 321, 132, 131393, 0, 131319, 0,
+    131410, 0, 338, 8, 247, 8, 321, 8, 353, 24, 320, 104, 371, 8, 360, 8,
+    295, 8, 365, 12, 291, 56, 340, 192, 342, 16, 131414, 0, 342, 256, 343, 16,
+    375, 256, 368, 16, 65878, 640, 65879, 40, 65911, 640, 65904, 40, 65878, 1216, 65879, 76,
+    65878, 2080, 65879, 130, 352, 16, 298, 2048, 65834, 4096, 65834, 8192, 357, 192, 307, 16,
+    131379, 0, 307, 256, 373, 16, 351, 256, 297, 16, 65843, 640, 65909, 40, 65887, 640,
+    65833, 40, 65843, 1216, 65909, 76, 65843, 2080, 65909, 130, 329, 16, 339, 2048, 65875, 4096,
+    65875, 8192, 65927, 32, 328, 192, 366, 256, 309, 16, 367, 256, 384, 16, 65902, 640,
+    65845, 40, 358, 16, 336, 2048, 65872, 4096, 293, 192, 376, 16, 131448, 0, 376, 256,
+    315, 16, 282, 256, 311, 16, 65912, 640, 65851, 40, 334, 16, 324, 2048, 65860, 4096,
+    406, 232, 382, 272, 131478, 0, 406, 112, 131478, 0, 131454, 0, 131433, 0, 131431, 0,
+    131388, 0, 131366, 0, 131374, 0, 131380, 0, 131367, 0, 131470, 0, 131432, 0, 131413, 0,
+    131368, 0, 131443, 0, 131386, 0, 131446, 0, 131450, 0, 131461, 0, 131394, 0, 131409, 0,
+    131364, 0, 131397, 0, 131373, 0, 131376, 0, 131393, 0, 131435, 0, 131319, 0, 131375, 0,
+    131362, 0, 131410, 0, 131395, 0, 131399, 0, 131384, 0, 131385, 0, 131377, 0, 131449, 0,
+    131371, 0, 131442, 0, 131378, 0, 131382, 0, 131434, 0, 131441, 0, 131389, 0, 131372, 0,
+    131455, 0, 131370, 0, 131424, 0, 131414, 0, 131415, 0, 131447, 0, 131440, 0, 131412, 0,
+    131444, 0, 131359, 0, 131411, 0, 131401, 0, 131379, 0, 131445, 0, 131423, 0, 131369, 0,
+    131429, 0, 131392, 0, 131425, 0, 131408, 0, 131430, 0, 131438, 0, 131381, 0, 131439, 0,
+    131456, 0, 131400, 0, 131391, 0, 131390, 0, 131396, 0, 131406, 0, 131448, 0, 131387, 0,
+    131354, 0, 131383, 0, 131365, 0, 131363, 0, 131437, 0, 131407, 0, 131451, 0, 131463, 0,
+    131417, 0, 131416, 0, 131360, 0, 131361, 0, 131352, 0, 131402, 0, 330, 304, 280, 8,
+    289, 16, 288, 24, 344, 9, 65880, 18, 345, 152, 391, 5140, 379, 2, 335, 256,
+    365, 6, 291, 8, 293, 14, 311, 8, 65847, 16, 65847, 32, 282, 8, 65818, 16,
+    65818, 32, 315, 8, 65851, 16, 65851, 32, 376, 80, 334, 20, 131387, 0, 131383, 0,
+    131354, 0, 282, 8, 65818, 16, 65818, 32, 311, 8, 315, 48, 324, 72, 318, 20,
+    319, 8, 65851, 96, 65847, 16, 328, 8, 384, 14, 367, 8, 65903, 16, 65903, 32,
+    309, 8, 65845, 16, 65845, 32, 366, 8, 65902, 16, 65902, 32, 358, 80, 336, 20,
+    131438, 0, 131439, 0, 131381, 0, 309, 8, 65845, 16, 65845, 32, 367, 8, 366, 48,
+    65902, 96, 65903, 16, 65864, 16, 353, 14, 320, 8, 65856, 16, 65856, 32, 357, 8,
+    297, 48, 351, 72, 373, 20, 65855, 16, 65833, 96, 65893, 16, 65864, 32, 307, 14,
+    329, 8, 65865, 16, 65865, 32, 339, 8, 287, 48, 65823, 96, 65875, 16, 372, 20,
+    340, 32, 368, 8, 375, 8, 343, 8, 342, 8, 352, 24, 298, 104, 383, 8,
+    300, 8, 317, 8, 369, 12, 362, 56, 310, 20, 306, 32, 131463, 0, 131451, 0,
+    131407, 0, 335, 8, 65871, 16, 65880, 27, 65880, 36, 65880, 45, 131436, 0, 364, 29,
+    379, 30, 391, 116, 370, 116, 131442, 0, 131463, 0, 131436, 0, 364, 232, 391, 272,
+    131436, 0, 364, 112, 131436, 0, 131463, 0, 391, 232, 131463, 0, 131398, 0, 326, 33,
+    391, 34, 364, 132, 370, 132, 131442, 0, 131436, 0, 131398, 0, 326, 8, 364, 8,
+    370, 8, 299, 24, 377, 104, 305, 8, 313, 8, 312, 8, 327, 12, 323, 56,
+    338, 192, 290, 16, 131362, 0, 290, 256, 303, 16, 247, 256, 363, 16, 65826, 640,
+    65839, 40, 65783, 640, 65899, 40, 65826, 1216, 65839, 76, 65826, 2080, 65839, 130, 321, 16,
+    304, 2048, 65840, 4096, 65840, 8192, 301, 192, 325, 16, 131397, 0, 325, 256, 292, 16,
+    337, 256, 322, 16, 65861, 640, 65828, 40, 65873, 640, 65858, 40, 65861, 1216, 65828, 76,
+    65861, 2080, 65828, 130, 389, 16, 378, 2048, 65914, 4096, 65914, 8192, 65871, 32, 374, 192,
+    314, 256, 371, 16, 296, 256, 341, 16, 65850, 640, 65907, 40, 360, 16, 398, 2048,
+    65934, 4096, 295, 192, 308, 16, 131380, 0, 308, 256, 302, 16, 294, 256, 316, 16,
+    65844, 640, 65838, 40, 359, 16, 361, 2048, 65897, 4096, 382, 232, 406, 272, 131454, 0,
+    382, 112, 131454, 0, 131478, 0, 131412, 0, 131444, 0, 131440, 0, 131365, 0, 131406, 0,
+    131448, 0, 131384, 0, 131354, 0, 131385, 0, 131387, 0, 131383, 0, 131377, 0, 131456, 0,
+    131408, 0, 131430, 0, 131389, 0, 131381, 0, 131372, 0, 131438, 0, 131439, 0, 131455, 0,
+    131425, 0, 131442, 0, 131392, 0, 131436, 0, 131369, 0, 131429, 0, 131398, 0, 131379, 0,
+    131414, 0, 131401, 0, 131415, 0, 131359, 0, 131411, 0, 131447, 0, 131400, 0, 131437, 0,
+    131363, 0, 131390, 0, 131396, 0, 131445, 0, 131423, 0, 131391, 0, 131376, 0, 131393, 0,
+    131362, 0, 131375, 0, 131319, 0, 131435, 0, 131410, 0, 131370, 0, 131424, 0, 131450, 0,
+    131461, 0, 131397, 0, 131364, 0, 131409, 0, 131394, 0, 131373, 0, 131449, 0, 131371, 0,
+    131470, 0, 131432, 0, 131386, 0, 131443, 0, 131368, 0, 131413, 0, 131446, 0, 131434, 0,
+    131441, 0, 131433, 0, 131431, 0, 131380, 0, 131374, 0, 131366, 0, 131388, 0, 131367, 0,
+    131395, 0, 131399, 0, 131378, 0, 131382, 0, 131407, 0, 131416, 0, 131360, 0, 131361, 0,
+    131417, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 345, 16, 289, 24, 288, 9,
+    65824, 18, 344, 152, 335, 5140, 310, 2, 306, 256, 327, 6, 323, 8, 295, 14,
+    316, 8, 65852, 16, 65852, 32, 294, 8, 65830, 16, 65830, 32, 302, 8, 65838, 16,
+    65838, 32, 308, 80, 359, 20, 131374, 0, 131388, 0, 131366, 0, 294, 8, 65830, 16,
+    65830, 32, 316, 8, 302, 48, 361, 72, 369, 20, 362, 8, 65838, 96, 65852, 16,
+    374, 8, 341, 14, 296, 8, 65832, 16, 65832, 32, 371, 8, 65907, 16, 65907, 32,
+    314, 8, 65850, 16, 65850, 32, 360, 80, 398, 20, 131386, 0, 131368, 0, 131443, 0,
+    371, 8, 65907, 16, 65907, 32, 296, 8, 314, 48, 65850, 96, 65832, 16, 65910, 16,
+    299, 14, 377, 8, 65913, 16, 65913, 32, 301, 8, 322, 48, 337, 72, 292, 20,
+    65898, 16, 65858, 96, 65837, 16, 65910, 32, 325, 14, 389, 8, 65925, 16, 65925, 32,
+    378, 8, 352, 48, 65888, 96, 65914, 16, 298, 20, 338, 32, 363, 8, 247, 8,
+    303, 8, 290, 8, 321, 24, 304, 104, 319, 8, 351, 8, 373, 8, 324, 12,
+    318, 56, 291, 20, 365, 32, 131407, 0, 131382, 0, 131378, 0, 306, 8, 65842, 16,
+    65824, 27, 65824, 36, 65824, 45, 131451, 0, 379, 29, 310, 30, 335, 116, 328, 116,
+    131400, 0, 131407, 0, 131451, 0, 379, 232, 335, 272, 131451, 0, 379, 112, 131451, 0,
+    131407, 0, 335, 232, 131407, 0, 131463, 0, 391, 33, 335, 34, 379, 132, 328, 132,
+    131400, 0, 131451, 0, 131463, 0, 391, 8, 379, 8, 328, 8, 375, 24, 339, 104,
+    287, 8, 343, 8, 329, 8, 342, 12, 307, 56, 326, 192, 357, 16, 131429, 0,
+    357, 256, 297, 16, 364, 256, 320, 16, 65893, 640, 65833, 40, 65900, 640, 65856, 40,
+    65893, 1216, 65833, 76, 65893, 2080, 65833, 130, 370, 16, 353, 2048, 65889, 4096, 65889, 8192,
+    383, 192, 367, 16, 131439, 0, 367, 256, 366, 16, 300, 256, 309, 16, 65903, 640,
+    65902, 40, 65836, 640, 65845, 40, 65903, 1216, 65902, 76, 65903, 2080, 65902, 130, 317, 16,
+    358, 2048, 65894, 4096, 65894, 8192, 65842, 32, 336, 192, 384, 256, 305, 16, 311, 256,
+    315, 16, 65920, 640, 65841, 40, 313, 16, 282, 2048, 65818, 4096, 312, 192, 376, 16,
+    131448, 0, 376, 256, 334, 16, 293, 256, 368, 16, 65912, 640, 65870, 40, 372, 16,
+    340, 2048, 65876, 4096, 406, 232, 382, 272, 131478, 0, 406, 112, 131478, 0, 131454, 0,
+    131410, 0, 131370, 0, 131435, 0, 131367, 0, 131431, 0, 131380, 0, 131401, 0, 131366, 0,
+    131415, 0, 131374, 0, 131388, 0, 131359, 0, 131413, 0, 131470, 0, 131432, 0, 131445, 0,
+    131443, 0, 131423, 0, 131386, 0, 131368, 0, 131391, 0, 131371, 0, 131400, 0, 131449, 0,
+    131451, 0, 131394, 0, 131373, 0, 131463, 0, 131397, 0, 131362, 0, 131461, 0, 131375, 0,
+    131424, 0, 131450, 0, 131319, 0, 131446, 0, 131399, 0, 131395, 0, 131441, 0, 131433, 0,
+    131364, 0, 131409, 0, 131434, 0, 131425, 0, 131442, 0, 131429, 0, 131369, 0, 131436, 0,
+    131392, 0, 131398, 0, 131376, 0, 131393, 0, 131430, 0, 131389, 0, 131439, 0, 131438, 0,
+    131372, 0, 131381, 0, 131455, 0, 131411, 0, 131447, 0, 131354, 0, 131385, 0, 131456, 0,
+    131377, 0, 131383, 0, 131387, 0, 131408, 0, 131390, 0, 131396, 0, 131412, 0, 131444, 0,
+    131448, 0, 131406, 0, 131365, 0, 131440, 0, 131384, 0, 131379, 0, 131414, 0, 131437, 0,
+    131363, 0, 131378, 0, 131360, 0, 131361, 0, 131417, 0, 131416, 0, 131352, 0, 131402, 0,
+    330, 304, 280, 8, 344, 16, 345, 24, 289, 9, 65825, 18, 288, 152, 306, 5140,
+    291, 2, 365, 256, 342, 6, 307, 8, 312, 14, 368, 8, 65904, 16, 65904, 32,
+    293, 8, 65829, 16, 65829, 32, 334, 8, 65870, 16, 65870, 32, 376, 80, 372, 20,
+    131406, 0, 131440, 0, 131365, 0, 293, 8, 65829, 16, 65829, 32, 368, 8, 334, 48,
+    340, 72, 324, 20, 318, 8, 65870, 96, 65904, 16, 336, 8, 315, 14, 311, 8,
+    65847, 16, 65847, 32, 305, 8, 65841, 16, 65841, 32, 384, 8, 65920, 16, 65920, 32,
+    313, 80, 282, 20, 131456, 0, 131383, 0, 131377, 0, 305, 8, 65841, 16, 65841, 32,
+    311, 8, 384, 48, 65920, 96, 65847, 16, 65872, 16, 375, 14, 339, 8, 65875, 16,
+    65875, 32, 383, 8, 309, 48, 300, 72, 366, 20, 65854, 16, 65845, 96, 65919, 16,
+    65872, 32, 367, 14, 317, 8, 65853, 16, 65853, 32, 358, 8, 321, 48, 65857, 96,
+    65894, 16, 304, 20, 326, 32, 320, 8, 364, 8, 297, 8, 357, 8, 370, 24,
+    353, 104, 362, 8, 337, 8, 292, 8, 361, 12, 369, 56, 323, 20, 327, 32,
+    131378, 0, 131363, 0, 131437, 0, 365, 8, 65901, 16, 65825, 27, 65825, 36, 65825, 45,
+    131382, 0, 310, 29, 291, 30, 306, 116, 374, 116, 131446, 0, 131378, 0, 131382, 0,
+    310, 232, 306, 272, 131382, 0, 310, 112, 131382, 0, 131378, 0, 306, 232, 131378, 0,
+    131407, 0, 335, 33, 306, 34, 310, 132, 374, 132, 131446, 0, 131382, 0, 131407, 0,
+    335, 8, 310, 8, 374, 8, 247, 24, 378, 104, 352, 8, 303, 8, 389, 8,
+    290, 12, 325, 56, 391, 192, 301, 16, 131373, 0, 301, 256, 322, 16, 379, 256,
+    377, 16, 65837, 640, 65858, 40, 65915, 640, 65913, 40, 65837, 1216, 65858, 76, 65837, 2080,
+    65858, 130, 328, 16, 299, 2048, 65835, 4096, 65835, 8192, 319, 192, 296, 16, 131368, 0,
+    296, 256, 314, 16, 351, 256, 371, 16, 65832, 640, 65850, 40, 65887, 640, 65907, 40,
+    65832, 1216, 65850, 76, 65832, 2080, 65850, 130, 373, 16, 360, 2048, 65896, 4096, 65896, 8192,
+    65901, 32, 398, 192, 341, 256, 287, 16, 316, 256, 302, 16, 65877, 640, 65823, 40,
+    343, 16, 294, 2048, 65830, 4096, 329, 192, 308, 16, 131380, 0, 308, 256, 359, 16,
+    295, 256, 363, 16, 65844, 640, 65895, 40, 298, 16, 338, 2048, 65874, 4096, 382, 232,
+    406, 272, 131454, 0, 382, 112, 131454, 0, 131478, 0, 131398, 0, 131376, 0, 131392, 0,
+    131384, 0, 131444, 0, 131448, 0, 131461, 0, 131365, 0, 131375, 0, 131406, 0, 131440, 0,
+    131424, 0, 131387, 0, 131354, 0, 131385, 0, 131364, 0, 131377, 0, 131409, 0, 131456, 0,
+    131383, 0, 131434, 0, 131447, 0, 131446, 0, 131411, 0, 131382, 0, 131381, 0, 131455, 0,
+    131407, 0, 131439, 0, 131429, 0, 131389, 0, 131369, 0, 131393, 0, 131430, 0, 131436, 0,
+    131408, 0, 131414, 0, 131379, 0, 131396, 0, 131412, 0, 131438, 0, 131372, 0, 131390, 0,
+    131371, 0, 131400, 0, 131373, 0, 131394, 0, 131451, 0, 131449, 0, 131463, 0, 131425, 0,
+    131442, 0, 131432, 0, 131445, 0, 131368, 0, 131386, 0, 131423, 0, 131443, 0, 131391, 0,
+    131450, 0, 131319, 0, 131366, 0, 131415, 0, 131413, 0, 131359, 0, 131388, 0, 131374, 0,
+    131470, 0, 131441, 0, 131433, 0, 131410, 0, 131370, 0, 131380, 0, 131431, 0, 131367, 0,
+    131435, 0, 131401, 0, 131397, 0, 131362, 0, 131399, 0, 131395, 0, 131437, 0, 131361, 0,
+    131417, 0, 131416, 0, 131360, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 288, 16,
+    344, 24, 345, 9, 65881, 18, 289, 152, 365, 5140, 323, 2, 327, 256, 290, 6,
+    325, 8, 329, 14, 363, 8, 65899, 16, 65899, 32, 295, 8, 65831, 16, 65831, 32,
+    359, 8, 65895, 16, 65895, 32, 308, 80, 298, 20, 131431, 0, 131435, 0, 131367, 0,
+    295, 8, 65831, 16, 65831, 32, 363, 8, 359, 48, 338, 72, 361, 20, 369, 8,
+    65895, 96, 65899, 16, 398, 8, 302, 14, 316, 8, 65852, 16, 65852, 32, 287, 8,
+    65823, 16, 65823, 32, 341, 8, 65877, 16, 65877, 32, 343, 80, 294, 20, 131413, 0,
+    131388, 0, 131359, 0, 287, 8, 65823, 16, 65823, 32, 316, 8, 341, 48, 65877, 96,
+    65852, 16, 65934, 16, 247, 14, 378, 8, 65914, 16, 65914, 32, 319, 8, 371, 48,
+    351, 72, 314, 20, 65905, 16, 65907, 96, 65855, 16, 65934, 32, 296, 14, 373, 8,
+    65909, 16, 65909, 32, 360, 8, 370, 48, 65906, 96, 65896, 16, 353, 20, 391, 32,
+    377, 8, 379, 8, 322, 8, 301, 8, 328, 24, 299, 104, 318, 8, 300, 8,
+    366, 8, 340, 12, 324, 56, 307, 20, 342, 32, 131437, 0, 131395, 0, 131399, 0,
+    327, 8, 65863, 16, 65881, 27, 65881, 36, 65881, 45, 131363, 0, 291, 29, 323, 30,
+    365, 116, 336, 116, 131408, 0, 131437, 0, 131363, 0, 291, 232, 365, 272, 131363, 0,
+    291, 112, 131363, 0, 131437, 0, 365, 232, 131437, 0, 131378, 0, 306, 33, 365, 34,
+    291, 132, 336, 132, 131408, 0, 131363, 0, 131378, 0, 306, 8, 291, 8, 336, 8,
+    364, 24, 358, 104, 321, 8, 297, 8, 317, 8, 357, 12, 367, 56, 335, 192,
+    383, 16, 131455, 0, 383, 256, 309, 16, 310, 256, 339, 16, 65919, 640, 65845, 40,
+    65846, 640, 65875, 40, 65919, 1216, 65845, 76, 65919, 2080, 65845, 130, 374, 16, 375, 2048,
+    65911, 4096, 65911, 8192, 362, 192, 311, 16, 131383, 0, 311, 256, 384, 16, 337, 256,
+    305, 16, 65847, 640, 65920, 40, 65873, 640, 65841, 40, 65847, 1216, 65920, 76, 65847, 2080,
+    65920, 130, 292, 16, 313, 2048, 65849, 4096, 65849, 8192, 65863, 32, 282, 192, 315, 256,
+    352, 16, 368, 256, 334, 16, 65851, 640, 65888, 40, 303, 16, 293, 2048, 65829, 4096,
+    389, 192, 376, 16, 131448, 0, 376, 256, 372, 16, 312, 256, 320, 16, 65912, 640,
+    65908, 40, 304, 16, 326, 2048, 65862, 4096, 406, 232, 382, 272, 131478, 0, 406, 112,
+    131478, 0, 131454, 0, 131463, 0, 131425, 0, 131449, 0, 131401, 0, 131370, 0, 131380, 0,
+    131389, 0, 131367, 0, 131369, 0, 131431, 0, 131435, 0, 131393, 0, 131374, 0, 131366, 0,
+    131415, 0, 131438, 0, 131359, 0, 131372, 0, 131413, 0, 131388, 0, 131390, 0, 131319, 0,
+    131408, 0, 131450, 0, 131363, 0, 131443, 0, 131391, 0, 131378, 0, 131368, 0, 131373, 0,
+    131445, 0, 131394, 0, 131442, 0, 131432, 0, 131451, 0, 131470, 0, 131362, 0, 131397, 0,
+    131433, 0, 131410, 0, 131386, 0, 131423, 0, 131441, 0, 131447, 0, 131446, 0, 131455, 0,
+    131381, 0, 131382, 0, 131411, 0, 131407, 0, 131371, 0, 131400, 0, 131385, 0, 131364, 0,
+    131383, 0, 131456, 0, 131409, 0, 131377, 0, 131434, 0, 131430, 0, 131436, 0, 131365, 0,
+    131375, 0, 131387, 0, 131424, 0, 131440, 0, 131406, 0, 131354, 0, 131396, 0, 131412, 0,
+    131398, 0, 131376, 0, 131448, 0, 131444, 0, 131384, 0, 131392, 0, 131461, 0, 131439, 0,
+    131429, 0, 131414, 0, 131379, 0, 131399, 0, 131417, 0, 131416, 0, 131360, 0, 131361, 0,
+    131352, 0, 131402, 0, 330, 304, 280, 8, 289, 16, 288, 24, 344, 9, 65880, 18,
+    345, 152, 327, 5140, 307, 2, 342, 256, 357, 6, 367, 8, 389, 14, 320, 8,
+    65856, 16, 65856, 32, 312, 8, 65848, 16, 65848, 32, 372, 8, 65908, 16, 65908, 32,
+    376, 80, 304, 20, 131444, 0, 131392, 0, 131384, 0, 312, 8, 65848, 16, 65848, 32,
+    320, 8, 372, 48, 326, 72, 340, 20, 324, 8, 65908, 96, 65856, 16, 282, 8,
+    334, 14, 368, 8, 65904, 16, 65904, 32, 352, 8, 65888, 16, 65888, 32, 315, 8,
+    65851, 16, 65851, 32, 303, 80, 293, 20, 131387, 0, 131440, 0, 131424, 0, 352, 8,
+    65888, 16, 65888, 32, 368, 8, 315, 48, 65851, 96, 65904, 16, 65818, 16, 364, 14,
+    358, 8, 65894, 16, 65894, 32, 362, 8, 305, 48, 337, 72, 384, 20, 65860, 16,
+    65841, 96, 65898, 16, 65818, 32, 311, 14, 292, 8, 65828, 16, 65828, 32, 313, 8,
+    328, 48, 65864, 96, 65849, 16, 299, 20, 335, 32, 339, 8, 310, 8, 309, 8,
+    383, 8, 374, 24, 375, 104, 369, 8, 351, 8, 314, 8, 338, 12, 361, 56,
+    325, 20, 290, 32, 131399, 0, 131379, 0, 131414, 0, 342, 8, 65878, 16, 65880, 27,
+    65880, 36, 65880, 45, 131395, 0, 323, 29, 307, 30, 327, 116, 398, 116, 131470, 0,
+    131399, 0, 131395, 0, 323, 232, 327, 272, 131395, 0, 323, 112, 131395, 0, 131399, 0,
+    327, 232, 131399, 0, 131437, 0, 365, 33, 327, 34, 323, 132, 398, 132, 131470, 0,
+    131395, 0, 131437, 0, 365, 8, 323, 8, 398, 8, 379, 24, 360, 104, 370, 8,
+    322, 8, 373, 8, 301, 12, 296, 56, 306, 192, 319, 16, 131391, 0, 319, 256,
+    371, 16, 291, 256, 378, 16, 65855, 640, 65907, 40, 65827, 640, 65914, 40, 65855, 1216,
+    65907, 76, 65855, 2080, 65907, 130, 336, 16, 247, 2048, 65783, 4096, 65783, 8192, 318, 192,
+    316, 16, 131388, 0, 316, 256, 341, 16, 300, 256, 287, 16, 65852, 640, 65877, 40,
+    65836, 640, 65823, 40, 65852, 1216, 65877, 76, 65852, 2080, 65877, 130, 366, 16, 343, 2048,
+    65879, 4096, 65879, 8192, 65878, 32, 294, 192, 302, 256, 321, 16, 363, 256, 359, 16,
+    65838, 640, 65857, 40, 297, 16, 295, 2048, 65831, 4096, 317, 192, 308, 16, 131380, 0,
+    308, 256, 298, 16, 329, 256, 377, 16, 65844, 640, 65834, 40, 353, 16, 391, 2048,
+    65927, 4096, 382, 232, 406, 272, 131454, 0, 382, 112, 131454, 0, 131478, 0, 131407, 0,
+    131371, 0, 131411, 0, 131461, 0, 131376, 0, 131448, 0, 131445, 0, 131384, 0, 131394, 0,
+    131444, 0, 131392, 0, 131442, 0, 131406, 0, 131365, 0, 131375, 0, 131386, 0, 131424, 0,
+    131423, 0, 131387, 0, 131440, 0, 131441, 0, 131436, 0, 131470, 0, 131430, 0, 131395, 0,
+    131377, 0, 131434, 0, 131437, 0, 131383, 0, 131455, 0, 131364, 0, 131381, 0, 131400, 0,
+    131385, 0, 131382, 0, 131354, 0, 131429, 0, 131439, 0, 131412, 0, 131398, 0, 131456, 0,
+    131409, 0, 131396, 0, 131319, 0, 131408, 0, 131391, 0, 131443, 0, 131363, 0, 131450, 0,
+    131378, 0, 131447, 0, 131446, 0, 131415, 0, 131438, 0, 131388, 0, 131413, 0, 131372, 0,
+    131359, 0, 131390, 0, 131432, 0, 131451, 0, 131367, 0, 131369, 0, 131374, 0, 131393, 0,
+    131435, 0, 131431, 0, 131366, 0, 131433, 0, 131410, 0, 131463, 0, 131425, 0, 131380, 0,
+    131370, 0, 131401, 0, 131449, 0, 131389, 0, 131368, 0, 131373, 0, 131362, 0, 131397, 0,
+    131414, 0, 131416, 0, 131360, 0, 131361, 0, 131417, 0, 131352, 0, 131402, 0, 330, 304,
+    280, 8, 345, 16, 289, 24, 288, 9, 65824, 18, 344, 152, 342, 5140, 325, 2,
+    290, 256, 301, 6, 296, 8, 317, 14, 377, 8, 65913, 16, 65913, 32, 329, 8,
+    65865, 16, 65865, 32, 298, 8, 65834, 16, 65834, 32, 308, 80, 353, 20, 131370, 0,
+    131449, 0, 131401, 0, 329, 8, 65865, 16, 65865, 32, 377, 8, 298, 48, 391, 72,
+    338, 20, 361, 8, 65834, 96, 65913, 16, 294, 8, 359, 14, 363, 8, 65899, 16,
+    65899, 32, 321, 8, 65857, 16, 65857, 32, 302, 8, 65838, 16, 65838, 32, 297, 80,
+    295, 20, 131374, 0, 131435, 0, 131393, 0, 321, 8, 65857, 16, 65857, 32, 363, 8,
+    302, 48, 65838, 96, 65899, 16, 65830, 16, 379, 14, 360, 8, 65896, 16, 65896, 32,
+    318, 8, 287, 48, 300, 72, 341, 20, 65897, 16, 65823, 96, 65854, 16, 65830, 32,
+    316, 14, 366, 8, 65902, 16, 65902, 32, 343, 8, 374, 48, 65910, 96, 65879, 16,
+    375, 20, 306, 32, 378, 8, 291, 8, 371, 8, 319, 8, 336, 24, 247, 104,
+    324, 8, 337, 8, 384, 8, 326, 12, 340, 56, 367, 20, 357, 32, 131414, 0,
+    131397, 0, 131362, 0, 290, 8, 65826, 16, 65824, 27, 65824, 36, 65824, 45, 131379, 0,
+    307, 29, 325, 30, 342, 116, 282, 116, 131354, 0, 131414, 0, 131379, 0, 307, 232,
+    342, 272, 131379, 0, 307, 112, 131379, 0, 131414, 0, 342, 232, 131414, 0, 131399, 0,
+    327, 33, 342, 34, 307, 132, 282, 132, 131354, 0, 131379, 0, 131399, 0, 327, 8,
+    307, 8, 282, 8, 310, 24, 313, 104, 328, 8, 309, 8, 292, 8, 383, 12,
+    311, 56, 365, 192, 362, 16, 131434, 0, 362, 256, 305, 16, 323, 256, 358, 16,
+    65898, 640, 65841, 40, 65859, 640, 65894, 40, 65898, 1216, 65841, 76, 65898, 2080, 65841, 130,
+    398, 16, 364, 2048, 65900, 4096, 65900, 8192, 369, 192, 368, 16, 131440, 0, 368, 256,
+    315, 16, 351, 256, 352, 16, 65904, 640, 65851, 40, 65887, 640, 65888, 40, 65904, 1216,
+    65851, 76, 65904, 2080, 65851, 130, 314, 16, 303, 2048, 65839, 4096, 65839, 8192, 65826, 32,
+    293, 192, 334, 256, 370, 16, 320, 256, 372, 16, 65870, 640, 65906, 40, 322, 16,
+    312, 2048, 65848, 4096, 373, 192, 376, 16, 131448, 0, 376, 256, 304, 16, 389, 256,
+    339, 16, 65912, 640, 65840, 40, 299, 16, 335, 2048, 65871, 4096, 406, 232, 382, 272,
+    131478, 0, 406, 112, 131478, 0, 131454, 0, 131378, 0, 131447, 0, 131450, 0, 131389, 0,
+    131425, 0, 131380, 0, 131364, 0, 131401, 0, 131381, 0, 131370, 0, 131449, 0, 131400, 0,
+    131431, 0, 131367, 0, 131369, 0, 131456, 0, 131393, 0, 131409, 0, 131374, 0, 131435, 0,
+    131396, 0, 131451, 0, 131354, 0, 131432, 0, 131379, 0, 131359, 0, 131390, 0, 131399, 0,
+    131388, 0, 131391, 0, 131438, 0, 131443, 0, 131446, 0, 131415, 0, 131363, 0, 131366, 0,
+    131373, 0, 131368, 0, 131410, 0, 131463, 0, 131413, 0, 131372, 0, 131433, 0, 131436, 0,
+    131470, 0, 131434, 0, 131377, 0, 131395, 0, 131430, 0, 131437, 0, 131319, 0, 131408, 0,
+    131375, 0, 131386, 0, 131440, 0, 131387, 0, 131423, 0, 131424, 0, 131441, 0, 131385, 0,
+    131382, 0, 131384, 0, 131394, 0, 131406, 0, 131442, 0, 131392, 0, 131444, 0, 131365, 0,
+    131412, 0, 131398, 0, 131407, 0, 131371, 0, 131448, 0, 131376, 0, 131461, 0, 131411, 0,
+    131445, 0, 131383, 0, 131455, 0, 131429, 0, 131439, 0, 131362, 0, 131360, 0, 131361, 0,
+    131417, 0, 131416, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 344, 16, 345, 24,
+    289, 9, 65825, 18, 288, 152, 290, 5140, 367, 2, 357, 256, 383, 6, 311, 8,
+    373, 14, 339, 8, 65875, 16, 65875, 32, 389, 8, 65925, 16, 65925, 32, 304, 8,
+    65840, 16, 65840, 32, 376, 80, 299, 20, 131376, 0, 131411, 0, 131461, 0, 389, 8,
+    65925, 16, 65925, 32, 339, 8, 304, 48, 335, 72, 326, 20, 340, 8, 65840, 96,
+    65875, 16, 293, 8, 372, 14, 320, 8, 65856, 16, 65856, 32, 370, 8, 65906, 16,
+    65906, 32, 334, 8, 65870, 16, 65870, 32, 322, 80, 312, 20, 131406, 0, 131392, 0,
+    131442, 0, 370, 8, 65906, 16, 65906, 32, 320, 8, 334, 48, 65870, 96, 65856, 16,
+    65829, 16, 310, 14, 313, 8, 65849, 16, 65849, 32, 369, 8, 352, 48, 351, 72,
+    315, 20, 65876, 16, 65888, 96, 65905, 16, 65829, 32, 368, 14, 314, 8, 65850, 16,
+    65850, 32, 303, 8, 336, 48, 65872, 96, 65839, 16, 247, 20, 365, 32, 358, 8,
+    323, 8, 305, 8, 362, 8, 398, 24, 364, 104, 361, 8, 300, 8, 341, 8,
+    391, 12, 338, 56, 296, 20, 301, 32, 131362, 0, 131439, 0, 131429, 0, 357, 8,
+    65893, 16, 65825, 27, 65825, 36, 65825, 45, 131397, 0, 325, 29, 367, 30, 290, 116,
+    294, 116, 131366, 0, 131362, 0, 131397, 0, 325, 232, 290, 272, 131397, 0, 325, 112,
+    131397, 0, 131362, 0, 290, 232, 131362, 0, 131414, 0, 342, 33, 290, 34, 325, 132,
+    294, 132, 131366, 0, 131397, 0, 131414, 0, 342, 8, 325, 8, 294, 8, 291, 24,
+    343, 104, 374, 8, 371, 8, 366, 8, 319, 12, 316, 56, 327, 192, 318, 16,
+    131390, 0, 318, 256, 287, 16, 307, 256, 360, 16, 65854, 640, 65823, 40, 65843, 640,
+    65896, 40, 65854, 1216, 65823, 76, 65854, 2080, 65823, 130, 282, 16, 379, 2048, 65915, 4096,
+    65915, 8192, 324, 192, 363, 16, 131435, 0, 363, 256, 302, 16, 337, 256, 321, 16,
+    65899, 640, 65838, 40, 65873, 640, 65857, 40, 65899, 1216, 65838, 76, 65899, 2080, 65838, 130,
+    384, 16, 297, 2048, 65833, 4096, 65833, 8192, 65893, 32, 295, 192, 359, 256, 328, 16,
+    377, 256, 298, 16, 65895, 640, 65864, 40, 309, 16, 329, 2048, 65865, 4096, 292, 192,
+    308, 16, 131380, 0, 308, 256, 353, 16, 317, 256, 378, 16, 65844, 640, 65889, 40,
+    375, 16, 306, 2048, 65842, 4096, 382, 232, 406, 272, 131454, 0, 382, 112, 131454, 0,
+    131478, 0, 131437, 0, 131319, 0, 131430, 0, 131445, 0, 131371, 0, 131448, 0, 131438, 0,
+    131461, 0, 131443, 0, 131376, 0, 131411, 0, 131446, 0, 131444, 0, 131384, 0, 131394, 0,
+    131413, 0, 131442, 0, 131372, 0, 131406, 0, 131392, 0, 131433, 0, 131382, 0, 131366, 0,
+    131385, 0, 131397, 0, 131424, 0, 131441, 0, 131414, 0, 131440, 0, 131434, 0, 131386, 0,
+    131377, 0, 131408, 0, 131375, 0, 131395, 0, 131365, 0, 131455, 0, 131383, 0, 131398, 0,
+    131407, 0, 131387, 0, 131423, 0, 131412, 0, 131451, 0, 131354, 0, 131390, 0, 131359, 0,
+    131379, 0, 131432, 0, 131399, 0, 131436, 0, 131470, 0, 131369, 0, 131456, 0, 131435, 0,
+    131374, 0, 131409, 0, 131393, 0, 131396, 0, 131415, 0, 131363, 0, 131401, 0, 131381, 0,
+    131431, 0, 131400, 0, 131449, 0, 131370, 0, 131367, 0, 131410, 0, 131463, 0, 131378, 0,
+    131447, 0, 131380, 0, 131425, 0, 131389, 0, 131450, 0, 131364, 0, 131388, 0, 131391, 0,
+    131373, 0, 131368, 0, 131429, 0, 131361, 0, 131417, 0, 131416, 0, 131360, 0, 131352, 0,
+    131402, 0, 330, 304, 280, 8, 288, 16, 344, 24, 345, 9, 65881, 18, 289, 152,
+    357, 5140, 296, 2, 301, 256, 319, 6, 316, 8, 292, 14, 378, 8, 65914, 16,
+    65914, 32, 317, 8, 65853, 16, 65853, 32, 353, 8, 65889, 16, 65889, 32, 308, 80,
+    375, 20, 131425, 0, 131450, 0, 131389, 0, 317, 8, 65853, 16, 65853, 32, 378, 8,
+    353, 48, 306, 72, 391, 20, 338, 8, 65889, 96, 65914, 16, 295, 8, 298, 14,
+    377, 8, 65913, 16, 65913, 32, 328, 8, 65864, 16, 65864, 32, 359, 8, 65895, 16,
+    65895, 32, 309, 80, 329, 20, 131431, 0, 131449, 0, 131400, 0, 328, 8, 65864, 16,
+    65864, 32, 377, 8, 359, 48, 65895, 96, 65913, 16, 65831, 16, 291, 14, 343, 8,
+    65879, 16, 65879, 32, 324, 8, 321, 48, 337, 72, 302, 20, 65874, 16, 65857, 96,
+    65860, 16, 65831, 32, 363, 14, 384, 8, 65920, 16, 65920, 32, 297, 8, 398, 48,
+    65934, 96, 65833, 16, 364, 20, 327, 32, 360, 8, 307, 8, 287, 8, 318, 8,
+    282, 24, 379, 104, 340, 8, 351, 8, 315, 8, 335, 12, 326, 56, 311, 20,
+    383, 32, 131429, 0, 131368, 0, 131373, 0, 301, 8, 65837, 16, 65881, 27, 65881, 36,
+    65881, 45, 296, 232, 357, 272, 131368, 0, 296, 112, 131368, 0, 131429, 0, 357, 8,
+    296, 8, 293, 8, 323, 24, 303, 104, 336, 8, 305, 8, 314, 8, 362, 12,
+    368, 56, 342, 192, 369, 16, 131441, 0, 369, 256, 352, 16, 325, 256, 313, 16,
+    65905, 640, 65888, 40, 65905, 1216, 65888, 76, 294, 16, 310, 2048, 361, 192, 320, 16,
+    131392, 0, 320, 256, 334, 16, 300, 256, 370, 16, 65856, 640, 65870, 40, 341, 16,
+    322, 2048, 65837, 32, 312, 192, 372, 16, 131444, 0, 372, 256, 374, 16, 339, 256,
+    304, 16, 65908, 640, 65910, 40, 371, 16, 389, 2048, 366, 192, 376, 16, 131448, 0,
+    376, 256, 299, 16, 373, 256, 358, 16, 65912, 640, 65835, 40, 247, 16, 365, 2048,
+    406, 232, 382, 272, 131478, 0, 406, 112, 131478, 0, 131454, 0, 382, 232, 406, 272,
+    131454, 0, 382, 112, 131454, 0, 131478, 0, 406, 30, 131478, 0, 406, 1536000, 382, 24,
+    131454, 0, 382, 4268, 284, 24, 131356, 0, 284, 4268, 388, 1152480, 401, 76, 283, 76,
+    385, 76, 405, 32, 403, 32, 131477, 0, 131475, 0, 403, 2048, 405, 512, 408, 1024,
+    131475, 0, 403, 1152, 404, 128, 395, 1152, 393, 1152, 396, 64, 281, 64, 131468, 0,
+    131353, 0, 281, 2048, 396, 698, 392, 1396, 131353, 0, 281, 128, 387, 128, 399, 64,
+    394, 64, 131471, 0, 131466, 0, 394, 2048, 399, 512, 278, 1024, 131466, 0, 131473, 0,
+    131475, 0, 131476, 0, 131457, 0, 131355, 0, 131477, 0, 131480, 0, 65924, 1728901, 131465, 0,
+    131467, 0, 131468, 0, 131464, 0, 131459, 0, 131353, 0, 131471, 0, 131350, 0, 131356, 0,
+    284, 40, 278, 1536851, 131460, 0, 388, 40, 399, 1536851, 131350, 0, 131356, 0, 131454, 0,
+    131478, 0, 131471, 0, 131460, 0, 131439, 0, 367, 30, 388, 31, 399, 120, 406, 120,
+    131478, 0, 131471, 0, 131439, 0, 367, 232, 131439, 0, 131362, 0, 290, 33, 367, 34,
+    399, 132, 406, 132, 131478, 0, 131471, 0, 131362, 0, 290, 232, 131362, 0, 290, 30,
+    131362, 0, 290, 1536000, 399, 24, 131471, 0, 399, 2248, 406, 24, 131478, 0, 406, 2248,
+    382, 1152480, 284, 76, 278, 76, 281, 76, 387, 32, 392, 32, 131459, 0, 131464, 0,
+    392, 2048, 387, 512, 396, 1024, 131464, 0, 392, 1152, 395, 128, 393, 1152, 408, 1152,
+    405, 64, 283, 64, 131477, 0, 131355, 0, 283, 2048, 405, 512, 385, 1024, 131355, 0,
+    283, 128, 404, 128, 403, 64, 401, 64, 131475, 0, 131473, 0, 401, 2048, 403, 512,
+    394, 1024, 131473, 0, 131356, 0, 131464, 0, 131467, 0, 131353, 0, 131350, 0, 131459, 0,
+    131468, 0, 65918, 1728901, 131480, 0, 131465, 0, 131477, 0, 131457, 0, 131476, 0, 131355, 0,
+    131475, 0, 131466, 0, 131478, 0, 406, 40, 394, 1536851, 131454, 0, 382, 40, 403, 1536851,
+    131466, 0, 131478, 0, 131471, 0, 131362, 0, 131475, 0, 131454, 0, 382, 232, 403, 272,
+    131454, 0, 382, 112, 131454, 0, 131475, 0, 403, 30, 131475, 0, 403, 1536000, 382, 24,
+    131454, 0, 382, 4268, 290, 24, 131362, 0, 290, 4268, 399, 1152480, 406, 76, 394, 76,
+    283, 76, 404, 32, 385, 32, 131476, 0, 131457, 0, 385, 2048, 404, 512, 405, 1024,
+    131457, 0, 385, 1152, 393, 128, 408, 1152, 396, 1152, 387, 64, 278, 64, 131459, 0,
+    131350, 0, 278, 2048, 387, 698, 281, 1396, 131350, 0, 278, 128, 395, 128, 392, 64,
+    284, 64, 131464, 0, 131356, 0, 284, 2048, 392, 512, 401, 1024, 131356, 0, 131478, 0,
+    131457, 0, 131465, 0, 131355, 0, 131466, 0, 131476, 0, 131477, 0, 65935, 1728901, 131468, 0,
+    131480, 0, 131459, 0, 131353, 0, 131467, 0, 131350, 0, 131464, 0, 131473, 0, 131362, 0,
+    290, 40, 401, 1536851, 131471, 0, 399, 40, 392, 1536851, 131473, 0, 131362, 0, 131454, 0,
+    131475, 0, 131464, 0, 131471, 0, 131460, 0, 388, 29, 399, 30, 392, 116, 403, 116,
+    131475, 0, 131464, 0, 131460, 0, 131439, 0, 367, 33, 388, 34, 392, 132, 403, 132,
+    131475, 0, 131464, 0, 131439, 0, 367, 16, 131439, 0, 65861, 640, 65849, 40, 65905, 2080,
+    65888, 130, 65846, 4096, 65846, 8192, 367, 16, 131439, 0, 65836, 640, 65906, 40, 65856, 1216,
+    65870, 76, 65856, 2080, 65870, 130, 65858, 4096, 65858, 8192, 65925, 4096, 367, 16, 131439, 0,
+    65901, 4096, 367, 232, 392, 272, 131439, 0, 367, 112, 131439, 0, 131464, 0, 392, 232,
+    367, 272, 131464, 0, 392, 112, 131464, 0, 131439, 0, 367, 30, 131439, 0, 367, 1536000,
+    392, 24, 131464, 0, 392, 6800, 403, 24, 131475, 0, 403, 6800, 382, 1152480, 290, 76,
+    401, 76, 278, 76, 395, 32, 281, 32, 131467, 0, 131353, 0, 281, 2048, 395, 512,
+    387, 1024, 131353, 0, 281, 1152, 408, 128, 396, 1152, 405, 1152, 404, 64, 394, 64,
+    131476, 0, 131466, 0, 394, 2048, 404, 702, 283, 1404, 131466, 0, 394, 128, 393, 128,
+    385, 64, 406, 64, 131457, 0, 131478, 0, 406, 2048, 385, 514, 284, 1028, 131478, 0,
+    131362, 0, 131353, 0, 131480, 0, 131350, 0, 131473, 0, 131467, 0, 131459, 0, 65918, 1728901,
+    131477, 0, 131468, 0, 131476, 0, 131355, 0, 131465, 0, 131466, 0, 131457, 0, 131356, 0,
+    131475, 0, 403, 40, 284, 1536851, 131454, 0, 382, 40, 385, 1536851, 131356, 0, 131475, 0,
+    131464, 0, 131439, 0, 131457, 0, 131454, 0, 131399, 0, 131436, 0, 131432, 0, 131364, 0,
+    131447, 0, 131380, 0, 131386, 0, 131389, 0, 131377, 0, 131425, 0, 131450, 0, 131408, 0,
+    131370, 0, 131401, 0, 131381, 0, 131387, 0, 131400, 0, 131423, 0, 131431, 0, 131449, 0,
+    131412, 0, 131363, 0, 131365, 0, 131415, 0, 131368, 0, 131393, 0, 131396, 0, 131429, 0,
+    131435, 0, 131390, 0, 131456, 0, 131359, 0, 131470, 0, 131369, 0, 131379, 0, 131367, 0,
+    131391, 0, 131388, 0, 131463, 0, 131378, 0, 131374, 0, 131409, 0, 131410, 0, 131382, 0,
+    131366, 0, 131441, 0, 131424, 0, 131397, 0, 131385, 0, 131414, 0, 131451, 0, 131354, 0,
+    131394, 0, 131413, 0, 131392, 0, 131406, 0, 131372, 0, 131442, 0, 131433, 0, 131375, 0,
+    131395, 0, 131461, 0, 131443, 0, 131444, 0, 131446, 0, 131411, 0, 131376, 0, 131384, 0,
+    131398, 0, 131407, 0, 131437, 0, 131319, 0, 131448, 0, 131371, 0, 131445, 0, 131430, 0,
+    131438, 0, 131440, 0, 131434, 0, 131455, 0, 131383, 0, 131373, 0, 131417, 0, 131416, 0,
+    131360, 0, 131361, 0, 131352, 0, 131402, 0, 330, 304, 280, 8, 289, 16, 288, 24,
+    344, 9, 65880, 18, 345, 152, 301, 5140, 311, 2, 383, 256, 362, 6, 368, 8,
+    366, 14, 358, 8, 65894, 16, 65894, 32, 373, 8, 65909, 16, 65909, 32, 299, 8,
+    65835, 16, 65835, 32, 376, 80, 247, 20, 131371, 0, 131430, 0, 131445, 0, 373, 8,
+    65909, 16, 65909, 32, 358, 8, 299, 48, 365, 72, 335, 20, 326, 8, 65835, 96,
+    65894, 16, 312, 8, 304, 14, 339, 8, 65875, 16, 65875, 32, 374, 8, 65910, 16,
+    65910, 32, 372, 8, 65908, 16, 65908, 32, 371, 80, 389, 20, 131444, 0, 131411, 0,
+    131446, 0, 374, 8, 65910, 16, 65910, 32, 339, 8, 372, 48, 65908, 96, 65875, 16,
+    65848, 16, 323, 14, 303, 8, 65839, 16, 65839, 32, 361, 8, 370, 48, 300, 72,
+    334, 20, 65862, 16, 65906, 96, 65897, 16, 65848, 32, 320, 14, 341, 8, 65877, 16,
+    65877, 32, 322, 8, 282, 48, 65818, 96, 65858, 16, 379, 20, 342, 32, 313, 8,
+    325, 8, 352, 8, 369, 8, 294, 24, 310, 104, 338, 8, 337, 8, 302, 8,
+    306, 12, 391, 56, 316, 20, 319, 32, 131373, 0, 131383, 0, 131455, 0, 383, 8,
+    65919, 16, 65880, 27, 65880, 36, 65880, 45, 311, 72, 65816, 16, 301, 16, 65837, 32,
+    65837, 48, 65837, 64, 295, 24, 307, 9, 65843, 18, 65843, 27, 65843, 36, 65843, 45,
+    65843, 54, 131471, 0, 399, 30, 297, 31, 398, 120, 287, 120, 131359, 0, 131470, 0,
+    131471, 0, 399, 232, 398, 272, 131471, 0, 399, 232, 287, 184, 384, 112, 131456, 0,
+    131470, 0, 131471, 0, 131359, 0, 131460, 0, 388, 33, 287, 34, 399, 132, 398, 132,
+    131470, 0, 131471, 0, 131460, 0, 65843, 63, 131369, 0, 297, 29, 388, 30, 399, 116,
+    398, 116, 131470, 0, 131471, 0, 131369, 0, 297, 232, 399, 272, 398, 232, 384, 184,
+    131369, 0, 297, 112, 131369, 0, 131471, 0, 131470, 0, 131456, 0, 131359, 0, 287, 33,
+    384, 34, 398, 132, 399, 132, 131471, 0, 131470, 0, 131359, 0, 287, 8, 398, 8,
+    399, 8, 297, 24, 318, 104, 363, 8, 357, 8, 324, 8, 321, 12, 296, 56,
+    343, 192, 293, 16, 131365, 0, 293, 256, 291, 16, 340, 256, 377, 16, 65829, 640,
+    65827, 40, 65876, 640, 65913, 40, 65829, 1216, 65827, 76, 359, 16, 351, 2048, 65887, 4096,
+    328, 192, 315, 16, 131387, 0, 315, 256, 309, 16, 329, 256, 298, 16, 65851, 640,
+    65845, 40, 336, 16, 378, 2048, 65919, 32, 353, 192, 305, 16, 131377, 0, 305, 256,
+    317, 16, 314, 256, 308, 16, 65841, 640, 65853, 40, 375, 16, 292, 2048, 360, 192,
+    364, 16, 131436, 0, 364, 256, 327, 16, 382, 256, 385, 16, 65900, 640, 65863, 40,
+    367, 16, 392, 2048, 403, 232, 284, 272, 394, 232, 393, 184, 131475, 0, 403, 112,
+    131475, 0, 131356, 0, 131466, 0, 131465, 0, 131460, 0, 388, 29, 393, 30, 394, 116,
+    284, 116, 131356, 0, 131466, 0, 131460, 0, 388, 232, 394, 272, 131460, 0, 388, 112,
+    131460, 0, 388, 232, 131466, 0, 394, 232, 131460, 0, 388, 4, 284, 18, 403, 48,
+    131475, 0, 131460, 0, 388, 184, 131466, 0, 131460, 0, 131356, 0, 131456, 0, 384, 33,
+    284, 34, 388, 132, 394, 132, 131466, 0, 131460, 0, 131456, 0, 384, 16, 131456, 0,
+    65829, 2080, 65827, 130, 384, 16, 131456, 0, 65865, 640, 65834, 40, 65851, 1216, 65845, 76,
+    65851, 2080, 65845, 130, 65914, 4096, 384, 16, 131456, 0, 384, 16, 131456, 0, 384, 232,
+    388, 272, 131456, 0, 384, 112, 131456, 0, 384, 232, 131460, 0, 388, 232, 131456, 0,
+    384, 184, 131460, 0, 131456, 0, 131465, 0, 393, 29, 384, 30, 388, 116, 394, 116,
+    131466, 0, 131460, 0, 131465, 0, 393, 232, 388, 272, 131465, 0, 393, 112, 131465, 0,
+    131460, 0, 131356, 0, 284, 33, 388, 34, 393, 132, 394, 132, 131466, 0, 131465, 0,
+    131356, 0, 284, 16, 131356, 0, 65887, 8192, 284, 16, 131356, 0, 65914, 8192, 65828, 4096,
+    284, 16, 131356, 0, 65928, 4096, 284, 232, 393, 272, 131356, 0, 284, 112, 131356, 0,
+    131465, 0, 131414, 0, 131451, 0, 131385, 0, 131438, 0, 131319, 0, 131448, 0, 131396, 0,
+    131445, 0, 131429, 0, 131371, 0, 131430, 0, 131435, 0, 131376, 0, 131461, 0, 131443, 0,
+    131374, 0, 131446, 0, 131409, 0, 131444, 0, 131411, 0, 131410, 0, 131395, 0, 131471, 0,
+    131375, 0, 131470, 0, 131442, 0, 131433, 0, 131359, 0, 131392, 0, 131441, 0, 131413, 0,
+    131424, 0, 131354, 0, 131394, 0, 131397, 0, 131384, 0, 131434, 0, 131440, 0, 131407, 0,
+    131437, 0, 131406, 0, 131372, 0, 131398, 0, 131423, 0, 131431, 0, 131365, 0, 131363, 0,
+    131412, 0, 131449, 0, 131415, 0, 131382, 0, 131366, 0, 131450, 0, 131408, 0, 131387, 0,
+    131381, 0, 131401, 0, 131370, 0, 131400, 0, 131390, 0, 131369, 0, 131364, 0, 131447, 0,
+    131377, 0, 131389, 0, 131386, 0, 131380, 0, 131425, 0, 131463, 0, 131378, 0, 131464, 0,
+    131439, 0, 131436, 0, 131399, 0, 131454, 0, 131457, 0, 131432, 0, 131368, 0, 131393, 0,
+    131391, 0, 131388, 0, 131455, 0, 131416, 0, 131360, 0, 131361, 0, 131417, 0, 65816, 8,
+    131402, 0, 131379, 0, 131367, 0, 65837, 48, 65837, 32, 65837, 16, 131373, 0, 131352, 0,
+    131383, 0, 311, 72, 280, 8, 301, 16, 65837, 32, 65837, 48, 65837, 64, 295, 24,
+    307, 9, 65843, 18, 65843, 27, 65843, 36, 65843, 45, 65843, 54, 65843, 63, 330, 304,
+    345, 80, 289, 8, 288, 16, 344, 24, 383, 9, 65919, 18, 316, 152, 319, 5140,
+    321, 2, 296, 256, 360, 6, 385, 8, 382, 14, 327, 8, 65863, 16, 65863, 32,
+    364, 8, 65900, 16, 65900, 32, 367, 8, 65903, 16, 65903, 32, 392, 80, 306, 20,
+    131439, 0, 131399, 0, 131436, 0, 364, 8, 65900, 16, 65900, 32, 327, 8, 367, 48,
+    391, 72, 353, 20, 308, 8, 65903, 96, 65863, 16, 314, 8, 317, 14, 305, 8,
+    65841, 16, 65841, 32, 375, 8, 65911, 16, 65911, 32, 292, 8, 65828, 16, 65828, 32,
+    297, 80, 318, 20, 131364, 0, 131377, 0, 131447, 0, 375, 8, 65911, 16, 65911, 32,
+    305, 8, 292, 48, 65828, 96, 65841, 16, 65850, 16, 328, 14, 298, 8, 65834, 16,
+    65834, 32, 329, 8, 309, 48, 315, 72, 336, 20, 65844, 16, 65845, 96, 65865, 16,
+    65850, 32, 378, 14, 294, 8, 65830, 16, 65830, 32, 310, 8, 343, 48, 65879, 96,
+    65846, 16, 377, 20, 340, 32, 291, 8, 293, 8, 359, 8, 351, 8, 326, 24,
+    300, 104, 334, 8, 365, 8, 335, 8, 368, 12, 362, 56, 312, 20, 325, 32,
+    131391, 0, 131393, 0, 131368, 0, 296, 8, 65832, 16, 131456, 0, 384, 29, 321, 30,
+    319, 116, 322, 116, 131394, 0, 131391, 0, 131456, 0, 384, 232, 319, 232, 131456, 0,
+    384, 272, 322, 60, 282, 66, 352, 176, 131424, 0, 131394, 0, 131391, 0, 319, 112,
+    131391, 0, 131456, 0, 131354, 0, 131460, 0, 388, 33, 282, 34, 384, 132, 319, 132,
+    131391, 0, 131456, 0, 131460, 0, 388, 8, 384, 8, 319, 8, 322, 24, 352, 104,
+    341, 8, 369, 8, 320, 8, 287, 12, 361, 56, 370, 192, 398, 16, 131470, 0,
+    398, 256, 303, 16, 399, 256, 323, 16, 65934, 640, 65839, 40, 65935, 640, 65859, 40,
+    65934, 1216, 65839, 76, 338, 16, 339, 2048, 372, 192, 337, 16, 131409, 0, 337, 256,
+    374, 16, 302, 256, 371, 16, 65873, 640, 65910, 40, 65832, 32, 389, 192, 304, 16,
+    131376, 0, 304, 256, 363, 16, 358, 256, 299, 16, 65840, 640, 65899, 40, 357, 16,
+    373, 2048, 324, 192, 376, 16, 131448, 0, 376, 256, 247, 16, 366, 256, 313, 16,
+    65912, 640, 65783, 40, 379, 16, 342, 2048, 393, 232, 284, 232, 131465, 0, 393, 60,
+    394, 66, 403, 176, 131475, 0, 131465, 0, 393, 272, 131356, 0, 284, 112, 131356, 0,
+    131465, 0, 131466, 0, 65919, 27, 131393, 0, 321, 29, 394, 30, 393, 116, 284, 116,
+    131356, 0, 131465, 0, 131393, 0, 321, 232, 393, 232, 131393, 0, 321, 60, 284, 66,
+    403, 176, 131475, 0, 131393, 0, 131465, 0, 131356, 0, 131354, 0, 282, 33, 284, 34,
+    393, 132, 321, 132, 131393, 0, 131465, 0, 131354, 0, 131412, 0, 131449, 0, 131363, 0,
+    131454, 0, 131378, 0, 131464, 0, 131392, 0, 131436, 0, 131441, 0, 131439, 0, 131399, 0,
+    131413, 0, 131389, 0, 131390, 0, 131369, 0, 131407, 0, 131447, 0, 131437, 0, 131364, 0,
+    131377, 0, 131406, 0, 131400, 0, 131391, 0, 131370, 0, 131456, 0, 131381, 0, 131401, 0,
+    131460, 0, 131450, 0, 131423, 0, 131366, 0, 131431, 0, 131415, 0, 131382, 0, 131365, 0,
+    131386, 0, 131432, 0, 131457, 0, 131425, 0, 131463, 0, 131408, 0, 131387, 0, 131380, 0,
+    131411, 0, 131410, 0, 131470, 0, 131375, 0, 131471, 0, 131395, 0, 131442, 0, 131372, 0,
+    131398, 0, 131409, 0, 131446, 0, 131374, 0, 131443, 0, 131444, 0, 131424, 0, 131394, 0,
+    131445, 0, 131429, 0, 131376, 0, 131435, 0, 131430, 0, 131371, 0, 131461, 0, 131434, 0,
+    131440, 0, 131414, 0, 131451, 0, 131448, 0, 131319, 0, 131438, 0, 131385, 0, 131396, 0,
+    131433, 0, 131359, 0, 131397, 0, 131384, 0, 131368, 0, 131455, 0, 131416, 0, 131360, 0,
+    131388, 0, 131361, 0, 131402, 0, 131379, 0, 131367, 0, 65837, 48, 65837, 32, 65837, 16,
+    131373, 0, 131417, 0, 131352, 0, 131383, 0, 311, 304, 280, 8, 345, 16, 301, 24,
+    295, 9, 65831, 18, 307, 152, 330, 5140, 289, 2, 316, 256, 288, 6, 344, 8,
+    383, 14, 296, 8, 65832, 16, 65832, 32, 312, 8, 65848, 16, 65848, 32, 325, 8,
+    65861, 16, 65861, 32, 287, 80, 361, 20, 131397, 0, 131368, 0, 131384, 0, 312, 8,
+    65848, 16, 65848, 32, 296, 8, 325, 48, 324, 72, 313, 20, 366, 8, 65861, 96,
+    65832, 16, 247, 8, 376, 14, 379, 8, 65915, 16, 65915, 32, 342, 8, 65878, 16,
+    65878, 32, 368, 8, 65904, 16, 65904, 32, 362, 80, 389, 20, 131440, 0, 131451, 0,
+    131414, 0, 342, 8, 65878, 16, 65878, 32, 379, 8, 368, 48, 65904, 96, 65915, 16,
+    65783, 16, 299, 14, 358, 8, 65894, 16, 65894, 32, 363, 8, 304, 48, 357, 72,
+    373, 20, 65902, 16, 65840, 96, 65899, 16, 65783, 32, 322, 14, 352, 8, 65888, 16,
+    65888, 32, 372, 8, 371, 48, 65907, 96, 65908, 16, 302, 20, 374, 32, 337, 8,
+    326, 8, 300, 8, 370, 8, 323, 24, 399, 104, 303, 8, 398, 8, 338, 8,
+    339, 12, 308, 56, 315, 20, 336, 32, 131402, 0, 131361, 0, 131388, 0, 316, 8,
+    65852, 16, 65831, 27, 65831, 36, 65831, 45, 289, 232, 330, 272, 131361, 0, 289, 112,
+    131361, 0, 131402, 0, 330, 192, 289, 16, 131361, 0, 289, 256, 391, 16, 353, 256,
+    385, 16, 65825, 640, 65927, 40, 360, 16, 314, 2048, 293, 192, 310, 16, 131382, 0,
+    310, 256, 343, 16, 359, 256, 294, 16, 65846, 640, 65879, 40, 351, 16, 378, 2048,
+    388, 232, 329, 272, 131460, 0, 388, 112, 131460, 0, 131401, 0, 329, 16, 131401, 0,
+    329, 16, 131401, 0, 329, 232, 388, 272, 131401, 0, 329, 112, 131401, 0, 131460, 0,
+    388, 8, 329, 8, 309, 8, 384, 24, 298, 104, 319, 8, 328, 8, 334, 8,
+    305, 12, 292, 56, 365, 16, 131437, 0, 65825, 1216, 65927, 76, 365, 192, 375, 16,
+    131447, 0, 375, 256, 335, 16, 297, 256, 318, 16, 65911, 640, 65871, 40, 317, 16,
+    341, 2048, 65852, 32, 327, 16, 131399, 0, 327, 192, 367, 16, 131439, 0, 367, 256,
+    369, 16, 364, 256, 320, 16, 65903, 640, 65905, 40, 392, 16, 306, 2048, 382, 232,
+    291, 272, 131454, 0, 382, 112, 131454, 0, 131363, 0, 291, 16, 131363, 0, 291, 16,
+    131363, 0, 291, 16, 131363, 0, 291, 16, 131363, 0, 131466, 0, 394, 30, 291, 31,
+    382, 120, 377, 120, 131449, 0, 131454, 0, 131466, 0, 394, 232, 382, 272, 131466, 0,
+    394, 112, 131466, 0, 131454, 0, 131356, 0, 284, 33, 382, 34, 394, 132, 377, 132,
+    131449, 0, 131466, 0, 131356, 0, 284, 16, 131356, 0, 65889, 640, 65921, 40, 65850, 4096,
+    284, 16, 131356, 0, 284, 16, 131356, 0, 284, 16, 131356, 0, 284, 232, 394, 272,
+    131356, 0, 284, 112, 131356, 0, 131466, 0, 394, 16, 131466, 0, 394, 16, 131466, 0,
+    394, 16, 131466, 0, 394, 16, 131466, 0, 394, 232, 284, 272, 131466, 0, 394, 112,
+    131466, 0, 131356, 0, 284, 16, 131356, 0, 284, 16, 131356, 0, 65833, 640, 65854, 40,
+    65911, 1216, 65871, 76, 284, 16, 131356, 0, 284, 16, 131356, 0, 284, 232, 394, 272,
+    131356, 0, 284, 112, 131356, 0, 131466, 0, 394, 16, 131466, 0, 394, 16, 131466, 0,
+    394, 16, 131466, 0, 394, 16, 131466, 0, 394, 232, 284, 272, 131466, 0, 394, 112,
+    131466, 0, 131356, 0, 284, 16, 131356, 0, 65825, 2080, 65927, 130, 284, 16, 131356, 0,
+    284, 16, 131356, 0, 284, 16, 131356, 0, 284, 232, 394, 272, 131356, 0, 284, 112,
+    131356, 0, 131466, 0, 131363, 0, 291, 30, 394, 31, 284, 120, 377, 120, 131449, 0,
+    131356, 0, 131363, 0, 131454, 0, 382, 33, 291, 34, 284, 132, 377, 132, 131449, 0,
+    131356, 0, 131454, 0, 382, 16, 131454, 0, 382, 16, 131454, 0, 65911, 2080, 65871, 130,
+    382, 16, 131454, 0, 382, 232, 284, 272, 131454, 0, 382, 112, 131454, 0, 131356, 0,
+    284, 16, 131356, 0, 65850, 8192, 284, 16, 131356, 0, 65877, 4096, 65877, 8192, 65914, 4096,
+    284, 16, 131356, 0, 65842, 4096, 131386, 0, 131432, 0, 131361, 0, 131463, 0, 131425, 0,
+    131457, 0, 131402, 0, 131450, 0, 131423, 0, 131382, 0, 131415, 0, 131431, 0, 131366, 0,
+    131365, 0, 293, 232, 294, 272, 131365, 0, 293, 112, 131365, 0, 131366, 0, 294, 192,
+    293, 16, 131365, 0, 293, 256, 359, 16, 343, 256, 310, 16, 65829, 640, 65895, 40,
+    65829, 1216, 65895, 76, 351, 16, 378, 2048, 330, 16, 131402, 0, 330, 192, 385, 16,
+    131457, 0, 385, 256, 353, 16, 391, 256, 289, 16, 65921, 640, 65889, 40, 360, 16,
+    314, 2048, 284, 16, 131356, 0, 284, 232, 382, 272, 131356, 0, 284, 112, 131356, 0,
+    131454, 0, 382, 232, 284, 272, 131454, 0, 382, 112, 131454, 0, 131356, 0, 284, 30,
+    131356, 0, 284, 1536000, 382, 24, 131454, 0, 382, 4268, 377, 24, 131449, 0, 377, 4268,
+    340, 1152480, 282, 76, 393, 76, 321, 76, 403, 32, 283, 32, 131475, 0, 131355, 0,
+    283, 2048, 403, 512, 404, 1024, 131355, 0, 283, 1152, 396, 128, 405, 1152, 387, 1152,
+    395, 64, 401, 64, 131467, 0, 131473, 0, 401, 2048, 395, 698, 278, 1396, 131473, 0,
+    401, 128, 408, 128, 281, 64, 290, 64, 131353, 0, 131362, 0, 290, 2048, 281, 512,
+    406, 1024, 131362, 0, 131354, 0, 131355, 0, 131468, 0, 131393, 0, 131465, 0, 131475, 0,
+    131476, 0, 65876, 1728901, 131459, 0, 131477, 0, 131467, 0, 131350, 0, 131480, 0, 131473, 0,
+    131353, 0, 131478, 0, 131449, 0, 377, 40, 406, 1536851, 131412, 0, 340, 40, 281, 1536851,
+    131478, 0, 131449, 0, 131454, 0, 131356, 0, 131353, 0, 131412, 0, 131446, 0, 131374, 0,
+    131409, 0, 131455, 0, 131433, 0, 131359, 0, 131406, 0, 131384, 0, 131400, 0, 131397, 0,
+    131368, 0, 131391, 0, 131448, 0, 131461, 0, 131434, 0, 131410, 0, 131414, 0, 131470, 0,
+    131440, 0, 131451, 0, 131375, 0, 131371, 0, 131381, 0, 131430, 0, 131401, 0, 131376, 0,
+    131435, 0, 131460, 0, 131394, 0, 131442, 0, 131424, 0, 131372, 0, 131443, 0, 131444, 0,
+    131398, 0, 131319, 0, 131360, 0, 131416, 0, 131385, 0, 131396, 0, 131445, 0, 131429, 0,
+    131438, 0, 131450, 0, 131423, 0, 131365, 0, 131431, 0, 131415, 0, 131382, 0, 131366, 0,
+    131471, 0, 131395, 0, 131413, 0, 131389, 0, 131447, 0, 131407, 0, 131369, 0, 131390, 0,
+    131437, 0, 131370, 0, 131456, 0, 131386, 0, 131432, 0, 131457, 0, 131425, 0, 131463, 0,
+    131361, 0, 131402, 0, 131380, 0, 131411, 0, 131378, 0, 131464, 0, 131439, 0, 131441, 0,
+    131436, 0, 131392, 0, 131399, 0, 131364, 0, 131377, 0, 131408, 0, 131387, 0, 131388, 0,
+    131367, 0, 131373, 0, 131417, 0, 131379, 0, 131352, 0, 131383, 0, 311, 304, 280, 8,
+    307, 16, 345, 24, 301, 9, 65837, 18, 295, 152, 316, 5140, 315, 2, 336, 256,
+    305, 6, 292, 8, 327, 14, 320, 8, 65856, 16, 65856, 32, 364, 8, 65900, 16,
+    65900, 32, 369, 8, 65905, 16, 65905, 32, 367, 80, 392, 20, 131441, 0, 131392, 0,
+    131436, 0, 364, 8, 65900, 16, 65900, 32, 320, 8, 369, 48, 306, 72, 339, 20,
+    308, 8, 65905, 96, 65856, 16, 330, 8, 289, 14, 391, 8, 65927, 16, 65927, 32,
+    353, 8, 65889, 16, 65889, 32, 385, 8, 65921, 16, 65921, 32, 360, 80, 314, 20,
+    131457, 0, 131463, 0, 131425, 0, 353, 8, 65889, 16, 65889, 32, 391, 8, 385, 48,
+    65921, 96, 65927, 16, 65866, 16, 384, 14, 298, 8, 65834, 16, 65834, 32, 365, 8,
+    318, 48, 297, 72, 335, 20, 65844, 16, 65854, 96, 65901, 16, 65866, 32, 375, 14,
+    317, 8, 65853, 16, 65853, 32, 341, 8, 323, 48, 65859, 96, 65877, 16, 399, 20,
+    294, 32, 310, 8, 343, 8, 359, 8, 293, 8, 351, 24, 378, 104, 366, 8,
+    357, 8, 373, 8, 324, 12, 313, 56, 344, 20, 288, 32, 131388, 0, 131387, 0,
+    131408, 0, 336, 8, 65872, 16, 65837, 27, 65837, 36, 65837, 45, 131466, 0, 394, 30,
+    315, 31, 316, 120, 247, 120, 131319, 0, 131388, 0, 131466, 0, 394, 232, 316, 272,
+    131466, 0, 394, 112, 131466, 0, 131388, 0, 131363, 0, 291, 33, 316, 34, 394, 132,
+    247, 132, 131319, 0, 131466, 0, 131363, 0, 291, 8, 394, 8, 247, 8, 326, 24,
+    372, 104, 371, 8, 300, 8, 352, 8, 370, 12, 322, 56, 388, 192, 363, 16,
+    131435, 0, 363, 256, 304, 16, 329, 256, 358, 16, 65899, 640, 65840, 40, 65865, 640,
+    65894, 40, 65899, 1216, 65840, 76, 309, 16, 299, 2048, 65835, 4096, 303, 192, 379, 16,
+    131451, 0, 379, 256, 368, 16, 398, 256, 342, 16, 65915, 640, 65904, 40, 65934, 640,
+    65878, 40, 65915, 1216, 65904, 76, 338, 16, 362, 2048, 65898, 4096, 65872, 32, 389, 192,
+    376, 16, 131448, 0, 376, 256, 319, 16, 296, 256, 325, 16, 65912, 640, 65855, 40,
+    328, 16, 312, 2048, 334, 192, 287, 16, 131359, 0, 287, 256, 361, 16, 383, 256,
+    337, 16, 65823, 640, 65897, 40, 302, 16, 374, 2048, 131387, 0, 315, 33, 340, 34,
+    281, 132, 284, 132, 131356, 0, 131353, 0, 131387, 0, 315, 232, 281, 272, 131387, 0,
+    315, 112, 131387, 0, 131353, 0, 131388, 0, 316, 33, 281, 34, 315, 132, 284, 132,
+    131356, 0, 131387, 0, 131388, 0, 316, 16, 131388, 0, 65899, 2080, 65840, 130, 65835, 8192,
+    316, 16, 131388, 0, 65915, 2080, 65904, 130, 65898, 8192, 65848, 4096, 316, 16, 131388, 0,
+    65910, 4096, 131412, 0, 340, 33, 316, 34, 315, 132, 284, 132, 131356, 0, 131387, 0,
+    131412, 0, 340, 232, 315, 272, 131412, 0, 340, 112, 131412, 0, 131387, 0, 131353, 0,
+    281, 33, 315, 34, 340, 132, 284, 132, 131356, 0, 131412, 0, 131353, 0, 281, 16,
+    131353, 0, 281, 16, 131353, 0, 281, 16, 131353, 0, 131388, 0, 316, 33, 281, 34,
+    340, 132, 284, 132, 131356, 0, 131412, 0, 131388, 0, 316, 232, 340, 272, 131388, 0,
+    316, 112, 131388, 0, 131412, 0, 131387, 0, 315, 33, 340, 34, 316, 132, 284, 132,
+    131356, 0, 131388, 0, 131387, 0, 315, 16, 131387, 0, 315, 16, 131387, 0, 315, 16,
+    131387, 0, 131353, 0, 281, 33, 315, 34, 316, 132, 284, 132, 131356, 0, 131388, 0,
+    131353, 0, 281, 232, 316, 272, 131353, 0, 281, 112, 131353, 0, 131388, 0, 131412, 0,
+    340, 33, 316, 34, 281, 132, 284, 132, 131356, 0, 131353, 0, 131412, 0, 340, 16,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 131387, 0, 315, 33, 340, 34,
+    281, 132, 284, 132, 131356, 0, 131353, 0, 131387, 0, 315, 232, 281, 272, 131387, 0,
+    315, 112, 131387, 0, 131353, 0, 131388, 0, 316, 33, 281, 34, 315, 132, 284, 132,
+    131356, 0, 131387, 0, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16,
+    131388, 0, 131412, 0, 340, 33, 316, 34, 315, 132, 284, 132, 131356, 0, 131387, 0,
+    131412, 0, 340, 232, 315, 272, 131412, 0, 340, 112, 131412, 0, 131387, 0, 131353, 0,
+    281, 33, 315, 34, 340, 132, 284, 132, 131356, 0, 131412, 0, 131353, 0, 281, 16,
+    131353, 0, 281, 16, 131353, 0, 281, 16, 131353, 0, 131388, 0, 316, 33, 281, 34,
+    340, 132, 284, 132, 131356, 0, 131412, 0, 131388, 0, 316, 232, 340, 272, 131388, 0,
+    316, 112, 131388, 0, 131412, 0, 131387, 0, 315, 33, 340, 34, 316, 132, 284, 132,
+    131356, 0, 131388, 0, 131387, 0, 315, 16, 131387, 0, 315, 16, 131387, 0, 315, 16,
+    131387, 0, 131353, 0, 281, 33, 315, 34, 316, 132, 284, 132, 131356, 0, 131388, 0,
+    131353, 0, 281, 232, 316, 272, 131353, 0, 281, 112, 131353, 0, 131388, 0, 131412, 0,
+    340, 33, 316, 34, 281, 132, 284, 132, 131356, 0, 131353, 0, 131412, 0, 340, 16,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 131387, 0, 315, 33, 340, 34,
+    281, 132, 284, 132, 131356, 0, 131353, 0, 131387, 0, 315, 232, 281, 272, 131387, 0,
+    315, 112, 131387, 0, 131353, 0, 131388, 0, 316, 33, 281, 34, 315, 132, 284, 132,
+    131356, 0, 131387, 0, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16,
+    131388, 0, 131412, 0, 340, 33, 316, 34, 315, 132, 284, 132, 131356, 0, 131387, 0,
+    131412, 0, 340, 232, 315, 272, 131412, 0, 340, 112, 131412, 0, 131387, 0, 131353, 0,
+    281, 33, 315, 34, 340, 132, 284, 132, 131356, 0, 131412, 0, 131353, 0, 281, 16,
+    131353, 0, 281, 16, 131353, 0, 281, 16, 131353, 0, 131388, 0, 316, 33, 281, 34,
+    340, 132, 284, 132, 131356, 0, 131412, 0, 131388, 0, 316, 232, 340, 272, 131388, 0,
+    316, 112, 131388, 0, 131412, 0, 131387, 0, 315, 33, 340, 34, 316, 132, 284, 132,
+    131356, 0, 131388, 0, 131387, 0, 315, 16, 131387, 0, 315, 16, 131387, 0, 315, 16,
+    131387, 0, 315, 16, 131387, 0, 131353, 0, 281, 33, 315, 34, 316, 132, 284, 132,
+    131356, 0, 131388, 0, 131353, 0, 281, 232, 316, 272, 131353, 0, 281, 112, 131353, 0,
+    131388, 0, 131412, 0, 340, 33, 316, 34, 281, 132, 284, 132, 131356, 0, 131353, 0,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 131387, 0,
+    315, 33, 340, 34, 281, 132, 284, 132, 131356, 0, 131353, 0, 131387, 0, 315, 232,
+    281, 272, 131387, 0, 315, 112, 131387, 0, 131353, 0, 131388, 0, 316, 33, 281, 34,
+    315, 132, 284, 132, 131356, 0, 131387, 0, 131388, 0, 316, 16, 131388, 0, 316, 16,
+    131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 131412, 0, 340, 33, 316, 34,
+    315, 132, 284, 132, 131356, 0, 131387, 0, 131412, 0, 340, 232, 315, 272, 131412, 0,
+    340, 112, 131412, 0, 131387, 0, 131353, 0, 281, 33, 315, 34, 340, 132, 284, 132,
+    131356, 0, 131412, 0, 131353, 0, 281, 16, 131353, 0, 281, 16, 131353, 0, 281, 16,
+    131353, 0, 131388, 0, 316, 33, 281, 34, 340, 132, 284, 132, 131356, 0, 131412, 0,
+    131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0, 131412, 0, 131387, 0,
+    315, 33, 340, 34, 316, 132, 284, 132, 131356, 0, 131388, 0, 131387, 0, 315, 16,
+    131387, 0, 315, 16, 131387, 0, 315, 16, 131387, 0, 315, 16, 131387, 0, 131353, 0,
+    281, 33, 315, 34, 316, 132, 284, 132, 131356, 0, 131388, 0, 131353, 0, 281, 232,
+    316, 272, 131353, 0, 281, 112, 131353, 0, 131388, 0, 131412, 0, 340, 33, 316, 34,
+    281, 132, 284, 132, 131356, 0, 131353, 0, 131412, 0, 340, 16, 131412, 0, 340, 16,
+    131412, 0, 340, 16, 131412, 0, 131387, 0, 315, 33, 340, 34, 281, 132, 284, 132,
+    131356, 0, 131353, 0, 131387, 0, 315, 232, 281, 272, 131387, 0, 315, 112, 131387, 0,
+    131353, 0, 131388, 0, 316, 33, 281, 34, 315, 132, 284, 132, 131356, 0, 131387, 0,
+    131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 131412, 0,
+    340, 33, 316, 34, 315, 132, 284, 132, 131356, 0, 131387, 0, 131412, 0, 340, 232,
+    315, 272, 131412, 0, 340, 112, 131412, 0, 131387, 0, 131353, 0, 281, 33, 315, 34,
+    340, 132, 284, 132, 131356, 0, 131412, 0, 131353, 0, 281, 16, 131353, 0, 281, 16,
+    131353, 0, 281, 16, 131353, 0, 131388, 0, 316, 33, 281, 34, 340, 132, 284, 132,
+    131356, 0, 131412, 0, 131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0,
+    131412, 0, 131387, 0, 315, 33, 340, 34, 316, 132, 284, 132, 131356, 0, 131388, 0,
+    131387, 0, 315, 16, 131387, 0, 315, 16, 131387, 0, 315, 16, 131387, 0, 131353, 0,
+    281, 33, 315, 34, 316, 132, 284, 132, 131356, 0, 131388, 0, 131353, 0, 281, 232,
+    316, 272, 131353, 0, 281, 112, 131353, 0, 131388, 0, 131412, 0, 340, 33, 316, 34,
+    281, 132, 284, 132, 131356, 0, 131353, 0, 131412, 0, 340, 16, 131412, 0, 340, 16,
+    131412, 0, 340, 16, 131412, 0, 131387, 0, 315, 33, 340, 34, 281, 132, 284, 132,
+    131356, 0, 131353, 0, 131387, 0, 315, 232, 281, 272, 131387, 0, 315, 112, 131387, 0,
+    131353, 0, 131388, 0, 316, 33, 281, 34, 315, 132, 284, 132, 131356, 0, 131387, 0,
+    131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 131412, 0,
+    340, 33, 316, 34, 315, 132, 284, 132, 131356, 0, 131387, 0, 131412, 0, 340, 232,
+    315, 272, 131412, 0, 340, 112, 131412, 0, 131387, 0, 131353, 0, 281, 33, 315, 34,
+    340, 132, 284, 132, 131356, 0, 131412, 0, 131353, 0, 281, 16, 131353, 0, 281, 16,
+    131353, 0, 281, 16, 131353, 0, 131388, 0, 316, 33, 281, 34, 340, 132, 284, 132,
+    131356, 0, 131412, 0, 131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232,
+    316, 272, 131412, 0, 340, 112, 131412, 0, 131388, 0, 316, 16, 131388, 0, 316, 16,
+    131388, 0, 316, 16, 131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232,
+    316, 272, 131412, 0, 340, 112, 131412, 0, 131388, 0, 316, 16, 131388, 0, 316, 16,
+    131388, 0, 316, 16, 131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232,
+    316, 272, 131412, 0, 340, 112, 131412, 0, 131388, 0, 316, 16, 131388, 0, 316, 16,
+    131388, 0, 316, 16, 131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 131371, 0,
+    131381, 0, 131435, 0, 131376, 0, 131401, 0, 131430, 0, 131460, 0, 131384, 0, 131400, 0,
+    131448, 0, 131391, 0, 131368, 0, 131397, 0, 131461, 0, 389, 232, 325, 272, 131461, 0,
+    389, 112, 131461, 0, 131397, 0, 131387, 0, 315, 33, 325, 34, 389, 132, 296, 132,
+    131368, 0, 131461, 0, 131387, 0, 315, 192, 389, 16, 131461, 0, 389, 256, 296, 16,
+    319, 256, 376, 16, 65925, 640, 65832, 40, 328, 16, 312, 2048, 388, 192, 358, 16,
+    131430, 0, 358, 256, 329, 16, 304, 256, 363, 16, 65894, 640, 65865, 40, 309, 16,
+    299, 2048, 340, 232, 316, 272, 131412, 0, 340, 112, 131412, 0, 131388, 0, 316, 16,
+    131388, 0, 316, 16, 131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232, 316, 272, 131412, 0,
+    340, 112, 131412, 0, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 232,
+    340, 272, 131388, 0, 316, 112, 131388, 0, 131412, 0, 340, 16, 131412, 0, 340, 16,
+    131412, 0, 340, 232, 316, 272, 131412, 0, 340, 112, 131412, 0, 131388, 0, 316, 16,
+    131388, 0, 316, 16, 131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232, 316, 272, 131412, 0,
+    340, 112, 131412, 0, 131388, 0, 316, 16, 131388, 0, 131434, 0, 131410, 0, 131451, 0,
+    131440, 0, 131470, 0, 131414, 0, 131375, 0, 303, 16, 131375, 0, 131446, 0, 131374, 0,
+    131359, 0, 131433, 0, 131455, 0, 131409, 0, 131406, 0, 334, 232, 337, 272, 131406, 0,
+    334, 112, 131406, 0, 131409, 0, 131353, 0, 281, 30, 337, 31, 334, 120, 383, 120,
+    131455, 0, 131406, 0, 131353, 0, 281, 16, 131353, 0, 65925, 1216, 65832, 76, 281, 192,
+    334, 16, 131406, 0, 334, 256, 383, 16, 361, 256, 287, 16, 65870, 640, 65919, 40,
+    302, 16, 374, 2048, 303, 16, 131375, 0, 303, 192, 342, 16, 131414, 0, 342, 256,
+    398, 16, 368, 256, 379, 16, 65878, 640, 65934, 40, 338, 16, 362, 2048, 316, 232,
+    340, 272, 131388, 0, 316, 112, 131388, 0, 131412, 0, 340, 16, 131412, 0, 340, 16,
+    131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232, 316, 272, 131412, 0,
+    340, 112, 131412, 0, 131388, 0, 316, 16, 131388, 0, 65855, 640, 65912, 40, 65848, 4096,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 232, 340, 272,
+    131388, 0, 316, 112, 131388, 0, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0,
+    340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232, 316, 272, 131412, 0, 340, 112,
+    131412, 0, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0,
+    316, 16, 131388, 0, 316, 232, 340, 272, 131388, 0, 316, 112, 131388, 0, 131412, 0,
+    340, 16, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0,
+    340, 232, 316, 272, 131412, 0, 340, 112, 131412, 0, 131388, 0, 316, 16, 131388, 0,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 232, 340, 272,
+    131388, 0, 316, 112, 131388, 0, 131412, 0, 131397, 0, 325, 33, 340, 34, 316, 132,
+    284, 132, 131356, 0, 131388, 0, 131397, 0, 325, 16, 131397, 0, 325, 16, 131397, 0,
+    325, 16, 131397, 0, 325, 16, 131397, 0, 325, 232, 316, 272, 131397, 0, 325, 112,
+    131397, 0, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 65870, 1216, 65919, 76,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 316, 232, 325, 272, 131388, 0, 316, 112,
+    131388, 0, 131397, 0, 325, 16, 131397, 0, 325, 16, 131397, 0, 325, 16, 131397, 0,
+    325, 16, 131397, 0, 325, 232, 316, 272, 131397, 0, 325, 112, 131397, 0, 131388, 0,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 65897, 640, 65823, 40, 316, 16, 131388, 0,
+    316, 16, 131388, 0, 316, 232, 325, 272, 131388, 0, 316, 112, 131388, 0, 131397, 0,
+    325, 16, 131397, 0, 325, 16, 131397, 0, 325, 16, 131397, 0, 325, 16, 131397, 0,
+    325, 232, 316, 272, 131397, 0, 325, 112, 131397, 0, 131388, 0, 316, 16, 131388, 0,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 232, 325, 272,
+    131388, 0, 316, 112, 131388, 0, 131397, 0, 325, 16, 131397, 0, 65855, 1216, 65912, 76,
+    65925, 2080, 65832, 130, 325, 16, 131397, 0, 325, 16, 131397, 0, 325, 16, 131397, 0,
+    325, 232, 316, 272, 131397, 0, 325, 112, 131397, 0, 131388, 0, 316, 16, 131388, 0,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 232, 325, 272,
+    131388, 0, 316, 112, 131388, 0, 131397, 0, 131409, 0, 337, 30, 325, 31, 316, 120,
+    284, 120, 131356, 0, 131388, 0, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0,
+    337, 16, 131409, 0, 337, 16, 131409, 0, 337, 232, 316, 272, 131409, 0, 337, 112,
+    131409, 0, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0,
+    316, 16, 131388, 0, 316, 232, 337, 272, 131388, 0, 316, 112, 131388, 0, 131409, 0,
+    337, 16, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0,
+    337, 232, 316, 272, 131409, 0, 337, 112, 131409, 0, 131388, 0, 316, 16, 131388, 0,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 316, 232, 337, 272,
+    131388, 0, 316, 112, 131388, 0, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0,
+    337, 16, 131409, 0, 337, 16, 131409, 0, 337, 232, 316, 272, 131409, 0, 337, 112,
+    131409, 0, 131388, 0, 316, 16, 131388, 0, 316, 16, 131388, 0, 65870, 2080, 65919, 130,
+    316, 16, 131388, 0, 316, 16, 131388, 0, 316, 232, 337, 272, 131388, 0, 316, 112,
+    131388, 0, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0, 65897, 1216, 65823, 76,
+    337, 16, 131409, 0, 337, 16, 131409, 0, 337, 232, 316, 272, 131409, 0, 337, 112,
+    131409, 0, 131388, 0, 131412, 0, 340, 33, 316, 34, 337, 132, 284, 132, 131356, 0,
+    131409, 0, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0, 340, 16, 131412, 0,
+    340, 16, 131412, 0, 340, 232, 337, 272, 131412, 0, 340, 112, 131412, 0, 131409, 0,
+    337, 16, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0,
+    337, 232, 340, 272, 131409, 0, 337, 112, 131409, 0, 131412, 0, 340, 16, 131412, 0,
+    340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232, 337, 272, 131412, 0, 340, 112,
+    131412, 0, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0,
+    337, 232, 340, 272, 131409, 0, 337, 112, 131409, 0, 131412, 0, 340, 16, 131412, 0,
+    340, 16, 131412, 0, 340, 16, 131412, 0, 340, 232, 337, 272, 131412, 0, 340, 112,
+    131412, 0, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0, 337, 16, 131409, 0,
+    337, 232, 340, 272, 131409, 0, 337, 112, 131409, 0, 131412, 0, 131366, 0, 131471, 0,
+    131382, 0, 131399, 0, 131464, 0, 131439, 0, 131424, 0, 131436, 0, 131372, 0, 131441, 0,
+    131392, 0, 131443, 0, 131361, 0, 131386, 0, 131432, 0, 131445, 0, 131425, 0, 131429, 0,
+    131457, 0, 131463, 0, 131438, 0, 131456, 0, 131319, 0, 131370, 0, 131466, 0, 131390, 0,
+    131437, 0, 131363, 0, 131447, 0, 131365, 0, 131389, 0, 131431, 0, 131395, 0, 131413, 0,
+    131415, 0, 131402, 0, 131377, 0, 131364, 0, 131411, 0, 131378, 0, 131407, 0, 131369, 0,
+    131380, 0, 131384, 0, 131400, 0, 131461, 0, 131368, 0, 131391, 0, 131448, 0, 131387, 0,
+    131450, 0, 131423, 0, 131446, 0, 131374, 0, 131406, 0, 131455, 0, 131433, 0, 131359, 0,
+    131353, 0, 131444, 0, 131398, 0, 131371, 0, 131381, 0, 131430, 0, 131401, 0, 131376, 0,
+    131435, 0, 131460, 0, 131385, 0, 131396, 0, 131434, 0, 131410, 0, 131414, 0, 131470, 0,
+    131440, 0, 131451, 0, 131375, 0, 131394, 0, 131442, 0, 131360, 0, 131416, 0, 131408, 0,
+    131373, 0, 131417, 0, 131379, 0, 131367, 0, 131352, 0, 131383, 0, 311, 304, 280, 8,
+    295, 16, 307, 24, 345, 9, 65881, 18, 301, 152, 336, 567, 344, 2, 288, 256,
+    370, 6, 322, 96, 303, 72, 379, 20, 368, 8, 65858, 192, 398, 8, 342, 13,
+    338, 16, 362, 8, 324, 11, 313, 16, 65898, 16, 65934, 16, 388, 8, 363, 20,
+    304, 32, 329, 8, 358, 6, 309, 8, 299, 5, 65845, 16, 326, 8, 372, 8,
+    281, 20, 287, 32, 361, 20, 383, 32, 131408, 0, 131416, 0, 131360, 0, 288, 8,
+    65881, 27, 65881, 36, 65881, 45, 131376, 0, 131435, 0, 131401, 0, 131394, 0, 131444, 0,
+    131470, 0, 131398, 0, 131460, 0, 131442, 0, 131451, 0, 131375, 0, 131414, 0, 131410, 0,
+    131396, 0, 131385, 0, 131430, 0, 131371, 0, 131381, 0, 131434, 0, 131440, 0, 131359, 0,
+    131353, 0, 131455, 0, 131433, 0, 131360, 0, 131417, 0, 131379, 0, 131367, 0, 131373, 0,
+    131352, 0, 131383, 0, 311, 304, 280, 8, 301, 16, 295, 24, 307, 9, 65843, 18,
+    345, 152, 288, 567, 361, 2, 383, 256, 281, 6, 287, 96, 368, 72, 362, 20,
+    309, 8, 65823, 192, 299, 8, 358, 13, 313, 16, 324, 8, 338, 11, 342, 16,
+    65860, 16, 65835, 16, 303, 8, 379, 20, 370, 32, 388, 8, 326, 6, 398, 8,
+    372, 5, 65934, 16, 322, 8, 329, 8, 363, 20, 304, 32, 344, 20, 336, 32,
+    131360, 0, 131433, 0, 131455, 0, 383, 8, 65843, 27, 65843, 36, 65843, 45, 131397, 0,
+    325, 30, 361, 31, 288, 120, 334, 120, 131406, 0, 131360, 0, 131397, 0, 325, 232,
+    288, 272, 131397, 0, 325, 112, 131397, 0, 131360, 0, 131388, 0, 316, 33, 288, 34,
+    325, 132, 334, 132, 131406, 0, 131397, 0, 131388, 0, 316, 232, 325, 272, 131388, 0,
+    316, 112, 131388, 0, 131397, 0, 325, 232, 316, 272, 131397, 0, 325, 112, 131397, 0,
+    131388, 0, 316, 232, 325, 272, 131388, 0, 316, 112, 131388, 0, 131397, 0, 131442, 0,
+    131451, 0, 131460, 0, 131359, 0, 131401, 0, 131371, 0, 131394, 0, 131375, 0, 131353, 0,
+    131434, 0, 131440, 0, 131430, 0, 131385, 0, 131410, 0, 131414, 0, 131398, 0, 131444, 0,
+    131470, 0, 131396, 0, 131381, 0, 131376, 0, 131435, 0, 131408, 0, 131416, 0, 131455, 0,
+    131379, 0, 131367, 0, 131373, 0, 131417, 0, 131352, 0, 131383, 0, 311, 304, 280, 8,
+    345, 16, 301, 24, 295, 9, 65831, 18, 307, 152, 383, 567, 344, 2, 336, 256,
+    363, 6, 304, 96, 309, 72, 324, 20, 398, 8, 65840, 192, 372, 8, 326, 13,
+    342, 16, 338, 8, 313, 11, 358, 16, 65874, 16, 65908, 16, 368, 8, 362, 20,
+    281, 32, 303, 8, 322, 6, 299, 8, 329, 5, 65835, 16, 287, 8, 388, 8,
+    379, 20, 370, 32, 325, 20, 316, 32, 131455, 0, 131416, 0, 131408, 0, 336, 8,
+    65831, 27, 65831, 36, 65831, 45, 344, 80, 383, 24, 334, 8, 131433, 0, 361, 30,
+    302, 31, 374, 120, 351, 120, 131423, 0, 131446, 0, 131433, 0, 361, 232, 374, 272,
+    131433, 0, 361, 112, 131433, 0, 131446, 0, 131360, 0, 288, 33, 374, 34, 361, 132,
+    351, 132, 131423, 0, 131433, 0, 131360, 0, 288, 232, 361, 272, 131360, 0, 288, 112,
+    131360, 0, 131433, 0, 131379, 0, 307, 232, 361, 272, 131379, 0, 307, 112, 131379, 0,
+    131433, 0, 131374, 0, 302, 29, 361, 30, 307, 116, 288, 116, 131360, 0, 131379, 0,
+    131374, 0, 131446, 0, 374, 33, 302, 34, 307, 132, 288, 132, 131360, 0, 131379, 0,
+    131446, 0, 374, 232, 307, 272, 131446, 0, 374, 112, 131446, 0, 131379, 0, 307, 152,
+    131433, 0, 361, 29, 374, 30, 288, 116, 351, 116, 131423, 0, 131360, 0, 131433, 0,
+    361, 232, 288, 272, 131433, 0, 361, 112, 131433, 0, 131360, 0, 131374, 0, 302, 33,
+    288, 34, 361, 132, 351, 132, 131423, 0, 131433, 0, 131374, 0, 131379, 0, 307, 232,
+    302, 272, 131379, 0, 307, 112, 131379, 0, 131374, 0, 131455, 0, 131406, 0, 131353, 0,
+    131434, 0, 131375, 0, 131376, 0, 131460, 0, 131444, 0, 131359, 0, 131440, 0, 131435, 0,
+    131396, 0, 131381, 0, 131398, 0, 131414, 0, 131385, 0, 131430, 0, 131394, 0, 131401, 0,
+    131371, 0, 131410, 0, 131470, 0, 131442, 0, 131451, 0, 131388, 0, 131397, 0, 131408, 0,
+    131367, 0, 131373, 0, 131417, 0, 131416, 0, 131352, 0, 131383, 0, 311, 304, 280, 8,
+    344, 16, 345, 24, 301, 9, 65837, 18, 295, 152, 336, 567, 325, 2, 316, 256,
+    379, 6, 370, 96, 398, 72, 338, 20, 299, 8, 65906, 192, 329, 8, 322, 13,
+    358, 16, 313, 8, 342, 11, 326, 16, 65849, 16, 65865, 16, 309, 8, 324, 20,
+    363, 32, 368, 8, 287, 6, 372, 8, 388, 5, 65908, 16, 304, 8, 303, 8,
+    362, 20, 281, 32, 334, 20, 383, 32, 131408, 0, 131397, 0, 131388, 0, 316, 8,
+    65837, 27, 65837, 36, 65837, 45, 325, 80, 336, 24, 302, 8, 131446, 0, 374, 29,
+    307, 30, 361, 116, 351, 116, 131423, 0, 131433, 0, 131446, 0, 374, 232, 361, 272,
+    131446, 0, 374, 112, 131446, 0, 131433, 0, 131360, 0, 288, 33, 361, 34, 374, 132,
+    351, 132, 131423, 0, 131446, 0, 131360, 0, 288, 152, 131367, 0, 295, 232, 374, 272,
+    131367, 0, 295, 112, 131367, 0, 131446, 0, 374, 232, 295, 272, 131446, 0, 374, 112,
+    131446, 0, 131367, 0, 295, 232, 374, 272, 131367, 0, 295, 112, 131367, 0, 131446, 0,
+    131379, 0, 307, 30, 374, 31, 295, 120, 351, 120, 131423, 0, 131367, 0, 131379, 0,
+    131433, 0, 361, 33, 307, 34, 295, 132, 351, 132, 131423, 0, 131367, 0, 131433, 0,
+    361, 232, 295, 272, 131433, 0, 361, 112, 131433, 0, 131367, 0, 295, 232, 361, 272,
+    131367, 0, 295, 112, 131367, 0, 131433, 0, 361, 232, 295, 272, 131433, 0, 361, 112,
+    131433, 0, 131367, 0, 131446, 0, 374, 30, 295, 31, 361, 120, 351, 120, 131423, 0,
+    131433, 0, 131446, 0, 131379, 0, 307, 33, 374, 34, 361, 132, 351, 132, 131423, 0,
+    131433, 0, 131379, 0, 307, 232, 361, 272, 131379, 0, 307, 112, 131379, 0, 131433, 0,
+    361, 232, 307, 272, 131433, 0, 361, 112, 131433, 0, 131379, 0, 307, 232, 361, 272,
+    131379, 0, 307, 112, 131379, 0, 131433, 0, 131367, 0, 295, 30, 361, 31, 307, 120,
+    351, 120, 131423, 0, 131379, 0, 131367, 0, 131446, 0, 374, 33, 295, 34, 307, 132,
+    351, 132, 131423, 0, 131379, 0, 131446, 0, 374, 232, 307, 272, 131446, 0, 374, 112,
+    131446, 0, 131379, 0, 307, 232, 374, 272, 131379, 0, 307, 112, 131379, 0, 131446, 0,
+    374, 232, 307, 272, 131446, 0, 374, 112, 131446, 0, 131379, 0, 131433, 0, 361, 30,
+    307, 31, 374, 120, 351, 120, 131423, 0, 131446, 0, 131433, 0, 131367, 0, 295, 33,
+    361, 34, 374, 132, 351, 132, 131423, 0, 131446, 0, 131367, 0, 295, 232, 374, 272,
+    131367, 0, 295, 112, 131367, 0, 131446, 0, 374, 232, 295, 272, 131446, 0, 374, 112,
+    131446, 0, 131367, 0, 295, 232, 374, 272, 131367, 0, 295, 112, 131367, 0, 131446, 0,
+    131379, 0, 307, 30, 374, 31, 295, 120, 351, 120, 131423, 0, 131367, 0, 131379, 0,
+    131433, 0, 361, 33, 307, 34, 295, 132, 351, 132, 131423, 0, 131367, 0, 131433, 0,
+    361, 232, 295, 272, 131433, 0, 361, 112, 131433, 0, 131367, 0, 295, 232, 361, 272,
+    131367, 0, 295, 112, 131367, 0, 131433, 0, 361, 232, 295, 272, 131433, 0, 361, 112,
+    131433, 0, 131367, 0, 131446, 0, 374, 30, 295, 31, 361, 120, 351, 120, 131423, 0,
+    131433, 0, 131446, 0, 131379, 0, 307, 33, 374, 34, 361, 132, 351, 132, 131423, 0,
+    131433, 0, 131379, 0, 307, 232, 361, 272, 131379, 0, 307, 112, 131379, 0, 131433, 0,
+    361, 232, 307, 272, 131433, 0, 361, 112, 131433, 0, 131379, 0, 307, 232, 361, 272,
+    131379, 0, 307, 112, 131379, 0, 131433, 0, 131367, 0, 295, 30, 361, 31, 307, 120,
+    351, 120, 131423, 0, 131379, 0, 131367, 0, 131446, 0, 374, 33, 295, 34, 307, 132,
+    351, 132, 131423, 0, 131379, 0, 131446, 0, 374, 232, 307, 272, 131446, 0, 374, 112,
+    131446, 0, 131379, 0, 307, 232, 374, 272, 131379, 0, 307, 112, 131379, 0, 131446, 0,
+    374, 232, 307, 272, 131446, 0, 374, 112, 131446, 0, 131379, 0, 131433, 0, 361, 30,
+    307, 31, 374, 120, 351, 120, 131423, 0, 131446, 0, 131433, 0, 131367, 0, 295, 33,
+    361, 34, 374, 132, 351, 132, 131423, 0, 131446, 0, 131367, 0, 295, 232, 374, 272,
+    131367, 0, 295, 112, 131367, 0, 131446, 0, 374, 232, 295, 272, 131446, 0, 374, 112,
+    131446, 0, 131367, 0, 295, 232, 374, 272, 131367, 0, 295, 112, 131367, 0, 131446, 0,
+    131379, 0, 307, 30, 374, 31, 295, 120, 351, 120, 131423, 0, 131367, 0, 131379, 0,
+    131433, 0, 361, 33, 307, 34, 295, 132, 351, 132, 131423, 0, 131367, 0, 131433, 0,
+    361, 232, 295, 272, 131433, 0, 361, 112, 131433, 0, 131367, 0, 295, 232, 361, 272,
+    131367, 0, 295, 112, 131367, 0, 131433, 0, 361, 232, 295, 272, 131433, 0, 361, 112,
+    131433, 0, 131367, 0, 131446, 0, 374, 30, 295, 31, 361, 120, 351, 120, 131423, 0,
+    131433, 0, 131446, 0, 131379, 0, 307, 33, 374, 34, 361, 132, 351, 132, 131423, 0,
+    131433, 0, 131379, 0, 307, 232, 361, 272, 131379, 0, 307, 112, 131379, 0, 131433, 0,
+    131408, 0, 131374, 0, 131435, 0, 131396, 0, 131440, 0, 131442, 0, 131375, 0, 131401, 0,
+    131376, 0, 131381, 0, 131451, 0, 131410, 0, 131470, 0, 131394, 0, 131430, 0, 131414, 0,
+    131398, 0, 131359, 0, 131460, 0, 131444, 0, 131385, 0, 131371, 0, 131353, 0, 131434, 0,
+    131455, 0, 131406, 0, 131388, 0, 131373, 0, 131417, 0, 131416, 0, 131360, 0, 131397, 0,
+    131352, 0, 131383, 0, 311, 304, 280, 8, 325, 16, 288, 24, 344, 9, 65880, 18,
+    345, 152, 301, 567, 316, 2, 334, 256, 383, 6, 362, 96, 281, 72, 299, 20,
+    313, 8, 65898, 192, 372, 8, 388, 13, 287, 16, 326, 8, 342, 11, 358, 16,
+    65862, 16, 65908, 16, 322, 8, 398, 20, 338, 32, 379, 8, 309, 6, 304, 8,
+    329, 5, 65840, 16, 303, 8, 370, 8, 368, 20, 324, 32, 363, 20, 302, 32,
+    131373, 0, 131388, 0, 131406, 0, 334, 8, 65880, 27, 65880, 36, 65880, 45, 316, 80,
+    301, 24, 336, 8, 131367, 0, 295, 29, 361, 30, 307, 116, 351, 116, 131423, 0,
+    131379, 0, 131367, 0, 295, 232, 307, 272, 131367, 0, 295, 112, 131367, 0, 131379, 0,
+    131446, 0, 374, 33, 307, 34, 295, 132, 351, 132, 131423, 0, 131367, 0, 131446, 0,
+    374, 232, 295, 272, 131446, 0, 374, 112, 131446, 0, 131367, 0, 295, 232, 374, 272,
+    131367, 0, 295, 112, 131367, 0, 131446, 0, 131433, 0, 361, 30, 374, 31, 295, 120,
+    351, 120, 131423, 0, 131367, 0, 131433, 0, 131379, 0, 307, 33, 361, 34, 295, 132,
+    351, 132, 131423, 0, 131367, 0, 131379, 0, 307, 232, 295, 272, 131379, 0, 307, 112,
+    131379, 0, 131367, 0, 295, 232, 307, 272, 131367, 0, 295, 112, 131367, 0, 131379, 0,
+    131446, 0, 374, 30, 307, 31, 295, 120, 351, 120, 131423, 0, 131367, 0, 131446, 0,
+    131433, 0, 361, 33, 374, 34, 295, 132, 351, 132, 131423, 0, 131367, 0, 131433, 0,
+    361, 232, 295, 272, 131433, 0, 361, 112, 131433, 0, 131367, 0, 295, 232, 361, 272,
+    131367, 0, 295, 112, 131367, 0, 131433, 0, 361, 232, 295, 272, 131433, 0, 361, 112,
+    131433, 0, 131367, 0, 295, 232, 361, 272, 131367, 0, 295, 112, 131367, 0, 131433, 0,
+    361, 232, 295, 272, 131433, 0, 361, 112, 131433, 0, 131367, 0, 131379, 0, 307, 30,
+    295, 31, 361, 120, 351, 120, 131423, 0, 131433, 0, 131379, 0, 131446, 0, 374, 33,
+    307, 34, 361, 132, 351, 132, 131423, 0, 131433, 0, 131446, 0, 374, 232, 361, 272,
+    131446, 0, 374, 112, 131446, 0, 131433, 0, 131373, 0, 131408, 0, 131410, 0, 131470, 0,
+    131451, 0, 131434, 0, 131442, 0, 131444, 0, 131375, 0, 131394, 0, 131455, 0, 131371, 0,
+    131353, 0, 131460, 0, 131359, 0, 131414, 0, 131430, 0, 131381, 0, 131401, 0, 131376, 0,
+    131398, 0, 131385, 0, 131396, 0, 131440, 0, 131374, 0, 131435, 0, 131406, 0, 131416, 0,
+    131360, 0, 131397, 0, 131417, 0, 131388, 0, 131352, 0, 131383, 0, 311, 304, 280, 8,
+    316, 16, 345, 24, 325, 9, 65861, 18, 288, 152, 344, 567, 334, 2, 363, 256,
+    302, 6, 368, 96, 324, 72, 313, 20, 326, 8, 65904, 192, 304, 8, 329, 13,
+    309, 16, 358, 8, 342, 11, 287, 16, 65894, 16, 65840, 16, 388, 8, 281, 20,
+    299, 32, 383, 8, 322, 6, 303, 8, 372, 5, 65839, 16, 370, 8, 362, 8,
+    379, 20, 398, 32, 338, 20, 336, 32, 131416, 0, 131406, 0, 131435, 0, 363, 8,
+    65861, 27, 65861, 36, 65861, 45, 334, 232, 344, 272, 131406, 0, 334, 112, 131406, 0,
+    131416, 0, 344, 232, 334, 272, 131416, 0, 344, 112, 131416, 0, 131406, 0, 131371, 0,
+    131353, 0, 131455, 0, 131440, 0, 131434, 0, 131376, 0, 131442, 0, 131460, 0, 131374, 0,
+    131385, 0, 131396, 0, 131401, 0, 131381, 0, 131414, 0, 131359, 0, 131394, 0, 131444, 0,
+    131375, 0, 131430, 0, 131398, 0, 131470, 0, 131451, 0, 131408, 0, 131410, 0, 131435, 0,
+    131397, 0, 131417, 0, 131388, 0, 131360, 0, 131352, 0, 131383, 0, 311, 304, 280, 8,
+    288, 16, 316, 24, 345, 9, 65881, 18, 325, 152, 363, 567, 338, 2, 336, 256,
+    379, 6, 398, 96, 326, 72, 358, 20, 303, 8, 65934, 192, 372, 8, 322, 13,
+    287, 16, 342, 8, 309, 11, 329, 16, 65878, 16, 65908, 16, 324, 8, 313, 20,
+    302, 32, 388, 8, 370, 6, 304, 8, 362, 5, 65840, 16, 368, 8, 383, 8,
+    281, 20, 299, 32, 334, 20, 344, 32, 131435, 0, 131410, 0, 131408, 0, 336, 8,
+    65881, 27, 65881, 36, 65881, 45, 338, 58, 363, 256, 131410, 0, 131435, 0, 363, 41,
+    338, 256, 131435, 0, 131410, 0, 338, 42, 363, 256, 131410, 0, 131435, 0, 363, 54,
+    338, 256, 131435, 0, 131410, 0, 338, 17, 363, 256, 131410, 0, 131435, 0, 363, 80,
+    338, 256, 131435, 0, 131410, 0, 338, 40, 363, 256, 131410, 0, 131435, 0, 131374, 0,
+    131385, 0, 131460, 0, 131470, 0, 131455, 0, 131444, 0, 131440, 0, 131396, 0, 131451, 0,
+    131430, 0, 131398, 0, 131394, 0, 131359, 0, 131381, 0, 131401, 0, 131442, 0, 131434, 0,
+    131376, 0, 131414, 0, 131375, 0, 131371, 0, 131353, 0, 131416, 0, 131406, 0, 131408, 0,
+    131417, 0, 131388, 0, 131360, 0, 131397, 0, 131352, 0, 131383, 0, 311, 304, 280, 8,
+    325, 16, 288, 24, 316, 9, 65852, 18, 345, 152, 336, 567, 334, 2, 344, 256,
+    281, 6, 299, 96, 303, 72, 342, 20, 304, 8, 65835, 192, 362, 8, 370, 13,
+    329, 16, 309, 8, 287, 11, 322, 16, 65845, 16, 65898, 16, 326, 8, 358, 20,
+    379, 32, 324, 8, 368, 6, 372, 8, 383, 5, 65908, 16, 398, 8, 388, 8,
+    313, 20, 302, 32, 363, 20, 338, 32, 131408, 0, 131406, 0, 131416, 0, 344, 8,
+    65852, 27, 65852, 36, 65852, 45, 131451, 0, 131430, 0, 131396, 0, 131371, 0, 131460, 0,
+    131434, 0, 131470, 0, 131398, 0, 131353, 0, 131414, 0, 131375, 0, 131442, 0, 131401, 0,
+    131359, 0, 131394, 0, 131440, 0, 131455, 0, 131444, 0, 131381, 0, 131376, 0, 131374, 0,
+    131385, 0, 131410, 0, 131435, 0, 131416, 0, 131388, 0, 131360, 0, 131397, 0, 131417, 0,
+    131352, 0, 131383, 0, 311, 304, 280, 8, 345, 16, 325, 24, 288, 9, 65824, 18,
+    316, 152, 344, 5140, 363, 2, 338, 256, 313, 6, 302, 8, 304, 14, 309, 8,
+    65845, 16, 65845, 32, 372, 8, 65908, 16, 65908, 32, 383, 8, 65919, 16, 65919, 32,
+    368, 80, 322, 20, 131455, 0, 131381, 0, 131444, 0, 372, 8, 65908, 16, 65908, 32,
+    309, 8, 383, 48, 287, 72, 329, 20, 370, 8, 65919, 96, 65845, 16, 303, 8,
+    342, 14, 281, 8, 65817, 16, 65817, 32, 326, 8, 65862, 16, 65862, 32, 398, 8,
+    65934, 16, 65934, 32, 362, 80, 388, 20, 131470, 0, 131353, 0, 131398, 0, 326, 8,
+    65862, 16, 65862, 32, 281, 8, 398, 48, 65934, 96, 65817, 16, 65839, 16, 299, 14,
+    324, 8, 65860, 16, 65860, 32, 358, 8, 379, 48, 334, 72, 336, 20, 65906, 16,
+    65915, 96, 65894, 16, 65839, 32, 301, 14, 361, 8, 65897, 16, 65897, 32, 374, 8,
+    351, 48, 65887, 96, 65910, 16, 378, 20, 315, 32, 376, 8, 319, 8, 296, 8,
+    389, 8, 328, 24, 312, 104, 308, 8, 297, 8, 335, 8, 306, 12, 339, 56,
+    292, 20, 305, 32, 131416, 0, 131435, 0, 131410, 0, 338, 8, 65874, 16, 131367, 0,
+    295, 30, 363, 31, 344, 120, 330, 120, 131402, 0, 131416, 0, 131367, 0, 295, 232,
+    344, 272, 131367, 0, 295, 112, 131367, 0, 131416, 0, 131379, 0, 307, 33, 344, 34,
+    295, 132, 330, 132, 131402, 0, 131367, 0, 131379, 0, 307, 8, 295, 8, 330, 8,
+    343, 24, 341, 104, 323, 8, 359, 8, 317, 8, 293, 12, 375, 56, 291, 192,
+    365, 16, 131437, 0, 365, 256, 318, 16, 394, 256, 298, 16, 65901, 640, 65854, 40,
+    65930, 640, 65834, 40, 65901, 1216, 65854, 76, 247, 16, 384, 2048, 65920, 4096, 366, 192,
+    391, 16, 131463, 0, 391, 256, 385, 16, 357, 256, 353, 16, 65927, 640, 65921, 40,
+    373, 16, 360, 2048, 65874, 32, 314, 192, 289, 16, 131361, 0, 289, 256, 371, 16,
+    320, 256, 369, 16, 65825, 640, 65907, 40, 300, 16, 364, 2048, 352, 192, 367, 16,
+    131439, 0, 367, 256, 392, 16, 327, 256, 310, 16, 65903, 640, 65928, 40, 399, 16,
+    294, 2048, 340, 232, 337, 272, 131412, 0, 340, 112, 131412, 0, 131409, 0, 131387, 0,
+    131450, 0, 131448, 0, 131376, 0, 131394, 0, 131440, 0, 131389, 0, 131444, 0, 131431, 0,
+    131455, 0, 131381, 0, 131395, 0, 131414, 0, 131460, 0, 131434, 0, 131407, 0, 131398, 0,
+    131369, 0, 131470, 0, 131353, 0, 131380, 0, 131371, 0, 131402, 0, 131396, 0, 131367, 0,
+    131451, 0, 131430, 0, 131379, 0, 131373, 0, 131461, 0, 131433, 0, 131368, 0, 131423, 0,
+    131446, 0, 131391, 0, 131375, 0, 131385, 0, 131374, 0, 131401, 0, 131359, 0, 131408, 0,
+    131406, 0, 131442, 0, 131456, 0, 131319, 0, 131437, 0, 131390, 0, 131466, 0, 131370, 0,
+    131363, 0, 131384, 0, 131400, 0, 131432, 0, 131445, 0, 131463, 0, 131457, 0, 131429, 0,
+    131425, 0, 131438, 0, 131413, 0, 131415, 0, 131436, 0, 131372, 0, 131361, 0, 131443, 0,
+    131392, 0, 131441, 0, 131386, 0, 131411, 0, 131378, 0, 131366, 0, 131471, 0, 131439, 0,
+    131464, 0, 131399, 0, 131382, 0, 131424, 0, 131447, 0, 131365, 0, 131377, 0, 131364, 0,
+    131410, 0, 131360, 0, 131397, 0, 131417, 0, 131388, 0, 131352, 0, 131383, 0, 131404, 0,
+    131418, 0, 131357, 0, 131358, 0, 131403, 0, 131420, 0, 131348, 0, 131349, 0, 131347, 0,
+    131346, 0, 131345, 0, 131335, 0, 131336, 0, 131334, 0, 131333, 0, 131339, 0, 131340, 0,
+    131338, 0, 131337, 0, 131343, 0, 131344, 0, 131342, 0, 131341, 0, 131084, 0, 131311, 0,
+    131317, 0, 131318, 0, 131316, 0, 131296, 0, 131308, 0, 131320, 0, 131322, 0, 131331, 0,
+    131332, 0, 131297, 0, 131435, 0, 131315, 0, 131314, 0, 131313, 0, 131312, 0, 65774, 8,
+    131309, 0, 131327, 0, 131328, 0, 131329, 0, 131416, 0, 131326, 0, 131325, 0, 131324, 0,
+    131323, 0, 131310, 0, 131321, 0, 131300, 0, 65763, 24, 131306, 0, 131305, 0, 65763, 16,
+    131304, 0, 131307, 0, 65763, 8, 131298, 0, 65767, 32, 65767, 16, 131303, 0, 131351, 0,
+    131299, 0, 131302, 0, 131226, 0, 131227, 0, 131225, 0, 131224, 0, 131072, 0, 131078, 0,
+    131077, 0, 131233, 0, 131231, 0, 131232, 0, 131234, 0, 131237, 0, 131248, 0, 131249, 0,
+    131250, 0, 131251, 0, 131252, 0, 131253, 0, 131238, 0, 131239, 0, 131246, 0, 131247, 0,
+    131242, 0, 131241, 0, 131243, 0, 131244, 0, 131245, 0, 131235, 0, 131236, 0, 131254, 0,
+    131255, 0, 131240, 0, 131256, 0, 131257, 0, 131229, 0, 131230, 0, 131259, 0, 131260, 0,
+    131258, 0, 131261, 0, 131262, 0, 131269, 0, 131270, 0, 131268, 0, 131263, 0, 131264, 0,
+    131265, 0, 131266, 0, 131267, 0, 131281, 0, 131282, 0, 131283, 0, 131284, 0, 131285, 0,
+    131286, 0, 131271, 0, 131273, 0, 131274, 0, 131275, 0, 131278, 0, 131276, 0, 131277, 0,
+    131272, 0, 131279, 0, 131280, 0, 131287, 0, 131288, 0, 131291, 0, 131292, 0, 131293, 0,
+    131290, 0, 131289, 0, 131294, 0, 131295, 0, 131228, 0, 131085, 0, 131086, 0, 131096, 0,
+    131095, 0, 131094, 0, 131093, 0, 131092, 0, 131091, 0, 131087, 0, 131330, 0, 131452, 0,
+    131469, 0, 131453, 0, 131426, 0, 131428, 0, 131427, 0, 131405, 0, 131421, 0, 131419, 0,
+    131422, 0, 131081, 0, 131082, 0, 131083, 0, 131080, 0, 131079, 0, 131075, 0, 131076, 0,
+    131074, 0, 131073, 0, 131301, 0, 131097, 0, 131090, 0, 131089, 0, 131088, 0, 131098, 0,
+    131099, 0, 131100, 0, 131101, 0, 131102, 0, 131103, 0, 131104, 0, 131105, 0, 131106, 0,
+    131107, 0, 131108, 0, 131109, 0, 131110, 0, 131111, 0, 131112, 0, 131113, 0, 131114, 0,
+    131115, 0, 131116, 0, 131117, 0, 131118, 0, 131119, 0, 131120, 0, 131121, 0, 131122, 0,
+    131123, 0, 131124, 0, 131125, 0, 131126, 0, 131127, 0, 131128, 0, 131129, 0, 131130, 0,
+    131131, 0, 131132, 0, 131133, 0, 131134, 0, 131135, 0, 131136, 0, 131137, 0, 131138, 0,
+    131139, 0, 131140, 0, 131141, 0, 131142, 0, 131143, 0, 131144, 0, 131145, 0, 131146, 0,
+    131147, 0, 131148, 0, 131149, 0, 131150, 0, 131151, 0, 131152, 0, 131153, 0, 131154, 0,
+    131155, 0, 131156, 0, 131157, 0, 131158, 0, 131159, 0, 131160, 0, 131161, 0, 131162, 0,
+    131163, 0, 131164, 0, 131165, 0, 131166, 0, 131167, 0, 131168, 0, 131169, 0, 131170, 0,
+    131171, 0, 131172, 0, 131173, 0, 131174, 0, 131175, 0, 131176, 0, 131177, 0, 131178, 0,
+    131179, 0, 131180, 0, 131181, 0, 131182, 0, 131183, 0, 131184, 0, 131185, 0, 131186, 0,
+    131187, 0, 131188, 0, 131189, 0, 131190, 0, 131191, 0, 131192, 0, 131193, 0, 131194, 0,
+    131195, 0, 131196, 0, 131197, 0, 131198, 0, 131199, 0, 131200, 0, 131201, 0, 131202, 0,
+    131203, 0, 131204, 0, 131205, 0, 131206, 0, 131207, 0, 131208, 0, 131209, 0, 131210, 0,
+    131211, 0, 131212, 0, 131213, 0, 131214, 0, 131215, 0, 131216, 0, 131217, 0, 131218, 0,
+    131219, 0, 131220, 0, 131221, 0, 131222, 0, 131223, 0, 0, 2568, 1, 112, 2, 16384,
+    3, 48, 4, 56, 5, 56, 6, 152, 7, 208, 8, 32, 9, 72, 10, 72,
+    11, 72, 12, 56, 13, 152, 14, 152, 15, 72, 16, 24, 17, 24, 18, 24,
+    19, 72, 20, 72, 21, 72, 22, 72, 23, 72, 24, 72, 25, 1, 26, 272,
+    27, 8, 28, 40, 29, 16, 30, 32, 31, 7, 32, 32, 33, 10, 34, 32,
+    35, 9, 36, 32, 37, 9, 38, 32, 39, 7, 40, 32, 41, 10, 42, 32,
+    43, 11, 44, 32, 45, 11, 46, 32, 47, 19, 48, 32, 49, 15, 50, 32,
+    51, 22, 52, 32, 53, 9, 54, 32, 55, 16, 56, 32, 57, 16, 58, 32,
+    59, 14, 60, 32, 61, 9, 62, 32, 63, 16, 64, 32, 65, 14, 66, 32,
+    67, 12, 68, 32, 69, 17, 70, 32, 71, 10, 72, 32, 73, 9, 74, 32,
+    75, 17, 76, 32, 77, 13, 78, 32, 79, 18, 80, 32, 81, 16, 82, 32,
+    83, 12, 84, 32, 85, 12, 86, 32, 87, 7, 88, 32, 89, 10, 90, 32,
+    91, 12, 92, 32, 93, 10, 94, 32, 95, 12, 96, 32, 97, 25, 98, 32,
+    99, 28, 100, 32, 101, 10, 102, 32, 103, 13, 104, 32, 105, 20, 106, 32,
+    107, 24, 108, 32, 109, 16, 110, 32, 111, 28, 112, 32, 113, 29, 114, 32,
+    115, 31, 116, 32, 117, 32, 118, 32, 119, 31, 120, 32, 121, 25, 122, 32,
+    123, 27, 124, 32, 125, 27, 126, 32, 127, 18, 128, 32, 129, 23, 130, 32,
+    131, 27, 132, 32, 133, 23, 134, 32, 135, 23, 136, 32, 137, 23, 138, 32,
+    139, 23, 140, 32, 141, 24, 142, 32, 143, 28, 144, 32, 145, 24, 146, 32,
+    147, 24, 148, 32, 149, 24, 150, 32, 151, 24, 152, 688, 153, 104, 154, 544,
+    155, 56, 156, 1768, 157, 9, 158, 9, 159, 9, 65695, 18, 65695, 27, 65695, 36,
+    65695, 45, 65695, 54, 65695, 63, 65695, 72, 65695, 81, 160, 9, 161, 9, 65697, 18,
+    65697, 27, 65697, 36, 65697, 45, 65697, 54, 65697, 63, 162, 9, 65698, 18, 65698, 27,
+    65698, 36, 65698, 45, 65698, 54, 65698, 63, 65698, 72, 65698, 81, 65698, 90, 65698, 99,
+    65698, 108, 65698, 117, 65698, 126, 65698, 135, 163, 9, 65699, 18, 65699, 27, 65699, 36,
+    164, 9, 65700, 18, 65700, 27, 165, 9, 65701, 18, 65701, 27, 65701, 36, 65701, 45,
+    65701, 54, 65701, 63, 65701, 72, 65701, 81, 65701, 90, 65701, 99, 65701, 108, 65701, 117,
+    65701, 126, 166, 9, 65702, 18, 167, 9, 65703, 18, 168, 9, 65704, 18, 169, 9,
+    65705, 18, 65705, 27, 65705, 36, 65705, 45, 65705, 54, 170, 9, 65706, 18, 65706, 27,
+    65706, 36, 65706, 45, 65706, 54, 171, 9, 65707, 18, 172, 9, 173, 9, 174, 9,
+    65710, 18, 65710, 27, 65710, 36, 65710, 45, 65710, 54, 175, 9, 65711, 18, 65711, 27,
+    65711, 36, 65711, 45, 65711, 54, 176, 9, 65712, 18, 65712, 27, 177, 9, 65713, 18,
+    65713, 27, 178, 9, 65714, 18, 65714, 27, 179, 9, 65715, 18, 65715, 27, 180, 9,
+    65716, 18, 65716, 27, 181, 9, 65717, 18, 65717, 27, 182, 9, 183, 9, 184, 9,
+    185, 9, 65721, 18, 186, 9, 65722, 18, 65722, 27, 65722, 36, 65722, 45, 65722, 54,
+    65722, 63, 187, 9, 188, 9, 189, 9, 65725, 18, 65725, 27, 190, 9, 191, 9,
+    192, 9, 65728, 18, 65728, 27, 65728, 36, 65728, 45, 65728, 54, 65728, 63, 65728, 72,
+    65728, 81, 65728, 90, 65728, 99, 193, 9, 194, 9, 65730, 18, 65730, 27, 65730, 36,
+    65730, 45, 195, 9, 65731, 18, 196, 9, 65732, 18, 65732, 27, 197, 9, 65733, 18,
+    65733, 27, 65733, 36, 65733, 45, 198, 9, 65734, 18, 65734, 27, 65734, 36, 65734, 45,
+    199, 9, 65735, 18, 65735, 27, 65735, 36, 65735, 45, 65735, 54, 65735, 63, 65735, 72,
+    65735, 81, 200, 9, 65736, 18, 65736, 27, 65736, 36, 65736, 45, 201, 9, 65737, 18,
+    65737, 27, 65737, 36, 65737, 45, 65737, 54, 65737, 63, 65737, 72, 65737, 81, 65737, 90,
+    202, 9, 65738, 18, 65738, 27, 65738, 36, 65738, 45, 65738, 54, 65738, 63, 65738, 72,
+    65738, 81, 65738, 90, 203, 9, 65739, 18, 65739, 27, 65739, 36, 65739, 45, 65739, 54,
+    204, 9, 65740, 18, 65740, 27, 65740, 36, 65740, 45, 65740, 54, 205, 9, 65741, 18,
+    65741, 27, 65741, 36, 65741, 45, 65741, 54, 65741, 63, 206, 9, 65742, 18, 65742, 27,
+    65742, 36, 207, 9, 65743, 18, 208, 9, 65744, 18, 65744, 27, 209, 9, 65745, 18,
+    65745, 27, 210, 9, 65746, 18, 65746, 27, 65746, 36, 65746, 45, 211, 9, 212, 9,
+    65748, 18, 65748, 27, 65748, 36, 65748, 45, 65748, 54, 213, 9, 65749, 18, 65749, 27,
+    65749, 36, 214, 9, 65750, 18, 65750, 27, 65750, 36, 65750, 45, 65750, 54, 215, 9,
+    65751, 18, 216, 9, 65752, 18, 217, 9, 65753, 18, 65753, 27, 65753, 36, 218, 9,
+    219, 9, 65755, 18, 65755, 27, 65755, 36, 65755, 45, 65755, 54, 65755, 63, 220, 9,
+    65756, 18, 65756, 27, 65756, 36, 65756, 45, 65756, 54, 65756, 63, 65756, 72, 221, 9,
+    222, 9, 65758, 18, 65758, 27, 65758, 36, 65758, 45, 65758, 54, 65758, 63, 223, 9,
+    65759, 18, 65759, 27, 65759, 36, 65759, 45, 224, 24, 225, 8, 226, 72, 227, 8,
+    228, 16, 65764, 32, 65764, 48, 229, 16, 230, 72, 65763, 16, 231, 16, 65767, 32,
+    65767, 48, 232, 72, 65763, 24, 233, 16, 65769, 32, 65769, 48, 234, 72, 65763, 32,
+    235, 16, 65771, 32, 65771, 48, 65764, 32, 65764, 16, 131300, 0, 65769, 32, 65769, 16,
+    131305, 0, 65771, 32, 65771, 16, 131307, 0, 235, 80, 233, 80, 228, 80, 236, 24,
+    65761, 40, 237, 144, 238, 8, 65765, 32, 239, 5, 240, 20, 241, 20, 131313, 0,
+    131312, 0, 240, 80, 241, 16, 242, 24, 243, 9, 65779, 18, 65779, 27, 65779, 36,
+    65779, 45, 65779, 54, 65779, 63, 131311, 0, 239, 2, 244, 8, 245, 8, 131317, 0,
+    131316, 0, 65779, 72, 65779, 81, 65779, 90, 244, 56, 245, 24, 246, 8, 131311, 0,
+    239, 27, 247, 28, 248, 108, 249, 108, 131321, 0, 131320, 0, 131311, 0, 239, 56,
+    248, 24, 249, 144, 65774, 16, 250, 5, 251, 20, 252, 20, 131324, 0, 131323, 0,
+    251, 80, 252, 16, 253, 24, 254, 9, 65790, 18, 65790, 27, 65790, 36, 65790, 45,
+    65790, 54, 65790, 63, 131322, 0, 250, 2, 255, 8, 256, 8, 131328, 0, 131327, 0,
+    65790, 72, 65790, 81, 65790, 90, 255, 56, 256, 24, 257, 8, 131322, 0, 250, 33,
+    258, 34, 259, 132, 260, 132, 131332, 0, 131331, 0, 131322, 0, 250, 24, 259, 24,
+    260, 24, 65761, 72, 261, 848, 262, 56, 263, 24, 264, 8, 265, 848, 266, 56,
+    267, 24, 268, 8, 269, 848, 270, 56, 271, 24, 272, 8, 273, 40, 274, 848,
+    275, 56, 276, 24, 277, 8, 131229, 0, 131230, 0, 158, 9, 157, 9, 131231, 0,
+    159, 9, 65695, 18, 65695, 27, 65695, 36, 65695, 45, 65695, 54, 65695, 63, 65695, 72,
+    65695, 81, 131232, 0, 160, 9, 131233, 0, 161, 9, 65697, 18, 65697, 27, 65697, 36,
+    65697, 45, 65697, 54, 65697, 63, 131234, 0, 162, 9, 65698, 18, 65698, 27, 65698, 36,
+    65698, 45, 65698, 54, 65698, 63, 65698, 72, 65698, 81, 65698, 90, 65698, 99, 65698, 108,
+    65698, 117, 65698, 126, 65698, 135, 131235, 0, 163, 9, 65699, 18, 65699, 27, 65699, 36,
+    131236, 0, 164, 9, 65700, 18, 65700, 27, 131237, 0, 165, 9, 65701, 18, 65701, 27,
+    65701, 36, 65701, 45, 65701, 54, 65701, 63, 65701, 72, 65701, 81, 65701, 90, 65701, 99,
+    65701, 108, 65701, 117, 65701, 126, 131238, 0, 166, 9, 65702, 18, 131239, 0, 167, 9,
+    65703, 18, 131240, 0, 168, 9, 65704, 18, 131241, 0, 169, 9, 65705, 18, 65705, 27,
+    65705, 36, 65705, 45, 65705, 54, 131242, 0, 170, 9, 65706, 18, 65706, 27, 65706, 36,
+    65706, 45, 65706, 54, 131243, 0, 171, 9, 65707, 18, 131244, 0, 172, 9, 131245, 0,
+    173, 9, 131246, 0, 174, 9, 65710, 18, 65710, 27, 65710, 36, 65710, 45, 65710, 54,
+    131247, 0, 175, 9, 65711, 18, 65711, 27, 65711, 36, 65711, 45, 65711, 54, 131248, 0,
+    176, 9, 65712, 18, 65712, 27, 131249, 0, 177, 9, 65713, 18, 65713, 27, 131250, 0,
+    178, 9, 65714, 18, 65714, 27, 131251, 0, 179, 9, 65715, 18, 65715, 27, 131252, 0,
+    180, 9, 65716, 18, 65716, 27, 131253, 0, 181, 9, 65717, 18, 65717, 27, 131254, 0,
+    182, 9, 131255, 0, 183, 9, 131256, 0, 184, 9, 131257, 0, 185, 9, 65721, 18,
+    131258, 0, 186, 9, 65722, 18, 65722, 27, 65722, 36, 65722, 45, 65722, 54, 65722, 63,
+    131259, 0, 187, 9, 131260, 0, 188, 9, 131261, 0, 189, 9, 65725, 18, 65725, 27,
+    131262, 0, 190, 9, 131263, 0, 191, 9, 131264, 0, 192, 9, 65728, 18, 65728, 27,
+    65728, 36, 65728, 45, 65728, 54, 65728, 63, 65728, 72, 65728, 81, 65728, 90, 65728, 99,
+    131265, 0, 193, 9, 131266, 0, 194, 9, 65730, 18, 65730, 27, 65730, 36, 65730, 45,
+    131267, 0, 195, 9, 65731, 18, 131268, 0, 196, 9, 65732, 18, 65732, 27, 131269, 0,
+    197, 9, 65733, 18, 65733, 27, 65733, 36, 65733, 45, 131270, 0, 198, 9, 65734, 18,
+    65734, 27, 65734, 36, 65734, 45, 131271, 0, 199, 9, 65735, 18, 65735, 27, 65735, 36,
+    65735, 45, 65735, 54, 65735, 63, 65735, 72, 65735, 81, 131272, 0, 200, 9, 65736, 18,
+    65736, 27, 65736, 36, 65736, 45, 131273, 0, 201, 9, 65737, 18, 65737, 27, 65737, 36,
+    65737, 45, 65737, 54, 65737, 63, 65737, 72, 65737, 81, 65737, 90, 131274, 0, 202, 9,
+    65738, 18, 65738, 27, 65738, 36, 65738, 45, 65738, 54, 65738, 63, 65738, 72, 65738, 81,
+    65738, 90, 131275, 0, 203, 9, 65739, 18, 65739, 27, 65739, 36, 65739, 45, 65739, 54,
+    131276, 0, 204, 9, 65740, 18, 65740, 27, 65740, 36, 65740, 45, 65740, 54, 131277, 0,
+    205, 9, 65741, 18, 65741, 27, 65741, 36, 65741, 45, 65741, 54, 65741, 63, 131278, 0,
+    206, 9, 65742, 18, 65742, 27, 65742, 36, 131279, 0, 207, 9, 65743, 18, 131280, 0,
+    208, 9, 65744, 18, 65744, 27, 131281, 0, 209, 9, 65745, 18, 65745, 27, 131282, 0,
+    210, 9, 65746, 18, 65746, 27, 65746, 36, 65746, 45, 131283, 0, 211, 9, 131284, 0,
+    212, 9, 65748, 18, 65748, 27, 65748, 36, 65748, 45, 65748, 54, 131285, 0, 213, 9,
+    65749, 18, 65749, 27, 65749, 36, 131286, 0, 214, 9, 65750, 18, 65750, 27, 65750, 36,
+    65750, 45, 65750, 54, 131287, 0, 215, 9, 65751, 18, 131288, 0, 216, 9, 65752, 18,
+    131289, 0, 217, 9, 65753, 18, 65753, 27, 65753, 36, 131290, 0, 218, 9, 131291, 0,
+    219, 9, 65755, 18, 65755, 27, 65755, 36, 65755, 45, 65755, 54, 65755, 63, 131292, 0,
+    220, 9, 65756, 18, 65756, 27, 65756, 36, 65756, 45, 65756, 54, 65756, 63, 65756, 72,
+    131293, 0, 221, 9, 131294, 0, 222, 9, 65758, 18, 65758, 27, 65758, 36, 65758, 45,
+    65758, 54, 65758, 63, 131295, 0, 223, 9, 65759, 18, 65759, 27, 65759, 36, 65759, 45,
+    131296, 0, 65761, 40, 224, 24, 65761, 72, 65767, 64, 278, 24, 279, 9, 280, 9,
+    281, 9, 282, 9, 65818, 18, 283, 9, 65819, 18, 284, 80, 285, 80, 286, 8,
+    287, 16, 65823, 32, 65765, 48, 65823, 48, 288, 24, 289, 9, 65825, 18, 290, 72,
+    291, 80, 292, 8, 293, 16, 65829, 32, 65829, 48, 294, 72, 65828, 16, 295, 16,
+    296, 24, 297, 9, 65833, 18, 298, 80, 299, 24, 300, 8, 301, 24, 65836, 40,
+    65825, 27, 65825, 36, 65833, 27, 65833, 36, 65829, 64, 302, 24, 303, 9, 65839, 18,
+    65839, 27, 65839, 36, 304, 24, 305, 8, 306, 72, 307, 8, 308, 16, 65844, 32,
+    65844, 48, 65844, 64, 65844, 80, 309, 24, 310, 9, 65846, 18, 311, 72, 312, 80,
+    313, 8, 314, 16, 65850, 32, 65850, 48, 65850, 64, 65850, 80, 65850, 96, 65765, 64,
+    65850, 112, 315, 24, 316, 9, 65852, 18, 65852, 27, 317, 80, 318, 24, 319, 8,
+    320, 144, 321, 8, 322, 5, 323, 20, 324, 20, 131396, 0, 131395, 0, 323, 80,
+    131394, 0, 322, 8, 324, 32, 325, 32, 131397, 0, 131396, 0, 324, 16, 325, 24,
+    326, 9, 65862, 18, 65862, 27, 327, 32, 131399, 0, 327, 1024, 131399, 0, 327, 32,
+    131399, 0, 327, 32, 131399, 0, 327, 32, 131399, 0, 327, 32, 131399, 0, 327, 72,
+    65843, 16, 328, 16, 65864, 32, 65864, 48, 65864, 64, 65864, 80, 329, 24, 330, 9,
+    65866, 18, 331, 72, 65849, 16, 332, 16, 65868, 32, 65868, 48, 65868, 64, 65868, 80,
+    65868, 96, 65868, 112, 333, 24, 334, 9, 65870, 18, 65870, 27, 335, 80, 336, 24,
+    337, 8, 338, 144, 339, 8, 340, 5, 341, 20, 342, 20, 131414, 0, 131413, 0,
+    341, 80, 131412, 0, 340, 10, 342, 40, 343, 40, 131415, 0, 131414, 0, 342, 16,
+    343, 24, 344, 9, 65880, 18, 65880, 27, 345, 72, 65843, 24, 346, 16, 65882, 32,
+    65882, 48, 65882, 64, 65882, 80, 347, 24, 348, 9, 65884, 18, 349, 72, 65849, 24,
+    350, 16, 65886, 32, 65886, 48, 65886, 64, 65886, 80, 65886, 96, 65886, 112, 351, 24,
+    352, 9, 65888, 18, 65888, 27, 353, 80, 354, 24, 355, 8, 356, 144, 357, 8,
+    358, 5, 359, 20, 360, 20, 131432, 0, 131431, 0, 359, 80, 131430, 0, 358, 5,
+    360, 20, 361, 20, 131433, 0, 131432, 0, 360, 16, 361, 24, 362, 9, 65898, 18,
+    65898, 27, 65839, 45, 363, 128, 65849, 32, 65765, 80, 364, 16, 365, 24, 366, 9,
+    65902, 18, 65902, 27, 367, 144, 65849, 40, 368, 5, 369, 20, 370, 20, 131442, 0,
+    131441, 0, 369, 80, 370, 16, 131440, 0, 368, 12, 371, 13, 372, 48, 373, 48,
+    131445, 0, 131444, 0, 131440, 0, 368, 32, 65904, 64, 65904, 96, 131440, 0, 368, 32,
+    131440, 0, 368, 32, 65904, 64, 65904, 96, 131440, 0, 65906, 32, 368, 24, 372, 9,
+    65908, 18, 65908, 27, 373, 144, 65849, 48, 374, 5, 375, 20, 376, 20, 131448, 0,
+    131447, 0, 375, 80, 131446, 0, 374, 16, 376, 32, 65912, 64, 65912, 96, 131448, 0,
+    65910, 32, 376, 24, 377, 9, 65913, 18, 65913, 27, 378, 72, 379, 80, 380, 8,
+    381, 16, 65917, 32, 65917, 48, 65917, 64, 382, 24, 383, 9, 384, 128, 385, 80,
+    386, 8, 387, 144, 65922, 16, 388, 5, 389, 20, 390, 20, 131462, 0, 131461, 0,
+    389, 80, 390, 16, 131460, 0, 388, 144, 65922, 24, 391, 5, 392, 20, 393, 20,
+    131465, 0, 131464, 0, 392, 80, 393, 16, 131463, 0, 391, 144, 65922, 32, 394, 5,
+    395, 20, 396, 20, 131468, 0, 131467, 0, 395, 80, 396, 16, 131466, 0, 394, 144,
+    65922, 40, 397, 5, 398, 20, 399, 20, 131471, 0, 131470, 0, 398, 80, 131469, 0,
+    397, 144, 65922, 48, 399, 5, 400, 20, 401, 20, 131473, 0, 131472, 0, 400, 80,
+    401, 16, 131471, 0, 399, 144, 65922, 56, 402, 5, 403, 20, 404, 20, 131476, 0,
+    131475, 0, 403, 80, 131474, 0, 402, 72, 65922, 64, 404, 16, 65940, 32, 65940, 48,
+    65940, 64, 65940, 80, 65940, 96, 65940, 112, 65940, 128, 65940, 144, 405, 80, 65940, 160,
+    406, 24, 407, 9, 408, 144, 409, 8, 410, 5, 411, 20, 412, 20, 131484, 0,
+    131483, 0, 411, 80, 131482, 0, 410, 16, 412, 24, 413, 9, 65949, 18, 65949, 27,
+    414, 72, 65922, 72, 415, 16, 65951, 32, 65951, 48, 65951, 64, 65951, 80, 65951, 96,
+    65951, 112, 65951, 128, 65951, 144, 416, 80, 417, 1024, 65951, 160, 418, 24, 419, 9,
+    420, 48, 421, 152, 65955, 18, 422, 48, 423, 152, 131489, 0, 65951, 176, 417, 24,
+    424, 9, 425, 144, 426, 8, 427, 5, 428, 20, 429, 20, 131501, 0, 131500, 0,
+    428, 80, 131499, 0, 427, 16, 429, 24, 430, 9, 65966, 18, 65966, 27, 431, 128,
+    65822, 16, 432, 16, 65968, 32, 65968, 48, 65968, 64, 65968, 80, 65968, 96, 65968, 112,
+    65968, 128, 65968, 144, 65968, 160, 65968, 176, 65968, 192, 65765, 96, 433, 80, 434, 20,
+    65968, 208, 435, 24, 436, 9, 65972, 18, 65972, 27, 437, 80, 438, 24, 439, 8,
+    65972, 36, 131505, 0, 131506, 0, 434, 656, 433, 164, 440, 164, 131512, 0, 440, 72,
+    65916, 16, 441, 16, 65977, 32, 65977, 48, 65977, 64, 442, 24, 443, 9, 444, 144,
+    445, 80, 446, 8, 447, 5, 448, 20, 449, 20, 131521, 0, 131520, 0, 448, 80,
+    449, 16, 131519, 0, 447, 144, 65982, 16, 450, 5, 451, 20, 452, 20, 131524, 0,
+    131523, 0, 451, 80, 131522, 0, 450, 16, 452, 168, 65982, 24, 453, 16, 65989, 32,
+    65989, 48, 65989, 64, 65989, 80, 65989, 96, 65989, 112, 65989, 128, 65989, 144, 65765, 112,
+    454, 144, 455, 80, 456, 8, 457, 16, 458, 5, 459, 20, 460, 20, 131532, 0,
+    131531, 0, 459, 80, 65993, 32, 460, 24, 461, 9, 131530, 0, 458, 1, 462, 4,
+    463, 4, 131535, 0, 131534, 0, 462, 24, 463, 8, 464, 24, 65999, 40, 465, 32,
+    66001, 64, 66001, 96, 131537, 0, 65994, 1, 465, 4, 466, 4, 131538, 0, 131537, 0,
+    65994, 1, 465, 4, 466, 4, 131538, 0, 131537, 0, 65994, 1, 465, 4, 466, 4,
+    131538, 0, 131537, 0, 65994, 1, 465, 4, 466, 4, 131538, 0, 131537, 0, 65997, 18,
+    65994, 1, 465, 4, 466, 4, 131538, 0, 131537, 0, 65989, 160, 465, 24, 466, 9,
+    467, 10, 468, 24, 469, 8, 470, 144, 65982, 32, 471, 5, 472, 20, 473, 20,
+    131545, 0, 131544, 0, 472, 80, 131543, 0, 471, 16, 473, 168, 65982, 40, 474, 16,
+    66010, 32, 66010, 48, 66010, 64, 66010, 80, 66010, 96, 66010, 112, 66010, 128, 66010, 144,
+    475, 144, 476, 80, 477, 8, 478, 16, 479, 5, 480, 20, 481, 20, 131553, 0,
+    131552, 0, 480, 80, 66014, 32, 481, 24, 482, 9, 131551, 0, 479, 1, 483, 4,
+    484, 4, 131556, 0, 131555, 0, 483, 24, 484, 8, 485, 24, 66020, 40, 66015, 1,
+    486, 4, 487, 4, 131559, 0, 131558, 0, 66015, 1, 486, 4, 487, 4, 131559, 0,
+    131558, 0, 66015, 1, 486, 4, 487, 4, 131559, 0, 131558, 0, 66015, 1, 486, 4,
+    487, 4, 131559, 0, 131558, 0, 66018, 18, 66015, 1, 486, 4, 487, 4, 131559, 0,
+    131558, 0, 66010, 160, 486, 24, 487, 9, 488, 1, 489, 14, 490, 24, 491, 8,
+    492, 144, 65982, 48, 493, 5, 494, 20, 495, 20, 131567, 0, 131566, 0, 494, 80,
+    131565, 0, 493, 16, 495, 128, 65982, 56, 496, 16, 66032, 32, 66032, 48, 66032, 64,
+    66032, 80, 66032, 96, 66032, 112, 66032, 128, 66032, 144, 65765, 128, 497, 80, 65822, 24,
+    498, 16, 66034, 32, 66034, 48, 66034, 64, 66034, 80, 66034, 96, 66034, 112, 66034, 128,
+    66034, 144, 65765, 144, 499, 144, 500, 80, 501, 8, 502, 5, 503, 20, 504, 20,
+    131576, 0, 131575, 0, 503, 80, 504, 144, 65982, 64, 505, 5, 506, 20, 507, 20,
+    131579, 0, 131578, 0, 506, 80, 131577, 0, 505, 16, 507, 168, 65982, 72, 508, 16,
+    66044, 32, 66044, 48, 66044, 64, 66044, 80, 66044, 96, 66044, 112, 66044, 128, 66044, 144,
+    509, 144, 510, 80, 511, 8, 512, 16, 513, 5, 514, 20, 515, 20, 131587, 0,
+    131586, 0, 514, 80, 66048, 32, 515, 24, 516, 9, 131585, 0, 513, 1, 517, 4,
+    518, 4, 131590, 0, 131589, 0, 517, 24, 518, 8, 519, 24, 66054, 40, 66049, 1,
+    520, 4, 521, 4, 131593, 0, 131592, 0, 66049, 1, 520, 4, 521, 4, 131593, 0,
+    131592, 0, 66049, 1, 520, 4, 521, 4, 131593, 0, 131592, 0, 66049, 1, 520, 4,
+    521, 4, 131593, 0, 131592, 0, 66052, 18, 66049, 1, 520, 4, 521, 4, 131593, 0,
+    131592, 0, 66044, 160, 520, 24, 521, 9, 522, 24, 523, 8, 524, 72, 65916, 24,
+    525, 16, 66061, 32, 66061, 48, 526, 144, 527, 80, 528, 8, 529, 5, 530, 20,
+    531, 20, 131603, 0, 131602, 0, 530, 80, 531, 16, 131601, 0, 529, 144, 66064, 16,
+    532, 5, 533, 20, 534, 20, 131606, 0, 131605, 0, 533, 80, 131604, 0, 532, 16,
+    534, 224, 66064, 24, 535, 16, 66071, 32, 66071, 48, 66071, 64, 66071, 80, 66071, 96,
+    66071, 112, 66071, 128, 66071, 144, 66071, 160, 65765, 160, 536, 80, 66071, 176, 537, 24,
+    538, 9, 539, 24, 540, 8, 541, 144, 66064, 32, 542, 5, 543, 20, 544, 20,
+    131616, 0, 131615, 0, 543, 80, 131614, 0, 542, 16, 544, 80, 66064, 40, 545, 16,
+    66081, 32, 66081, 48, 66081, 64, 66081, 80, 66081, 96, 66081, 112, 66081, 128, 66081, 144,
+    66081, 160, 66081, 176, 66081, 192, 65765, 176, 546, 144, 66064, 48, 547, 5, 548, 20,
+    549, 20, 131621, 0, 131620, 0, 548, 80, 131619, 0, 547, 16, 549, 80, 66064, 56,
+    550, 16, 66086, 32, 66086, 48, 66086, 64, 66086, 80, 66086, 96, 66086, 112, 66086, 128,
+    66086, 144, 66086, 160, 66086, 176, 66086, 192, 65846, 27, 65846, 36, 65846, 45, 65919, 18,
+    65919, 27, 65919, 36, 65919, 45, 65919, 54, 65919, 63, 65919, 72, 65919, 81, 65919, 90,
+    551, 16, 552, 24, 553, 9, 66089, 18, 66089, 27, 66089, 36, 66089, 45, 66089, 54,
+    65926, 32, 554, 24, 555, 9, 66091, 18, 66091, 27, 66091, 36, 66091, 45, 66091, 54,
+    65929, 32, 556, 24, 557, 9, 66093, 18, 66093, 27, 66093, 36, 66093, 45, 66093, 54,
+    65932, 32, 558, 24, 559, 9, 66095, 18, 66095, 27, 66095, 36, 66095, 45, 66095, 54,
+    560, 16, 561, 24, 562, 9, 66098, 18, 66098, 27, 66098, 36, 66098, 45, 66098, 54,
+    65937, 32, 563, 24, 564, 9, 66100, 18, 66100, 27, 66100, 36, 66100, 45, 66100, 54,
+    565, 16, 566, 24, 567, 9, 66103, 18, 66103, 27, 66103, 36, 66103, 45, 66103, 54,
+    65943, 18, 65943, 27, 65943, 36, 65943, 45, 65943, 54, 65943, 63, 65960, 18, 65960, 27,
+    65960, 36, 65960, 45, 65960, 54, 65960, 63, 65979, 18, 65979, 27, 65979, 36, 65979, 45,
+    65979, 54, 65979, 63, 65979, 72, 65979, 81, 65979, 90, 65985, 32, 568, 24, 569, 9,
+    66105, 18, 66105, 27, 66105, 36, 66105, 45, 66105, 54, 66002, 18, 66002, 27, 66002, 36,
+    66002, 45, 66002, 54, 66002, 63, 65986, 32, 570, 24, 571, 9, 66107, 18, 66107, 27,
+    66107, 36, 66107, 45, 66107, 54, 66023, 18, 66023, 27, 66023, 36, 66023, 45, 66023, 54,
+    66023, 63, 66007, 32, 572, 24, 573, 9, 66109, 18, 66109, 27, 66109, 36, 66109, 45,
+    66109, 54, 66057, 18, 66057, 27, 66057, 36, 66057, 45, 66057, 54, 66057, 63, 66041, 32,
+    574, 24, 575, 9, 66111, 18, 66111, 27, 66111, 36, 66111, 45, 66111, 54, 66032, 160,
+    576, 24, 577, 9, 66113, 18, 66113, 27, 66113, 36, 66113, 45, 66113, 54, 66029, 32,
+    578, 24, 579, 9, 66115, 18, 66115, 27, 66115, 36, 66115, 45, 66115, 54, 66061, 64,
+    580, 24, 581, 9, 66117, 18, 66117, 27, 66117, 36, 66117, 45, 66117, 54, 66117, 63,
+    66117, 72, 66117, 81, 66067, 32, 582, 24, 583, 9, 66119, 18, 66119, 27, 66119, 36,
+    66119, 45, 66119, 54, 66074, 18, 66074, 27, 66074, 36, 66074, 45, 66074, 54, 66074, 63,
+    66068, 32, 584, 24, 585, 9, 66121, 18, 66121, 27, 66121, 36, 66121, 45, 66121, 54,
+    66086, 208, 586, 24, 587, 9, 66123, 18, 66123, 27, 66123, 36, 66123, 45, 66123, 54,
+    66083, 32, 588, 24, 589, 9, 66125, 18, 66125, 27, 66125, 36, 66125, 45, 66125, 54,
+    66081, 208, 590, 24, 591, 9, 66127, 18, 66127, 27, 66127, 36, 66127, 45, 66127, 54,
+    66078, 32, 592, 24, 593, 9, 66129, 18, 66129, 27, 66129, 36, 66129, 45, 66129, 54,
+    65866, 27, 65866, 36, 594, 72, 595, 80, 596, 8, 597, 16, 66133, 32, 66133, 48,
+    66133, 64, 598, 24, 599, 9, 66135, 18, 66135, 27, 66135, 36, 66135, 45, 66135, 54,
+    66135, 63, 66135, 72, 600, 144, 601, 80, 602, 8, 603, 5, 604, 20, 605, 20,
+    131677, 0, 131676, 0, 604, 80, 605, 16, 131675, 0, 66141, 32, 603, 24, 606, 9,
+    66142, 18, 66142, 27, 66142, 36, 66142, 45, 66142, 54, 607, 144, 66138, 16, 608, 16,
+    66144, 32, 66144, 48, 65765, 192, 609, 80, 66144, 64, 610, 24, 611, 9, 66147, 18,
+    66147, 27, 66147, 36, 66147, 45, 66147, 54, 612, 72, 66138, 24, 613, 16, 66149, 32,
+    66149, 48, 66149, 32, 66149, 48, 614, 24, 615, 9, 66151, 18, 66151, 27, 66151, 36,
+    66151, 45, 66151, 54, 66151, 63, 66151, 72, 66151, 81, 616, 80, 617, 176, 618, 8,
+    619, 16, 66155, 32, 66155, 48, 66155, 64, 66155, 80, 66155, 96, 66155, 112, 66155, 128,
+    65765, 208, 66155, 144, 620, 24, 621, 9, 66157, 18, 66157, 27, 66157, 36, 66157, 45,
+    66157, 54, 66157, 63, 622, 80, 623, 24, 624, 8, 66157, 72, 66157, 81, 625, 144,
+    66154, 16, 626, 16, 66162, 32, 66162, 48, 627, 80, 66162, 64, 628, 24, 629, 9,
+    66165, 18, 66165, 27, 66165, 36, 66165, 45, 66165, 54, 66165, 63, 66165, 72, 66165, 81,
+    66165, 90, 66147, 63, 66147, 72, 630, 48, 631, 48, 632, 72, 66132, 16, 633, 16,
+    66169, 32, 66169, 48, 66169, 64, 634, 24, 635, 9, 66171, 18, 66171, 27, 66171, 36,
+    66171, 45, 66171, 54, 66171, 63, 66171, 72, 636, 144, 637, 80, 638, 8, 639, 5,
+    640, 20, 641, 20, 131713, 0, 131712, 0, 640, 80, 641, 16, 131711, 0, 66177, 32,
+    639, 24, 642, 9, 66178, 18, 66178, 27, 66178, 36, 66178, 45, 66178, 54, 643, 144,
+    66174, 16, 644, 16, 66180, 32, 66180, 48, 645, 80, 66180, 64, 646, 24, 647, 9,
+    66183, 18, 66183, 27, 66183, 36, 66183, 45, 66183, 54, 648, 72, 66174, 24, 649, 16,
+    66185, 32, 66185, 48, 66185, 32, 66185, 48, 650, 24, 651, 9, 66187, 18, 66187, 27,
+    66187, 36, 66187, 45, 66187, 54, 66187, 63, 66187, 72, 66187, 81, 652, 80, 653, 176,
+    654, 8, 655, 16, 66191, 32, 66191, 48, 66191, 64, 66191, 80, 66191, 96, 66191, 112,
+    66191, 128, 66191, 144, 656, 24, 657, 9, 66193, 18, 66193, 27, 66193, 36, 66193, 45,
+    66193, 54, 66193, 63, 658, 80, 659, 24, 660, 8, 66193, 72, 66193, 81, 661, 144,
+    66190, 16, 662, 16, 66198, 32, 66198, 48, 663, 80, 66198, 64, 664, 24, 665, 9,
+    66201, 18, 66201, 27, 66201, 36, 66201, 45, 66201, 54, 66201, 63, 66201, 72, 66201, 81,
+    66201, 90, 66183, 63, 66183, 72, 666, 48, 667, 48, 668, 48, 669, 48, 670, 20,
+    671, 20, 672, 24, 673, 24, 131744, 0, 131742, 0, 131745, 0, 131743, 0, 671, 28,
+    673, 28, 670, 8, 672, 8, 674, 1024, 65989, 176, 675, 24, 676, 9, 677, 48,
+    678, 152, 131746, 0, 65994, 1, 674, 4, 679, 4, 131751, 0, 131746, 0, 674, 152,
+    679, 1024, 66010, 176, 680, 24, 681, 9, 682, 48, 683, 152, 131751, 0, 66015, 1,
+    679, 4, 684, 4, 131756, 0, 131751, 0, 679, 152, 684, 1024, 66044, 176, 685, 24,
+    686, 9, 687, 48, 688, 152, 131756, 0, 66049, 1, 684, 4, 689, 4, 131761, 0,
+    131756, 0, 684, 152, 131742, 0, 131743, 0, 131744, 0, 131745, 0, 673, 28, 672, 28,
+    671, 8, 670, 8, 131743, 0, 131745, 0, 131742, 0, 131744, 0, 672, 8, 670, 8,
+    673, 8, 671, 8, 131745, 0, 131744, 0, 131743, 0, 131742, 0, 670, 12, 671, 8,
+    672, 8, 131742, 0, 670, 8, 673, 4, 689, 4, 131742, 0, 131745, 0, 131743, 0,
+    131761, 0, 131744, 0, 672, 12, 689, 12, 671, 8, 673, 8, 131743, 0, 131744, 0,
+    131745, 0, 131761, 0, 689, 12, 673, 8, 672, 8, 131761, 0, 689, 8, 671, 4,
+    670, 4, 131761, 0, 131743, 0, 131745, 0, 131742, 0, 131744, 0, 672, 12, 670, 12,
+    673, 8, 671, 8, 131745, 0, 131744, 0, 131743, 0, 131742, 0, 670, 32, 131742, 0,
+    670, 32, 131742, 0, 670, 20, 671, 20, 672, 24, 673, 24, 131744, 0, 131742, 0,
+    131745, 0, 131743, 0, 65994, 1, 671, 4, 673, 4, 131745, 0, 131743, 0, 66015, 1,
+    671, 4, 673, 4, 131745, 0, 131743, 0, 66049, 1, 671, 4, 673, 4, 131745, 0,
+    131743, 0, 671, 28, 673, 28, 670, 8, 672, 8, 131746, 0, 131751, 0, 131756, 0,
+    131742, 0, 131743, 0, 131744, 0, 131745, 0, 673, 28, 672, 28, 671, 8, 670, 8,
+    131743, 0, 131745, 0, 131742, 0, 131744, 0, 672, 8, 670, 8, 673, 8, 671, 8,
+    131745, 0, 131744, 0, 131743, 0, 131742, 0, 670, 12, 671, 8, 672, 8, 131742, 0,
+    670, 8, 673, 4, 684, 4, 131742, 0, 131745, 0, 131743, 0, 131756, 0, 131744, 0,
+    672, 12, 684, 12, 671, 8, 673, 8, 131743, 0, 131744, 0, 131745, 0, 131756, 0,
+    684, 12, 673, 8, 672, 8, 131756, 0, 684, 8, 671, 4, 670, 4, 131756, 0,
+    131743, 0, 131745, 0, 131742, 0, 131744, 0, 672, 12, 670, 12, 673, 8, 671, 8,
+    131745, 0, 131744, 0, 131743, 0, 131742, 0, 670, 32, 131742, 0, 670, 32, 131742, 0,
+    670, 20, 671, 20, 672, 24, 673, 24, 131744, 0, 131742, 0, 131745, 0, 131743, 0,
+    65994, 1, 671, 4, 673, 4, 131745, 0, 131743, 0, 66015, 1, 671, 4, 673, 4,
+    131745, 0, 131743, 0, 66049, 1, 671, 4, 673, 4, 131745, 0, 131743, 0, 671, 28,
+    673, 28, 670, 8, 672, 8, 131742, 0, 131743, 0, 131744, 0, 131745, 0, 673, 8,
+    672, 8, 671, 8, 670, 8, 131743, 0, 131745, 0, 131742, 0, 131744, 0, 672, 12,
+    670, 8, 673, 8, 131744, 0, 672, 8, 671, 4, 684, 4, 131744, 0, 131743, 0,
+    131742, 0, 131756, 0, 131745, 0, 673, 12, 684, 12, 670, 8, 671, 8, 131742, 0,
+    131745, 0, 131743, 0, 131756, 0, 684, 12, 671, 8, 673, 8, 131756, 0, 684, 8,
+    670, 4, 672, 4, 131756, 0, 131742, 0, 131743, 0, 131744, 0, 131745, 0, 673, 12,
+    672, 12, 671, 8, 670, 8, 131743, 0, 131745, 0, 131742, 0, 131744, 0, 672, 20,
+    670, 20, 673, 24, 671, 24, 131745, 0, 131744, 0, 131743, 0, 131742, 0, 670, 72,
+    66132, 24, 671, 16, 66207, 32, 66207, 48, 66207, 64, 672, 24, 673, 9, 66209, 18,
+    684, 144, 679, 80, 674, 8, 689, 5, 690, 20, 691, 20, 131763, 0, 131762, 0,
+    690, 80, 691, 16, 131761, 0, 689, 144, 66210, 16, 692, 16, 66228, 32, 66228, 48,
+    693, 80, 66228, 64, 694, 24, 695, 9, 696, 72, 66210, 24, 697, 16, 66233, 32,
+    66233, 48, 66233, 64, 698, 24, 699, 9, 66235, 18, 66233, 48, 66233, 64, 66235, 27,
+    700, 144, 66210, 32, 701, 5, 702, 20, 703, 20, 131775, 0, 131774, 0, 702, 80,
+    131773, 0, 701, 72, 66210, 40, 703, 16, 66239, 32, 66239, 48, 66239, 64, 704, 24,
+    705, 9, 66241, 18, 66239, 48, 66239, 64, 66241, 27, 706, 144, 66210, 48, 707, 5,
+    708, 20, 709, 20, 131781, 0, 131780, 0, 708, 80, 131779, 0, 707, 72, 66210, 56,
+    709, 16, 66245, 32, 66245, 48, 66245, 64, 710, 24, 711, 9, 66247, 18, 66245, 48,
+    66245, 64, 66247, 27, 712, 144, 66210, 64, 713, 5, 714, 20, 715, 20, 131787, 0,
+    131786, 0, 714, 80, 131785, 0, 66209, 27, 66209, 36, 66209, 45, 66227, 32, 713, 24,
+    715, 9, 66251, 18, 66251, 27, 66251, 36, 66251, 45, 66251, 54, 66231, 18, 66231, 27,
+    66231, 36, 66231, 45, 66231, 54, 66231, 63, 66235, 36, 66235, 45, 66235, 54, 66235, 63,
+    66235, 72, 66235, 81, 66241, 36, 66241, 45, 66241, 54, 66241, 63, 66241, 72, 66241, 81,
+    66247, 36, 66247, 45, 66247, 54, 66247, 63, 66247, 72, 66247, 81, 716, 16, 717, 24,
+    718, 9, 66254, 18, 66254, 27, 66254, 36, 66254, 45, 66254, 54, 719, 16, 720, 24,
+    721, 9, 66257, 18, 66257, 27, 66257, 36, 66257, 45, 66257, 54, 722, 16, 723, 24,
+    724, 9, 66260, 18, 66260, 27, 66260, 36, 66260, 45, 66260, 54, 725, 72, 66132, 32,
+    726, 16, 66262, 32, 66262, 48, 66262, 64, 727, 24, 728, 9, 66264, 18, 729, 144,
+    730, 80, 731, 8, 732, 5, 733, 20, 734, 20, 131806, 0, 131805, 0, 733, 80,
+    734, 16, 131804, 0, 732, 144, 66267, 16, 735, 16, 66271, 32, 66271, 48, 736, 80,
+    66271, 64, 737, 24, 738, 9, 739, 72, 66267, 24, 740, 16, 66276, 32, 66276, 48,
+    66276, 64, 741, 24, 742, 9, 66278, 18, 66276, 48, 66276, 64, 66278, 27, 743, 144,
+    66267, 32, 744, 5, 745, 20, 746, 20, 131818, 0, 131817, 0, 745, 80, 131816, 0,
+    744, 72, 66267, 40, 746, 16, 66282, 32, 66282, 48, 66282, 64, 747, 24, 748, 9,
+    66284, 18, 66282, 48, 66282, 64, 66284, 27, 749, 144, 66267, 48, 750, 5, 751, 20,
+    752, 20, 131824, 0, 131823, 0, 751, 80, 131822, 0, 750, 72, 66267, 56, 752, 16,
+    66288, 32, 66288, 48, 66288, 64, 753, 24, 754, 9, 66290, 18, 66288, 48, 66288, 64,
+    66290, 27, 755, 144, 66267, 64, 756, 5, 757, 20, 758, 20, 131830, 0, 131829, 0,
+    757, 80, 131828, 0, 66264, 27, 66264, 36, 66264, 45, 66270, 32, 756, 24, 758, 9,
+    66294, 18, 66294, 27, 66294, 36, 66294, 45, 66294, 54, 66274, 18, 66274, 27, 66274, 36,
+    66274, 45, 66274, 54, 66274, 63, 66278, 36, 66278, 45, 66278, 54, 66278, 63, 66278, 72,
+    66278, 81, 66284, 36, 66284, 45, 66284, 54, 66284, 63, 66284, 72, 66284, 81, 66290, 36,
+    66290, 45, 66290, 54, 66290, 63, 66290, 72, 66290, 81, 759, 16, 760, 24, 761, 9,
+    66297, 18, 66297, 27, 66297, 36, 66297, 45, 66297, 54, 762, 16, 763, 24, 764, 9,
+    66300, 18, 66300, 27, 66300, 36, 66300, 45, 66300, 54, 765, 16, 766, 24, 767, 9,
+    66303, 18, 66303, 27, 66303, 36, 66303, 45, 66303, 54, 768, 72, 66132, 40, 769, 16,
+    66305, 32, 66305, 48, 66305, 64, 770, 24, 771, 9, 66307, 18, 772, 144, 773, 80,
+    774, 8, 775, 5, 776, 20, 777, 20, 131849, 0, 131848, 0, 776, 80, 777, 16,
+    131847, 0, 775, 144, 66310, 16, 778, 16, 66314, 32, 66314, 48, 779, 80, 66314, 64,
+    780, 24, 781, 9, 782, 72, 66310, 24, 783, 16, 66319, 32, 66319, 48, 66319, 64,
+    784, 24, 785, 9, 66321, 18, 66319, 48, 66319, 64, 66321, 27, 786, 144, 66310, 32,
+    787, 5, 788, 20, 789, 20, 131861, 0, 131860, 0, 788, 80, 131859, 0, 787, 72,
+    66310, 40, 789, 16, 66325, 32, 66325, 48, 66325, 64, 790, 24, 791, 9, 66327, 18,
+    66325, 48, 66325, 64, 66327, 27, 792, 144, 66310, 48, 793, 5, 794, 20, 795, 20,
+    131867, 0, 131866, 0, 794, 80, 131865, 0, 793, 72, 66310, 56, 795, 16, 66331, 32,
+    66331, 48, 66331, 64, 796, 24, 797, 9, 66333, 18, 66331, 48, 66331, 64, 66333, 27,
+    798, 144, 66310, 64, 799, 5, 800, 20, 801, 20, 131873, 0, 131872, 0, 800, 80,
+    131871, 0, 66307, 27, 66307, 36, 66307, 45, 66313, 32, 799, 24, 801, 9, 66337, 18,
+    66337, 27, 66337, 36, 66337, 45, 66337, 54, 66317, 18, 66317, 27, 66317, 36, 66317, 45,
+    66317, 54, 66317, 63, 66321, 36, 66321, 45, 66321, 54, 66321, 63, 66321, 72, 66321, 81,
+    66327, 36, 66327, 45, 66327, 54, 66327, 63, 66327, 72, 66327, 81, 66333, 36, 66333, 45,
+    66333, 54, 66333, 63, 66333, 72, 66333, 81, 802, 16, 803, 24, 804, 9, 66340, 18,
+    66340, 27, 66340, 36, 66340, 45, 66340, 54, 805, 16, 806, 24, 807, 9, 66343, 18,
+    66343, 27, 66343, 36, 66343, 45, 66343, 54, 808, 16, 809, 24, 810, 9, 66346, 18,
+    66346, 27, 66346, 36, 66346, 45, 66346, 54, 811, 12, 812, 8, 813, 8, 131883, 0,
+    811, 8, 814, 4, 815, 4, 131883, 0, 131886, 0, 131884, 0, 131887, 0, 131885, 0,
+    813, 20, 815, 20, 812, 8, 814, 8, 131884, 0, 131885, 0, 131886, 0, 131887, 0,
+    815, 20, 814, 20, 813, 8, 812, 8, 131885, 0, 131887, 0, 131884, 0, 131886, 0,
+    814, 20, 812, 20, 815, 8, 813, 8, 131887, 0, 131886, 0, 131885, 0, 131884, 0,
+    812, 32, 131884, 0, 812, 32, 131884, 0, 812, 32, 66348, 64, 66348, 96, 131884, 0,
+    812, 20, 813, 20, 814, 8, 815, 8, 131886, 0, 131884, 0, 131887, 0, 131885, 0,
+    813, 20, 815, 20, 812, 8, 814, 8, 131884, 0, 131885, 0, 131886, 0, 131887, 0,
+    815, 20, 814, 20, 813, 8, 812, 8, 131885, 0, 131887, 0, 131884, 0, 131886, 0,
+    814, 32, 131886, 0, 814, 32, 131886, 0, 814, 32, 66350, 64, 66350, 96, 131886, 0,
+    814, 20, 812, 20, 815, 8, 813, 8, 131887, 0, 131886, 0, 131885, 0, 131884, 0,
+    812, 20, 813, 20, 814, 8, 815, 8, 131886, 0, 131884, 0, 131887, 0, 131885, 0,
+    813, 20, 815, 20, 812, 8, 814, 8, 131884, 0, 131885, 0, 131886, 0, 131887, 0,
+    815, 32, 131887, 0, 815, 32, 131887, 0, 815, 32, 66351, 64, 66351, 96, 131887, 0,
+    815, 20, 814, 20, 813, 8, 812, 8, 131885, 0, 131887, 0, 131884, 0, 131886, 0,
+    814, 20, 812, 20, 815, 8, 813, 8, 131887, 0, 131886, 0, 131885, 0, 131884, 0,
+    812, 20, 813, 20, 814, 8, 815, 8, 131886, 0, 131884, 0, 131887, 0, 131885, 0,
+    66231, 72, 66274, 72, 66317, 72, 66231, 81, 66231, 90, 66231, 99, 66231, 108, 813, 128,
+    815, 8, 812, 16, 66348, 32, 66348, 48, 66348, 64, 65765, 224, 814, 80, 66348, 48,
+    66348, 32, 66348, 48, 811, 24, 816, 9, 66352, 18, 66352, 27, 66348, 64, 817, 24,
+    818, 9, 66354, 18, 819, 152, 820, 14, 821, 15, 822, 56, 823, 56, 131895, 0,
+    131894, 0, 131892, 0, 820, 128, 66351, 16, 822, 16, 66358, 32, 66358, 48, 66358, 64,
+    823, 80, 66358, 48, 66358, 64, 824, 24, 825, 9, 66361, 18, 66361, 27, 66361, 36,
+    66361, 45, 66361, 54, 66361, 63, 66358, 80, 826, 24, 827, 9, 66363, 18, 66361, 72,
+    66361, 81, 66361, 90, 828, 152, 131893, 0, 821, 14, 829, 15, 830, 56, 831, 56,
+    131903, 0, 131902, 0, 131893, 0, 821, 128, 66351, 24, 830, 16, 66366, 32, 66366, 48,
+    66366, 64, 831, 80, 66366, 48, 66366, 64, 832, 24, 833, 9, 66369, 18, 66369, 27,
+    66369, 36, 66369, 45, 66369, 54, 66369, 63, 66366, 80, 834, 24, 835, 9, 66371, 18,
+    66369, 72, 66369, 81, 66369, 90, 836, 152, 131901, 0, 829, 14, 837, 15, 838, 56,
+    839, 56, 131911, 0, 131910, 0, 131901, 0, 66271, 80, 829, 24, 838, 9, 839, 128,
+    840, 8, 841, 16, 66377, 32, 66377, 48, 66377, 64, 842, 80, 66377, 80, 843, 24,
+    844, 9, 66380, 18, 66380, 27, 66380, 36, 66380, 45, 66380, 54, 66377, 96, 845, 24,
+    846, 9, 66380, 63, 66377, 112, 847, 24, 848, 9, 66384, 18, 66384, 27, 66380, 72,
+    66380, 81, 66380, 90, 849, 128, 66376, 16, 850, 16, 66386, 32, 66386, 48, 66386, 64,
+    851, 80, 66386, 80, 852, 24, 853, 9, 66389, 18, 66389, 27, 66389, 36, 66389, 45,
+    66389, 54, 66389, 63, 66386, 96, 854, 24, 855, 9, 66386, 112, 856, 24, 857, 9,
+    66393, 18, 66393, 27, 66389, 72, 66389, 81, 66389, 90, 858, 128, 66376, 24, 859, 16,
+    66395, 32, 66395, 48, 66395, 64, 860, 80, 66395, 80, 861, 24, 862, 9, 66398, 18,
+    66398, 27, 66395, 96, 863, 24, 864, 9, 66395, 112, 865, 24, 866, 9, 66402, 18,
+    66402, 27, 66398, 36, 66398, 45, 66398, 54, 867, 56, 868, 24, 869, 8, 66314, 80,
+    870, 24, 871, 9, 66314, 96, 872, 24, 873, 9, 874, 9, 66410, 18, 875, 9,
+    66411, 18, 876, 9, 66412, 18, 877, 9, 66413, 18, 878, 9, 66414, 18, 879, 9,
+    66415, 18, 880, 9, 66416, 18, 881, 9, 66417, 18, 882, 9, 66418, 18, 883, 24,
+    884, 8, 885, 88, 886, 88, 887, 128, 888, 8, 889, 20, 890, 20, 891, 8,
+    892, 8, 131963, 0, 131961, 0, 131964, 0, 131962, 0, 890, 20, 892, 20, 889, 8,
+    891, 8, 131961, 0, 131962, 0, 131963, 0, 131964, 0, 892, 20, 891, 20, 890, 8,
+    889, 8, 131962, 0, 131964, 0, 131961, 0, 131963, 0, 891, 32, 131963, 0, 891, 32,
+    131963, 0, 891, 32, 66427, 64, 66427, 96, 131963, 0, 891, 20, 889, 20, 892, 8,
+    890, 8, 131964, 0, 131963, 0, 131962, 0, 131961, 0, 889, 20, 890, 20, 891, 8,
+    892, 8, 131963, 0, 131961, 0, 131964, 0, 131962, 0, 890, 20, 892, 20, 889, 8,
+    891, 8, 131961, 0, 131962, 0, 131963, 0, 131964, 0, 892, 16, 891, 24, 890, 9,
+    66426, 18, 66426, 27, 889, 144, 66424, 16, 893, 5, 894, 20, 895, 20, 131967, 0,
+    131966, 0, 894, 80, 895, 16, 131965, 0, 893, 144, 66424, 24, 896, 5, 897, 20,
+    898, 20, 131970, 0, 131969, 0, 897, 80, 131968, 0, 896, 5, 898, 20, 899, 20,
+    131971, 0, 131970, 0, 898, 152, 899, 80, 900, 3, 901, 4, 902, 12, 903, 12,
+    131975, 0, 131974, 0, 131972, 0, 66431, 32, 900, 24, 902, 9, 66438, 18, 66438, 27,
+    903, 16, 904, 24, 905, 9, 66441, 18, 66441, 27, 906, 24, 66420, 40, 65884, 27,
+    65884, 36, 907, 72, 908, 80, 909, 8, 910, 16, 66446, 32, 66446, 48, 66446, 64,
+    911, 24, 912, 9, 66448, 18, 66448, 27, 913, 144, 914, 80, 915, 8, 916, 5,
+    917, 20, 918, 20, 131990, 0, 131989, 0, 917, 80, 918, 16, 131988, 0, 916, 144,
+    66451, 16, 919, 5, 920, 20, 921, 20, 131993, 0, 131992, 0, 920, 80, 921, 16,
+    131991, 0, 66457, 32, 919, 144, 66451, 24, 922, 5, 923, 20, 924, 20, 131996, 0,
+    131995, 0, 923, 80, 924, 16, 131994, 0, 922, 144, 66451, 32, 925, 5, 926, 20,
+    927, 20, 131999, 0, 131998, 0, 926, 80, 131997, 0, 925, 25, 927, 92, 928, 92,
+    132000, 0, 131999, 0, 927, 16, 928, 24, 929, 9, 930, 176, 66451, 40, 931, 16,
+    66467, 32, 66467, 48, 66467, 64, 66467, 80, 66467, 96, 66467, 112, 66467, 128, 932, 80,
+    933, 24, 934, 8, 935, 48, 936, 28, 937, 48, 938, 28, 939, 48, 940, 28,
+    66467, 144, 941, 24, 942, 9, 66478, 18, 66478, 27, 66448, 36, 66448, 45, 66448, 54,
+    66454, 32, 943, 24, 944, 9, 66480, 18, 66480, 27, 66480, 36, 66480, 45, 66480, 54,
+    66457, 48, 945, 24, 946, 9, 66482, 18, 66482, 27, 66482, 36, 66482, 45, 66482, 54,
+    66460, 32, 947, 24, 948, 9, 66484, 18, 66484, 27, 66484, 36, 66484, 45, 66484, 54,
+    66465, 18, 66465, 27, 66465, 36, 66465, 45, 66465, 54, 66465, 63, 66478, 36, 66478, 45,
+    66478, 54, 66478, 63, 66478, 72, 66478, 81, 949, 72, 66445, 16, 950, 16, 66486, 32,
+    66486, 48, 66486, 64, 951, 24, 952, 9, 66488, 18, 66488, 27, 66488, 36, 66488, 45,
+    953, 144, 954, 80, 955, 8, 956, 5, 957, 20, 958, 20, 132030, 0, 132029, 0,
+    957, 80, 958, 16, 132028, 0, 956, 72, 66491, 16, 959, 16, 66495, 32, 66495, 48,
+    66495, 32, 66495, 16, 132031, 0, 959, 16, 960, 24, 961, 9, 66497, 18, 66497, 27,
+    66497, 36, 66497, 45, 962, 128, 963, 80, 964, 8, 965, 16, 966, 24, 967, 9,
+    66503, 18, 66503, 27, 66503, 36, 66503, 45, 66503, 54, 968, 144, 66500, 16, 969, 5,
+    970, 20, 971, 20, 132043, 0, 132042, 0, 970, 80, 132041, 0, 969, 16, 971, 24,
+    972, 9, 66508, 18, 66508, 27, 66508, 36, 66508, 45, 66508, 54, 973, 144, 66500, 24,
+    974, 5, 975, 20, 976, 20, 132048, 0, 132047, 0, 975, 80, 132046, 0, 974, 16,
+    66510, 32, 976, 24, 977, 9, 66513, 18, 66513, 27, 66513, 36, 66513, 45, 66513, 54,
+    978, 144, 66500, 32, 979, 5, 980, 20, 981, 20, 132053, 0, 132052, 0, 980, 80,
+    132051, 0, 979, 16, 981, 24, 982, 9, 66518, 18, 66518, 27, 66518, 36, 66518, 45,
+    66518, 54, 983, 72, 66491, 24, 984, 16, 66520, 32, 66520, 48, 66520, 32, 66520, 16,
+    132056, 0, 984, 16, 985, 24, 986, 9, 66522, 18, 66522, 27, 66522, 36, 66522, 45,
+    987, 128, 988, 80, 989, 8, 990, 16, 991, 24, 992, 9, 66528, 18, 66528, 27,
+    66528, 36, 66528, 45, 66528, 54, 993, 144, 66525, 16, 994, 5, 995, 20, 996, 20,
+    132068, 0, 132067, 0, 995, 80, 132066, 0, 994, 16, 996, 24, 997, 9, 66533, 18,
+    66533, 27, 66533, 36, 66533, 45, 66533, 54, 998, 144, 66525, 24, 999, 5, 1000, 20,
+    1001, 20, 132073, 0, 132072, 0, 1000, 80, 132071, 0, 999, 16, 66535, 32, 1001, 24,
+    1002, 9, 66538, 18, 66538, 27, 66538, 36, 66538, 45, 66538, 54, 1003, 144, 66525, 32,
+    1004, 5, 1005, 20, 1006, 20, 132078, 0, 132077, 0, 1005, 80, 132076, 0, 1004, 16,
+    1006, 24, 1007, 9, 66543, 18, 66543, 27, 66543, 36, 66543, 45, 66543, 54, 1008, 72,
+    66491, 32, 1009, 16, 66545, 32, 66545, 48, 66545, 32, 66545, 16, 132081, 0, 1009, 16,
+    1010, 24, 1011, 9, 66547, 18, 66547, 27, 66547, 36, 66547, 45, 1012, 128, 1013, 80,
+    1014, 8, 1015, 16, 1016, 24, 1017, 9, 66553, 18, 66553, 27, 66553, 36, 66553, 45,
+    66553, 54, 1018, 144, 66550, 16, 1019, 5, 1020, 20, 1021, 20, 132093, 0, 132092, 0,
+    1020, 80, 132091, 0, 1019, 16, 1021, 24, 1022, 9, 66558, 18, 66558, 27, 66558, 36,
+    66558, 45, 66558, 54, 1023, 144, 66550, 24, 1024, 5, 1025, 20, 1026, 20, 132098, 0,
+    132097, 0, 1025, 80, 132096, 0, 1024, 16, 66560, 32, 1026, 24, 1027, 9, 66563, 18,
+    66563, 27, 66563, 36, 66563, 45, 66563, 54, 1028, 144, 66550, 32, 1029, 5, 1030, 20,
+    1031, 20, 132103, 0, 132102, 0, 1030, 80, 132101, 0, 1029, 16, 1031, 24, 1032, 9,
+    66568, 18, 66568, 27, 66568, 36, 66568, 45, 66568, 54, 1033, 72, 66491, 40, 1034, 16,
+    66570, 32, 66570, 48, 66570, 32, 66570, 16, 132106, 0, 1034, 16, 1035, 24, 1036, 9,
+    66572, 18, 66572, 27, 66572, 36, 66572, 45, 1037, 128, 1038, 80, 1039, 8, 1040, 16,
+    1041, 24, 1042, 9, 66578, 18, 66578, 27, 66578, 36, 66578, 45, 66578, 54, 1043, 144,
+    66575, 16, 1044, 5, 1045, 20, 1046, 20, 132118, 0, 132117, 0, 1045, 80, 132116, 0,
+    1044, 16, 1046, 24, 1047, 9, 66583, 18, 66583, 27, 66583, 36, 66583, 45, 66583, 54,
+    1048, 144, 66575, 24, 1049, 5, 1050, 20, 1051, 20, 132123, 0, 132122, 0, 1050, 80,
+    132121, 0, 1049, 16, 66585, 32, 1051, 24, 1052, 9, 66588, 18, 66588, 27, 66588, 36,
+    66588, 45, 66588, 54, 1053, 144, 66575, 32, 1054, 5, 1055, 20, 1056, 20, 132128, 0,
+    132127, 0, 1055, 80, 132126, 0, 1054, 16, 1056, 24, 1057, 9, 66593, 18, 66593, 27,
+    66593, 36, 66593, 45, 66593, 54, 1058, 72, 66491, 48, 1059, 16, 66595, 32, 66595, 48,
+    66595, 32, 66595, 16, 132131, 0, 1059, 16, 1060, 24, 1061, 9, 66597, 18, 66597, 27,
+    66597, 36, 66597, 45, 1062, 128, 1063, 80, 1064, 8, 1065, 16, 1066, 24, 1067, 9,
+    66603, 18, 66603, 27, 66603, 36, 66603, 45, 66603, 54, 1068, 144, 66600, 16, 1069, 5,
+    1070, 20, 1071, 20, 132143, 0, 132142, 0, 1070, 80, 132141, 0, 1069, 16, 1071, 24,
+    1072, 9, 66608, 18, 66608, 27, 66608, 36, 66608, 45, 66608, 54, 1073, 144, 66600, 24,
+    1074, 5, 1075, 20, 1076, 20, 132148, 0, 132147, 0, 1075, 80, 132146, 0, 1074, 16,
+    66610, 32, 1076, 24, 1077, 9, 66613, 18, 66613, 27, 66613, 36, 66613, 45, 66613, 54,
+    1078, 144, 66600, 32, 1079, 5, 1080, 20, 1081, 20, 132153, 0, 132152, 0, 1080, 80,
+    132151, 0, 1079, 16, 1081, 24, 1082, 9, 66618, 18, 66618, 27, 66618, 36, 66618, 45,
+    66618, 54, 1083, 72, 66445, 24, 1084, 16, 66620, 32, 66620, 48, 66620, 64, 1085, 24,
+    1086, 9, 66622, 18, 66622, 27, 66622, 36, 66622, 45, 1087, 144, 1088, 80, 1089, 8,
+    1090, 5, 1091, 20, 1092, 20, 132164, 0, 132163, 0, 1091, 80, 1092, 16, 132162, 0,
+    1090, 88, 66625, 16, 1093, 16, 66629, 32, 66629, 48, 66629, 64, 66629, 80, 66629, 96,
+    66629, 112, 66629, 128, 66629, 144, 66629, 160, 65765, 240, 1094, 88, 66625, 24, 1095, 16,
+    66631, 32, 66631, 48, 66631, 64, 66631, 80, 66631, 96, 66631, 112, 66631, 128, 66631, 144,
+    66631, 160, 1096, 88, 66625, 32, 1097, 16, 66633, 32, 66633, 48, 66633, 64, 66633, 80,
+    66633, 96, 66633, 112, 66633, 128, 66633, 144, 66633, 160, 1098, 1024, 66633, 176, 1099, 24,
+    1100, 9, 1101, 48, 1102, 152, 132170, 0, 1098, 88, 66625, 40, 1103, 16, 66639, 32,
+    66639, 48, 66639, 64, 66639, 80, 66639, 96, 66639, 112, 66639, 128, 66639, 144, 66639, 160,
+    1104, 1024, 66639, 176, 1105, 24, 1106, 9, 1107, 48, 1108, 152, 66642, 18, 1109, 48,
+    1110, 152, 132176, 0, 1104, 88, 66625, 48, 1111, 16, 66647, 32, 66647, 48, 66647, 64,
+    66647, 80, 66647, 96, 66647, 112, 66647, 128, 66647, 144, 66647, 160, 1112, 1024, 66647, 176,
+    1113, 24, 1114, 9, 1115, 48, 1116, 152, 132184, 0, 1112, 1024, 66650, 18, 1117, 48,
+    1118, 152, 66650, 27, 1119, 48, 1120, 152, 132184, 0, 1112, 88, 66625, 56, 1121, 16,
+    66657, 32, 66657, 48, 66657, 64, 66657, 80, 66657, 96, 66657, 112, 66657, 128, 66657, 144,
+    66657, 160, 1122, 72, 65828, 24, 1123, 16, 66659, 32, 66659, 48, 66659, 32, 66659, 16,
+    132195, 0, 1123, 16, 1124, 24, 1125, 9, 66661, 18, 66661, 27, 66661, 36, 66661, 45,
+    66661, 54, 66661, 63, 66661, 72, 66661, 81, 66661, 90, 66661, 99, 66661, 108, 66661, 117,
+    66661, 126, 1126, 72, 1127, 80, 1128, 8, 1129, 16, 66665, 32, 66665, 48, 66665, 64,
+    66665, 80, 66665, 96, 66665, 112, 66665, 128, 66665, 144, 1130, 80, 66665, 160, 1131, 24,
+    1132, 9, 66668, 18, 66668, 27, 66668, 36, 66668, 45, 1133, 24, 1134, 8, 1135, 72,
+    66664, 16, 1136, 16, 66672, 32, 66672, 48, 66672, 64, 66672, 80, 66672, 96, 66672, 112,
+    66672, 128, 66672, 144, 1137, 80, 66672, 160, 1138, 24, 1139, 9, 66675, 18, 66675, 27,
+    66675, 36, 66675, 45, 1140, 24, 1141, 8, 1142, 72, 66664, 24, 1143, 16, 66679, 32,
+    66679, 48, 66679, 64, 66679, 80, 66679, 96, 66679, 112, 66679, 128, 66679, 144, 1144, 80,
+    66679, 160, 1145, 24, 1146, 9, 66682, 18, 66682, 27, 66682, 36, 66682, 45, 1147, 24,
+    1148, 8, 1149, 72, 66664, 32, 1150, 16, 66686, 32, 66686, 48, 66686, 64, 66686, 80,
+    66686, 96, 66686, 112, 66686, 128, 66686, 144, 1151, 80, 66686, 160, 1152, 24, 1153, 9,
+    66689, 18, 66689, 27, 66689, 36, 66689, 45, 1154, 24, 1155, 8, 1156, 72, 66664, 40,
+    1157, 16, 66693, 32, 66693, 48, 66693, 64, 66693, 80, 66693, 96, 66693, 112, 66693, 128,
+    66693, 144, 1158, 80, 66693, 160, 1159, 24, 1160, 9, 66696, 18, 66696, 27, 66696, 36,
+    66696, 45, 1161, 24, 1162, 8, 1163, 72, 66664, 48, 1164, 16, 66700, 32, 66700, 48,
+    66700, 64, 66700, 80, 66700, 96, 66700, 112, 66700, 128, 66700, 144, 1165, 80, 66700, 160,
+    1166, 24, 1167, 9, 66703, 18, 66703, 27, 66703, 36, 66703, 45, 1168, 24, 1169, 8,
+    1170, 72, 66664, 56, 1171, 16, 66707, 32, 66707, 48, 66707, 64, 66707, 80, 66707, 96,
+    66707, 112, 66707, 128, 66707, 144, 1172, 80, 66707, 160, 1173, 24, 1174, 9, 66710, 18,
+    66710, 27, 66710, 36, 66710, 45, 1175, 24, 1176, 8, 1177, 72, 65828, 32, 1178, 16,
+    66714, 32, 66714, 48, 66714, 64, 66714, 80, 66714, 96, 66714, 112, 66714, 128, 66714, 144,
+    1179, 80, 66714, 160, 1180, 24, 1181, 9, 66714, 176, 1182, 24, 1183, 9, 66719, 18,
+    66719, 27, 66719, 36, 66719, 45, 1184, 24, 1185, 8, 66719, 54, 66719, 63, 66719, 72,
+    66719, 81, 66719, 90, 66719, 99, 66719, 108, 131348, 0, 131349, 0, 131347, 0, 131346, 0,
+    131345, 0, 131335, 0, 131336, 0, 131334, 0, 131333, 0, 131339, 0, 131340, 0, 131338, 0,
+    131337, 0, 131343, 0, 131344, 0, 131342, 0, 131341, 0, 131084, 0, 131311, 0, 131317, 0,
+    131318, 0, 131316, 0, 131308, 0, 131320, 0, 131322, 0, 131331, 0, 131332, 0, 131296, 0,
+    131297, 0, 131319, 0, 131315, 0, 131314, 0, 131313, 0, 131312, 0, 65774, 8, 131309, 0,
+    131327, 0, 131328, 0, 131329, 0, 131330, 0, 131326, 0, 131325, 0, 131324, 0, 131323, 0,
+    131310, 0, 131321, 0, 131300, 0, 65763, 24, 131306, 0, 131305, 0, 65763, 16, 131304, 0,
+    131307, 0, 65763, 8, 131298, 0, 131353, 0, 131352, 0, 131354, 0, 131355, 0, 131376, 0,
+    131377, 0, 131390, 0, 131391, 0, 131394, 0, 131398, 0, 131397, 0, 131396, 0, 131395, 0,
+    131393, 0, 131392, 0, 131388, 0, 131387, 0, 65850, 96, 65850, 80, 65850, 64, 65850, 48,
+    65850, 32, 65850, 16, 131386, 0, 131389, 0, 65849, 40, 131383, 0, 131408, 0, 131409, 0,
+    131412, 0, 131416, 0, 131415, 0, 131414, 0, 131413, 0, 131411, 0, 131410, 0, 131406, 0,
+    131405, 0, 65868, 96, 65868, 80, 65868, 64, 65868, 48, 65868, 32, 65868, 16, 131404, 0,
+    131407, 0, 65849, 32, 131403, 0, 131426, 0, 131427, 0, 131430, 0, 131434, 0, 131433, 0,
+    131432, 0, 131431, 0, 131429, 0, 131428, 0, 131424, 0, 131423, 0, 65886, 96, 65886, 80,
+    65886, 64, 65886, 48, 65886, 32, 65886, 16, 131422, 0, 131425, 0, 65849, 24, 131421, 0,
+    131438, 0, 131437, 0, 131436, 0, 65849, 16, 131435, 0, 131443, 0, 131444, 0, 131440, 0,
+    65906, 16, 131442, 0, 131441, 0, 65849, 8, 131439, 0, 131449, 0, 131448, 0, 65910, 16,
+    131446, 0, 131447, 0, 131385, 0, 131445, 0, 131375, 0, 131374, 0, 65829, 48, 65829, 32,
+    65829, 16, 131365, 0, 131384, 0, 65828, 24, 131362, 0, 131371, 0, 131373, 0, 131372, 0,
+    131625, 0, 131624, 0, 131623, 0, 65922, 64, 131456, 0, 131627, 0, 131626, 0, 65926, 16,
+    131462, 0, 131461, 0, 65922, 56, 131459, 0, 131629, 0, 131628, 0, 65929, 16, 131465, 0,
+    131464, 0, 65922, 48, 131460, 0, 131631, 0, 131630, 0, 65932, 16, 131468, 0, 131467, 0,
+    65922, 40, 131463, 0, 131634, 0, 131633, 0, 131632, 0, 131470, 0, 65922, 32, 131466, 0,
+    131636, 0, 131635, 0, 65937, 16, 131473, 0, 131472, 0, 65922, 24, 131469, 0, 131639, 0,
+    131638, 0, 131637, 0, 131475, 0, 65922, 16, 131471, 0, 131485, 0, 131484, 0, 131482, 0,
+    131483, 0, 131481, 0, 131480, 0, 131479, 0, 131478, 0, 65940, 144, 65940, 128, 65940, 112,
+    65940, 96, 65940, 80, 65940, 64, 65940, 48, 65940, 32, 65940, 16, 131476, 0, 131477, 0,
+    65922, 8, 131474, 0, 131502, 0, 131501, 0, 131499, 0, 131500, 0, 131498, 0, 131497, 0,
+    425, 9, 131491, 0, 131493, 0, 131492, 0, 131497, 0, 131495, 0, 131494, 0, 131490, 0,
+    65951, 160, 131496, 0, 131489, 0, 65951, 144, 65951, 128, 65951, 112, 65951, 96, 65951, 80,
+    65951, 64, 65951, 48, 65951, 32, 65951, 16, 131487, 0, 131488, 0, 131458, 0, 131486, 0,
+    131455, 0, 131454, 0, 65917, 48, 65917, 32, 65917, 16, 131453, 0, 131457, 0, 65916, 16,
+    131450, 0, 131641, 0, 131640, 0, 65985, 16, 131521, 0, 131520, 0, 65982, 64, 131516, 0,
+    131643, 0, 131642, 0, 65986, 16, 131522, 0, 131523, 0, 65982, 56, 131519, 0, 131540, 0,
+    131541, 0, 131534, 0, 131536, 0, 131535, 0, 131530, 0, 131533, 0, 131532, 0, 65993, 16,
+    131529, 0, 131531, 0, 131528, 0, 131526, 0, 131539, 0, 131748, 0, 131750, 0, 131749, 0,
+    131747, 0, 65989, 160, 131538, 0, 131537, 0, 65989, 144, 65989, 128, 65989, 112, 65989, 96,
+    65989, 80, 65989, 64, 65989, 48, 65989, 32, 65989, 16, 131525, 0, 131527, 0, 65982, 48,
+    131524, 0, 131645, 0, 131644, 0, 66007, 16, 131543, 0, 131544, 0, 65982, 40, 131542, 0,
+    131562, 0, 131563, 0, 131555, 0, 131557, 0, 131556, 0, 131551, 0, 131554, 0, 131553, 0,
+    66014, 16, 131550, 0, 131552, 0, 131549, 0, 131547, 0, 131560, 0, 131561, 0, 131753, 0,
+    131755, 0, 131754, 0, 131752, 0, 66010, 160, 131559, 0, 131558, 0, 66010, 144, 66010, 128,
+    66010, 112, 66010, 96, 66010, 80, 66010, 64, 66010, 48, 66010, 32, 66010, 16, 131546, 0,
+    131548, 0, 65982, 32, 131545, 0, 131651, 0, 131650, 0, 66029, 16, 131565, 0, 131566, 0,
+    65982, 24, 131564, 0, 131574, 0, 131575, 0, 131573, 0, 131571, 0, 66034, 128, 66034, 112,
+    66034, 96, 66034, 80, 66034, 64, 66034, 48, 66034, 32, 66034, 16, 131570, 0, 131572, 0,
+    65822, 16, 131569, 0, 131649, 0, 131648, 0, 66032, 144, 66032, 128, 66032, 112, 66032, 96,
+    66032, 80, 66032, 64, 66032, 48, 66032, 32, 66032, 16, 131568, 0, 65982, 16, 131567, 0,
+    131647, 0, 131646, 0, 66041, 16, 131577, 0, 131578, 0, 65982, 8, 131576, 0, 131594, 0,
+    131595, 0, 131589, 0, 131591, 0, 131590, 0, 131585, 0, 131588, 0, 131587, 0, 66048, 16,
+    131584, 0, 131586, 0, 131583, 0, 131581, 0, 131758, 0, 131760, 0, 131759, 0, 131757, 0,
+    66044, 160, 131593, 0, 131592, 0, 66044, 144, 66044, 128, 66044, 112, 66044, 96, 66044, 80,
+    66044, 64, 66044, 48, 66044, 32, 66044, 16, 131580, 0, 131582, 0, 131518, 0, 131579, 0,
+    131515, 0, 131514, 0, 65977, 48, 65977, 32, 65977, 16, 131513, 0, 131517, 0, 65916, 8,
+    131512, 0, 131655, 0, 131654, 0, 66067, 16, 131603, 0, 131602, 0, 66064, 48, 131598, 0,
+    131657, 0, 131656, 0, 66068, 16, 131604, 0, 131605, 0, 66064, 40, 131601, 0, 131611, 0,
+    131612, 0, 131610, 0, 131609, 0, 66071, 160, 66071, 144, 66071, 128, 66071, 112, 66071, 96,
+    66071, 80, 66071, 64, 66071, 48, 66071, 32, 66071, 16, 131607, 0, 131608, 0, 66064, 32,
+    131606, 0, 131665, 0, 131664, 0, 66078, 16, 131614, 0, 131615, 0, 66064, 24, 131613, 0,
+    131663, 0, 131662, 0, 66081, 192, 66081, 176, 66081, 160, 66081, 144, 66081, 128, 66081, 112,
+    66081, 96, 66081, 80, 66081, 64, 66081, 48, 66081, 32, 66081, 16, 131617, 0, 66064, 16,
+    131616, 0, 131661, 0, 131660, 0, 66083, 16, 131619, 0, 131620, 0, 66064, 8, 131618, 0,
+    131659, 0, 131658, 0, 66086, 192, 66086, 176, 66086, 160, 66086, 144, 66086, 128, 66086, 112,
+    66086, 96, 66086, 80, 66086, 64, 66086, 48, 66086, 32, 66086, 16, 131622, 0, 131600, 0,
+    131621, 0, 131653, 0, 131652, 0, 66061, 48, 66061, 32, 66061, 16, 131597, 0, 131599, 0,
+    131452, 0, 131596, 0, 131382, 0, 131381, 0, 65844, 64, 65844, 48, 65844, 32, 65844, 16,
+    131380, 0, 131451, 0, 65843, 16, 131378, 0, 131678, 0, 131675, 0, 66141, 16, 131677, 0,
+    131676, 0, 66138, 16, 131672, 0, 131683, 0, 131682, 0, 66144, 48, 66144, 32, 66144, 16,
+    131680, 0, 131681, 0, 66138, 8, 131679, 0, 131695, 0, 131696, 0, 131703, 0, 131702, 0,
+    131693, 0, 131692, 0, 66155, 128, 66155, 112, 66155, 96, 66155, 80, 66155, 64, 66155, 48,
+    66155, 32, 66155, 16, 131691, 0, 131694, 0, 66154, 8, 131689, 0, 131701, 0, 131700, 0,
+    66162, 48, 66162, 32, 66162, 16, 131698, 0, 131699, 0, 131690, 0, 131697, 0, 131687, 0,
+    131686, 0, 66149, 32, 66149, 16, 131685, 0, 131688, 0, 131674, 0, 131684, 0, 131671, 0,
+    131670, 0, 66133, 48, 66133, 32, 66133, 16, 131669, 0, 131673, 0, 66132, 32, 131666, 0,
+    131714, 0, 131711, 0, 66177, 16, 131713, 0, 131712, 0, 66174, 16, 131708, 0, 131719, 0,
+    131718, 0, 66180, 48, 66180, 32, 66180, 16, 131716, 0, 131717, 0, 66174, 8, 131715, 0,
+    131731, 0, 131732, 0, 131739, 0, 131738, 0, 131741, 0, 131740, 0, 131729, 0, 131728, 0,
+    66191, 128, 66191, 112, 66191, 96, 66191, 80, 66191, 64, 66191, 48, 66191, 32, 66191, 16,
+    131727, 0, 131730, 0, 66190, 8, 131725, 0, 131737, 0, 131736, 0, 66198, 48, 66198, 32,
+    66198, 16, 131734, 0, 131735, 0, 131726, 0, 131733, 0, 131723, 0, 131722, 0, 66185, 32,
+    66185, 16, 131721, 0, 131724, 0, 131710, 0, 131720, 0, 131707, 0, 131706, 0, 66169, 48,
+    66169, 32, 66169, 16, 131705, 0, 131709, 0, 66132, 24, 131704, 0, 131787, 0, 131785, 0,
+    66227, 16, 131763, 0, 131762, 0, 66210, 56, 131756, 0, 131888, 0, 131883, 0, 66348, 48,
+    131890, 0, 131889, 0, 66348, 32, 66348, 16, 131884, 0, 131891, 0, 131886, 0, 66351, 16,
+    131885, 0, 131897, 0, 131896, 0, 66358, 64, 131899, 0, 131898, 0, 66358, 48, 66358, 32,
+    66358, 16, 131894, 0, 131900, 0, 131895, 0, 66351, 8, 131892, 0, 131905, 0, 131904, 0,
+    66366, 64, 131907, 0, 131906, 0, 66366, 48, 66366, 32, 66366, 16, 131902, 0, 131908, 0,
+    131903, 0, 131887, 0, 131893, 0, 131767, 0, 131766, 0, 66228, 48, 66228, 32, 66228, 16,
+    131764, 0, 131765, 0, 66210, 48, 131761, 0, 131771, 0, 131770, 0, 66233, 48, 66233, 32,
+    66233, 16, 131769, 0, 66210, 40, 131768, 0, 131909, 0, 131790, 0, 131789, 0, 131788, 0,
+    131774, 0, 66210, 32, 131772, 0, 131777, 0, 131776, 0, 66239, 48, 66239, 32, 66239, 16,
+    131775, 0, 66210, 24, 131773, 0, 131793, 0, 131792, 0, 131791, 0, 131780, 0, 66210, 16,
+    131778, 0, 131783, 0, 131782, 0, 66245, 48, 66245, 32, 66245, 16, 131781, 0, 66210, 8,
+    131779, 0, 131796, 0, 131795, 0, 131794, 0, 131786, 0, 131746, 0, 131784, 0, 131745, 0,
+    131744, 0, 66207, 48, 66207, 32, 66207, 16, 131743, 0, 131751, 0, 66132, 16, 131742, 0,
+    131830, 0, 131828, 0, 66270, 16, 131806, 0, 131805, 0, 66267, 56, 131801, 0, 131939, 0,
+    131940, 0, 131941, 0, 131916, 0, 131915, 0, 66377, 96, 131918, 0, 131917, 0, 66377, 80,
+    131920, 0, 131919, 0, 66377, 64, 66377, 48, 66377, 32, 66377, 16, 131913, 0, 131914, 0,
+    66376, 16, 131911, 0, 131925, 0, 131924, 0, 66386, 96, 131927, 0, 131926, 0, 66386, 80,
+    131929, 0, 131928, 0, 66386, 64, 66386, 48, 66386, 32, 66386, 16, 131922, 0, 131923, 0,
+    66376, 8, 131921, 0, 131934, 0, 131933, 0, 66395, 96, 131936, 0, 131935, 0, 66395, 80,
+    131938, 0, 131937, 0, 66395, 64, 66395, 48, 66395, 32, 66395, 16, 131931, 0, 131932, 0,
+    131912, 0, 131930, 0, 131810, 0, 131809, 0, 66271, 64, 131910, 0, 131901, 0, 66271, 48,
+    66271, 32, 66271, 16, 131807, 0, 131808, 0, 66267, 48, 131804, 0, 131814, 0, 131813, 0,
+    66276, 48, 66276, 32, 66276, 16, 131812, 0, 66267, 40, 131811, 0, 131833, 0, 131832, 0,
+    131831, 0, 131817, 0, 66267, 32, 131815, 0, 131820, 0, 131819, 0, 66282, 48, 66282, 32,
+    66282, 16, 131818, 0, 66267, 24, 131816, 0, 131836, 0, 131835, 0, 131834, 0, 131823, 0,
+    66267, 16, 131821, 0, 131826, 0, 131825, 0, 66288, 48, 66288, 32, 66288, 16, 131824, 0,
+    66267, 8, 131822, 0, 131839, 0, 131838, 0, 131837, 0, 131829, 0, 131803, 0, 131827, 0,
+    131800, 0, 131799, 0, 66262, 48, 66262, 32, 66262, 16, 131798, 0, 131802, 0, 66132, 8,
+    131797, 0, 131873, 0, 131871, 0, 66313, 16, 131849, 0, 131848, 0, 66310, 56, 131844, 0,
+    131946, 0, 131947, 0, 131948, 0, 131949, 0, 131950, 0, 131951, 0, 131952, 0, 131953, 0,
+    131954, 0, 131955, 0, 131978, 0, 131956, 0, 131962, 0, 131963, 0, 131964, 0, 131971, 0,
+    66424, 16, 131959, 0, 131973, 0, 131974, 0, 131972, 0, 66431, 16, 131967, 0, 131966, 0,
+    66424, 8, 131961, 0, 131968, 0, 131977, 0, 131976, 0, 131975, 0, 131969, 0, 131960, 0,
+    131965, 0, 131958, 0, 131957, 0, 131853, 0, 131852, 0, 66314, 80, 131943, 0, 131942, 0,
+    66314, 64, 131945, 0, 131944, 0, 66314, 48, 66314, 32, 66314, 16, 131850, 0, 131970, 0,
+    131851, 0, 66310, 48, 131847, 0, 131857, 0, 131856, 0, 66319, 48, 66319, 32, 66319, 16,
+    131855, 0, 66310, 40, 131854, 0, 131876, 0, 131875, 0, 131874, 0, 131860, 0, 66310, 32,
+    131858, 0, 131863, 0, 131862, 0, 66325, 48, 66325, 32, 66325, 16, 131861, 0, 66310, 24,
+    131859, 0, 131879, 0, 131878, 0, 131877, 0, 131866, 0, 66310, 16, 131864, 0, 131869, 0,
+    131868, 0, 66331, 48, 66331, 32, 66331, 16, 131867, 0, 66310, 8, 131865, 0, 131882, 0,
+    131881, 0, 131880, 0, 131872, 0, 131846, 0, 131870, 0, 131843, 0, 131842, 0, 66305, 48,
+    66305, 32, 66305, 16, 131841, 0, 131845, 0, 131668, 0, 131840, 0, 131402, 0, 131401, 0,
+    65864, 64, 65864, 48, 65864, 32, 65864, 16, 131400, 0, 131667, 0, 65843, 8, 131399, 0,
+    132016, 0, 132015, 0, 66454, 16, 131990, 0, 131989, 0, 66451, 32, 131985, 0, 132018, 0,
+    132017, 0, 66457, 32, 66457, 16, 131993, 0, 131992, 0, 66451, 24, 131988, 0, 132020, 0,
+    132019, 0, 66460, 16, 131996, 0, 131995, 0, 66451, 16, 131991, 0, 131997, 0, 132001, 0,
+    132000, 0, 131999, 0, 131998, 0, 66451, 8, 131994, 0, 132005, 0, 132006, 0, 132008, 0,
+    132007, 0, 132010, 0, 132009, 0, 132012, 0, 132011, 0, 132014, 0, 132013, 0, 66467, 128,
+    66467, 112, 66467, 96, 66467, 80, 66467, 64, 66467, 48, 66467, 32, 66467, 16, 132003, 0,
+    132004, 0, 131987, 0, 132002, 0, 131984, 0, 131983, 0, 66446, 48, 66446, 32, 66446, 16,
+    131982, 0, 131986, 0, 66445, 16, 131979, 0, 132030, 0, 132029, 0, 66491, 40, 132025, 0,
+    132039, 0, 132038, 0, 132037, 0, 66500, 24, 132034, 0, 132044, 0, 132043, 0, 132041, 0,
+    132042, 0, 66500, 16, 132040, 0, 132049, 0, 132048, 0, 66510, 16, 132046, 0, 132047, 0,
+    66500, 8, 132045, 0, 132054, 0, 132053, 0, 132051, 0, 132052, 0, 132036, 0, 132050, 0,
+    132033, 0, 132032, 0, 132031, 0, 132035, 0, 66491, 32, 132028, 0, 132064, 0, 132063, 0,
+    132062, 0, 66525, 24, 132059, 0, 132069, 0, 132068, 0, 132066, 0, 132067, 0, 66525, 16,
+    132065, 0, 132074, 0, 132073, 0, 66535, 16, 132071, 0, 132072, 0, 66525, 8, 132070, 0,
+    132079, 0, 132078, 0, 132076, 0, 132077, 0, 132061, 0, 132075, 0, 132058, 0, 132057, 0,
+    132056, 0, 132060, 0, 66491, 24, 132055, 0, 132089, 0, 132088, 0, 132087, 0, 66550, 24,
+    132084, 0, 132094, 0, 132093, 0, 132091, 0, 132092, 0, 66550, 16, 132090, 0, 132099, 0,
+    132098, 0, 66560, 16, 132096, 0, 132097, 0, 66550, 8, 132095, 0, 132104, 0, 132103, 0,
+    132101, 0, 132102, 0, 132086, 0, 132100, 0, 132083, 0, 132082, 0, 132081, 0, 132085, 0,
+    66491, 16, 132080, 0, 132114, 0, 132113, 0, 132112, 0, 66575, 24, 132109, 0, 132119, 0,
+    132118, 0, 132116, 0, 132117, 0, 66575, 16, 132115, 0, 132124, 0, 132123, 0, 66585, 16,
+    132121, 0, 132122, 0, 66575, 8, 132120, 0, 132129, 0, 132128, 0, 132126, 0, 132127, 0,
+    132111, 0, 132125, 0, 132108, 0, 132107, 0, 132106, 0, 132110, 0, 66491, 8, 132105, 0,
+    132139, 0, 132138, 0, 132137, 0, 66600, 24, 132134, 0, 132144, 0, 132143, 0, 132141, 0,
+    132142, 0, 66600, 16, 132140, 0, 132149, 0, 132148, 0, 66610, 16, 132146, 0, 132147, 0,
+    66600, 8, 132145, 0, 132154, 0, 132153, 0, 132151, 0, 132152, 0, 132136, 0, 132150, 0,
+    132133, 0, 132132, 0, 132131, 0, 132135, 0, 132027, 0, 132130, 0, 132024, 0, 132023, 0,
+    66486, 48, 66486, 32, 66486, 16, 132022, 0, 132026, 0, 66445, 8, 132021, 0, 132164, 0,
+    132163, 0, 66625, 48, 132159, 0, 66629, 144, 66629, 128, 66629, 112, 66629, 96, 66629, 80,
+    66629, 64, 66629, 48, 66629, 32, 66629, 16, 132165, 0, 66625, 40, 132162, 0, 66631, 144,
+    66631, 128, 66631, 112, 66631, 96, 66631, 80, 66631, 64, 66631, 48, 66631, 32, 66631, 16,
+    132167, 0, 66625, 32, 132166, 0, 132172, 0, 132174, 0, 132173, 0, 132171, 0, 66633, 160,
+    66633, 144, 66633, 128, 66633, 112, 66633, 96, 66633, 80, 66633, 64, 66633, 48, 66633, 32,
+    66633, 16, 132169, 0, 66625, 24, 132168, 0, 1096, 9, 132178, 0, 132180, 0, 132179, 0,
+    132168, 0, 132182, 0, 132181, 0, 132177, 0, 66639, 160, 66639, 144, 66639, 128, 66639, 112,
+    66639, 96, 66639, 80, 66639, 64, 66639, 48, 66639, 32, 66639, 16, 132175, 0, 66625, 16,
+    132170, 0, 1098, 18, 132186, 0, 132188, 0, 132187, 0, 1115, 9, 132170, 0, 132190, 0,
+    132189, 0, 132187, 0, 132192, 0, 132191, 0, 132185, 0, 66647, 160, 66647, 144, 66647, 128,
+    66647, 112, 66647, 96, 66647, 80, 66647, 64, 66647, 48, 66647, 32, 66647, 16, 132183, 0,
+    66625, 8, 132176, 0, 66657, 144, 66657, 128, 66657, 112, 66657, 96, 66657, 80, 66657, 64,
+    66657, 48, 66657, 32, 66657, 16, 132193, 0, 132161, 0, 132184, 0, 132158, 0, 132157, 0,
+    66620, 48, 66620, 32, 66620, 16, 132156, 0, 132160, 0, 131981, 0, 132155, 0, 131420, 0,
+    131419, 0, 65882, 64, 65882, 48, 65882, 32, 65882, 16, 131418, 0, 131980, 0, 131379, 0,
+    131417, 0, 131369, 0, 131368, 0, 131367, 0, 131370, 0, 65828, 16, 131366, 0, 132205, 0,
+    132206, 0, 132204, 0, 132203, 0, 66665, 144, 66665, 128, 66665, 112, 66665, 96, 66665, 80,
+    66665, 64, 66665, 48, 66665, 32, 66665, 16, 132201, 0, 132202, 0, 66664, 48, 132198, 0,
+    132212, 0, 132213, 0, 132211, 0, 132210, 0, 66672, 144, 66672, 128, 66672, 112, 66672, 96,
+    66672, 80, 66672, 64, 66672, 48, 66672, 32, 66672, 16, 132208, 0, 132209, 0, 66664, 40,
+    132207, 0, 132219, 0, 132220, 0, 132218, 0, 132217, 0, 66679, 144, 66679, 128, 66679, 112,
+    66679, 96, 66679, 80, 66679, 64, 66679, 48, 66679, 32, 66679, 16, 132215, 0, 132216, 0,
+    66664, 32, 132214, 0, 132226, 0, 132227, 0, 132225, 0, 132224, 0, 66686, 144, 66686, 128,
+    66686, 112, 66686, 96, 66686, 80, 66686, 64, 66686, 48, 66686, 32, 66686, 16, 132222, 0,
+    132223, 0, 66664, 24, 132221, 0, 132233, 0, 132234, 0, 132232, 0, 132231, 0, 66693, 144,
+    66693, 128, 66693, 112, 66693, 96, 66693, 80, 66693, 64, 66693, 48, 66693, 32, 66693, 16,
+    132229, 0, 132230, 0, 66664, 16, 132228, 0, 132240, 0, 132241, 0, 132239, 0, 132238, 0,
+    66700, 144, 66700, 128, 66700, 112, 66700, 96, 66700, 80, 66700, 64, 66700, 48, 66700, 32,
+    66700, 16, 132236, 0, 132237, 0, 66664, 8, 132235, 0, 132247, 0, 132248, 0, 132246, 0,
+    132245, 0, 66707, 144, 66707, 128, 66707, 112, 66707, 96, 66707, 80, 66707, 64, 66707, 48,
+    66707, 32, 66707, 16, 132243, 0, 132244, 0, 132200, 0, 132242, 0, 132197, 0, 132196, 0,
+    132195, 0, 132199, 0, 65828, 8, 132194, 0, 132256, 0, 132257, 0, 132253, 0, 132252, 0,
+    66714, 160, 132255, 0, 132254, 0, 66714, 144, 66714, 128, 66714, 112, 66714, 96, 66714, 80,
+    66714, 64, 66714, 48, 66714, 32, 66714, 16, 132250, 0, 132251, 0, 131364, 0, 132249, 0,
+    131361, 0, 131360, 0, 65823, 32, 65823, 16, 131359, 0, 131363, 0, 65822, 8, 131356, 0,
+    131510, 0, 131511, 0, 131506, 0, 131505, 0, 131508, 0, 131507, 0, 65968, 192, 65968, 176,
+    65968, 160, 65968, 144, 65968, 128, 65968, 112, 65968, 96, 65968, 80, 65968, 64, 65968, 48,
+    65968, 32, 65968, 16, 131504, 0, 131509, 0, 131358, 0, 131503, 0, 131351, 0, 131350, 0,
+    65767, 48, 65767, 32, 65767, 16, 131303, 0, 131357, 0, 131299, 0, 131302, 0, 131226, 0,
+    131227, 0, 131225, 0, 131224, 0, 131072, 0, 131078, 0, 131077, 0, 131233, 0, 131231, 0,
+    131232, 0, 131234, 0, 131237, 0, 131248, 0, 131249, 0, 131250, 0, 131251, 0, 131252, 0,
+    131253, 0, 131238, 0, 131239, 0, 131246, 0, 131247, 0, 131242, 0, 131241, 0, 131243, 0,
+    131244, 0, 131245, 0, 131235, 0, 131236, 0, 131254, 0, 131255, 0, 131240, 0, 131256, 0,
+    131257, 0, 131230, 0, 131229, 0, 131259, 0, 131260, 0, 131258, 0, 131261, 0, 131262, 0,
+    131269, 0, 131270, 0, 131268, 0, 131263, 0, 131264, 0, 131265, 0, 131266, 0, 131267, 0,
+    131281, 0, 131282, 0, 131283, 0, 131284, 0, 131285, 0, 131286, 0, 131271, 0, 131273, 0,
+    131274, 0, 131275, 0, 131278, 0, 131276, 0, 131277, 0, 131272, 0, 131279, 0, 131280, 0,
+    131287, 0, 131288, 0, 131291, 0, 131292, 0, 131293, 0, 131290, 0, 131289, 0, 131294, 0,
+    131295, 0, 131228, 0, 131085, 0, 131086, 0, 131096, 0, 131095, 0, 131094, 0, 131093, 0,
+    131092, 0, 131091, 0, 131087, 0, 131081, 0, 131082, 0, 131083, 0, 131080, 0, 131079, 0,
+    131075, 0, 131076, 0, 131074, 0, 131073, 0, 131301, 0, 131097, 0, 131090, 0, 131089, 0,
+    131088, 0, 131098, 0, 131099, 0, 131100, 0, 131101, 0, 131102, 0, 131103, 0, 131104, 0,
+    131105, 0, 131106, 0, 131107, 0, 131108, 0, 131109, 0, 131110, 0, 131111, 0, 131112, 0,
+    131113, 0, 131114, 0, 131115, 0, 131116, 0, 131117, 0, 131118, 0, 131119, 0, 131120, 0,
+    131121, 0, 131122, 0, 131123, 0, 131124, 0, 131125, 0, 131126, 0, 131127, 0, 131128, 0,
+    131129, 0, 131130, 0, 131131, 0, 131132, 0, 131133, 0, 131134, 0, 131135, 0, 131136, 0,
+    131137, 0, 131138, 0, 131139, 0, 131140, 0, 131141, 0, 131142, 0, 131143, 0, 131144, 0,
+    131145, 0, 131146, 0, 131147, 0, 131148, 0, 131149, 0, 131150, 0, 131151, 0, 131152, 0,
+    131153, 0, 131154, 0, 131155, 0, 131156, 0, 131157, 0, 131158, 0, 131159, 0, 131160, 0,
+    131161, 0, 131162, 0, 131163, 0, 131164, 0, 131165, 0, 131166, 0, 131167, 0, 131168, 0,
+    131169, 0, 131170, 0, 131171, 0, 131172, 0, 131173, 0, 131174, 0, 131175, 0, 131176, 0,
+    131177, 0, 131178, 0, 131179, 0, 131180, 0, 131181, 0, 131182, 0, 131183, 0, 131184, 0,
+    131185, 0, 131186, 0, 131187, 0, 131188, 0, 131189, 0, 131190, 0, 131191, 0, 131192, 0,
+    131193, 0, 131194, 0, 131195, 0, 131196, 0, 131197, 0, 131198, 0, 131199, 0, 131200, 0,
+    131201, 0, 131202, 0, 131203, 0, 131204, 0, 131205, 0, 131206, 0, 131207, 0, 131208, 0,
+    131209, 0, 131210, 0, 131211, 0, 131212, 0, 131213, 0, 131214, 0, 131215, 0, 131216, 0,
+    131217, 0, 131218, 0, 131219, 0, 131220, 0, 131221, 0, 131222, 0, 131223, 0,
+};
+
+const size_t test_mem_trace_event_cnt = sizeof(test_mem_trace) / sizeof(test_mem_trace[0]) / 2;
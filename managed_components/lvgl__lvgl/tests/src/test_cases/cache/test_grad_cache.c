@@ -0,0 +1,286 @@
+#if LV_BUILD_TEST
+
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../../../src/draw/sw/lv_draw_sw_grad.h"
+
+#include "unity/unity.h"
+
+#if LV_GRADIENT_CACHE_SIZE > 0
+
+#define grad_cache_p (LV_GLOBAL_DEFAULT()->grad_cache)
+
+static uint32_t build_cnt;
+
+void setUp(void)
+{
+    build_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+
+    /*Restore the cache if a test has removed it*/
+    lv_grad_cache_init(LV_GRADIENT_CACHE_SIZE);
+    lv_grad_cache_drop_all();
+}
+
+static void build_cb(void * table, lv_cache_entry_t * entry, void * user_data)
+{
+    LV_UNUSED(entry);
+    lv_memset(table, *(uint8_t *)user_data, 64);
+    build_cnt++;
+}
+
+static lv_grad_dsc_t grad_create(lv_grad_dir_t dir, lv_color_t c1, lv_color_t c2)
+{
+    lv_grad_dsc_t grad;
+    lv_memzero(&grad, sizeof(grad));
+    grad.dir = dir;
+    grad.stops_count = 2;
+    grad.stops[0].color = c1;
+    grad.stops[0].opa = LV_OPA_COVER;
+    grad.stops[0].frac = 0;
+    grad.stops[1].color = c2;
+    grad.stops[1].opa = LV_OPA_50;
+    grad.stops[1].frac = 200;
+    return grad;
+}
+
+/*Copy the rendered screen to compare it with an other rendering*/
+static uint8_t * screen_copy(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * copy = lv_malloc(size);
+    TEST_ASSERT_NOT_NULL(copy);
+    lv_memcpy(copy, buf->data, size);
+    return copy;
+}
+
+static void assert_screen_equal(const uint8_t * copy)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(copy, buf->data, buf->header.stride * buf->header.h);
+}
+
+void test_grad_cache_shares_tables_by_key(void)
+{
+    uint8_t key1[5] = {1, 2, 3, 4, 5};
+    uint8_t key2[5] = {1, 2, 3, 4, 6};
+    uint8_t fill1 = 0x11;
+    uint8_t fill2 = 0x22;
+
+    lv_cache_entry_t * e1 = lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_SW, key1, sizeof(key1), 64, build_cb, &fill1);
+    TEST_ASSERT_NOT_NULL(e1);
+    TEST_ASSERT_EQUAL_UINT32(1, build_cnt);
+
+    /*A copy of the same key gets the same table without building it again*/
+    uint8_t key1_copy[5] = {1, 2, 3, 4, 5};
+    lv_cache_entry_t * e2 = lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_SW, key1_copy, sizeof(key1_copy), 64, build_cb,
+                                                  &fill2);
+    TEST_ASSERT_EQUAL_PTR(e1, e2);
+    TEST_ASSERT_EQUAL_UINT32(1, build_cnt);
+    TEST_ASSERT_EQUAL_UINT8(0x11, ((uint8_t *)lv_grad_cache_entry_get_table(e2))[63]);
+
+    /*Another key, key size or format is another table*/
+    lv_cache_entry_t * e3 = lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_SW, key2, sizeof(key2), 64, build_cb, &fill2);
+    lv_cache_entry_t * e4 = lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_SW, key1, 4, 64, build_cb, &fill2);
+    lv_cache_entry_t * e5 = lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_THORVG, key1, sizeof(key1), 64, build_cb, &fill2);
+    TEST_ASSERT_EQUAL_UINT32(4, build_cnt);
+    TEST_ASSERT_TRUE(e3 != e1 && e4 != e1 && e5 != e1 && e3 != e4 && e3 != e5 && e4 != e5);
+    TEST_ASSERT_EQUAL_UINT8(0x22, ((uint8_t *)lv_grad_cache_entry_get_table(e5))[0]);
+
+    lv_grad_cache_release(e1);
+    lv_grad_cache_release(e2);
+    lv_grad_cache_release(e3);
+    lv_grad_cache_release(e4);
+    lv_grad_cache_release(e5);
+
+    /*Too large tables are not cached*/
+    TEST_ASSERT_NULL(lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_SW, key1, sizeof(key1), LV_GRADIENT_CACHE_SIZE / 2,
+                                           build_cb, &fill1));
+
+    /*The released tables are built again after dropping them*/
+    lv_grad_cache_drop_all();
+    TEST_ASSERT_EQUAL_size_t(0, lv_cache_get_size(grad_cache_p, NULL));
+    e1 = lv_grad_cache_acquire(LV_GRAD_CACHE_FORMAT_SW, key1, sizeof(key1), 64, build_cb, &fill1);
+    TEST_ASSERT_EQUAL_UINT32(5, build_cnt);
+    lv_grad_cache_release(e1);
+}
+
+void test_grad_cache_sw_tables(void)
+{
+    lv_grad_dsc_t grad = grad_create(LV_GRAD_DIR_HOR, lv_color_hex(0xff0000), lv_color_hex(0x0000ff));
+
+    lv_draw_sw_grad_calc_t * c1 = lv_draw_sw_grad_get(&grad, 100, 30);
+    lv_draw_sw_grad_calc_t * c2 = lv_draw_sw_grad_get(&grad, 100, 60);
+    TEST_ASSERT_NOT_NULL(c1);
+    TEST_ASSERT_NOT_NULL(c1->cache_entry);
+    TEST_ASSERT_EQUAL_PTR(c1, c2);
+
+    uint32_t i;
+    for(i = 0; i < c1->size; i++) {
+        lv_color_t color;
+        lv_opa_t opa;
+        lv_draw_sw_grad_color_calculate(&grad, c1->size, i, &color, &opa);
+        TEST_ASSERT_TRUE(lv_color_eq(color, c1->color_map[i]));
+        TEST_ASSERT_EQUAL_UINT8(opa, c1->opa_map[i]);
+    }
+
+    /*Other width or stops need other tables*/
+    lv_draw_sw_grad_calc_t * c3 = lv_draw_sw_grad_get(&grad, 120, 30);
+    grad.stops[1].frac = 255;
+    lv_draw_sw_grad_calc_t * c4 = lv_draw_sw_grad_get(&grad, 100, 30);
+    TEST_ASSERT_TRUE(c3 != c1 && c4 != c1 && c3 != c4);
+    TEST_ASSERT_EQUAL_UINT32(120, c3->size);
+
+    lv_draw_sw_grad_cleanup(c1);
+    lv_draw_sw_grad_cleanup(c2);
+    lv_draw_sw_grad_cleanup(c3);
+    lv_draw_sw_grad_cleanup(c4);
+
+    /*Without the cache private tables are used*/
+    lv_grad_cache_deinit();
+    c1 = lv_draw_sw_grad_get(&grad, 100, 30);
+    TEST_ASSERT_NOT_NULL(c1);
+    TEST_ASSERT_NULL(c1->cache_entry);
+    lv_draw_sw_grad_cleanup(c1);
+}
+
+void test_grad_cache_render_same_as_uncached(void)
+{
+    static const lv_grad_dir_t dirs[] = {
+        LV_GRAD_DIR_HOR, LV_GRAD_DIR_VER,
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+        LV_GRAD_DIR_LINEAR, LV_GRAD_DIR_RADIAL, LV_GRAD_DIR_CONICAL,
+#endif
+    };
+
+    uint32_t i;
+    for(i = 0; i < 12; i++) {
+        lv_obj_t * obj = lv_obj_create(lv_screen_active());
+        lv_obj_set_size(obj, 150, 100);
+        lv_obj_set_pos(obj, (i % 4) * 190 + 20, (i / 4) * 150 + 20);
+
+        /*Repeat the same gradients to share their tables*/
+        static lv_grad_dsc_t grads[(sizeof(dirs) / sizeof(dirs[0]))];
+        uint32_t d = i % (sizeof(dirs) / sizeof(dirs[0]));
+        grads[d] = grad_create(dirs[d], lv_palette_main(LV_PALETTE_RED + d), lv_palette_main(LV_PALETTE_TEAL));
+#if LV_USE_DRAW_SW_COMPLEX_GRADIENTS
+        if(dirs[d] == LV_GRAD_DIR_LINEAR) lv_grad_linear_init(&grads[d], 0, 0, LV_PCT(100), LV_PCT(100), LV_GRAD_EXTEND_PAD);
+        if(dirs[d] == LV_GRAD_DIR_RADIAL) lv_grad_radial_init(&grads[d], LV_GRAD_CENTER, LV_GRAD_CENTER, 40, 40,
+                                                                  LV_GRAD_EXTEND_REFLECT);
+        if(dirs[d] == LV_GRAD_DIR_CONICAL) lv_grad_conical_init(&grads[d], LV_GRAD_CENTER, LV_GRAD_CENTER, 0, 180,
+                                                                    LV_GRAD_EXTEND_REPEAT);
+#endif
+        lv_obj_set_style_bg_grad(obj, &grads[d], 0);
+    }
+
+    uint8_t * cold = screen_copy();
+    TEST_ASSERT_NOT_EQUAL(0, lv_cache_get_size(grad_cache_p, NULL));
+
+    /*Everything is in the cache now*/
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    assert_screen_equal(cold);
+
+    lv_grad_cache_deinit();
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    assert_screen_equal(cold);
+
+    lv_free(cold);
+}
+
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+
+static void vector_draw_cb(lv_event_t * e)
+{
+    lv_layer_t * layer = lv_event_get_layer(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+
+    lv_draw_vector_dsc_t * ctx = lv_draw_vector_dsc_create(layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    lv_grad_stop_t stops[2];
+    lv_memzero(stops, sizeof(stops));
+    stops[0].color = lv_color_hex(0xffff00);
+    stops[0].opa = LV_OPA_COVER;
+    stops[0].frac = 40;
+    stops[1].color = lv_color_hex(0x0000ff);
+    stops[1].opa = LV_OPA_70;
+    stops[1].frac = 200;
+
+    uint32_t i;
+    for(i = 0; i < 6; i++) {
+        lv_area_t rect = {0, 0, 99, 99};
+        lv_area_move(&rect, obj->coords.x1 + (i % 3) * 130, obj->coords.y1 + (i / 3) * 130);
+        lv_vector_path_clear(path);
+        lv_vector_path_append_rect(path, &rect, 10, 10);
+
+        lv_matrix_t mt;
+        lv_matrix_identity(&mt);
+        lv_matrix_translate(&mt, rect.x1, rect.y1);
+        lv_draw_vector_dsc_set_fill_transform(ctx, &mt);
+        if(i % 2) lv_draw_vector_dsc_set_fill_linear_gradient(ctx, 0, 0, 100, 100);
+        else lv_draw_vector_dsc_set_fill_radial_gradient(ctx, 50, 50, 40);
+        lv_draw_vector_dsc_set_fill_gradient_color_stops(ctx, stops, 2);
+        lv_draw_vector_dsc_set_fill_gradient_spread(ctx, i < 3 ? LV_VECTOR_GRADIENT_SPREAD_REPEAT :
+                                                    LV_VECTOR_GRADIENT_SPREAD_PAD);
+        lv_draw_vector_dsc_add_path(ctx, path);
+    }
+
+    lv_draw_vector(ctx);
+    lv_vector_path_delete(path);
+    lv_draw_vector_dsc_delete(ctx);
+}
+
+void test_grad_cache_vector_same_as_uncached(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 400, 240);
+    lv_obj_set_pos(obj, 20, 20);
+    lv_obj_add_event_cb(obj, vector_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    uint8_t * cold = screen_copy();
+    size_t cached_size = lv_cache_get_size(grad_cache_p, NULL);
+    TEST_ASSERT_NOT_EQUAL(0, cached_size);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    assert_screen_equal(cold);
+    TEST_ASSERT_EQUAL_size_t(cached_size, lv_cache_get_size(grad_cache_p, NULL));
+
+    lv_grad_cache_deinit();
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    assert_screen_equal(cold);
+
+    lv_free(cold);
+}
+
+#endif /*LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG*/
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_grad_cache_shares_tables_by_key(void)
+{
+}
+
+#endif /*LV_GRADIENT_CACHE_SIZE > 0*/
+
+#endif
@@ -4,6 +4,10 @@
 
 #include "unity/unity.h"
 
+#if LV_USE_LZ4_INTERNAL
+    #include "../../src/libs/lz4/lz4.h"
+#endif
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -317,4 +321,148 @@ void test_bin_decoder_open_stride_zero_handling(void)
 
     lv_bin_decoder_close(decoder_dsc->decoder, decoder_dsc);
 }
+#if LV_USE_LZ4_INTERNAL
+
+#define BLOCK_IMAGE_W       40
+#define BLOCK_IMAGE_H       30
+#define BLOCK_ROWS          8
+#define BLOCK_CNT           ((BLOCK_IMAGE_H + BLOCK_ROWS - 1) / BLOCK_ROWS)
+
+static LV_ATTRIBUTE_MEM_ALIGN lv_color32_t block_raw[BLOCK_IMAGE_W * BLOCK_IMAGE_H];
+static LV_ATTRIBUTE_MEM_ALIGN uint8_t block_bin[sizeof(lv_image_header_t) + 12 + (BLOCK_CNT + 1) * 4 +
+                                                BLOCK_CNT * LZ4_COMPRESSBOUND(BLOCK_ROWS * BLOCK_IMAGE_W * 4)];
+
+/**
+ * Create a block compressed ARGB8888 bin image in `block_bin` the same way LVGLImage.py does
+ * @return size of the bin file
+ */
+static uint32_t create_block_compressed_bin(void)
+{
+    uint32_t i;
+    for(i = 0; i < BLOCK_IMAGE_W * BLOCK_IMAGE_H; i++) {
+        uint32_t x = i % BLOCK_IMAGE_W;
+        uint32_t y = i / BLOCK_IMAGE_W;
+        block_raw[i].red = (uint8_t)(x * 6);
+        block_raw[i].green = (uint8_t)(y * 8);
+        block_raw[i].blue = (uint8_t)((x / 4 + y / 4) % 2 ? 0xff : 0);
+        block_raw[i].alpha = 0xff;
+    }
+
+    lv_image_header_t * header = (lv_image_header_t *)block_bin;
+    lv_memzero(header, sizeof(lv_image_header_t));
+    header->magic = LV_IMAGE_HEADER_MAGIC;
+    header->cf = LV_COLOR_FORMAT_ARGB8888;
+    header->flags = LV_IMAGE_FLAGS_COMPRESSED;
+    header->w = BLOCK_IMAGE_W;
+    header->h = BLOCK_IMAGE_H;
+    header->stride = BLOCK_IMAGE_W * 4;
+
+    uint32_t * compressed_header = (uint32_t *)(block_bin + sizeof(lv_image_header_t));
+    uint32_t * index = compressed_header + 3;
+    uint8_t * blocks = (uint8_t *)(index + BLOCK_CNT + 1);
+    uint32_t offset = 0;
+    for(i = 0; i < BLOCK_CNT; i++) {
+        uint32_t rows = LV_MIN(BLOCK_ROWS, BLOCK_IMAGE_H - i * BLOCK_ROWS);
+        index[i] = offset;
+        int len = LZ4_compress_default((const char *)&block_raw[i * BLOCK_ROWS * BLOCK_IMAGE_W], (char *)blocks + offset,
+                                       (int)(rows * BLOCK_IMAGE_W * 4), LZ4_COMPRESSBOUND(BLOCK_ROWS * BLOCK_IMAGE_W * 4));
+        TEST_ASSERT_GREATER_THAN(0, len);
+        offset += (uint32_t)len;
+    }
+    index[BLOCK_CNT] = offset;
+
+    compressed_header[0] = LV_IMAGE_COMPRESS_LZ4 | (BLOCK_ROWS << 4);
+    compressed_header[1] = (BLOCK_CNT + 1) * 4 + offset;
+    compressed_header[2] = sizeof(block_raw);
+
+    return sizeof(lv_image_header_t) + 12 + compressed_header[1];
+}
+
+void test_bin_decoder_block_compressed_get_area(void)
+{
+    uint32_t bin_size = create_block_compressed_bin();
+
+    lv_image_dsc_t img;
+    lv_memzero(&img, sizeof(img));
+    img.header = *(lv_image_header_t *)block_bin;
+    img.data = block_bin + sizeof(lv_image_header_t);
+    img.data_size = bin_size - sizeof(lv_image_header_t);
+
+    lv_fs_path_ex_t file;
+    lv_fs_make_path_from_buffer(&file, 'M', block_bin, bin_size, "bin");
+
+    const void * srcs[] = {&img, file.path};
+    uint32_t s;
+    for(s = 0; s < 2; s++) {
+        size_t mem_before = lv_test_get_free_mem();
+
+        /*The blocks are not decompressed on open*/
+        lv_image_decoder_dsc_t dsc;
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, srcs[s], NULL));
+        TEST_ASSERT_NULL(dsc.decoded);
+
+        /*Each call returns the rows in the next block*/
+        const lv_area_t full_area = {3, 5, 20, 22};
+        const int32_t expected_y2[] = {7, 15, 22};
+        lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+        uint32_t i;
+        for(i = 0; i < 3; i++) {
+            int32_t y1 = i == 0 ? full_area.y1 : expected_y2[i - 1] + 1;
+            TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+            TEST_ASSERT_EQUAL_INT32(full_area.x1, decoded_area.x1);
+            TEST_ASSERT_EQUAL_INT32(full_area.x2, decoded_area.x2);
+            TEST_ASSERT_EQUAL_INT32(y1, decoded_area.y1);
+            TEST_ASSERT_EQUAL_INT32(expected_y2[i], decoded_area.y2);
+
+            int32_t y;
+            for(y = decoded_area.y1; y <= decoded_area.y2; y++) {
+                const uint8_t * row = dsc.decoded->data + (y - decoded_area.y1) * dsc.decoded->header.stride;
+                TEST_ASSERT_EQUAL_MEMORY(&block_raw[y * BLOCK_IMAGE_W + full_area.x1], row,
+                                         lv_area_get_width(&full_area) * 4);
+            }
+        }
+        TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+
+        lv_image_decoder_close(&dsc);
+        TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+    }
+
+    /*A corrupted index is rejected*/
+    uint32_t * index = (uint32_t *)(block_bin + sizeof(lv_image_header_t) + 12);
+    index[1] = index[2] + 1;
+    lv_image_decoder_dsc_t dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_open(&dsc, &img, NULL));
+}
+
+void test_bin_decoder_block_compressed_draw(void)
+{
+    uint32_t bin_size = create_block_compressed_bin();
+
+    lv_image_dsc_t raw_img;
+    lv_memzero(&raw_img, sizeof(raw_img));
+    raw_img.header = *(lv_image_header_t *)block_bin;
+    raw_img.header.flags = 0;
+    raw_img.data = (const uint8_t *)block_raw;
+    raw_img.data_size = sizeof(block_raw);
+
+    lv_fs_path_ex_t file;
+    lv_fs_make_path_from_buffer(&file, 'M', block_bin, bin_size, "bin");
+
+    /*The block compressed image looks the same as the raw image*/
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &raw_img);
+    lv_draw_buf_t * expected = lv_snapshot_take(img, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(expected);
+
+    lv_image_set_src(img, file.path);
+    lv_draw_buf_t * snapshot = lv_snapshot_take(img, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot);
+    TEST_ASSERT_EQUAL_MEMORY(expected->data, snapshot->data, expected->data_size);
+
+    lv_draw_buf_destroy(expected);
+    lv_draw_buf_destroy(snapshot);
+}
+
+#endif /*LV_USE_LZ4_INTERNAL*/
+
 #endif
\ No newline at end of file
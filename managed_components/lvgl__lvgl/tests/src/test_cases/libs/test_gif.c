@@ -0,0 +1,126 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*Both GIFs are made of a full first frame and then frames updating only a small rectangle
+ *- spinner: 48x48, 8 frames, a highlighted dot moves on a circle
+ *- loader: 120x12, 12 frames, a progress bar is filled by 10 px in each frame*/
+#define SPINNER_SRC     "A:src/test_assets/test_gif_spinner.gif"
+#define LOADER_SRC      "A:src/test_assets/test_gif_loader.gif"
+#define FRAME_DELAY     100
+
+static uint32_t invalidated_px;
+
+static void invalidate_area_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    invalidated_px += lv_area_get_size(area);
+}
+
+void setUp(void)
+{
+    lv_display_add_event_cb(lv_display_get_default(), invalidate_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+}
+
+void tearDown(void)
+{
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), invalidate_area_cb, NULL);
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * gif_create(const char * src)
+{
+    lv_obj_t * gif = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(gif, src);
+    TEST_ASSERT_TRUE(lv_gif_is_loaded(gif));
+    lv_obj_set_pos(gif, 30, 20);
+    lv_refr_now(NULL);
+    return gif;
+}
+
+/*Play the next frame and return the number of invalidated pixels*/
+static uint32_t next_frame(void)
+{
+    invalidated_px = 0;
+    lv_test_fast_forward(FRAME_DELAY);
+    return invalidated_px;
+}
+
+/*Compare the partially redrawn screen with a fully redrawn one*/
+static void assert_same_as_full_redraw(void)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * partial = lv_malloc(size);
+    TEST_ASSERT_NOT_NULL(partial);
+    lv_memcpy(partial, buf->data, size);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_MEMORY(partial, buf->data, size);
+    lv_free(partial);
+}
+
+void test_gif_invalidate_only_changed_area(void)
+{
+    lv_obj_t * gif = gif_create(SPINNER_SRC);
+
+    /*Spinner: only the rectangle of the previous and the new dot changes*/
+    uint32_t i;
+    uint32_t spinner_px = 0;
+    for(i = 1; i < 8; i++) {
+        uint32_t px = next_frame();
+        TEST_ASSERT_NOT_EQUAL(0, px);
+        TEST_ASSERT_LESS_THAN_UINT32(48 * 48 / 2, px);
+        spinner_px += px;
+        assert_same_as_full_redraw();
+    }
+
+    /*The first frame is restarted and covers the whole GIF*/
+    TEST_ASSERT_EQUAL_UINT32(48 * 48, next_frame());
+    assert_same_as_full_redraw();
+    TEST_PRINTF("spinner: %" LV_PRIu32 " px redrawn per frame instead of %d", spinner_px / 7, 48 * 48);
+
+    lv_obj_delete(gif);
+    gif = gif_create(LOADER_SRC);
+
+    /*Loader: a 10x8 part of the bar in each frame*/
+    for(i = 1; i < 12; i++) {
+        TEST_ASSERT_EQUAL_UINT32(10 * 8, next_frame());
+        assert_same_as_full_redraw();
+    }
+    TEST_PRINTF("loader: %d px redrawn per frame instead of %d", 10 * 8, 120 * 12);
+}
+
+void test_gif_invalidate_aligned_and_clipped(void)
+{
+    lv_obj_t * gif = gif_create(LOADER_SRC);
+
+    /*The GIF is centered in the narrower widget so its sides are clipped*/
+    lv_obj_set_size(gif, 100, 40);
+    lv_image_set_inner_align(gif, LV_IMAGE_ALIGN_CENTER);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 1; i < 12; i++) {
+        uint32_t px = next_frame();
+        /*The bar starts at x = -10 in the widget so the first part is out of it*/
+        TEST_ASSERT_EQUAL_UINT32(i == 1 ? 0 : 10 * 8, px);
+        assert_same_as_full_redraw();
+    }
+}
+
+void test_gif_invalidate_whole_when_transformed(void)
+{
+    lv_obj_t * gif = gif_create(SPINNER_SRC);
+    lv_image_set_scale(gif, 512);
+    lv_refr_now(NULL);
+
+    uint32_t px = next_frame();
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(48 * 48, px);
+    assert_same_as_full_redraw();
+}
+
+#endif
@@ -160,4 +160,100 @@ void test_click(void)
     TEST_ASSERT_EQUAL_UINT8(1, counts.short_click_streak);
 }
 
+
+static lv_obj_t * create_plain_obj(lv_obj_t * parent, int32_t x, int32_t y, int32_t size)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, size, size);
+    return obj;
+}
+
+static lv_obj_t * search_at(int32_t x, int32_t y)
+{
+    lv_point_t p = {x, y};
+    return lv_indev_search_obj(lv_screen_active(), &p);
+}
+
+void test_click_search_follows_tree_changes(void)
+{
+    /*With LV_OBJ_DRAW_LIST the search uses a cached list of the objects
+     *which needs to follow every change*/
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_t * cont = create_plain_obj(scr, 0, 0, 200);
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_t * a = create_plain_obj(cont, 10, 10, 50);
+    lv_obj_t * b = create_plain_obj(cont, 30, 30, 50);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_EQUAL_PTR(b, search_at(40, 40));
+    TEST_ASSERT_EQUAL_PTR(a, search_at(15, 15));
+    TEST_ASSERT_EQUAL_PTR(cont, search_at(150, 150));
+
+    /*Hidden*/
+    lv_obj_add_flag(b, LV_OBJ_FLAG_HIDDEN);
+    TEST_ASSERT_EQUAL_PTR(a, search_at(40, 40));
+    lv_obj_remove_flag(b, LV_OBJ_FLAG_HIDDEN);
+    TEST_ASSERT_EQUAL_PTR(b, search_at(40, 40));
+
+    /*Order*/
+    lv_obj_move_to_index(b, 0);
+    TEST_ASSERT_EQUAL_PTR(a, search_at(40, 40));
+    lv_obj_move_to_index(b, -1);
+    TEST_ASSERT_EQUAL_PTR(b, search_at(40, 40));
+
+    /*Position*/
+    lv_obj_set_pos(b, 100, 100);
+    lv_obj_update_layout(scr);
+    TEST_ASSERT_EQUAL_PTR(a, search_at(40, 40));
+    TEST_ASSERT_EQUAL_PTR(b, search_at(110, 110));
+
+    /*Clipped by the parent*/
+    lv_obj_set_pos(b, 190, 20);
+    lv_obj_update_layout(scr);
+    TEST_ASSERT_EQUAL_PTR(b, search_at(195, 25));
+    TEST_ASSERT_EQUAL_PTR(scr, search_at(230, 25));
+
+    /*Extended click area*/
+    lv_obj_set_pos(b, 100, 100);
+    lv_obj_update_layout(scr);
+    TEST_ASSERT_EQUAL_PTR(cont, search_at(95, 95));
+    lv_obj_set_ext_click_area(b, 10);
+    TEST_ASSERT_EQUAL_PTR(b, search_at(95, 95));
+
+    /*Transformed*/
+    lv_obj_set_style_transform_scale(b, 512, 0);
+    lv_obj_set_style_transform_pivot_x(b, 0, 0);
+    lv_obj_set_style_transform_pivot_y(b, 0, 0);
+    TEST_ASSERT_EQUAL_PTR(b, search_at(190, 190));
+    lv_obj_set_style_transform_scale(b, 256, 0);
+    TEST_ASSERT_EQUAL_PTR(cont, search_at(190, 190));
+
+    /*New and deleted objects*/
+    lv_obj_t * c = create_plain_obj(cont, 0, 0, 50);
+    lv_obj_update_layout(scr);
+    TEST_ASSERT_EQUAL_PTR(c, search_at(15, 15));
+    lv_obj_delete(c);
+    TEST_ASSERT_EQUAL_PTR(a, search_at(15, 15));
+
+    /*New parent*/
+    lv_obj_set_parent(a, scr);
+    lv_obj_update_layout(scr);
+    TEST_ASSERT_EQUAL_PTR(a, search_at(15, 15));
+    lv_obj_set_parent(a, cont);
+    lv_obj_update_layout(scr);
+    TEST_ASSERT_EQUAL_PTR(a, search_at(15, 15));
+    lv_obj_move_to_index(cont, -1);
+    TEST_ASSERT_EQUAL_PTR(a, search_at(15, 15));
+
+    /*Moving the parent moves the children too*/
+    lv_obj_set_pos(cont, 300, 0);
+    lv_obj_update_layout(scr);
+    TEST_ASSERT_EQUAL_PTR(scr, search_at(15, 15));
+    TEST_ASSERT_EQUAL_PTR(a, search_at(315, 15));
+
+    lv_refr_now(NULL);
+}
+
 #endif
@@ -250,6 +250,129 @@ void test_display_triple_buffer(void)
     lv_draw_buf_destroy(buf3);
 }
 
+static lv_obj_t * sync_rect_create(lv_obj_t * parent, int32_t x, int32_t y)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, 10, 10);
+    return obj;
+}
+
+static lv_display_t * sync_display_create(lv_draw_buf_t * buf1, lv_draw_buf_t * buf2, lv_draw_buf_t * buf3)
+{
+    lv_display_t * disp = lv_display_create(100, 100);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, dummy_flush_cb);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_display_set_draw_buffers(disp, buf1, buf2);
+    if(buf3) lv_display_set_3rd_draw_buffer(disp, buf3);
+    return disp;
+}
+
+static bool sync_buf_equal(const lv_draw_buf_t * buf1, const lv_draw_buf_t * buf2)
+{
+    uint32_t y;
+    for(y = 0; y < buf1->header.h; y++) {
+        if(lv_memcmp(buf1->data + y * buf1->header.stride, buf2->data + y * buf2->header.stride, buf1->header.w * 2)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_display_direct_mode_sync(void)
+{
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_RGB565, 0);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_RGB565, 0);
+    lv_display_t * disp = sync_display_create(buf1, buf2, NULL);
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * a = sync_rect_create(scr, 10, 10);
+    lv_obj_t * b = sync_rect_create(scr, 60, 60);
+
+    /*The first frame is rendered into buf1 and there is nothing to sync yet*/
+    lv_obj_invalidate(scr);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->sync_copy_size);
+
+    /*buf2 receives everything from buf1 except the redrawn rectangle*/
+    lv_obj_set_style_bg_color(a, lv_color_hex(0x00ff00), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32((100 * 100 - 10 * 10) * 2, disp->sync_copy_size);
+
+    /*buf1 has missed only the change of `a`*/
+    lv_obj_set_style_bg_color(b, lv_color_hex(0x00ff00), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(10 * 10 * 2, disp->sync_copy_size);
+
+    /*The missed area is redrawn anyway*/
+    lv_obj_set_style_bg_color(b, lv_color_hex(0x0000ff), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->sync_copy_size);
+
+    /*Redraw a single pixel, after that both buffers should have the same content*/
+    lv_area_t px_area = {0, 0, 0, 0};
+    lv_obj_invalidate_area(scr, &px_area);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(10 * 10 * 2, disp->sync_copy_size);
+    TEST_ASSERT_TRUE(sync_buf_equal(buf1, buf2));
+
+    /*Nothing is copied if nothing is redrawn*/
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(10 * 10 * 2, disp->sync_copy_size);
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+}
+
+void test_display_direct_mode_sync_triple_buffer(void)
+{
+    lv_draw_buf_t * buf1 = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_RGB565, 0);
+    lv_draw_buf_t * buf2 = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_RGB565, 0);
+    lv_draw_buf_t * buf3 = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_RGB565, 0);
+    lv_display_t * disp = sync_display_create(buf1, buf2, buf3);
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_t * a = sync_rect_create(scr, 10, 10);
+    lv_obj_t * b = sync_rect_create(scr, 60, 60);
+
+    lv_obj_invalidate(scr);
+    lv_refr_now(disp);
+    lv_obj_set_style_bg_color(a, lv_color_hex(0x00ff00), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32((100 * 100 - 10 * 10) * 2, disp->sync_copy_size);
+
+    /*buf3 has missed the first two frames, the overlapping areas are copied only once*/
+    lv_obj_set_style_bg_color(b, lv_color_hex(0x00ff00), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32((100 * 100 - 10 * 10) * 2, disp->sync_copy_size);
+
+    /*buf1 has missed the changes of `a` and `b` but `a` is redrawn now*/
+    lv_obj_set_style_bg_color(a, lv_color_hex(0x0000ff), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(10 * 10 * 2, disp->sync_copy_size);
+    TEST_ASSERT_EQUAL(lv_display_get_buf_active(disp), buf2);
+
+    lv_obj_set_style_bg_color(a, lv_color_hex(0xff0000), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(10 * 10 * 2, disp->sync_copy_size);
+
+    lv_area_t px_area = {0, 0, 0, 0};
+    lv_obj_invalidate_area(scr, &px_area);
+    lv_refr_now(disp);
+    lv_obj_invalidate_area(scr, &px_area);
+    lv_refr_now(disp);
+    TEST_ASSERT_TRUE(sync_buf_equal(buf1, buf2));
+    TEST_ASSERT_TRUE(sync_buf_equal(buf1, buf3));
+
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(buf1);
+    lv_draw_buf_destroy(buf2);
+    lv_draw_buf_destroy(buf3);
+}
+
 static void refr_event_handler(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
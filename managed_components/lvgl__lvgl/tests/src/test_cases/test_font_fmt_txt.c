@@ -0,0 +1,89 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/* fonts converted to C structs using the LVGL Font Converter */
+extern lv_font_t test_font_1;
+extern lv_font_t test_font_2;
+extern lv_font_t test_font_3;
+
+static const char * latin_text = "The quick brown fox jumped over the lazy dog. AVAWAYTeToVa";
+static const char * cjk_text = "我们的生活中有很多人和事，这些都是我们成长的一部分。今天天气很好";
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void compare_glyphs(const lv_font_t * f1, const lv_font_t * f2, const char * text)
+{
+    uint32_t ofs = 0;
+    uint32_t letter = lv_text_encoded_next(text, &ofs);
+    while(letter) {
+        uint32_t letter_next = lv_text_encoded_next(text, &ofs);
+        lv_font_glyph_dsc_t g1;
+        lv_font_glyph_dsc_t g2;
+        bool found1 = lv_font_get_glyph_dsc(f1, &g1, letter, letter_next);
+        bool found2 = lv_font_get_glyph_dsc(f2, &g2, letter, letter_next);
+        TEST_ASSERT_EQUAL(found1, found2);
+        if(found1) {
+            TEST_ASSERT_EQUAL_UINT32(g1.gid.index, g2.gid.index);
+            TEST_ASSERT_EQUAL_INT32(g1.adv_w, g2.adv_w);
+            TEST_ASSERT_EQUAL_INT32(g1.box_w, g2.box_w);
+        }
+        letter = letter_next;
+    }
+}
+
+void test_font_fmt_txt_cached_lookup(void)
+{
+#if LV_FONT_SOURCE_HAN_SANS_SC_16_CJK
+    /*The second lookups come from the cache, they should give the same result*/
+    compare_glyphs(&lv_font_source_han_sans_sc_16_cjk, &lv_font_source_han_sans_sc_16_cjk, cjk_text);
+    compare_glyphs(&lv_font_source_han_sans_sc_16_cjk, &lv_font_source_han_sans_sc_16_cjk, latin_text);
+
+    /*Letters mapped to the same cache entry and letters which are probably missing*/
+    static const uint32_t letters[] = {0x4E00, 0x4E00 + 1024, 0x4E00 + 2048, 0x4E01, 0x4E02, 0x9FA0, 0xE000};
+    uint32_t gids[sizeof(letters) / sizeof(letters[0])];
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < 3; i++) {
+        for(j = 0; j < sizeof(letters) / sizeof(letters[0]); j++) {
+            lv_font_glyph_dsc_t g;
+            bool found = lv_font_get_glyph_dsc(&lv_font_source_han_sans_sc_16_cjk, &g, letters[j], 0);
+            uint32_t gid = found ? g.gid.index : 0;
+            if(i == 0) gids[j] = gid;
+            else TEST_ASSERT_EQUAL_UINT32(gids[j], gid);
+        }
+    }
+    TEST_ASSERT_NOT_EQUAL(0, gids[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, gids[6]);
+#endif
+}
+
+void test_font_fmt_txt_cache_of_loaded_fonts(void)
+{
+    /*The loaded fonts might be allocated to the same address,
+     *their caches shouldn't be mixed up*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_font_t * font_1 = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+        TEST_ASSERT_NOT_NULL(font_1);
+        compare_glyphs(&test_font_1, font_1, latin_text);
+        compare_glyphs(&test_font_1, font_1, latin_text);
+        lv_binfont_destroy(font_1);
+
+        lv_font_t * font_3 = lv_binfont_create("A:src/test_assets/test_font_3.fnt");
+        TEST_ASSERT_NOT_NULL(font_3);
+        compare_glyphs(&test_font_3, font_3, latin_text);
+        compare_glyphs(&test_font_3, font_3, latin_text);
+        lv_binfont_destroy(font_3);
+    }
+}
+
+#endif
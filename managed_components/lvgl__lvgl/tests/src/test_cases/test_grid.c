@@ -86,4 +86,83 @@ void test_subgrid_col(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("subgrid_col.png");
 }
 
+static lv_obj_t * plain_cell_create(lv_obj_t * parent, int32_t col, int32_t row)
+{
+    lv_obj_t * cell = lv_obj_create(parent);
+    lv_obj_remove_style_all(cell);
+    lv_obj_set_size(cell, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cell, LV_FLEX_FLOW_ROW);
+    lv_obj_set_grid_cell(cell, LV_GRID_ALIGN_START, col, 1, LV_GRID_ALIGN_START, row, 1);
+    return cell;
+}
+
+void test_grid_content_tracks_follow_nested_changes(void)
+{
+    static const int32_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    static const int32_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+
+    /*Each cell is a content sized flex container with a fixed size child*/
+    lv_obj_t * boxes[4];
+    lv_obj_t * cells[4];
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        cells[i] = plain_cell_create(cont, i % 2, i / 2);
+        boxes[i] = lv_obj_create(cells[i]);
+        lv_obj_remove_style_all(boxes[i]);
+        lv_obj_set_size(boxes[i], 10, 10);
+    }
+
+    /*A child with percentage width in a parent whose size changes*/
+    lv_obj_t * wrapper = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(wrapper);
+    lv_obj_set_size(wrapper, 20, 20);
+    lv_obj_t * pct = lv_obj_create(wrapper);
+    lv_obj_remove_style_all(pct);
+    lv_obj_set_size(pct, LV_PCT(50), 5);
+
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_width(cont));
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_height(cont));
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_x(cells[1]));
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_y(cells[3]));
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_width(pct));
+
+    /*Resize a deeply nested Widget: the cell, the track, the grid and the children of the grid follow it*/
+    lv_obj_set_width(boxes[0], 30);
+    lv_obj_set_height(boxes[3], 25);
+    lv_obj_set_width(wrapper, 40);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(30, lv_obj_get_width(cells[0]));
+    TEST_ASSERT_EQUAL_INT32(30, lv_obj_get_x(cells[1]));
+    TEST_ASSERT_EQUAL_INT32(30, lv_obj_get_x(cells[3]));
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_y(cells[3]));
+    TEST_ASSERT_EQUAL_INT32(40, lv_obj_get_width(cont));
+    TEST_ASSERT_EQUAL_INT32(35, lv_obj_get_height(cont));
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_width(pct));
+
+    /*And back*/
+    lv_obj_set_width(boxes[0], 10);
+    lv_obj_set_height(boxes[3], 10);
+    lv_obj_set_width(wrapper, 20);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_x(cells[1]));
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_width(cont));
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_height(cont));
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_width(pct));
+
+    /*Hidden items don't count*/
+    lv_obj_set_width(boxes[2], 50);
+    lv_obj_add_flag(cells[2], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(10, lv_obj_get_x(cells[1]));
+    lv_obj_remove_flag(cells[2], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_INT32(50, lv_obj_get_x(cells[1]));
+}
+
 #endif
@@ -0,0 +1,138 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "unity/unity.h"
+
+#define DISP_SIZE       200
+#define DISP_BUF_ROWS   20
+
+static lv_display_t * disp;
+static lv_draw_buf_t * draw_buf;
+static uint32_t rendered_area_cnt;
+static uint32_t rendered_px;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(d);
+}
+
+static void render_start_cb(lv_event_t * e)
+{
+    lv_display_t * d = lv_event_get_target(e);
+    rendered_area_cnt = 0;
+    rendered_px = 0;
+    uint32_t i;
+    for(i = 0; i < d->inv_p; i++) {
+        if(d->inv_area_joined[i]) continue;
+        rendered_area_cnt++;
+        rendered_px += lv_area_get_size(&d->inv_areas[i]);
+    }
+}
+
+static void invalidate(int32_t x, int32_t y, int32_t w, int32_t h)
+{
+    lv_area_t area = {x, y, x + w - 1, y + h - 1};
+    lv_obj_invalidate_area(lv_display_get_screen_active(disp), &area);
+}
+
+void setUp(void)
+{
+    disp = lv_display_create(DISP_SIZE, DISP_SIZE);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    draw_buf = lv_draw_buf_create(DISP_SIZE, DISP_BUF_ROWS, LV_COLOR_FORMAT_RGB565, 0);
+    lv_display_set_draw_buffers(disp, draw_buf, NULL);
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    lv_refr_now(disp);
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(draw_buf);
+    disp = NULL;
+}
+
+void test_inv_area_scattered(void)
+{
+#if LV_USE_INV_AREA_COST_MODEL
+    /*More areas than `LV_INV_BUF_SIZE` but they are not far from each other:
+     *the buffer grows instead of redrawing the whole screen*/
+    lv_display_set_inv_area_cost(disp, 0);
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        invalidate((i % 10) * 20, (i / 10) * 20, 2, 2);
+    }
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(100, rendered_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(100 * 2 * 2, rendered_px);
+
+    /*Beyond `LV_INV_BUF_MAX_SIZE` the new areas are joined into the closest ones*/
+    for(i = 0; i < LV_INV_BUF_MAX_SIZE + 100; i++) {
+        invalidate((i % 20) * 10, (i / 20) * 10, 1, 1);
+    }
+    lv_refr_now(disp);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_INV_BUF_MAX_SIZE, rendered_area_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(DISP_SIZE * DISP_SIZE / 10, rendered_px);
+#else
+    /*Without the cost model the whole screen is redrawn if the buffer is full*/
+    uint32_t i;
+    for(i = 0; i < LV_INV_BUF_SIZE + 1; i++) {
+        invalidate((i % 10) * 20, (i / 10) * 20, 2, 2);
+    }
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(DISP_SIZE * DISP_SIZE, rendered_px);
+#endif
+}
+
+void test_inv_area_join_by_cost(void)
+{
+#if LV_USE_INV_AREA_COST_MODEL
+    /*Without a fixed cost only the overlapping areas are worth joining*/
+    lv_display_set_inv_area_cost(disp, 0);
+    invalidate(0, 0, 10, 10);
+    invalidate(30, 0, 10, 10);
+    invalidate(35, 5, 10, 10);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(3, rendered_area_cnt);
+
+    /*Rendering 40x10 pixels once is cheaper than rendering 10x10 pixels twice*/
+    lv_display_set_inv_area_cost(disp, 500);
+    TEST_ASSERT_EQUAL_UINT32(500, lv_display_get_inv_area_cost(disp));
+    invalidate(0, 0, 10, 10);
+    invalidate(30, 0, 10, 10);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, rendered_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(40 * 10, rendered_px);
+
+    /*Areas far from each other are still rendered separately*/
+    invalidate(0, 0, 10, 10);
+    invalidate(150, 150, 10, 10);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, rendered_area_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * 10 * 10, rendered_px);
+#endif
+}
+
+void test_inv_area_join_bands(void)
+{
+#if LV_USE_INV_AREA_COST_MODEL
+    /*Two full width lines fitting into the same band of the buffer are rendered together,
+     *but not if they would need more bands*/
+    lv_display_set_inv_area_cost(disp, 4000);
+    invalidate(0, 0, DISP_SIZE, 2);
+    invalidate(0, DISP_BUF_ROWS - 2, DISP_SIZE, 2);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, rendered_area_cnt);
+
+    invalidate(0, 0, DISP_SIZE, 2);
+    invalidate(0, DISP_BUF_ROWS, DISP_SIZE, 2);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, rendered_area_cnt);
+#endif
+}
+
+#endif
@@ -50,4 +50,223 @@ void test_memcpy_unaligned(void)
     }
 }
 
+#if LV_USE_MEM_SLAB
+static uint32_t get_slab_used_cnt(void)
+{
+    lv_mem_slab_monitor_t mon;
+    lv_mem_slab_monitor(&mon);
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        TEST_ASSERT_LESS_OR_EQUAL(mon.classes[i].total_cnt, mon.classes[i].used_cnt + mon.classes[i].cached_cnt);
+        cnt += mon.classes[i].used_cnt;
+    }
+    return cnt;
+}
+#endif
+
+void test_mem_slab_alloc_free(void)
+{
+#if LV_USE_MEM_SLAB
+    static uint8_t * bufs[300];
+    uint32_t used_cnt = get_slab_used_cnt();
+
+    /*The small sizes are served from the size classes, the larger ones by the core allocator*/
+    uint32_t i;
+    for(i = 0; i < 300; i++) {
+        bufs[i] = lv_malloc(i + 1);
+        TEST_ASSERT_NOT_NULL(bufs[i]);
+        TEST_ASSERT_EQUAL(0, (lv_uintptr_t)bufs[i] & 0x7);
+        lv_memset(bufs[i], (uint8_t)i, i + 1);
+    }
+    TEST_ASSERT_EQUAL(used_cnt + 256, get_slab_used_cnt());
+
+    lv_mem_slab_monitor_t mon;
+    lv_mem_slab_monitor(&mon);
+    TEST_ASSERT_EQUAL(8, mon.classes[0].block_size);
+    TEST_ASSERT_EQUAL(256, mon.classes[LV_MEM_SLAB_CLASS_CNT - 1].block_size);
+    TEST_ASSERT_GREATER_THAN(0, mon.total_size);
+    TEST_ASSERT_LESS_OR_EQUAL(mon.total_size, mon.used_size);
+
+    /*Growing moves the content to a larger class or to the core allocator*/
+    for(i = 0; i < 300; i++) {
+        bufs[i] = lv_realloc(bufs[i], i + 1 + (i % 3) * 100);
+        TEST_ASSERT_NOT_NULL(bufs[i]);
+        uint32_t j;
+        for(j = 0; j <= i; j++) TEST_ASSERT_EQUAL_UINT8((uint8_t)i, bufs[i][j]);
+    }
+
+    for(i = 0; i < 300; i++) {
+        lv_free(bufs[i]);
+    }
+    TEST_ASSERT_EQUAL(used_cnt, get_slab_used_cnt());
+#endif
+}
+
+void test_mem_slab_reuse(void)
+{
+#if LV_USE_MEM_SLAB
+    /*Freeing and allocating the same size reuses the blocks without new pages*/
+    void * p = lv_malloc(40);
+    lv_free(p);
+
+    lv_mem_slab_monitor_t mon_before;
+    lv_mem_slab_monitor(&mon_before);
+
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        void * p1 = lv_malloc(40);
+        void * p2 = lv_zalloc(33);
+        TEST_ASSERT_EACH_EQUAL_UINT8(0, p2, 33);
+        lv_free(p1);
+        lv_free(p2);
+    }
+
+    lv_mem_slab_monitor_t mon_after;
+    lv_mem_slab_monitor(&mon_after);
+    TEST_ASSERT_EQUAL(mon_before.classes[4].page_cnt, mon_after.classes[4].page_cnt);
+    TEST_ASSERT_EQUAL(mon_before.classes[4].used_cnt, mon_after.classes[4].used_cnt);
+
+    /*The empty pages are freed, except one per class*/
+    static void * bufs[2000];
+    for(i = 0; i < 2000; i++) bufs[i] = lv_malloc(100);
+    lv_mem_slab_monitor(&mon_after);
+    TEST_ASSERT_GREATER_THAN(mon_before.classes[7].page_cnt + 10, mon_after.classes[7].page_cnt);
+
+    for(i = 0; i < 2000; i++) lv_free(bufs[i]);
+    lv_mem_slab_monitor(&mon_after);
+    TEST_ASSERT_LESS_OR_EQUAL(mon_before.classes[7].page_cnt + 3, mon_after.classes[7].page_cnt);
+#endif
+}
+
+void test_mem_slab_trim(void)
+{
+#if LV_USE_MEM_SLAB
+    static void * bufs[500];
+    uint32_t i;
+    for(i = 0; i < 500; i++) bufs[i] = lv_malloc(200);
+    for(i = 0; i < 500; i++) lv_free(bufs[i]);
+
+    /*The cached blocks and the empty pages are given back*/
+    lv_mem_slab_trim();
+    lv_mem_slab_monitor_t mon;
+    lv_mem_slab_monitor(&mon);
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        TEST_ASSERT_EQUAL(0, mon.classes[i].cached_cnt);
+        if(mon.classes[i].used_cnt == 0) TEST_ASSERT_EQUAL(0, mon.classes[i].page_cnt);
+    }
+
+    /*Still usable after trimming*/
+    void * p = lv_malloc(200);
+    TEST_ASSERT_NOT_NULL(p);
+    lv_free(p);
+#endif
+}
+
+#if LV_USE_MEM_TRACE
+static uint8_t dump_buf[sizeof(lv_mem_trace_header_t) + LV_MEM_TRACE_BUF_SIZE * sizeof(lv_mem_trace_entry_t)];
+static uint32_t dump_size;
+
+static void dump_cb(const void * data, uint32_t size, void * user_data)
+{
+    TEST_ASSERT_EQUAL_PTR(dump_buf, user_data);
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(dump_buf), dump_size + size);
+    lv_memcpy(dump_buf + dump_size, data, size);
+    dump_size += size;
+}
+
+static const lv_mem_trace_entry_t * dump_trace(void)
+{
+    dump_size = 0;
+    lv_mem_trace_dump(dump_cb, dump_buf);
+
+    const lv_mem_trace_header_t * header = (const lv_mem_trace_header_t *)dump_buf;
+    TEST_ASSERT_EQUAL_MEMORY("LVMT", header->magic, 4);
+    TEST_ASSERT_EQUAL(1, header->version);
+    TEST_ASSERT_EQUAL(sizeof(lv_mem_trace_entry_t), header->entry_size);
+    TEST_ASSERT_EQUAL(sizeof(lv_mem_trace_header_t) + header->entry_cnt * sizeof(lv_mem_trace_entry_t), dump_size);
+    return (const lv_mem_trace_entry_t *)(dump_buf + sizeof(lv_mem_trace_header_t));
+}
+#endif
+
+void test_mem_trace(void)
+{
+#if LV_USE_MEM_TRACE
+    lv_mem_trace_clear();
+    lv_mem_trace_start();
+
+    uint8_t * p1 = lv_malloc(100);
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_FONT);
+    uint8_t * p2 = lv_malloc(200);
+    LV_MEM_TRACE_TAG_BEGIN(LV_MEM_TRACE_TAG_USER + 1);
+    uint8_t * p2_old = p2;
+    p2 = lv_realloc(p2, 3000);
+    LV_MEM_TRACE_TAG_END();
+    LV_MEM_TRACE_TAG_END();
+    lv_free(p1);
+    lv_free(p2);
+
+    /*Not recorded*/
+    lv_mem_trace_stop();
+    lv_free(lv_malloc(10));
+
+    TEST_ASSERT_EQUAL(5, lv_mem_trace_get_entry_cnt());
+    const lv_mem_trace_entry_t * e = dump_trace();
+
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_OP_ALLOC, e[0].op);
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_TAG_NONE, e[0].tag);
+    TEST_ASSERT_EQUAL(100, e[0].size);
+    TEST_ASSERT_EQUAL_UINT32((lv_uintptr_t)p1, e[0].ptr);
+
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_OP_ALLOC, e[1].op);
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_TAG_FONT, e[1].tag);
+    TEST_ASSERT_EQUAL(200, e[1].size);
+
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_OP_REALLOC, e[2].op);
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_TAG_USER + 1, e[2].tag);
+    TEST_ASSERT_EQUAL(3000, e[2].size);
+    TEST_ASSERT_EQUAL_UINT32((lv_uintptr_t)p2_old, e[2].old_ptr);
+    TEST_ASSERT_EQUAL_UINT32((lv_uintptr_t)p2, e[2].ptr);
+
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_OP_FREE, e[3].op);
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_TAG_NONE, e[3].tag);
+    TEST_ASSERT_EQUAL_UINT32((lv_uintptr_t)p1, e[3].ptr);
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_OP_FREE, e[4].op);
+    TEST_ASSERT_EQUAL_UINT32((lv_uintptr_t)p2, e[4].ptr);
+    TEST_ASSERT_LESS_OR_EQUAL(e[4].timestamp, e[0].timestamp);
+
+    lv_mem_trace_clear();
+    TEST_ASSERT_EQUAL(0, lv_mem_trace_get_entry_cnt());
+#endif
+}
+
+void test_mem_trace_ring_buffer(void)
+{
+#if LV_USE_MEM_TRACE
+    lv_mem_trace_clear();
+    lv_mem_trace_start();
+
+    /*The oldest entries are overwritten*/
+    uint32_t i;
+    for(i = 0; i < LV_MEM_TRACE_BUF_SIZE / 2 + 10; i++) {
+        lv_free(lv_malloc(i + 1));
+    }
+    lv_mem_trace_stop();
+
+    TEST_ASSERT_EQUAL(LV_MEM_TRACE_BUF_SIZE, lv_mem_trace_get_entry_cnt());
+    const lv_mem_trace_entry_t * e = dump_trace();
+    const lv_mem_trace_header_t * header = (const lv_mem_trace_header_t *)dump_buf;
+    TEST_ASSERT_EQUAL(20, header->dropped_cnt);
+
+    for(i = 0; i < LV_MEM_TRACE_BUF_SIZE; i += 2) {
+        TEST_ASSERT_EQUAL(LV_MEM_TRACE_OP_ALLOC, e[i].op);
+        TEST_ASSERT_EQUAL(i / 2 + 11, e[i].size);
+        TEST_ASSERT_EQUAL(LV_MEM_TRACE_OP_FREE, e[i + 1].op);
+        TEST_ASSERT_EQUAL(e[i].ptr, e[i + 1].ptr);
+    }
+
+    lv_mem_trace_clear();
+#endif
+}
+
 #endif
@@ -68,6 +68,10 @@ void test_profiler_normal(void)
     TEST_ASSERT_EQUAL_STRING(output_buf[1], "   LVGL-1 [0] 1.000000000: tracing_mark_write: E|1|test_profiler_normal\n");
     TEST_ASSERT_EQUAL_STRING(output_buf[2], "   LVGL-1 [0] 2.000000000: tracing_mark_write: B|1|custom_tag\n");
     TEST_ASSERT_EQUAL_STRING(output_buf[3], "   LVGL-1 [0] 3.000000000: tracing_mark_write: E|1|custom_tag\n");
+
+    /* flushed items are not output again */
+    lv_profiler_builtin_flush();
+    TEST_ASSERT_EQUAL_INT(output_line, 4);
 }
 
 void test_profiler_disable(void)
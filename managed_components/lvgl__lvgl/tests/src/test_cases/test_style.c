@@ -222,4 +222,110 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+
+void test_style_resolved_values_follow_changes(void)
+{
+    /*The values must be the same with and without LV_OBJ_STYLE_RESOLVED_CACHE*/
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0xff0000));
+
+    lv_style_t style_pr;
+    lv_style_init(&style_pr);
+    lv_style_set_bg_color(&style_pr, lv_color_hex(0x00ff00));
+
+    lv_style_t style_parent;
+    lv_style_init(&style_parent);
+    lv_style_set_text_color(&style_parent, lv_color_hex(0x111111));
+
+    /*Remove the theme's styles to see only the styles added here*/
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(parent);
+    lv_obj_add_style(parent, &style_parent, 0);
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_add_style(obj, &style, 0);
+    lv_obj_add_style(obj, &style_pr, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, 0));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, 0));
+
+    /*Changing a shared style without reporting it*/
+    lv_style_set_bg_color(&style, lv_color_hex(0x0000ff));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, 0));
+
+    /*State change*/
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, 0));
+    lv_obj_remove_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, 0));
+
+    /*Local style*/
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x123456), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x123456), lv_obj_get_style_bg_color(obj, 0));
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_BG_COLOR, 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, 0));
+
+    /*Disabled and removed styles*/
+    lv_obj_style_set_disabled(obj, &style, 0, true);
+    TEST_ASSERT_EQUAL_COLOR(lv_style_prop_get_default(LV_STYLE_BG_COLOR).color, lv_obj_get_style_bg_color(obj, 0));
+    lv_obj_style_set_disabled(obj, &style, 0, false);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, 0));
+    lv_obj_remove_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_style_prop_get_default(LV_STYLE_BG_COLOR).color, lv_obj_get_style_bg_color(obj, 0));
+
+    /*Inherited value changed on the parent*/
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x111111), lv_obj_get_style_text_color(obj, 0));
+    lv_style_set_text_color(&style_parent, lv_color_hex(0x222222));
+    lv_obj_report_style_change(&style_parent);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x222222), lv_obj_get_style_text_color(obj, 0));
+
+    lv_obj_delete(parent);
+    lv_style_reset(&style);
+    lv_style_reset(&style_pr);
+    lv_style_reset(&style_parent);
+}
+
+void test_style_resolved_cache_hits(void)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0xff0000));
+    lv_style_set_pad_top(&style, 10);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+
+    lv_obj_style_resolved_cache_stats_t stats;
+    lv_obj_style_reset_resolved_cache_stats();
+    lv_obj_get_style_bg_color(obj, 0);
+    lv_obj_get_style_pad_top(obj, 0);
+    lv_obj_style_get_resolved_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.lookups);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hits);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.misses);
+
+    lv_obj_get_style_bg_color(obj, 0);
+    lv_obj_get_style_pad_top(obj, 0);
+    lv_obj_style_get_resolved_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.lookups);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hits);
+
+    /*Any change of a style drops the stored values*/
+    lv_style_set_pad_top(&style, 20);
+    TEST_ASSERT_EQUAL_INT32(20, lv_obj_get_style_pad_top(obj, 0));
+    lv_obj_style_get_resolved_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.misses);
+
+    /*Not frequently used properties are not cached*/
+    lv_obj_get_style_grid_cell_row_span(obj, 0);
+    lv_obj_style_get_resolved_cache_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.hits);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.misses);
+
+    lv_obj_delete(obj);
+    lv_style_reset(&style);
+#endif
+}
+
 #endif
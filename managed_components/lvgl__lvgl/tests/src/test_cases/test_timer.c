@@ -0,0 +1,255 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define SYS_TIMER_MAX   16
+
+static lv_timer_t * sys_timers[SYS_TIMER_MAX];
+static bool sys_timer_paused[SYS_TIMER_MAX];
+static uint32_t sys_timer_cnt;
+static char run_log[32];
+static uint32_t run_cnt;
+
+static bool is_sys_timer(lv_timer_t * timer)
+{
+    uint32_t i;
+    for(i = 0; i < sys_timer_cnt; i++) {
+        if(sys_timers[i] == timer) return true;
+    }
+    return false;
+}
+
+void setUp(void)
+{
+    /*Pause the timers of the display, input devices, etc. to see only the timers of the tests*/
+    sys_timer_cnt = 0;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        TEST_ASSERT_LESS_THAN_UINT32(SYS_TIMER_MAX, sys_timer_cnt);
+        sys_timers[sys_timer_cnt] = timer;
+        sys_timer_paused[sys_timer_cnt] = lv_timer_get_paused(timer);
+        sys_timer_cnt++;
+        lv_timer_pause(timer);
+        timer = lv_timer_get_next(timer);
+    }
+
+    lv_memzero(run_log, sizeof(run_log));
+    run_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_anim_delete_all();
+
+    /*Delete the timers of the tests*/
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+    while(timer) {
+        lv_timer_t * next = lv_timer_get_next(timer);
+        if(!is_sys_timer(timer)) lv_timer_delete(timer);
+        timer = next;
+    }
+
+    uint32_t i;
+    for(i = 0; i < sys_timer_cnt; i++) {
+        if(!sys_timer_paused[i]) lv_timer_resume(sys_timers[i]);
+    }
+}
+
+static void log_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
+
+static void log_name_cb(lv_timer_t * timer)
+{
+    lv_strcat(run_log, lv_timer_get_user_data(timer));
+}
+
+static void delete_next_cb(lv_timer_t * timer)
+{
+    log_name_cb(timer);
+    lv_timer_t * next = lv_timer_get_next(timer);
+    if(next && !is_sys_timer(next)) lv_timer_delete(next);
+}
+
+static void delete_self_cb(lv_timer_t * timer)
+{
+    run_cnt++;
+    lv_timer_delete(timer);
+}
+
+static lv_timer_t * create_timer(lv_timer_cb_t cb, uint32_t period)
+{
+    return lv_timer_create(cb, period, NULL);
+}
+
+void test_timer_time_until_next(void)
+{
+    create_timer(log_cb, 100);
+    create_timer(log_cb, 30);
+
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt);
+
+    lv_tick_inc(20);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+
+    lv_tick_inc(10);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+
+    /*Timers don't try to catch up the missed periods*/
+    lv_tick_inc(70);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+}
+
+void test_timer_no_timer_ready(void)
+{
+    lv_timer_t * timer = create_timer(log_cb, 10);
+    lv_timer_pause(timer);
+
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    lv_tick_inc(20);
+    lv_timer_resume(timer);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+}
+
+void test_timer_run_order(void)
+{
+    /*Timers with the same deadline run from the newest*/
+    lv_timer_create(log_name_cb, 100, (void *)"A");
+    lv_timer_create(log_name_cb, 100, (void *)"B");
+    lv_timer_create(log_name_cb, 100, (void *)"C");
+    lv_tick_inc(100);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("CBA", run_log);
+}
+
+void test_timer_period_change(void)
+{
+    lv_timer_t * timer = create_timer(log_cb, 100);
+    lv_tick_inc(20);
+    lv_timer_set_period(timer, 50);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+
+    lv_timer_reset(timer);
+    TEST_ASSERT_EQUAL_UINT32(50, lv_timer_handler());
+
+    lv_timer_ready(timer);
+    TEST_ASSERT_EQUAL_UINT32(50, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+}
+
+void test_timer_period_zero(void)
+{
+    /*Run only once per call even if it's ready again immediately*/
+    create_timer(log_cb, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * timer = create_timer(log_cb, 10);
+    lv_timer_set_repeat_count(timer, 3);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_tick_inc(10);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    /*Deleted when the repeat count is set to 0*/
+    timer = create_timer(log_cb, 1000);
+    lv_timer_set_repeat_count(timer, 0);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, run_cnt);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+void test_timer_delete_in_cb(void)
+{
+    /*"B" runs first and deletes "A"*/
+    lv_timer_create(log_name_cb, 10, (void *)"A");
+    lv_timer_create(delete_next_cb, 10, (void *)"B");
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("B", run_log);
+
+    create_timer(delete_self_cb, 5);
+    create_timer(delete_self_cb, 5);
+    lv_tick_inc(5);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+
+    lv_tick_inc(20);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_STRING("BB", run_log);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt);
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+void test_timer_anim_delay(void)
+{
+    int32_t value = -1;
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, &value);
+    lv_anim_set_exec_cb(&a, anim_exec_cb);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_duration(&a, 100);
+    lv_anim_set_delay(&a, 500);
+    lv_anim_start(&a);
+
+    lv_tick_inc(LV_DEF_REFR_PERIOD);
+    uint32_t time_until_next = lv_timer_handler();
+    lv_timer_t * anim_timer = lv_anim_get_timer();
+#if LV_USE_TIMER_HEAP
+    /*The animation timer sleeps until the delay is over*/
+    TEST_ASSERT_GREATER_THAN_UINT32(500 - 2 * LV_DEF_REFR_PERIOD, time_until_next);
+    TEST_ASSERT_GREATER_THAN_UINT32(500 - 2 * LV_DEF_REFR_PERIOD, anim_timer->period);
+#else
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DEF_REFR_PERIOD, time_until_next);
+    TEST_ASSERT_EQUAL_UINT32(LV_DEF_REFR_PERIOD, anim_timer->period);
+#endif
+
+    lv_test_wait(500);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(0, value);
+
+    lv_test_wait(100);
+    TEST_ASSERT_EQUAL_INT32(100, value);
+
+    /*Paused forever: the animation timer doesn't need to run at all*/
+    value = -1;
+    lv_anim_set_delay(&a, 0);
+    lv_anim_t * running = lv_anim_start(&a);
+    lv_test_wait(10);
+    lv_anim_pause(running);
+    lv_tick_inc(LV_DEF_REFR_PERIOD);
+    lv_timer_handler();
+#if LV_USE_TIMER_HEAP
+    TEST_ASSERT_TRUE(lv_timer_get_paused(anim_timer));
+#else
+    TEST_ASSERT_FALSE(lv_timer_get_paused(anim_timer));
+#endif
+
+    lv_anim_resume(running);
+    lv_test_wait(200);
+    TEST_ASSERT_EQUAL_INT32(100, value);
+}
+
+#endif
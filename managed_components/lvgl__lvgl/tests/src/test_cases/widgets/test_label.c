@@ -850,4 +850,94 @@ void test_label_setting_text_disables_translation(void)
     TEST_ASSERT_EQUAL_STRING(lv_label_get_text(label), "Der Tiger");
 }
 
+static uint32_t screen_size(void)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    return buf->header.stride * buf->header.h;
+}
+
+static uint8_t * render_screen(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint8_t * copy = lv_malloc(screen_size());
+    TEST_ASSERT_NOT_NULL(copy);
+    lv_memcpy(copy, buf->data, screen_size());
+    return copy;
+}
+
+static void assert_render_cached(uint8_t * ref)
+{
+    /*The first refresh renders the coverages, the second one uses the cached ones*/
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        uint8_t * cached = render_screen();
+        TEST_ASSERT_EQUAL_MEMORY(ref, cached, screen_size());
+        lv_free(cached);
+    }
+    lv_free(ref);
+}
+
+void test_label_render_cache(void)
+{
+    lv_obj_set_style_bg_color(active_screen, lv_palette_lighten(LV_PALETTE_AMBER, 3), 0);
+
+    lv_label_set_text(label, "Temperature 23.5 \xC2\xB0" "C\nHumidity 41 %");
+    lv_obj_set_style_text_color(label, lv_palette_main(LV_PALETTE_RED), 0);
+    lv_obj_set_pos(label, 10, 10);
+
+    lv_obj_set_width(long_label, 200);
+    lv_obj_set_pos(long_label, 10, 100);
+    lv_obj_set_style_text_align(long_label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_obj_set_style_text_decor(long_label, LV_TEXT_DECOR_UNDERLINE, 0);
+    lv_obj_set_style_text_opa(long_label, LV_OPA_70, 0);
+
+    /*Some letters are missing from the font*/
+    lv_label_set_text(long_label_multiline, "Missing: \xE4\xB8\x80\xE4\xBA\x8C");
+    lv_obj_set_pos(long_label_multiline, 300, 10);
+
+    uint8_t * ref = render_screen();
+    lv_label_set_render_cache(label, true);
+    lv_label_set_render_cache(long_label, true);
+    lv_label_set_render_cache(long_label_multiline, true);
+    TEST_ASSERT_TRUE(lv_label_get_render_cache(label));
+    assert_render_cached(ref);
+
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->draw_label_cache;
+    size_t cache_size = lv_cache_get_size(cache, NULL);
+    TEST_ASSERT_GREATER_THAN(0, cache_size);
+
+    /*Changing the text drops the cached coverage*/
+    lv_label_set_text(label, "Temperature 24.0 \xC2\xB0" "C");
+    TEST_ASSERT_LESS_THAN(cache_size, lv_cache_get_size(cache, NULL));
+#endif
+
+    lv_label_set_render_cache(label, false);
+    lv_label_set_render_cache(long_label, false);
+    lv_label_set_render_cache(long_label_multiline, false);
+    ref = render_screen();
+    lv_label_set_render_cache(label, true);
+    lv_label_set_render_cache(long_label, true);
+    lv_label_set_render_cache(long_label_multiline, true);
+    assert_render_cached(ref);
+
+    /*Changing the style or size is also visible*/
+    lv_label_set_render_cache(label, false);
+    lv_label_set_render_cache(long_label, false);
+    lv_obj_set_style_text_letter_space(label, 3, 0);
+    lv_obj_set_width(long_label, 150);
+    ref = render_screen();
+    lv_label_set_render_cache(label, true);
+    lv_label_set_render_cache(long_label, true);
+    assert_render_cached(ref);
+
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    /*Deleting the labels drops their coverage*/
+    lv_obj_clean(active_screen);
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+#endif
+}
+
 #endif
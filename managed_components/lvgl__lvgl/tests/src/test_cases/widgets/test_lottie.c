@@ -171,4 +171,473 @@ void test_lottie_no_jump_when_visible_again(void)
 
 }
 
+void test_lottie_skip_covered(void)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+
+    /*An opaque widget fully covering the animation*/
+    lv_obj_t * cover = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_radius(cover, 0, 0);
+    lv_obj_set_size(cover, 200, 200);
+    lv_obj_center(cover);
+
+    lv_lottie_render_stats_t stats;
+    lv_lottie_reset_render_stats(lottie);
+    lv_test_fast_forward(300);
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.rendered_frames);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.skipped_frames);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.rendered_px);
+
+    /*A translucent cover doesn't hide the animation*/
+    lv_obj_set_style_opa(cover, LV_OPA_50, 0);
+    lv_lottie_reset_render_stats(lottie);
+    lv_test_fast_forward(300);
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.rendered_frames);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.skipped_px);
+
+    /*Cover only the top 40 rows*/
+    lv_obj_set_style_opa(cover, LV_OPA_COVER, 0);
+    lv_obj_set_size(cover, 200, 40);
+    lv_obj_align_to(cover, lottie, LV_ALIGN_TOP_MID, 0, 0);
+    lv_lottie_reset_render_stats(lottie);
+    lv_test_fast_forward(300);
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.rendered_frames);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)stats.rendered_frames * 100 * 60, stats.rendered_px);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)stats.rendered_frames * 100 * 40, stats.skipped_px);
+
+    /*Hiding the cover renders the full frame again*/
+    lv_obj_add_flag(cover, LV_OBJ_FLAG_HIDDEN);
+    lv_lottie_reset_render_stats(lottie);
+    lv_test_fast_forward(300);
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.rendered_frames);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.skipped_px);
+}
+
+void test_lottie_render_only_visible_part(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_style_border_width(cont, 0, 0);
+    lv_obj_set_size(cont, 60, 100);
+    lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t * lottie = lv_lottie_create(cont);
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+
+    lv_lottie_render_stats_t stats;
+    lv_lottie_reset_render_stats(lottie);
+    lv_test_fast_forward(300);
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.rendered_frames);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)stats.rendered_frames * 60 * 100, stats.rendered_px);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t)stats.rendered_frames * 40 * 100, stats.skipped_px);
+
+    /*Scrolled out: nothing is rendered*/
+    lv_obj_set_x(lottie, 200);
+    lv_lottie_reset_render_stats(lottie);
+    lv_test_fast_forward(300);
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.rendered_frames);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.skipped_frames);
+}
+
+static uint32_t slow_tick;
+static uint32_t slow_tick_cb(void)
+{
+    /*Time passes quickly while rendering so every frame seems slow*/
+    slow_tick += 2;
+    return slow_tick;
+}
+
+static void slow_frame(void)
+{
+    /*Let a refresh period elapse so that the animation timer surely runs*/
+    slow_tick += LV_DEF_REFR_PERIOD;
+    lv_timer_handler();
+}
+
+void test_lottie_quality_levels(void)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+    TEST_ASSERT_EQUAL(LV_LOTTIE_QUALITY_FULL, lv_lottie_get_quality(lottie));
+
+    lv_lottie_quality_t q;
+    for(q = LV_LOTTIE_QUALITY_FULL; q < LV_LOTTIE_QUALITY_LAST; q++) {
+        lv_lottie_set_quality(lottie, q);
+        TEST_ASSERT_EQUAL(q, lv_lottie_get_quality(lottie));
+        lv_test_fast_forward(100);
+    }
+
+    /*In half resolution every pixel is doubled*/
+    lv_lottie_set_quality(lottie, LV_LOTTIE_QUALITY_HALF_RES);
+    lv_test_fast_forward(300);
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(lottie);
+    uint32_t stride = draw_buf->header.stride / 4;
+    const uint32_t * px = (const uint32_t *)draw_buf->data;
+    uint32_t x, y;
+    uint32_t opaque_cnt = 0;
+    for(y = 0; y < 100; y += 2) {
+        for(x = 0; x < 100; x += 2) {
+            uint32_t c = px[y * stride + x];
+            TEST_ASSERT_EQUAL_HEX32(c, px[y * stride + x + 1]);
+            TEST_ASSERT_EQUAL_HEX32(c, px[(y + 1) * stride + x]);
+            TEST_ASSERT_EQUAL_HEX32(c, px[(y + 1) * stride + x + 1]);
+            if(c >> 24) opaque_cnt++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, opaque_cnt);
+
+    /*Back to full quality gives the same result as before*/
+    lv_lottie_set_quality(lottie, LV_LOTTIE_QUALITY_FULL);
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_test_fast_forward(200);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_2.png");
+}
+
+void test_lottie_quality_policy(void)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+
+    lv_lottie_quality_policy_t policy;
+    lv_lottie_quality_policy_init(&policy);
+    policy.frame_budget = 10;
+    policy.min_quality = LV_LOTTIE_QUALITY_NO_ANTIALIAS;
+    policy.degrade_frames = 2;
+    policy.recover_frames = 3;
+    lv_lottie_set_quality_policy(lottie, &policy);
+
+    /*Slow frames lower the quality step by step but not below the minimum*/
+    uint32_t tick_start = lv_tick_get();
+    slow_tick = tick_start;
+    lv_tick_set_cb(slow_tick_cb);
+    uint32_t i;
+    for(i = 0; i < 3; i++) slow_frame();
+    TEST_ASSERT_GREATER_THAN_UINT32(policy.frame_budget, lv_lottie_get_render_time(lottie));
+    TEST_ASSERT_LESS_THAN(LV_LOTTIE_QUALITY_NO_ANTIALIAS, lv_lottie_get_quality(lottie));
+    for(i = 0; i < 20; i++) slow_frame();
+    TEST_ASSERT_EQUAL(LV_LOTTIE_QUALITY_NO_ANTIALIAS, lv_lottie_get_quality(lottie));
+    lv_tick_set_cb(NULL);
+    lv_tick_inc(slow_tick - tick_start);
+
+    /*Fast frames raise it again*/
+    for(i = 0; i < 3; i++) lv_test_fast_forward(20);
+    TEST_ASSERT_EQUAL(LV_LOTTIE_QUALITY_COARSE_CURVES, lv_lottie_get_quality(lottie));
+    for(i = 0; i < 20; i++) lv_test_fast_forward(20);
+    TEST_ASSERT_EQUAL(LV_LOTTIE_QUALITY_FULL, lv_lottie_get_quality(lottie));
+
+    /*Without policy the quality is not changed*/
+    lv_lottie_set_quality_policy(lottie, NULL);
+    lv_lottie_set_quality(lottie, LV_LOTTIE_QUALITY_HALF_RES);
+    for(i = 0; i < 20; i++) lv_test_fast_forward(20);
+    TEST_ASSERT_EQUAL(LV_LOTTIE_QUALITY_HALF_RES, lv_lottie_get_quality(lottie));
+}
+
+/*A red square moving from left to right in 60 frames with an "intro" and a "loop" marker.
+ *Its color and opacity can be overridden by the "square_color" and "square_opa" slots.*/
+static const char lottie_markers[] =
+    "{\"v\":\"5.7.0\",\"fr\":60,\"ip\":0,\"op\":60,\"w\":100,\"h\":100,"
+    "\"layers\":[{\"ty\":4,\"ind\":1,\"ip\":0,\"op\":60,\"st\":0,"
+    "\"ks\":{\"o\":{\"a\":0,\"k\":100},\"r\":{\"a\":0,\"k\":0},\"a\":{\"a\":0,\"k\":[0,0,0]},\"s\":{\"a\":0,\"k\":[100,100,100]},"
+    "\"p\":{\"a\":1,\"k\":[{\"t\":0,\"s\":[0,50,0],\"i\":{\"x\":[1],\"y\":[1]},\"o\":{\"x\":[0],\"y\":[0]}},{\"t\":60,\"s\":[100,50,0]}]}},"
+    "\"shapes\":[{\"ty\":\"rc\",\"p\":{\"a\":0,\"k\":[0,0]},\"s\":{\"a\":0,\"k\":[10,10]},\"r\":{\"a\":0,\"k\":0}},"
+    "{\"ty\":\"fl\",\"c\":{\"a\":0,\"k\":[1,0,0,1],\"sid\":\"square_color\"},\"o\":{\"a\":0,\"k\":100,\"sid\":\"square_opa\"}}]}],"
+    "\"markers\":[{\"cm\":\"intro\",\"tm\":0,\"dr\":20},{\"cm\":\"loop\",\"tm\":20,\"dr\":40}]}";
+
+static uint32_t ready_cnt;
+
+static lv_obj_t * create_marker_lottie(void)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, lottie_markers, sizeof(lottie_markers));
+    lv_obj_center(lottie);
+    lv_obj_update_layout(lottie);
+    ready_cnt = 0;
+    return lottie;
+}
+
+static bool is_px_opaque(lv_obj_t * lottie, int32_t x, int32_t y)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(lottie);
+    const uint32_t * px = (const uint32_t *)(draw_buf->data + y * draw_buf->header.stride);
+    return (px[x] >> 24) != 0;
+}
+
+static uint32_t get_px(lv_obj_t * lottie, int32_t x, int32_t y)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(lottie);
+    const uint32_t * px = (const uint32_t *)(draw_buf->data + y * draw_buf->header.stride);
+    return px[x];
+}
+
+static void ready_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    ready_cnt++;
+}
+
+static void play_loop_event_cb(lv_event_t * e)
+{
+    lv_obj_t * lottie = lv_event_get_target(e);
+    ready_cnt++;
+    lv_lottie_set_play_mode(lottie, LV_LOTTIE_PLAY_MODE_LOOP);
+    lv_lottie_play_segment(lottie, "loop");
+}
+
+void test_lottie_markers(void)
+{
+    lv_obj_t * lottie = create_marker_lottie();
+
+    TEST_ASSERT_EQUAL_UINT32(2, lv_lottie_get_marker_count(lottie));
+    TEST_ASSERT_EQUAL_STRING("intro", lv_lottie_get_marker_name(lottie, 0));
+    TEST_ASSERT_EQUAL_STRING("loop", lv_lottie_get_marker_name(lottie, 1));
+    TEST_ASSERT_NULL(lv_lottie_get_marker_name(lottie, 2));
+    TEST_ASSERT_EQUAL_UINT32(60, lv_lottie_get_total_frames(lottie));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_lottie_play_segment(lottie, "outro"));
+    TEST_ASSERT_EQUAL_UINT32(60, lv_lottie_get_total_frames(lottie));
+
+    /*The segment starts on the marker's first frame*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_play_segment(lottie, "loop"));
+    TEST_ASSERT_EQUAL_UINT32(40, lv_lottie_get_total_frames(lottie));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_lottie_get_current_frame(lottie));
+    TEST_ASSERT_TRUE(is_px_opaque(lottie, 33, 50));
+    TEST_ASSERT_FALSE(is_px_opaque(lottie, 5, 50));
+
+    /*Back to the whole animation*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_play_segment(lottie, NULL));
+    TEST_ASSERT_EQUAL_UINT32(60, lv_lottie_get_total_frames(lottie));
+    TEST_ASSERT_TRUE(is_px_opaque(lottie, 1, 50));
+}
+
+void test_lottie_segment_loop(void)
+{
+    lv_obj_t * lottie = create_marker_lottie();
+    lv_lottie_play_segment(lottie, "loop");
+
+    /*40 frames at 60 FPS is 666 ms*/
+    lv_test_fast_forward(500);
+    TEST_ASSERT_UINT32_WITHIN(1, 30, lv_lottie_get_current_frame(lottie));
+
+    lv_test_fast_forward(100);
+    TEST_ASSERT_UINT32_WITHIN(1, 36, lv_lottie_get_current_frame(lottie));
+    TEST_ASSERT_TRUE(is_px_opaque(lottie, 93, 50));
+
+    /*Restarts from the beginning of the segment, not from the beginning of the animation*/
+    lv_test_fast_forward(100);
+    TEST_ASSERT_LESS_THAN_UINT32(5, lv_lottie_get_current_frame(lottie));
+    TEST_ASSERT_TRUE(is_px_opaque(lottie, 36, 50));
+    TEST_ASSERT_FALSE(is_px_opaque(lottie, 5, 50));
+}
+
+void test_lottie_segment_once(void)
+{
+    lv_obj_t * lottie = create_marker_lottie();
+    lv_obj_add_event_cb(lottie, ready_event_cb, LV_EVENT_READY, NULL);
+    lv_lottie_set_play_mode(lottie, LV_LOTTIE_PLAY_MODE_ONCE);
+    lv_lottie_play_segment(lottie, "intro");
+
+    lv_test_fast_forward(200);
+    TEST_ASSERT_EQUAL_UINT32(0, ready_cnt);
+    lv_test_fast_forward(200);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_lottie_get_current_frame(lottie));
+    TEST_ASSERT_NULL(lv_lottie_get_anim(lottie));
+
+    /*Stays on the last frame*/
+    lv_test_fast_forward(500);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_lottie_get_current_frame(lottie));
+
+    /*Seeking a stopped animation only shows the frame*/
+    lv_lottie_seek(lottie, 5);
+    TEST_ASSERT_EQUAL_UINT32(5, lv_lottie_get_current_frame(lottie));
+    lv_test_fast_forward(100);
+    TEST_ASSERT_EQUAL_UINT32(5, lv_lottie_get_current_frame(lottie));
+
+    /*Play again*/
+    lv_lottie_play_segment(lottie, "intro");
+    TEST_ASSERT_NOT_NULL(lv_lottie_get_anim(lottie));
+    lv_test_fast_forward(400);
+    TEST_ASSERT_EQUAL_UINT32(2, ready_cnt);
+}
+
+void test_lottie_segment_intro_then_loop(void)
+{
+    lv_obj_t * lottie = create_marker_lottie();
+    lv_obj_add_event_cb(lottie, play_loop_event_cb, LV_EVENT_READY, NULL);
+    lv_lottie_set_play_mode(lottie, LV_LOTTIE_PLAY_MODE_ONCE);
+    lv_lottie_play_segment(lottie, "intro");
+
+    lv_test_fast_forward(400);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_EQUAL_UINT32(40, lv_lottie_get_total_frames(lottie));
+    TEST_ASSERT_EQUAL(LV_LOTTIE_PLAY_MODE_LOOP, lv_lottie_get_play_mode(lottie));
+    TEST_ASSERT_NOT_NULL(lv_lottie_get_anim(lottie));
+
+    /*Loops forever*/
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_test_fast_forward(100);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(40, lv_lottie_get_current_frame(lottie));
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+}
+
+void test_lottie_segment_ping_pong(void)
+{
+    lv_obj_t * lottie = create_marker_lottie();
+    lv_obj_add_event_cb(lottie, ready_event_cb, LV_EVENT_READY, NULL);
+    lv_lottie_set_play_mode(lottie, LV_LOTTIE_PLAY_MODE_PING_PONG);
+    lv_lottie_play_segment(lottie, "intro");
+
+    /*20 frames are 333 ms*/
+    lv_test_fast_forward(340);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_lottie_get_current_frame(lottie));
+    lv_test_fast_forward(100);
+    TEST_ASSERT_UINT32_WITHIN(1, 14, lv_lottie_get_current_frame(lottie));
+    lv_test_fast_forward(250);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, lv_lottie_get_current_frame(lottie));
+    lv_test_fast_forward(100);
+    TEST_ASSERT_UINT32_WITHIN(2, 7, lv_lottie_get_current_frame(lottie));
+    TEST_ASSERT_EQUAL_UINT32(0, ready_cnt);
+
+    /*Seeking while playing backward continues forward*/
+    lv_test_fast_forward(300);
+    lv_test_fast_forward(100);
+    lv_lottie_seek(lottie, 10);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_lottie_get_current_frame(lottie));
+    lv_test_fast_forward(50);
+    TEST_ASSERT_UINT32_WITHIN(1, 13, lv_lottie_get_current_frame(lottie));
+
+    /*Switching to loop on the same frame*/
+    lv_lottie_set_play_mode(lottie, LV_LOTTIE_PLAY_MODE_LOOP);
+    lv_test_fast_forward(100);
+    TEST_ASSERT_UINT32_WITHIN(1, 19, lv_lottie_get_current_frame(lottie));
+    lv_test_fast_forward(100);
+    TEST_ASSERT_LESS_THAN_UINT32(10, lv_lottie_get_current_frame(lottie));
+    TEST_ASSERT_EQUAL_UINT32(0, ready_cnt);
+}
+
+void test_lottie_seek(void)
+{
+    lv_obj_t * lottie = create_marker_lottie();
+    lv_lottie_render_stats_t stats;
+
+    lv_lottie_seek(lottie, 30);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_lottie_get_current_frame(lottie));
+    TEST_ASSERT_TRUE(is_px_opaque(lottie, 50, 50));
+
+    /*The same frame is not rendered again*/
+    lv_lottie_reset_render_stats(lottie);
+    lv_lottie_seek(lottie, 30);
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.rendered_frames);
+
+    /*Clamped to the last frame*/
+    lv_lottie_seek(lottie, 1000);
+    TEST_ASSERT_EQUAL_UINT32(60, lv_lottie_get_current_frame(lottie));
+
+    /*The animation continues from the sought frame*/
+    lv_lottie_seek(lottie, 12);
+    lv_test_fast_forward(100);
+    TEST_ASSERT_UINT32_WITHIN(1, 18, lv_lottie_get_current_frame(lottie));
+
+    /*Frame ranges*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_set_segment(lottie, 10, 30));
+    TEST_ASSERT_EQUAL_UINT32(20, lv_lottie_get_total_frames(lottie));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_lottie_get_current_frame(lottie));
+    TEST_ASSERT_TRUE(is_px_opaque(lottie, 17, 50));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_lottie_set_segment(lottie, 30, 10));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_lottie_set_segment(lottie, 0, 61));
+    TEST_ASSERT_EQUAL_UINT32(20, lv_lottie_get_total_frames(lottie));
+
+    lv_lottie_seek(lottie, 20);
+    TEST_ASSERT_TRUE(is_px_opaque(lottie, 50, 50));
+}
+
+void test_lottie_slots(void)
+{
+    lv_obj_t * lottie = create_marker_lottie();
+    lv_anim_pause(lv_lottie_get_anim(lottie));
+    lv_lottie_seek(lottie, 30);
+    TEST_ASSERT_EQUAL_HEX32(0xffff0000, get_px(lottie, 50, 50));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_set_slot_color(lottie, "square_color", lv_color_hex(0x0080ff)));
+    TEST_ASSERT_EQUAL_HEX32(0xff0080ff, get_px(lottie, 50, 50));
+
+    /*The slot is kept while playing*/
+    lv_lottie_seek(lottie, 31);
+    TEST_ASSERT_EQUAL_HEX32(0xff0080ff, get_px(lottie, 51, 50));
+
+    /*Premultiplied color with half opacity*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_set_slot_opa(lottie, "square_opa", LV_OPA_50));
+    TEST_ASSERT_UINT32_WITHIN(1, LV_OPA_50, get_px(lottie, 51, 50) >> 24);
+    TEST_ASSERT_UINT32_WITHIN(1, 0x40, (get_px(lottie, 51, 50) >> 8) & 0xff);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_set_slot_opa(lottie, "square_opa", LV_OPA_COVER));
+    TEST_ASSERT_EQUAL_HEX32(0xff0080ff, get_px(lottie, 51, 50));
+
+    /*Unknown and invalid slots don't change anything*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_lottie_set_slot_color(lottie, "bg_color", lv_color_hex(0x00ff00)));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_lottie_set_slot(lottie, "{\"square_color\":"));
+    TEST_ASSERT_EQUAL_HEX32(0xff0080ff, get_px(lottie, 51, 50));
+
+    /*Several slots at once, the unknown ones are ignored*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID,
+                      lv_lottie_set_slot(lottie, "{\"bg_color\":{\"p\":{\"a\":0,\"k\":[0,0,0]}},"
+                                         "\"square_color\":{\"p\":{\"a\":0,\"k\":[0,1,0]}}}"));
+    TEST_ASSERT_EQUAL_HEX32(0xff00ff00, get_px(lottie, 51, 50));
+
+    /*Restore the original values*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_set_slot(lottie, NULL));
+    TEST_ASSERT_EQUAL_HEX32(0xffff0000, get_px(lottie, 51, 50));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_set_slot_opa(lottie, "square_opa", LV_OPA_TRANSP));
+    TEST_ASSERT_EQUAL_HEX32(0x00000000, get_px(lottie, 51, 50));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_lottie_set_slot(lottie, NULL));
+    TEST_ASSERT_EQUAL_HEX32(0xffff0000, get_px(lottie, 51, 50));
+}
+
+void test_lottie_engine_stats(void)
+{
+    lv_obj_t * lottie = create_marker_lottie();
+    lv_lottie_reset_render_stats(lottie);
+    lv_lottie_seek(lottie, 30);
+
+    /*The 10x10 axis aligned square is filled directly without RLE spans*/
+    lv_lottie_render_stats_t stats;
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.rendered_frames);
+    TEST_ASSERT_EQUAL_UINT64(1, stats.shapes);
+    TEST_ASSERT_EQUAL_UINT64(0, stats.spans);
+    TEST_ASSERT_EQUAL_UINT64(100, stats.blended_px);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.compositors);
+
+    /*Curved shapes are rasterized from spans*/
+    lv_obj_delete(lottie);
+    lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_lottie_reset_render_stats(lottie);
+    lv_test_fast_forward(300);
+    lv_lottie_get_render_stats(lottie, &stats);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.rendered_frames);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT64(stats.rendered_frames, stats.shapes);
+    TEST_ASSERT_GREATER_THAN_UINT64(0, stats.spans);
+    TEST_ASSERT_GREATER_THAN_UINT64(0, stats.blended_px);
+}
+
 #endif
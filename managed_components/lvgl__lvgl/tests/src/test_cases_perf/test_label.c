@@ -1,20 +1,159 @@
 /* Performance test for the lv_text and lv_font_* functions */
 #if LV_BUILD_TEST_PERF
 #include "unity/unity.h"
+#include "../../lvgl_private.h"
+#include <time.h>
+
+#define TEXT_REPEAT_CNT     8
+#define MEASURE_CNT         20
+#define DASHBOARD_LABEL_CNT 200
+#define DASHBOARD_COL_CNT   8
+#define FRAME_CNT           20
 
 static lv_obj_t * active_screen = NULL;
 static lv_obj_t * label = NULL;
 
+static const char * latin_text =
+    "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae";
+
+static const char * cjk_text =
+    "我们的生活中有很多人和事，这些都是我们成长的一部分。今天天气很好，我和朋友一起去公园散步，"
+    "看到了许多美丽的花和树。学习中文需要时间和耐心，但是只要每天坚持，就一定会有进步。"
+    "这个城市的交通非常方便，你可以坐地铁、公共汽车或者出租车去任何地方。";
+
 void setUp(void)
 {
     active_screen = lv_screen_active();
     label = lv_label_create(active_screen);
 }
 
+void tearDown(void)
+{
+    lv_obj_delete(label);
+}
+
 void test_label(void)
 {
-    TEST_ASSERT_MAX_TIME(lv_label_set_text, 0.5, label,
-                         "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae");
+    TEST_ASSERT_MAX_TIME(lv_label_set_text, 0.5, label, latin_text);
+}
+
+/**
+ * Look up the glyph descriptor of each letter of a text, as it's done when the text is measured or drawn.
+ * @return  the average time of a lookup in nanoseconds
+ */
+static uint32_t measure_glyph_lookup(const char * text, const lv_font_t * font)
+{
+    uint32_t letter_cnt = 0;
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < MEASURE_CNT * TEXT_REPEAT_CNT; i++) {
+        uint32_t ofs = 0;
+        uint32_t letter = lv_text_encoded_next(text, &ofs);
+        while(letter) {
+            uint32_t letter_next = lv_text_encoded_next(text, &ofs);
+            lv_font_glyph_dsc_t g;
+            lv_font_get_glyph_dsc(font, &g, letter, letter_next);
+            letter = letter_next;
+            letter_cnt++;
+        }
+    }
+    t = clock() - t;
+
+    return (uint32_t)(((double)t * 1000000000.) / CLOCKS_PER_SEC / letter_cnt);
+}
+
+/**
+ * Set a long text on the label and measure its size to look up each glyph and its kerning.
+ * @return  the average time of a measurement in microseconds
+ */
+static uint32_t measure_text(const char * text, const lv_font_t * font)
+{
+    uint32_t len = lv_strlen(text);
+    char * long_text = lv_malloc(len * TEXT_REPEAT_CNT + 1);
+    uint32_t i;
+    for(i = 0; i < TEXT_REPEAT_CNT; i++) lv_memcpy(long_text + i * len, text, len);
+    long_text[len * TEXT_REPEAT_CNT] = '\0';
+
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_width(label, 300);
+
+    clock_t t = clock();
+    for(i = 0; i < MEASURE_CNT; i++) {
+        lv_label_set_text(label, long_text);
+        lv_obj_update_layout(label);
+    }
+    t = clock() - t;
+
+    lv_free(long_text);
+    return (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / MEASURE_CNT);
+}
+
+void test_label_glyph_lookup(void)
+{
+    uint32_t latin_time = measure_text(latin_text, &lv_font_montserrat_14);
+    TEST_PRINTF("Latin text, %u bytes: %u us/measurement, %u ns/glyph lookup", lv_strlen(latin_text) * TEXT_REPEAT_CNT,
+                latin_time, measure_glyph_lookup(latin_text, &lv_font_montserrat_14));
+
+#if LV_FONT_SOURCE_HAN_SANS_SC_16_CJK
+    uint32_t cjk_time = measure_text(cjk_text, &lv_font_source_han_sans_sc_16_cjk);
+    TEST_PRINTF("CJK text, %u bytes: %u us/measurement, %u ns/glyph lookup", lv_strlen(cjk_text) * TEXT_REPEAT_CNT,
+                cjk_time, measure_glyph_lookup(cjk_text, &lv_font_source_han_sans_sc_16_cjk));
+#else
+    LV_UNUSED(cjk_text);
+#endif
+}
+/**
+ * Redraw a dashboard of static labels as if something under them was animated.
+ * @return  the average time of a frame in microseconds
+ */
+static uint32_t measure_dashboard(lv_obj_t * dashboard, bool render_cache)
+{
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_count(dashboard); i++) {
+        lv_label_set_render_cache(lv_obj_get_child(dashboard, i), render_cache);
+    }
+
+    /*Fill the cache for the first time*/
+    lv_obj_invalidate(dashboard);
+    lv_refr_now(NULL);
+
+    clock_t t = clock();
+    for(i = 0; i < FRAME_CNT; i++) {
+        lv_obj_set_style_bg_color(dashboard, lv_color_hex3(i & 1 ? 0x123 : 0x234), 0);
+        lv_refr_now(NULL);
+    }
+    t = clock() - t;
+
+    return (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / FRAME_CNT);
+}
+
+void test_label_render_cache_dashboard(void)
+{
+    lv_obj_t * dashboard = lv_obj_create(active_screen);
+    lv_obj_remove_style_all(dashboard);
+    lv_obj_set_size(dashboard, lv_pct(100), lv_pct(100));
+    lv_obj_set_style_bg_opa(dashboard, LV_OPA_COVER, 0);
+
+    uint32_t i;
+    for(i = 0; i < DASHBOARD_LABEL_CNT; i++) {
+        lv_obj_t * value = lv_label_create(dashboard);
+        lv_label_set_text_fmt(value, "CH%03d %d.%d V", (int)i, (int)(i * 7) % 24, (int)i % 10);
+        lv_obj_set_style_text_color(value, lv_palette_lighten(i % LV_PALETTE_LAST, 2), 0);
+        lv_obj_set_pos(value, (i % DASHBOARD_COL_CNT) * 100 + 4,
+                      (i / DASHBOARD_COL_CNT) * (LV_VER_RES / (DASHBOARD_LABEL_CNT / DASHBOARD_COL_CNT)));
+    }
+
+    uint32_t uncached_time = measure_dashboard(dashboard, false);
+    uint32_t cached_time = measure_dashboard(dashboard, true);
+    TEST_PRINTF("%u labels: %u us/frame without, %u us/frame with the render cache", DASHBOARD_LABEL_CNT,
+                uncached_time, cached_time);
+
+#if LV_DRAW_LABEL_CACHE_SIZE > 0
+    uint32_t cache_size = lv_cache_get_size(LV_GLOBAL_DEFAULT()->draw_label_cache, NULL);
+    TEST_PRINTF("%u bytes of cached coverage", cache_size);
+    TEST_ASSERT_GREATER_THAN(0, cache_size);
+#endif
 
+    lv_obj_delete(dashboard);
 }
 #endif
@@ -0,0 +1,96 @@
+/* Performance test for updating the layout after changing a single cell of nested flex and grid layouts */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+#include "../../lvgl.h"
+#include <time.h>
+
+#if LV_USE_FLEX && LV_USE_GRID
+
+#define GRID_CNT        10
+#define GRID_COL_CNT    10
+#define GRID_ROW_CNT    10
+#define CELL_CNT        (GRID_CNT * GRID_COL_CNT * GRID_ROW_CNT)
+#define UPDATE_CNT      500
+
+static lv_obj_t * labels[CELL_CNT];
+
+static const int32_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT,
+                                  LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT,
+                                  LV_GRID_TEMPLATE_LAST
+                                 };
+static const int32_t row_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT,
+                                  LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_CONTENT,
+                                  LV_GRID_TEMPLATE_LAST
+                                 };
+
+void setUp(void)
+{
+    /*A scrollable flex column of content sized grids. Each cell is a content sized flex row with a label.*/
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_t * list = lv_obj_create(scr);
+    lv_obj_set_size(list, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_flex_flow(list, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t g;
+    for(g = 0; g < GRID_CNT; g++) {
+        lv_obj_t * grid = lv_obj_create(list);
+        lv_obj_set_size(grid, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+        lv_obj_set_grid_dsc_array(grid, col_dsc, row_dsc);
+
+        uint32_t i;
+        for(i = 0; i < GRID_COL_CNT * GRID_ROW_CNT; i++) {
+            lv_obj_t * cell = lv_obj_create(grid);
+            lv_obj_remove_style_all(cell);
+            lv_obj_set_size(cell, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+            lv_obj_set_flex_flow(cell, LV_FLEX_FLOW_ROW);
+            lv_obj_set_grid_cell(cell, LV_GRID_ALIGN_CENTER, i % GRID_COL_CNT, 1,
+                                 LV_GRID_ALIGN_CENTER, i / GRID_COL_CNT, 1);
+
+            lv_obj_t * label = lv_label_create(cell);
+            lv_label_set_text_fmt(label, "%" LV_PRIu32, g * 100 + i);
+            labels[g * GRID_COL_CNT * GRID_ROW_CNT + i] = label;
+        }
+    }
+
+    lv_obj_update_layout(scr);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_layout_single_cell_update(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < UPDATE_CNT; i++) {
+        /*Change the size of a cell back and forth*/
+        lv_obj_t * label = labels[(i * 37) % CELL_CNT];
+        lv_label_set_text(label, (i & 1) ? "1" : "1234567");
+        lv_obj_update_layout(scr);
+    }
+    t = clock() - t;
+
+    uint32_t update_time = (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / UPDATE_CNT);
+    TEST_PRINTF("%u cells in %u grids, incremental layout %s: %u us/update", CELL_CNT, GRID_CNT,
+                LV_LAYOUT_INCREMENTAL ? "on" : "off", update_time);
+
+    /*Changing the text of a cell without changing its size*/
+    t = clock();
+    for(i = 0; i < UPDATE_CNT; i++) {
+        lv_obj_t * label = labels[(i * 37) % CELL_CNT];
+        lv_label_set_text(label, (i & 1) ? "a" : "b");
+        lv_obj_update_layout(scr);
+    }
+    t = clock() - t;
+
+    update_time = (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / UPDATE_CNT);
+    TEST_PRINTF("same size text: %u us/update", update_time);
+}
+
+#endif /*LV_USE_FLEX && LV_USE_GRID*/
+
+#endif
@@ -0,0 +1,139 @@
+/* Performance test for the quality levels and theming of lv_lottie */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+#include <time.h>
+
+#if LV_USE_LOTTIE
+
+#define FRAME_CNT   30
+
+static uint32_t buf[LV_TEST_WIDTH_TO_STRIDE(200, 4) * 200 + LV_DRAW_BUF_ALIGN];
+static uint32_t ref_buf[200 * 200];
+extern const uint8_t test_lottie_approve[];
+extern const size_t test_lottie_approve_size;
+
+/*A red square whose color can be changed by the "square_color" slot*/
+static const char lottie_slots[] =
+    "{\"v\":\"5.7.0\",\"fr\":60,\"ip\":0,\"op\":60,\"w\":100,\"h\":100,"
+    "\"layers\":[{\"ty\":4,\"ind\":1,\"ip\":0,\"op\":60,\"st\":0,"
+    "\"ks\":{\"o\":{\"a\":0,\"k\":100},\"r\":{\"a\":0,\"k\":0},\"a\":{\"a\":0,\"k\":[0,0,0]},\"s\":{\"a\":0,\"k\":[100,100,100]},"
+    "\"p\":{\"a\":0,\"k\":[50,50,0]}},"
+    "\"shapes\":[{\"ty\":\"rc\",\"p\":{\"a\":0,\"k\":[0,0]},\"s\":{\"a\":0,\"k\":[50,50]},\"r\":{\"a\":0,\"k\":10}},"
+    "{\"ty\":\"fl\",\"c\":{\"a\":0,\"k\":[1,0,0,1],\"sid\":\"square_color\"},\"o\":{\"a\":0,\"k\":100}}]}]}";
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * lottie = NULL;
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+    lottie = lv_lottie_create(active_screen);
+    lv_lottie_set_buffer(lottie, 200, 200, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+    lv_obj_update_layout(lottie);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(active_screen);
+}
+
+/*Return the average render time of a frame in microseconds*/
+static uint32_t render_frames(lv_lottie_quality_t quality)
+{
+    lv_lottie_set_quality(lottie, quality);
+    lv_anim_t * a = lv_lottie_get_anim(lottie);
+
+    clock_t t = clock();
+    int32_t i;
+    for(i = 0; i < FRAME_CNT; i++) {
+        a->exec_cb(a->var, a->end_value * i / FRAME_CNT);
+    }
+    t = clock() - t;
+
+    /*Render the same frame as the reference*/
+    a->exec_cb(a->var, a->end_value / 2);
+    return (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / FRAME_CNT);
+}
+
+/*Count the rows which are visibly different from the reference frame*/
+static uint32_t get_diff_rows(void)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(lottie);
+    uint32_t x, y;
+    uint32_t cnt = 0;
+    for(y = 0; y < 200; y++) {
+        const uint8_t * row = draw_buf->data + y * draw_buf->header.stride;
+        const uint8_t * ref_row = (const uint8_t *)&ref_buf[y * 200];
+        for(x = 0; x < 200 * 4; x++) {
+            if(LV_ABS(row[x] - ref_row[x]) > 16) {
+                cnt++;
+                break;
+            }
+        }
+    }
+    return cnt;
+}
+
+void test_lottie_quality(void)
+{
+    uint32_t full_time = render_frames(LV_LOTTIE_QUALITY_FULL);
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(lottie);
+    uint32_t y;
+    for(y = 0; y < 200; y++) {
+        lv_memcpy(&ref_buf[y * 200], draw_buf->data + y * draw_buf->header.stride, 200 * 4);
+    }
+
+    TEST_PRINTF("quality %d: %u us/frame", LV_LOTTIE_QUALITY_FULL, full_time);
+    lv_lottie_quality_t q;
+    uint32_t time = full_time;
+    for(q = LV_LOTTIE_QUALITY_FULL + 1; q < LV_LOTTIE_QUALITY_LAST; q++) {
+        time = render_frames(q);
+        TEST_PRINTF("quality %d: %u us/frame, %u rows differ", q, time, get_diff_rows());
+    }
+
+    /*Rendering only a quarter of the pixels needs to be faster*/
+    TEST_ASSERT_LESS_THAN_UINT32(full_time, time);
+}
+
+static lv_obj_t * create_slot_lottie(void)
+{
+    lv_obj_t * obj = lv_lottie_create(active_screen);
+    lv_lottie_set_buffer(obj, 200, 200, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(obj, lottie_slots, sizeof(lottie_slots));
+    return obj;
+}
+
+void test_lottie_theme_switch(void)
+{
+    lv_obj_delete(lottie);
+    lottie = create_slot_lottie();
+
+    /*Change the color by a slot*/
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < FRAME_CNT; i++) {
+        lv_result_t res = lv_lottie_set_slot_color(lottie, "square_color",
+                                                   (i & 1) ? lv_color_hex(0x0000ff) : lv_color_hex(0xff0000));
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, res);
+    }
+    t = clock() - t;
+    uint32_t slot_time = (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / FRAME_CNT);
+
+    /*Without slots a differently colored copy of the animation needs to be loaded*/
+    t = clock();
+    for(i = 0; i < FRAME_CNT; i++) {
+        lv_obj_delete(lottie);
+        lottie = create_slot_lottie();
+    }
+    t = clock() - t;
+    uint32_t reload_time = (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / FRAME_CNT);
+
+    TEST_PRINTF("theme switch by slot: %u us, by reloading: %u us", slot_time, reload_time);
+    TEST_ASSERT_LESS_THAN_UINT32(reload_time, slot_time);
+}
+
+#endif /*LV_USE_LOTTIE*/
+
+#endif
@@ -0,0 +1,111 @@
+/* Performance test of the slab allocator replaying an allocation trace of a Lottie plus widgets session */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+#include "../../lvgl_private.h"
+#include <time.h>
+
+#define REPLAY_CNT      10
+
+extern const uint32_t test_mem_trace[];
+extern const size_t test_mem_trace_event_cnt;
+extern const uint32_t test_mem_trace_slot_cnt;
+
+typedef struct {
+    void * (*alloc)(size_t size);
+    void * (*realloc)(void * p, size_t size);
+    void (*free)(void * p);
+} allocator_t;
+
+#if LV_USE_MEM_SLAB
+
+static void ** slots;
+
+void setUp(void)
+{
+    slots = lv_malloc_core(test_mem_trace_slot_cnt * sizeof(void *));
+    TEST_ASSERT_NOT_NULL(slots);
+}
+
+void tearDown(void)
+{
+    lv_free_core(slots);
+}
+
+/**
+ * Replay the trace with an allocator
+ * @param a             the allocator functions
+ * @param mon_event     print the state of the slab allocator at this event
+ * @return              the time of a replay in microseconds
+ */
+static uint32_t replay(const allocator_t * a, size_t mon_event)
+{
+    clock_t t = clock();
+    uint32_t r;
+    for(r = 0; r < REPLAY_CNT; r++) {
+        size_t i;
+        for(i = 0; i < test_mem_trace_event_cnt; i++) {
+            uint32_t op = test_mem_trace[i * 2] >> 16;
+            uint32_t slot = test_mem_trace[i * 2] & 0xffff;
+            uint32_t size = test_mem_trace[i * 2 + 1];
+            if(op == 0) {
+                slots[slot] = a->alloc(size);
+                TEST_ASSERT_NOT_NULL(slots[slot]);
+                *(uint8_t *)slots[slot] = 0;  /*Touch the memory like a constructor*/
+            }
+            else if(op == 1) {
+                slots[slot] = a->realloc(slots[slot], size);
+                TEST_ASSERT_NOT_NULL(slots[slot]);
+            }
+            else {
+                a->free(slots[slot]);
+            }
+
+            if(r == 0 && i == mon_event) {
+                lv_mem_slab_monitor_t mon;
+                lv_mem_slab_monitor(&mon);
+                uint32_t c;
+                for(c = 0; c < LV_MEM_SLAB_CLASS_CNT; c++) {
+                    TEST_PRINTF("%u bytes: %u live, %u cached, %u blocks in %u pages",
+                                mon.classes[c].block_size, mon.classes[c].used_cnt, mon.classes[c].cached_cnt,
+                                mon.classes[c].total_cnt, mon.classes[c].page_cnt);
+                }
+                TEST_PRINTF("%zu bytes in pages, %zu bytes live, %u%% fragmentation",
+                            mon.total_size, mon.used_size, mon.frag_pct);
+            }
+        }
+    }
+    t = clock() - t;
+
+    return (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / REPLAY_CNT);
+}
+
+void test_mem_replay_trace(void)
+{
+    static const allocator_t core = {lv_malloc_core, lv_realloc_core, lv_free_core};
+    static const allocator_t slab = {lv_mem_slab_alloc, lv_mem_slab_realloc, lv_mem_slab_free};
+
+    uint32_t core_time = replay(&core, SIZE_MAX);
+    uint32_t slab_time = replay(&slab, test_mem_trace_event_cnt / 2);
+
+    TEST_PRINTF("%zu events: %u us with the core allocator, %u us with the slab allocator",
+                test_mem_trace_event_cnt, core_time, slab_time);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_mem_replay_trace(void)
+{
+    TEST_IGNORE_MESSAGE("Ignoring test_mem_replay_trace as it requires LV_USE_MEM_SLAB");
+}
+
+#endif /*LV_USE_MEM_SLAB*/
+
+#endif
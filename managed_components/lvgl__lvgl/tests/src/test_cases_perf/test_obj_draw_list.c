@@ -0,0 +1,118 @@
+/* Performance test for refreshing and hit testing a screen with many Widgets using the draw list */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+#include "../../lvgl_private.h"
+#include <time.h>
+
+#if LV_OBJ_DRAW_LIST
+
+#define CONT_CNT        50
+#define OBJ_PER_CONT    100
+#define OBJ_CNT         (CONT_CNT * OBJ_PER_CONT)
+#define OBJ_PER_ROW     20
+#define OBJ_SIZE        8
+#define FRAME_CNT       200
+#define SEARCH_CNT      2000
+
+static lv_obj_t * objs[OBJ_CNT];
+
+void setUp(void)
+{
+    /*Rows of containers with a grid of small Widgets, most of them are out of the screen*/
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t c;
+    for(c = 0; c < CONT_CNT; c++) {
+        lv_obj_t * cont = lv_obj_create(scr);
+        lv_obj_remove_style_all(cont);
+        lv_obj_set_size(cont, OBJ_PER_ROW * (OBJ_SIZE + 2), (OBJ_PER_CONT / OBJ_PER_ROW) * (OBJ_SIZE + 2));
+        lv_obj_set_pos(cont, (c % 4) * 210, (c / 4) * 60);
+
+        uint32_t i;
+        for(i = 0; i < OBJ_PER_CONT; i++) {
+            lv_obj_t * obj = lv_obj_create(cont);
+            lv_obj_remove_style_all(obj);
+            lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+            lv_obj_set_style_bg_color(obj, lv_palette_main(i % LV_PALETTE_LAST), 0);
+            lv_obj_set_size(obj, OBJ_SIZE, OBJ_SIZE);
+            lv_obj_set_pos(obj, (i % OBJ_PER_ROW) * (OBJ_SIZE + 2), (i / OBJ_PER_ROW) * (OBJ_SIZE + 2));
+            objs[c * OBJ_PER_CONT + i] = obj;
+        }
+    }
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static uint32_t measure_refr(void)
+{
+    clock_t t = clock();
+    uint32_t f;
+    for(f = 0; f < FRAME_CNT; f++) {
+        /*Redraw only a single Widget in each frame*/
+        lv_obj_invalidate(objs[(f * 7) % (OBJ_PER_CONT * 8)]);
+        lv_refr_now(NULL);
+    }
+    t = clock() - t;
+
+    return (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / FRAME_CNT);
+}
+
+static uint32_t measure_search(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t hit_cnt = 0;
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < SEARCH_CNT; i++) {
+        lv_point_t p = {(int32_t)((i * 37) % 400), (int32_t)((i * 53) % 400)};
+        if(lv_indev_search_obj(scr, &p) != scr) hit_cnt++;
+    }
+    t = clock() - t;
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, hit_cnt);
+    return (uint32_t)(((double)t * 1000000000.) / CLOCKS_PER_SEC / SEARCH_CNT);
+}
+
+void test_obj_draw_list_refr_and_search(void)
+{
+    lv_obj_draw_list_set_enabled(false);
+    uint32_t refr_tree = measure_refr();
+    uint32_t search_tree = measure_search();
+
+    lv_obj_draw_list_set_enabled(true);
+    uint32_t refr_list = measure_refr();
+    uint32_t search_list = measure_search();
+
+    TEST_PRINTF("%u Widgets, redraw one per frame: tree %u us/frame, draw list %u us/frame",
+                OBJ_CNT, refr_tree, refr_list);
+    TEST_PRINTF("hit testing: tree %u ns/search, draw list %u ns/search", search_tree, search_list);
+}
+
+void test_obj_draw_list_move(void)
+{
+    /*Moving a Widget updates the areas of the list in each frame but doesn't rebuild it*/
+    uint32_t results[2];
+    uint32_t en;
+    for(en = 0; en < 2; en++) {
+        lv_obj_draw_list_set_enabled(en);
+        clock_t t = clock();
+        uint32_t f;
+        for(f = 0; f < FRAME_CNT; f++) {
+            lv_obj_t * obj = objs[(f * 7) % (OBJ_PER_CONT * 8)];
+            lv_obj_set_x(obj, lv_obj_get_x(obj) + ((f & 1) ? -1 : 1));
+            lv_refr_now(NULL);
+        }
+        t = clock() - t;
+        results[en] = (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / FRAME_CNT);
+    }
+
+    TEST_PRINTF("%u Widgets, move one per frame: tree %u us/frame, draw list %u us/frame", OBJ_CNT, results[0],
+                results[1]);
+}
+
+#endif /*LV_OBJ_DRAW_LIST*/
+
+#endif
@@ -0,0 +1,114 @@
+/* Performance test for joining the invalidated areas of many small animated Widgets */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+#include "../../lvgl_private.h"
+#include <time.h>
+
+#if LV_USE_INV_AREA_COST_MODEL
+
+#define DISP_HOR_RES    800
+#define DISP_VER_RES    480
+#define DISP_BUF_ROWS   48
+#define OBJ_CNT         120
+#define OBJ_SIZE        12
+#define FRAME_CNT       50
+
+static lv_display_t * disp;
+static lv_draw_buf_t * draw_buf;
+static lv_obj_t * objs[OBJ_CNT];
+static uint32_t frame_area_cnt;
+static uint32_t frame_px;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(d);
+}
+
+static void render_start_cb(lv_event_t * e)
+{
+    lv_display_t * d = lv_event_get_target(e);
+    uint32_t i;
+    for(i = 0; i < d->inv_p; i++) {
+        if(d->inv_area_joined[i]) continue;
+        frame_area_cnt++;
+        frame_px += lv_area_get_size(&d->inv_areas[i]);
+    }
+}
+
+void setUp(void)
+{
+    disp = lv_display_create(DISP_HOR_RES, DISP_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    draw_buf = lv_draw_buf_create(DISP_HOR_RES, DISP_BUF_ROWS, LV_COLOR_FORMAT_RGB565, 0);
+    lv_display_set_draw_buffers(disp, draw_buf, NULL);
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+
+    /*Scatter the Widgets pseudo-randomly, the same way in every run*/
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    uint32_t seed = 12345;
+    uint32_t i;
+    for(i = 0; i < OBJ_CNT; i++) {
+        seed = seed * 1103515245 + 12345;
+        int32_t x = (seed >> 8) % (DISP_HOR_RES - OBJ_SIZE * 2);
+        seed = seed * 1103515245 + 12345;
+        int32_t y = (seed >> 8) % (DISP_VER_RES - OBJ_SIZE);
+        objs[i] = lv_obj_create(scr);
+        lv_obj_remove_style_all(objs[i]);
+        lv_obj_set_style_bg_opa(objs[i], LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(objs[i], lv_palette_main(i % LV_PALETTE_LAST), 0);
+        lv_obj_set_size(objs[i], OBJ_SIZE, OBJ_SIZE);
+        lv_obj_set_pos(objs[i], x, y);
+    }
+    lv_refr_now(disp);
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(draw_buf);
+}
+
+static void measure(uint32_t cost)
+{
+    lv_display_set_inv_area_cost(disp, cost);
+    frame_area_cnt = 0;
+    frame_px = 0;
+
+    clock_t t = clock();
+    uint32_t f;
+    for(f = 0; f < FRAME_CNT; f++) {
+        /*Move the Widgets back and forth by a few pixels as if they were animated*/
+        uint32_t i;
+        for(i = 0; i < OBJ_CNT; i++) {
+            lv_obj_set_x(objs[i], lv_obj_get_x(objs[i]) + ((f & 1) ? -2 : 2));
+        }
+        lv_refr_now(disp);
+    }
+    t = clock() - t;
+
+    uint32_t frame_time = (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / FRAME_CNT);
+    TEST_PRINTF("area cost %u px: %u areas/frame, %u px redrawn/frame, %u us/frame",
+                cost, frame_area_cnt / FRAME_CNT, frame_px / FRAME_CNT, frame_time);
+}
+
+void test_refr_scattered_widgets(void)
+{
+    TEST_PRINTF("%u Widgets of %ux%u px on a %ux%u display", OBJ_CNT, OBJ_SIZE, OBJ_SIZE,
+                DISP_HOR_RES, DISP_VER_RES);
+    measure(0);
+    uint32_t px_no_cost = frame_px;
+    measure(512);
+    measure(LV_INV_AREA_COST_PX);
+    measure(8192);
+
+    /*Each Widget redraws about (OBJ_SIZE + 2) x OBJ_SIZE pixels, nothing close to the whole screen*/
+    TEST_ASSERT_LESS_THAN_UINT32(DISP_HOR_RES * DISP_VER_RES, px_no_cost / FRAME_CNT);
+}
+
+#endif /*LV_USE_INV_AREA_COST_MODEL*/
+
+#endif
@@ -0,0 +1,51 @@
+/* Performance test for getting the style properties of the Widgets */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+#include "../demos/lv_demos.h"
+#include <time.h>
+
+#if LV_USE_DEMO_WIDGETS && LV_OBJ_STYLE_RESOLVED_CACHE
+
+#define FRAME_CNT   10
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_style_lookups_per_frame(void)
+{
+    lv_demo_widgets();
+
+    /*Create the layout and render the first frame*/
+    lv_refr_now(NULL);
+
+    lv_obj_style_reset_resolved_cache_stats();
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < FRAME_CNT; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+    t = clock() - t;
+
+    lv_obj_style_resolved_cache_stats_t stats;
+    lv_obj_style_get_resolved_cache_stats(&stats);
+    uint32_t frame_time = (uint32_t)(((double)t * 1000000.) / CLOCKS_PER_SEC / FRAME_CNT);
+    uint32_t resolved = stats.hits + stats.misses;
+    uint32_t hit_ratio = resolved ? stats.hits * 100 / resolved : 0;
+
+    TEST_PRINTF("style lookups: %u/frame, styles searched: %u/frame, cache hits: %u percent, %u us/frame",
+                stats.lookups / FRAME_CNT, stats.misses / FRAME_CNT, hit_ratio, frame_time);
+
+    /*Nothing has changed between the frames so almost everything should come from the cache*/
+    TEST_ASSERT_GREATER_THAN_UINT32(50, hit_ratio);
+}
+
+#endif /*LV_USE_DEMO_WIDGETS && LV_OBJ_STYLE_RESOLVED_CACHE*/
+
+#endif
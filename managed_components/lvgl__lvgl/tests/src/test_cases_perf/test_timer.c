@@ -0,0 +1,83 @@
+/* Performance test for the overhead of `lv_timer_handler()` with many timers and animations */
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+#include <time.h>
+
+#define TIMER_CNT       1000
+#define ANIM_CNT        500
+#define SIMULATED_MS    2000
+
+static lv_timer_t * timers[TIMER_CNT];
+static int32_t anim_values[ANIM_CNT];
+static uint32_t timer_run_cnt;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_anim_delete_all();
+
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        if(timers[i]) lv_timer_delete(timers[i]);
+        timers[i] = NULL;
+    }
+}
+
+static void timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    timer_run_cnt++;
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    *((int32_t *)var) = v;
+}
+
+void test_timer_handler_overhead(void)
+{
+    /*Mostly slow timers, e.g. clocks, status polling, screen savers*/
+    uint32_t i;
+    for(i = 0; i < TIMER_CNT; i++) {
+        uint32_t period = i % 10 == 0 ? 50 + i % 100 : 1000 + i * 7;
+        timers[i] = lv_timer_create(timer_cb, period, NULL);
+    }
+
+    /*A few running animations, the others are waiting for their delay or paused*/
+    for(i = 0; i < ANIM_CNT; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, &anim_values[i]);
+        lv_anim_set_exec_cb(&a, anim_exec_cb);
+        lv_anim_set_values(&a, 0, 1000);
+        lv_anim_set_duration(&a, 500);
+        lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+        if(i % 50 != 0) lv_anim_set_delay(&a, 60000 + i);
+        lv_anim_t * new_a = lv_anim_start(&a);
+        if(i % 5 == 1) lv_anim_pause(new_a);
+    }
+
+    /*Call the handler in every millisecond as a port would do*/
+    timer_run_cnt = 0;
+    uint32_t handler_cnt = 0;
+    clock_t t = clock();
+    for(i = 0; i < SIMULATED_MS; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+        handler_cnt++;
+    }
+    t = clock() - t;
+
+    uint32_t call_time = (uint32_t)(((double)t * 1000000000.) / CLOCKS_PER_SEC / handler_cnt);
+    TEST_PRINTF("%u timers, %u animations: %u ns/handler call, %u timer callbacks",
+                TIMER_CNT, ANIM_CNT, call_time, timer_run_cnt);
+
+    /*The fast timers run ~20 times in 2 seconds, the slow ones once or twice*/
+    TEST_ASSERT_GREATER_THAN_UINT32(TIMER_CNT, timer_run_cnt);
+    TEST_ASSERT_EQUAL_INT32(anim_values[0], anim_values[50]);
+}
+
+#endif